@@ -39,4 +39,5 @@
 #include "TmxPolyline.h"
 #include "TmxPropertySet.h"
 #include "TmxUtil.h"
-#include "TmxImageLayer.h"
\ No newline at end of file
+#include "TmxImageLayer.h"
+#include "TmxBinary.h"
\ No newline at end of file
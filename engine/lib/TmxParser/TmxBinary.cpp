@@ -0,0 +1,63 @@
+//-----------------------------------------------------------------------------
+// TmxBinary.cpp
+//
+// Compact binary form of a parsed map, used to cache maps so that loading
+// them does not need to parse and decode the XML again.
+//-----------------------------------------------------------------------------
+#include <string.h>
+
+#include "TmxBinary.h"
+
+namespace Tmx 
+{
+	void BinaryWriter::WriteString(const std::string &value) 
+	{
+		WriteUnsigned((unsigned)value.size());
+		WriteBytes(value.data(), value.size());
+	}
+
+	const char *BinaryReader::ReadBytes(size_t count) 
+	{
+		if (has_error || count > size - position)
+		{
+			has_error = true;
+			return NULL;
+		}
+
+		const char *bytes = data + position;
+		position += count;
+		return bytes;
+	}
+
+	std::string BinaryReader::ReadString() 
+	{
+		unsigned length = ReadUnsigned();
+		const char *bytes = ReadBytes(length);
+		
+		if (!bytes)
+			return std::string();
+
+		return std::string(bytes, length);
+	}
+
+	int BinaryReader::ReadCount(size_t itemSize) 
+	{
+		int count = ReadInt();
+
+		if (count < 0 || (itemSize > 0 && (size_t)count > (size - position) / itemSize))
+		{
+			has_error = true;
+			return 0;
+		}
+
+		return count;
+	}
+
+	void BinaryReader::Read(void *value, size_t count) 
+	{
+		const char *bytes = ReadBytes(count);
+
+		if (bytes)
+			memcpy(value, bytes, count);
+	}
+};
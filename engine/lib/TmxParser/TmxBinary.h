@@ -0,0 +1,96 @@
+//-----------------------------------------------------------------------------
+// TmxBinary.h
+//
+// Compact binary form of a parsed map, used to cache maps so that loading
+// them does not need to parse and decode the XML again.
+//-----------------------------------------------------------------------------
+#pragma once
+
+#include <string>
+#include <stddef.h>
+
+namespace Tmx 
+{
+	//-------------------------------------------------------------------------
+	// Appends values to a growing byte buffer.
+	// Values are written in the native byte order, so a binary map is only
+	// meant to be read back on the platform that wrote it.
+	//-------------------------------------------------------------------------
+	class BinaryWriter 
+	{
+	public:
+		BinaryWriter() : buffer() {}
+
+		void WriteBytes(const void *data, size_t size) { buffer.append((const char*)data, size); }
+
+		void WriteInt(int value) { WriteBytes(&value, sizeof(value)); }
+
+		void WriteUnsigned(unsigned value) { WriteBytes(&value, sizeof(value)); }
+
+		void WriteFloat(float value) { WriteBytes(&value, sizeof(value)); }
+
+		void WriteDouble(double value) { WriteBytes(&value, sizeof(value)); }
+
+		void WriteBool(bool value) { unsigned char byte = value ? 1 : 0; WriteBytes(&byte, 1); }
+
+		void WriteString(const std::string &value);
+
+		const std::string &GetBuffer() const { return buffer; }
+
+	private:
+		std::string buffer;
+	};
+
+	//-------------------------------------------------------------------------
+	// Reads values in place from a byte buffer written by a BinaryWriter.
+	// Reading past the end of the buffer flags an error and returns zeros
+	// rather than failing, so callers only need to check HasError() once.
+	//-------------------------------------------------------------------------
+	class BinaryReader 
+	{
+	public:
+		BinaryReader(const char *_data, size_t _size) 
+			: data(_data)
+			, size(_size)
+			, position(0)
+			, has_error(false)
+		{}
+
+		// Return a pointer to the next bytes and advance past them (NULL on error).
+		const char *ReadBytes(size_t count);
+
+		int ReadInt() { int value = 0; Read(&value, sizeof(value)); return value; }
+
+		unsigned ReadUnsigned() { unsigned value = 0; Read(&value, sizeof(value)); return value; }
+
+		float ReadFloat() { float value = 0.0f; Read(&value, sizeof(value)); return value; }
+
+		double ReadDouble() { double value = 0.0; Read(&value, sizeof(value)); return value; }
+
+		bool ReadBool() { unsigned char byte = 0; Read(&byte, 1); return byte != 0; }
+
+		std::string ReadString();
+
+		// Read a count of items that are each at least itemSize bytes, flagging an error for
+		// counts that could not possibly fit in the rest of the buffer.
+		int ReadCount(size_t itemSize);
+
+		size_t GetPosition() const { return position; }
+
+		// Get the number of bytes left to read.
+		size_t GetRemaining() const { return size - position; }
+
+		// Flag an error for values that were read but are not valid.
+		void SetError() { has_error = true; }
+
+		bool HasError() const { return has_error; }
+
+	private:
+		void Read(void *value, size_t count);
+
+		const char *data;
+		size_t size;
+		size_t position;
+		bool has_error;
+	};
+};
@@ -28,6 +28,7 @@
 #include "tinyxml/tinyxml.h"
 
 #include "TmxImage.h"
+#include "TmxBinary.h"
 
 namespace Tmx 
 {	
@@ -57,4 +58,20 @@ namespace Tmx
 			transparent_color = trans;
 		}
 	}
+
+	void Image::WriteBinary(BinaryWriter &writer) const 
+	{
+		writer.WriteString(source);
+		writer.WriteInt(width);
+		writer.WriteInt(height);
+		writer.WriteString(transparent_color);
+	}
+
+	void Image::ParseBinary(BinaryReader &reader) 
+	{
+		source = reader.ReadString();
+		width = reader.ReadInt();
+		height = reader.ReadInt();
+		transparent_color = reader.ReadString();
+	}
 };
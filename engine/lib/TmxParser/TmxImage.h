@@ -33,6 +33,9 @@ class TiXmlNode;
 
 namespace Tmx 
 {
+	class BinaryReader;
+	class BinaryWriter;
+
 	//-------------------------------------------------------------------------
 	// An image within a tileset.
 	//-------------------------------------------------------------------------
@@ -45,6 +48,12 @@ namespace Tmx
 		// Parses an image element.
 		void Parse(const TiXmlNode *imageNode);
 
+		// Write the image to a binary map.
+		void WriteBinary(Tmx::BinaryWriter &writer) const;
+
+		// Read the image from a binary map.
+		void ParseBinary(Tmx::BinaryReader &reader);
+
 		// Get the path to the file of the image (relative to the map)
 		const std::string &GetSource() const { return source; }
 
@@ -28,6 +28,7 @@
 #include "tinyxml/tinyxml.h"
 
 #include "TmxImageLayer.h"
+#include "TmxBinary.h"
 #include "TmxImage.h"
 
 using std::vector;
@@ -93,4 +94,38 @@ namespace Tmx
 		}
 	}
 
+
+	void ImageLayer::WriteBinary(BinaryWriter &writer) const 
+	{
+		writer.WriteString(name);
+		writer.WriteInt(width);
+		writer.WriteInt(height);
+		writer.WriteFloat(opacity);
+		writer.WriteBool(visible);
+		writer.WriteInt(zOrder);
+		properties.WriteBinary(writer);
+
+		writer.WriteBool(image != NULL);
+		if (image) 
+		{
+			image->WriteBinary(writer);
+		}
+	}
+
+	void ImageLayer::ParseBinary(BinaryReader &reader) 
+	{
+		name = reader.ReadString();
+		width = reader.ReadInt();
+		height = reader.ReadInt();
+		opacity = reader.ReadFloat();
+		visible = reader.ReadBool();
+		zOrder = reader.ReadInt();
+		properties.ParseBinary(reader);
+
+		if (reader.ReadBool()) 
+		{
+			image = new Image();
+			image->ParseBinary(reader);
+		}
+	}
 };
@@ -36,6 +36,9 @@ class TiXmlNode;
 
 namespace Tmx 
 {
+	class BinaryReader;
+	class BinaryWriter;
+
 	class Map;
 	class Image;
 
@@ -53,6 +56,12 @@ namespace Tmx
 		// Parse a ImageLayer element.
 		void Parse(const TiXmlNode *imageLayerNode);
 
+		// Write the image layer to a binary map.
+		void WriteBinary(Tmx::BinaryWriter &writer) const;
+
+		// Read the image layer from a binary map.
+		void ParseBinary(Tmx::BinaryReader &reader);
+
 		// Returns the name of the ImageLayer.
 		const std::string &GetName() const { return name; }
 
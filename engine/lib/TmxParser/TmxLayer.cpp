@@ -31,6 +31,7 @@
 #include <stdio.h>
 
 #include "TmxLayer.h"
+#include "TmxBinary.h"
 #include "TmxUtil.h"
 #include "TmxMap.h"
 #include "TmxTileset.h"
@@ -243,17 +244,23 @@ namespace Tmx
 
 	void Layer::ParseCSV(const std::string &innerText) 
 	{
-		// Duplicate the string for use with C stdio.
-		char *csv = strdup(innerText.c_str());
-		
-		// Iterate through every token of ';' in the CSV string.
-		char *pch = strtok(csv, ",");
+		// Walk the comma separated gids in place. (strtok is not safe to use while other layers decode on other threads)
+		const char *pch = innerText.c_str();
 		int tileCount = 0;
+		const int tileTotal = width * height;
 		
-		while (pch) 
+		while (*pch && tileCount < tileTotal) 
 		{
-			unsigned gid;
-			sscanf(pch, "%u", &gid);
+			char *end;
+			unsigned gid = (unsigned)strtoul(pch, &end, 10);
+
+			// Skip anything that is not a number, such as the line breaks between rows.
+			if (end == pch)
+			{
+				++pch;
+				continue;
+			}
+			pch = end;
 
 			// Find the tileset index.
 			const int tilesetIndex = map->FindTilesetIndex(gid);
@@ -269,10 +276,61 @@ namespace Tmx
 				tile_map[tileCount] = MapTile(gid, 0, -1);
 			}
 
-			pch = strtok(NULL, ",");
 			tileCount++;
 		}
+	}
+
+	void Layer::WriteBinary(BinaryWriter &writer) const 
+	{
+		writer.WriteString(name);
+		writer.WriteInt(width);
+		writer.WriteInt(height);
+		writer.WriteFloat(opacity);
+		writer.WriteBool(visible);
+		writer.WriteInt(zOrder);
+		writer.WriteInt(encoding);
+		writer.WriteInt(compression);
+		properties.WriteBinary(writer);
+
+		// The decoded tiles are written as they are in memory so reading them back is a single copy.
+		writer.WriteBytes(tile_map, width * height * sizeof(MapTile));
+	}
+
+	void Layer::ParseBinary(BinaryReader &reader) 
+	{
+		name = reader.ReadString();
+		width = reader.ReadInt();
+		height = reader.ReadInt();
+		opacity = reader.ReadFloat();
+		visible = reader.ReadBool();
+		zOrder = reader.ReadInt();
+		encoding = (LayerEncodingType)reader.ReadInt();
+		compression = (LayerCompressionType)reader.ReadInt();
+		properties.ParseBinary(reader);
+
+		// Check the size before allocating so a truncated or corrupt map cannot ask for
+		// more tiles than the rest of the buffer holds or overflow the tile count.
+		if (reader.HasError() || 
+			width < 0 || height < 0 || 
+			width > TMX_LAYER_MAX_SIZE || height > TMX_LAYER_MAX_SIZE || 
+			(size_t)width * (size_t)height > reader.GetRemaining() / sizeof(MapTile))
+		{
+			reader.SetError();
+			width = 0;
+			height = 0;
+		}
+
+		tile_map = new MapTile[width * height];
+
+		const char *tiles = reader.ReadBytes(width * height * sizeof(MapTile));
+		if (tiles == NULL) 
+		{
+			// The reader has flagged the error so the map reports the failure.
+			width = 0;
+			height = 0;
+			return;
+		}
 
-		free(csv);
+		memcpy(tile_map, tiles, width * height * sizeof(MapTile));
 	}
 };
@@ -36,8 +36,14 @@ class TiXmlNode;
 
 namespace Tmx 
 {
+	class BinaryReader;
+	class BinaryWriter;
+
 	class Map;
 
+	// The largest width or height a layer read from a binary map may have.
+	const int TMX_LAYER_MAX_SIZE = 32768;
+
 	//-------------------------------------------------------------------------
 	// Type used for the encoding of the layer data.
 	//-------------------------------------------------------------------------
@@ -75,6 +81,12 @@ namespace Tmx
 		// Parse a layer node.
 		void Parse(const TiXmlNode *layerNode);
 
+		// Write the layer to a binary map.
+		void WriteBinary(Tmx::BinaryWriter &writer) const;
+
+		// Read the layer from a binary map.
+		void ParseBinary(Tmx::BinaryReader &reader);
+
 		// Get the name of the layer.
 		const std::string &GetName() const { return name; }
 
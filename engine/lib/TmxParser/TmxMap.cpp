@@ -33,6 +33,7 @@
 #include "TmxLayer.h"
 #include "TmxObjectGroup.h"
 #include "TmxImageLayer.h"
+#include "TmxBinary.h"
 
 #ifdef USE_SDL2_LOAD
 #include <SDL.h>
@@ -58,6 +59,7 @@ namespace Tmx
 		, has_error(false)
 		, error_code(0)
 		, error_text()
+		, parallel_for(NULL)
 	{}
 
 	Map::~Map() 
@@ -232,6 +234,9 @@ namespace Tmx
 		}
 		
 
+		// Layer data is decoded once every tileset has been read.
+		vector< const TiXmlNode* > layerNodes;
+
 		const TiXmlNode *node = mapElem->FirstChild();
 		int zOrder = 0;
 		while( node )
@@ -256,9 +261,9 @@ namespace Tmx
 			// Iterate through all of the layer elements.			
 			if( strcmp( node->Value(), "layer" ) == 0 )
 			{
-				// Allocate a new layer and parse it.
+				// Allocate a new layer to be parsed below.
 				Layer *layer = new Layer(this);
-				layer->Parse(node);
+				layerNodes.push_back(node);
 				layer->SetZOrder( zOrder );
 				++zOrder;
 
@@ -294,6 +299,136 @@ namespace Tmx
 
 			node = node->NextSibling();
 		}
+
+		// Each layer only reads its own node and the tilesets, so they can be decoded at the same time.
+		std::pair< Map*, const TiXmlNode** > context(this, layerNodes.empty() ? NULL : &layerNodes[0]);
+		if (parallel_for != NULL)
+		{
+			parallel_for(&Map::ParseLayerJob, &context, (unsigned int)layerNodes.size());
+		}
+		else
+		{
+			for (unsigned int i = 0; i < layerNodes.size(); ++i)
+				ParseLayerJob(&context, i);
+		}
+	}
+
+	void Map::ParseLayerJob(void *context, unsigned int index)
+	{
+		std::pair< Map*, const TiXmlNode** > *layerContext = (std::pair< Map*, const TiXmlNode** > *)context;
+		layerContext->first->layers[index]->Parse(layerContext->second[index]);
+	}
+
+	void Map::ParseBinary(const string &fileName, const char *data, size_t size) 
+	{
+		file_name = fileName;
+
+		int lastSlash = fileName.find_last_of("/");
+
+		// Get the directory of the file using substring.
+		if (lastSlash > 0) 
+		{
+			file_path = fileName.substr(0, lastSlash + 1);
+		} 
+		else 
+		{
+			file_path = "";
+		}
+
+		BinaryReader reader(data, size);
+
+		// Read the map attributes.
+		version = reader.ReadDouble();
+		orientation = (MapOrientation)reader.ReadInt();
+		width = reader.ReadInt();
+		height = reader.ReadInt();
+		tile_width = reader.ReadInt();
+		tile_height = reader.ReadInt();
+		properties.ParseBinary(reader);
+
+		// Read the tilesets.
+		int tilesetCount = reader.ReadCount(sizeof(int));
+		for (int i = 0; i < tilesetCount; ++i) 
+		{
+			Tileset *tileset = new Tileset();
+			tileset->ParseBinary(reader);
+			tilesets.push_back(tileset);
+		}
+
+		// Read the layers.
+		int layerCount = reader.ReadCount(sizeof(int));
+		for (int i = 0; i < layerCount; ++i) 
+		{
+			Layer *layer = new Layer(this);
+			layer->ParseBinary(reader);
+			layers.push_back(layer);
+		}
+
+		// Read the image layers.
+		int imageLayerCount = reader.ReadCount(sizeof(int));
+		for (int i = 0; i < imageLayerCount; ++i) 
+		{
+			ImageLayer *imageLayer = new ImageLayer(this);
+			imageLayer->ParseBinary(reader);
+			image_layers.push_back(imageLayer);
+		}
+
+		// Read the object groups.
+		int objectGroupCount = reader.ReadCount(sizeof(int));
+		for (int i = 0; i < objectGroupCount; ++i) 
+		{
+			ObjectGroup *objectGroup = new ObjectGroup();
+			objectGroup->ParseBinary(reader);
+			object_groups.push_back(objectGroup);
+		}
+
+		// Check for a truncated or corrupt map.
+		if (reader.HasError()) 
+		{
+			has_error = true;
+			error_code = TMX_PARSING_ERROR;
+			error_text = "The binary map is truncated or corrupt.";
+		}
+	}
+
+	void Map::WriteBinary(BinaryWriter &writer) const 
+	{
+		// Write the map attributes.
+		writer.WriteDouble(version);
+		writer.WriteInt(orientation);
+		writer.WriteInt(width);
+		writer.WriteInt(height);
+		writer.WriteInt(tile_width);
+		writer.WriteInt(tile_height);
+		properties.WriteBinary(writer);
+
+		// Write the tilesets.
+		writer.WriteInt((int)tilesets.size());
+		for (unsigned int i = 0; i < tilesets.size(); ++i) 
+		{
+			tilesets[i]->WriteBinary(writer);
+		}
+
+		// Write the layers.
+		writer.WriteInt((int)layers.size());
+		for (unsigned int i = 0; i < layers.size(); ++i) 
+		{
+			layers[i]->WriteBinary(writer);
+		}
+
+		// Write the image layers.
+		writer.WriteInt((int)image_layers.size());
+		for (unsigned int i = 0; i < image_layers.size(); ++i) 
+		{
+			image_layers[i]->WriteBinary(writer);
+		}
+
+		// Write the object groups.
+		writer.WriteInt((int)object_groups.size());
+		for (unsigned int i = 0; i < object_groups.size(); ++i) 
+		{
+			object_groups[i]->WriteBinary(writer);
+		}
 	}
 
 	int Map::FindTilesetIndex(int gid) const
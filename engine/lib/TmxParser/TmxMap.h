@@ -38,6 +38,8 @@ namespace Tmx
 	class ImageLayer;
 	class ObjectGroup;
 	class Tileset;
+	class BinaryReader;
+	class BinaryWriter;
 
 	//-------------------------------------------------------------------------
 	// Error in handling of the Map class.
@@ -70,6 +72,13 @@ namespace Tmx
 		TMX_MO_STAGGERED = 0x03
 	};
 
+	//-------------------------------------------------------------------------
+	// Runs job(context, index) for every index below count and returns once
+	// they have all finished. The jobs may run at the same time on other threads.
+	//-------------------------------------------------------------------------
+	typedef void (*ParallelForJob)(void *context, unsigned int index);
+	typedef void (*ParallelForFunction)(ParallelForJob job, void *context, unsigned int count);
+
 	//-------------------------------------------------------------------------
 	// This class is the root class of the parser.
 	// It has all of the information in regard to the TMX file.
@@ -92,6 +101,17 @@ namespace Tmx
 		// Parse text containing TMX formatted XML.
 		void ParseText(const std::string &text);
 
+		// Set a function used to decode the layers in parallel when parsing XML.
+		// Layers are decoded one after another when this is not set.
+		void SetParallelFor(ParallelForFunction function) { parallel_for = function; }
+
+		// Parse a binary map previously written by WriteBinary().
+		// The file name is only used to set the file name and path of the map.
+		void ParseBinary(const std::string &fileName, const char *data, size_t size);
+
+		// Write the map in its binary form.
+		void WriteBinary(Tmx::BinaryWriter &writer) const;
+
 		// Get the filename used to read the map.
 		const std::string &GetFilename() { return file_name; }
 
@@ -192,5 +212,9 @@ namespace Tmx
 		std::string error_text;
 
 		Tmx::PropertySet properties;
+
+		ParallelForFunction parallel_for;
+
+		static void ParseLayerJob(void *context, unsigned int index);
 	};
 };
@@ -28,6 +28,7 @@
 #include "tinyxml/tinyxml.h"
 
 #include "TmxObject.h"
+#include "TmxBinary.h"
 #include "TmxPolygon.h"
 #include "TmxPolyline.h"
 #include "TmxEllipse.h"
@@ -121,4 +122,62 @@ namespace Tmx
 			properties.Parse(propertiesNode);
 		}
 	}
+
+	void Object::WriteBinary(BinaryWriter &writer) const 
+	{
+		writer.WriteString(name);
+		writer.WriteString(type);
+		writer.WriteInt(x);
+		writer.WriteInt(y);
+		writer.WriteInt(width);
+		writer.WriteInt(height);
+		writer.WriteInt(gid);
+
+		// The ellipse is made from the object bounds so it only needs a flag.
+		writer.WriteBool(ellipse != 0);
+
+		writer.WriteBool(polygon != 0);
+		if (polygon != 0) 
+		{
+			polygon->WriteBinary(writer);
+		}
+
+		writer.WriteBool(polyline != 0);
+		if (polyline != 0) 
+		{
+			polyline->WriteBinary(writer);
+		}
+
+		properties.WriteBinary(writer);
+	}
+
+	void Object::ParseBinary(BinaryReader &reader) 
+	{
+		name = reader.ReadString();
+		type = reader.ReadString();
+		x = reader.ReadInt();
+		y = reader.ReadInt();
+		width = reader.ReadInt();
+		height = reader.ReadInt();
+		gid = reader.ReadInt();
+
+		if (reader.ReadBool()) 
+		{
+			ellipse = new Ellipse(x,y,width,height);
+		}
+
+		if (reader.ReadBool()) 
+		{
+			polygon = new Polygon();
+			polygon->ParseBinary(reader);
+		}
+
+		if (reader.ReadBool()) 
+		{
+			polyline = new Polyline();
+			polyline->ParseBinary(reader);
+		}
+
+		properties.ParseBinary(reader);
+	}
 };
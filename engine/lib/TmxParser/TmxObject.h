@@ -35,6 +35,9 @@ class TiXmlNode;
 
 namespace Tmx 
 {
+	class BinaryReader;
+	class BinaryWriter;
+
 	class Ellipse;
 	class Polygon;
 	class Polyline;
@@ -50,6 +53,12 @@ namespace Tmx
 
 		// Parse an object node.
 		void Parse(const TiXmlNode *objectNode);
+
+		// Write the object to a binary map.
+		void WriteBinary(Tmx::BinaryWriter &writer) const;
+
+		// Read the object from a binary map.
+		void ParseBinary(Tmx::BinaryReader &reader);
 	
 		// Get the name of the object.
 		const std::string &GetName() const { return name; }
@@ -28,6 +28,7 @@
 #include "tinyxml/tinyxml.h"
 
 #include "TmxObjectGroup.h"
+#include "TmxBinary.h"
 #include "TmxObject.h"
 
 namespace Tmx 
@@ -81,4 +82,38 @@ namespace Tmx
 		}
 	}
 
+
+	void ObjectGroup::WriteBinary(BinaryWriter &writer) const 
+	{
+		writer.WriteString(name);
+		writer.WriteInt(width);
+		writer.WriteInt(height);
+		writer.WriteInt(visible);
+		writer.WriteInt(zOrder);
+		properties.WriteBinary(writer);
+
+		writer.WriteInt((int)objects.size());
+		for (unsigned int i = 0; i < objects.size(); ++i) 
+		{
+			objects[i]->WriteBinary(writer);
+		}
+	}
+
+	void ObjectGroup::ParseBinary(BinaryReader &reader) 
+	{
+		name = reader.ReadString();
+		width = reader.ReadInt();
+		height = reader.ReadInt();
+		visible = reader.ReadInt();
+		zOrder = reader.ReadInt();
+		properties.ParseBinary(reader);
+
+		int objectCount = reader.ReadCount(2 * sizeof(unsigned));
+		for (int i = 0; i < objectCount; ++i) 
+		{
+			Object *object = new Object();
+			object->ParseBinary(reader);
+			objects.push_back(object);
+		}
+	}
 };
@@ -36,6 +36,9 @@ class TiXmlNode;
 
 namespace Tmx 
 {
+	class BinaryReader;
+	class BinaryWriter;
+
 	class Object;
 	
 	//-------------------------------------------------------------------------
@@ -51,6 +54,12 @@ namespace Tmx
 		// Parse an objectgroup node.
 		void Parse(const TiXmlNode *objectGroupNode);
 
+		// Write the object group to a binary map.
+		void WriteBinary(Tmx::BinaryWriter &writer) const;
+
+		// Read the object group from a binary map.
+		void ParseBinary(Tmx::BinaryReader &reader);
+
 		// Get the name of the object group.
 		const std::string &GetName() const { return name; }
 
@@ -35,6 +35,9 @@ class TiXmlNode;
 
 namespace Tmx
 {
+	class BinaryReader;
+	class BinaryWriter;
+
 	//-------------------------------------------------------------------------
 	// Class to store a Polygon of an Object.
 	//-------------------------------------------------------------------------
@@ -46,6 +49,12 @@ namespace Tmx
 		// Parse the polygon node.
 		void Parse(const TiXmlNode *polygonNode);
 
+		// Write the polygon to a binary map.
+		void WriteBinary(Tmx::BinaryWriter &writer) const;
+
+		// Read the polygon from a binary map.
+		void ParseBinary(Tmx::BinaryReader &reader);
+
 		// Get one of the vertices.
 		const Tmx::Point &GetPoint(int index) const { return points[index]; }
 
@@ -28,6 +28,7 @@
 #include "tinyxml/tinyxml.h"
 
 #include "TmxPolyline.h"
+#include "TmxBinary.h"
 
 namespace Tmx 
 {
@@ -53,4 +54,24 @@ namespace Tmx
 
 		free(pointsLine);
 	}
+
+	void Polyline::WriteBinary(BinaryWriter &writer) const 
+	{
+		writer.WriteInt((int)points.size());
+		if (!points.empty()) 
+		{
+			writer.WriteBytes(&points[0], points.size() * sizeof(Point));
+		}
+	}
+
+	void Polyline::ParseBinary(BinaryReader &reader) 
+	{
+		int pointCount = reader.ReadCount(sizeof(Point));
+		const char *pointData = reader.ReadBytes(pointCount * sizeof(Point));
+		if (pointData && pointCount > 0) 
+		{
+			points.resize(pointCount);
+			memcpy(&points[0], pointData, pointCount * sizeof(Point));
+		}
+	}
 }
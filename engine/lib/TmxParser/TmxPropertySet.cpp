@@ -28,6 +28,7 @@
 #include "tinyxml/tinyxml.h"
 
 #include "TmxPropertySet.h"
+#include "TmxBinary.h"
 
 using std::string;
 using std::map;
@@ -91,4 +92,28 @@ namespace Tmx
 		return ( properties.find(name) != properties.end() );
 	}
 
+
+	void PropertySet::WriteBinary(BinaryWriter &writer) const 
+	{
+		writer.WriteInt((int)properties.size());
+
+		map< string, string >::const_iterator iter;
+		for (iter = properties.begin(); iter != properties.end(); ++iter) 
+		{
+			writer.WriteString(iter->first);
+			writer.WriteString(iter->second);
+		}
+	}
+
+	void PropertySet::ParseBinary(BinaryReader &reader) 
+	{
+		properties.clear();
+
+		int count = reader.ReadCount(2 * sizeof(unsigned));
+		for (int i = 0; i < count; ++i) 
+		{
+			string propertyName = reader.ReadString();
+			properties[propertyName] = reader.ReadString();
+		}
+	}
 };
@@ -34,6 +34,9 @@ class TiXmlNode;
 
 namespace Tmx 
 {
+	class BinaryReader;
+	class BinaryWriter;
+
 	//-----------------------------------------------------------------------------
 	// This class contains a map of properties.
 	//-----------------------------------------------------------------------------
@@ -45,6 +48,12 @@ namespace Tmx
 
 		// Parse a node containing all the property nodes.
 		void Parse(const TiXmlNode *propertiesNode);
+
+		// Write the property set to a binary map.
+		void WriteBinary(Tmx::BinaryWriter &writer) const;
+
+		// Read the property set from a binary map.
+		void ParseBinary(Tmx::BinaryReader &reader);
 	
 		// Get a numeric property (integer).
 		int GetNumericProperty(const std::string &name) const;
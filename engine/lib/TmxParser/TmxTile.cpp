@@ -28,6 +28,7 @@
 #include "tinyxml/tinyxml.h"
 
 #include "TmxTile.h"
+#include "TmxBinary.h"
 
 namespace Tmx 
 {
@@ -52,4 +53,16 @@ namespace Tmx
 			properties.Parse(propertiesNode);
 		}
 	}
+
+	void Tile::WriteBinary(BinaryWriter &writer) const 
+	{
+		writer.WriteInt(id);
+		properties.WriteBinary(writer);
+	}
+
+	void Tile::ParseBinary(BinaryReader &reader) 
+	{
+		id = reader.ReadInt();
+		properties.ParseBinary(reader);
+	}
 };
@@ -31,6 +31,9 @@
 
 namespace Tmx 
 {
+	class BinaryReader;
+	class BinaryWriter;
+
 	//-------------------------------------------------------------------------
 	// Class to contain information about every tile in the tileset/tiles 
 	// element.
@@ -46,6 +49,12 @@ namespace Tmx
 	
 		// Parse a tile node.
 		void Parse(const TiXmlNode *tileNode);
+
+		// Write the tile to a binary map.
+		void WriteBinary(Tmx::BinaryWriter &writer) const;
+
+		// Read the tile from a binary map.
+		void ParseBinary(Tmx::BinaryReader &reader);
 		
 		// Get the Id. (relative to the tilset)
 		int GetId() const { return id; }
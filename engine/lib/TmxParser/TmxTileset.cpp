@@ -28,6 +28,7 @@
 #include "tinyxml/tinyxml.h"
 
 #include "TmxTileset.h"
+#include "TmxBinary.h"
 #include "TmxImage.h"
 #include "TmxTile.h"
 
@@ -128,4 +129,54 @@ namespace Tmx
 
 		return NULL;
 	}
+
+	void Tileset::WriteBinary(BinaryWriter &writer) const 
+	{
+		writer.WriteInt(first_gid);
+		writer.WriteString(name);
+		writer.WriteInt(tile_width);
+		writer.WriteInt(tile_height);
+		writer.WriteInt(margin);
+		writer.WriteInt(spacing);
+
+		writer.WriteBool(image != NULL);
+		if (image) 
+		{
+			image->WriteBinary(writer);
+		}
+
+		writer.WriteInt((int)tiles.size());
+		for (unsigned int i = 0; i < tiles.size(); ++i) 
+		{
+			tiles[i]->WriteBinary(writer);
+		}
+
+		properties.WriteBinary(writer);
+	}
+
+	void Tileset::ParseBinary(BinaryReader &reader) 
+	{
+		first_gid = reader.ReadInt();
+		name = reader.ReadString();
+		tile_width = reader.ReadInt();
+		tile_height = reader.ReadInt();
+		margin = reader.ReadInt();
+		spacing = reader.ReadInt();
+
+		if (reader.ReadBool()) 
+		{
+			image = new Image();
+			image->ParseBinary(reader);
+		}
+
+		int tileCount = reader.ReadCount(2 * sizeof(int));
+		for (int i = 0; i < tileCount; ++i) 
+		{
+			Tile *tile = new Tile();
+			tile->ParseBinary(reader);
+			tiles.push_back(tile);
+		}
+
+		properties.ParseBinary(reader);
+	}
 };
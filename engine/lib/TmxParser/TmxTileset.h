@@ -36,6 +36,9 @@ class TiXmlNode;
 
 namespace Tmx 
 {
+	class BinaryReader;
+	class BinaryWriter;
+
 	class Image;
 	class Tile;
 
@@ -53,6 +56,12 @@ namespace Tmx
 		// Parse a tileset element.
 		void Parse(const TiXmlNode *tilesetNode);
 
+		// Write the tileset to a binary map.
+		void WriteBinary(Tmx::BinaryWriter &writer) const;
+
+		// Read the tileset from a binary map.
+		void ParseBinary(Tmx::BinaryReader &reader);
+
 		// Returns the global id of the first tile.
 		int GetFirstGid() const { return first_gid; }
 
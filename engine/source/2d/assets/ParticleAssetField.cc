@@ -38,6 +38,15 @@
 #include "string/stringUnit.h"
 #endif
 
+// Select the SIMD lookup table sampling.
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define PARTICLE_ASSET_FIELD_SSE
+#include <emmintrin.h>
+#elif defined(__ARM_NEON__) || defined(__ARM_NEON)
+#define PARTICLE_ASSET_FIELD_NEON
+#include <arm_neon.h>
+#endif
+
 //-----------------------------------------------------------------------------
 
 static StringTableEntry particleAssetFieldRepeatTimeName   = StringTable->insert( "RepeatTime" );
@@ -68,6 +77,9 @@ ParticleAssetField::ParticleAssetField() :
 {
     // Set Vector Associations.
     VECTOR_SET_ASSOCIATION( mDataKeys );
+
+    // Bake the (empty) lookup table.
+    bakeLookupTable();
 }
 
 //-----------------------------------------------------------------------------
@@ -170,6 +182,9 @@ void ParticleAssetField::setValueBounds( F32 maxTime, F32 minValue, F32 maxValue
 
     // Flag the value bounds as dirty.
     mValueBoundsDirty = true;
+
+    // Bake the lookup table.
+    bakeLookupTable();
 }
 
 //-----------------------------------------------------------------------------
@@ -202,6 +217,9 @@ bool ParticleAssetField::setRepeatTime( const F32 repeatTime )
     // Set repeat time.
     mRepeatTime = repeatTime;
 
+    // Bake the lookup table.
+    bakeLookupTable();
+
     // Return Okay.
     return true;
 }
@@ -223,6 +241,9 @@ bool ParticleAssetField::setValueScale( const F32 valueScale )
     // Set Value Scale/
     mValueScale = valueScale;
 
+    // Bake the lookup table.
+    bakeLookupTable();
+
     // Return Okay.
     return true;
 }
@@ -273,6 +294,9 @@ S32 ParticleAssetField::addDataKey( const F32 time, const F32 value )
             // Yes, so set time.
             mDataKeys[index].mValue = value;
 
+            // Bake the lookup table.
+            bakeLookupTable();
+
             // Return Index.
             return index;
         }
@@ -289,6 +313,9 @@ S32 ParticleAssetField::addDataKey( const F32 time, const F32 value )
     mDataKeys[index].mTime = time;
     mDataKeys[index].mValue = value;
 
+    // Bake the lookup table.
+    bakeLookupTable();
+
     // Return Index.
     return index;
 }
@@ -316,6 +343,9 @@ bool ParticleAssetField::removeDataKey( const U32 index )
     // Remove Index.
     mDataKeys.erase(index);
 
+    // Bake the lookup table.
+    bakeLookupTable();
+
     // Return Okay.
     return true;
 }
@@ -343,6 +373,9 @@ bool ParticleAssetField::setDataKeyValue( const U32 index, const F32 value )
     // Set Data Key Value.
     mDataKeys[index].mValue = value;
 
+    // Bake the lookup table.
+    bakeLookupTable();
+
     // Return Okay.
     return true;
 }
@@ -442,7 +475,106 @@ F32 ParticleAssetField::getFieldValue( F32 time ) const
 
 //-----------------------------------------------------------------------------
 
-F32 ParticleAssetField::calculateFieldBV( const ParticleAssetField& base, const ParticleAssetField& variation, const F32 effectAge, const bool modulate, const F32 modulo )
+void ParticleAssetField::bakeLookupTable( void )
+{
+    // Calculate the lookup scale.
+    mLookupScale = (F32)LookupTableResolution / mMaxTime;
+
+    // Clear the lookup table if there are no data keys.
+    if ( getDataKeyCount() == 0 )
+    {
+        dMemset( mLookupTable, 0, sizeof(mLookupTable) );
+        return;
+    }
+
+    // Sample the field at each lookup table interval.
+    for ( U32 index = 0; index <= LookupTableResolution; ++index )
+    {
+        mLookupTable[index] = getFieldValue( mMaxTime * ((F32)index / (F32)LookupTableResolution) );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void ParticleAssetField::sampleLookupTable( const F32* pTimes, const F32* pScales, const F32 scale, const F32 minValue, const F32 maxValue, F32* pValues, const U32 count ) const
+{
+    U32 index = 0;
+
+#if defined(PARTICLE_ASSET_FIELD_SSE)
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 maxTime = _mm_set1_ps( mMaxTime );
+    const __m128 lookupScale = _mm_set1_ps( mLookupScale );
+    const __m128 maxCell = _mm_set1_ps( (F32)(LookupTableResolution-1) );
+    const __m128 valueScale = _mm_set1_ps( scale );
+    const __m128 valueMin = _mm_set1_ps( minValue );
+    const __m128 valueMax = _mm_set1_ps( maxValue );
+    S32 cells[4];
+
+    for ( ; index + 4 <= count; index += 4 )
+    {
+        // Calculate the lookup table cells and the lerp within them.
+        const __m128 cellTime = _mm_mul_ps( _mm_min_ps( _mm_max_ps( _mm_loadu_ps( pTimes + index ), zero ), maxTime ), lookupScale );
+        const __m128 cell = _mm_min_ps( _mm_cvtepi32_ps( _mm_cvttps_epi32( cellTime ) ), maxCell );
+        const __m128 lerp = _mm_sub_ps( cellTime, cell );
+        _mm_storeu_si128( (__m128i*)cells, _mm_cvttps_epi32( cell ) );
+
+        // Fetch the cell values.
+        const __m128 value0 = _mm_set_ps( mLookupTable[cells[3]], mLookupTable[cells[2]], mLookupTable[cells[1]], mLookupTable[cells[0]] );
+        const __m128 value1 = _mm_set_ps( mLookupTable[cells[3]+1], mLookupTable[cells[2]+1], mLookupTable[cells[1]+1], mLookupTable[cells[0]+1] );
+
+        // Lerp, scale and clamp the values.
+        __m128 value = _mm_add_ps( value0, _mm_mul_ps( _mm_sub_ps( value1, value0 ), lerp ) );
+        if ( pScales != NULL )
+            value = _mm_mul_ps( value, _mm_loadu_ps( pScales + index ) );
+        value = _mm_min_ps( _mm_max_ps( _mm_mul_ps( value, valueScale ), valueMin ), valueMax );
+        _mm_storeu_ps( pValues + index, value );
+    }
+#elif defined(PARTICLE_ASSET_FIELD_NEON)
+    const float32x4_t zero = vdupq_n_f32( 0.0f );
+    const float32x4_t maxTime = vdupq_n_f32( mMaxTime );
+    const float32x4_t lookupScale = vdupq_n_f32( mLookupScale );
+    const float32x4_t maxCell = vdupq_n_f32( (F32)(LookupTableResolution-1) );
+    const float32x4_t valueScale = vdupq_n_f32( scale );
+    const float32x4_t valueMin = vdupq_n_f32( minValue );
+    const float32x4_t valueMax = vdupq_n_f32( maxValue );
+    S32 cells[4];
+
+    for ( ; index + 4 <= count; index += 4 )
+    {
+        // Calculate the lookup table cells and the lerp within them.
+        const float32x4_t cellTime = vmulq_f32( vminq_f32( vmaxq_f32( vld1q_f32( pTimes + index ), zero ), maxTime ), lookupScale );
+        const float32x4_t cell = vminq_f32( vcvtq_f32_s32( vcvtq_s32_f32( cellTime ) ), maxCell );
+        const float32x4_t lerp = vsubq_f32( cellTime, cell );
+        vst1q_s32( cells, vcvtq_s32_f32( cell ) );
+
+        // Fetch the cell values.
+        const F32 values0[4] = { mLookupTable[cells[0]], mLookupTable[cells[1]], mLookupTable[cells[2]], mLookupTable[cells[3]] };
+        const F32 values1[4] = { mLookupTable[cells[0]+1], mLookupTable[cells[1]+1], mLookupTable[cells[2]+1], mLookupTable[cells[3]+1] };
+        const float32x4_t value0 = vld1q_f32( values0 );
+        const float32x4_t value1 = vld1q_f32( values1 );
+
+        // Lerp, scale and clamp the values.
+        float32x4_t value = vmlaq_f32( value0, vsubq_f32( value1, value0 ), lerp );
+        if ( pScales != NULL )
+            value = vmulq_f32( value, vld1q_f32( pScales + index ) );
+        value = vminq_f32( vmaxq_f32( vmulq_f32( value, valueScale ), valueMin ), valueMax );
+        vst1q_f32( pValues + index, value );
+    }
+#endif
+
+    // Sample any remaining values.
+    for ( ; index < count; ++index )
+    {
+        F32 value = sampleLookupTable( pTimes[index] );
+        if ( pScales != NULL )
+            value *= pScales[index];
+        pValues[index] = mClampF( value * scale, minValue, maxValue );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+F32 ParticleAssetField::calculateFieldBV( const ParticleAssetField& base, const ParticleAssetField& variation, const F32 effectAge, RandomGeneratorBase& random, const bool modulate, const F32 modulo )
 {
     // Fetch Graph Components.
     const F32 baseValue   = base.getFieldValue( effectAge );
@@ -451,15 +583,15 @@ F32 ParticleAssetField::calculateFieldBV( const ParticleAssetField& base, const
     // Modulate?
     if ( modulate )
         // Return Modulo Calculation.
-        return mFmod( baseValue + CoreMath::mGetRandomF(-varValue, varValue), modulo );
+        return mFmod( baseValue + random.randRangeF(-varValue, varValue), modulo );
     else
         // Return Clamped Calculation.
-        return mClampF( baseValue + CoreMath::mGetRandomF(-varValue, varValue), base.getMinValue(), base.getMaxValue() );
+        return mClampF( baseValue + random.randRangeF(-varValue, varValue), base.getMinValue(), base.getMaxValue() );
 }
 
 //-----------------------------------------------------------------------------
 
-F32 ParticleAssetField::calculateFieldBVE( const ParticleAssetField& base, const ParticleAssetField& variation, const ParticleAssetField& effect, const F32 effectAge, const bool modulate, const F32 modulo )
+F32 ParticleAssetField::calculateFieldBVE( const ParticleAssetField& base, const ParticleAssetField& variation, const ParticleAssetField& effect, const F32 effectAge, RandomGeneratorBase& random, const bool modulate, const F32 modulo )
 {
     // Fetch Graph Components.
     const F32 baseValue   = base.getFieldValue( effectAge );
@@ -469,15 +601,15 @@ F32 ParticleAssetField::calculateFieldBVE( const ParticleAssetField& base, const
     // Modulate?
     if ( modulate )
         // Return Modulo Calculation.
-        return mFmod( (baseValue + CoreMath::mGetRandomF(-varValue, varValue)) * effectValue, modulo );
+        return mFmod( (baseValue + random.randRangeF(-varValue, varValue)) * effectValue, modulo );
     else
         // Return Clamped Calculation.
-        return mClampF( (baseValue + CoreMath::mGetRandomF(-varValue, varValue)) * effectValue, base.getMinValue(), base.getMaxValue() );
+        return mClampF( (baseValue + random.randRangeF(-varValue, varValue)) * effectValue, base.getMinValue(), base.getMaxValue() );
 }
 
 //-----------------------------------------------------------------------------
 
-F32 ParticleAssetField::calculateFieldBVLE( const ParticleAssetField& base, const ParticleAssetField& variation, const ParticleAssetField& overlife, const ParticleAssetField& effect, const F32 effectAge, const F32 particleAge, const bool modulate, const F32 modulo )
+F32 ParticleAssetField::calculateFieldBVLE( const ParticleAssetField& base, const ParticleAssetField& variation, const ParticleAssetField& overlife, const ParticleAssetField& effect, const F32 effectAge, const F32 particleAge, RandomGeneratorBase& random, const bool modulate, const F32 modulo )
 {
     // Fetch Graph Components.
     const F32 baseValue   = base.getFieldValue( effectAge );
@@ -488,10 +620,10 @@ F32 ParticleAssetField::calculateFieldBVLE( const ParticleAssetField& base, cons
     // Modulate?
     if ( modulate )
         // Return Modulo Calculation.
-        return mFmod( (baseValue + CoreMath::mGetRandomF(-varValue, varValue)) * effectValue * lifeValue, modulo );
+        return mFmod( (baseValue + random.randRangeF(-varValue, varValue)) * effectValue * lifeValue, modulo );
     else
         // Return Clamped Calculation.
-        return mClampF( (baseValue + CoreMath::mGetRandomF(-varValue, varValue)) * effectValue * lifeValue, base.getMinValue(), base.getMaxValue() );
+        return mClampF( (baseValue + random.randRangeF(-varValue, varValue)) * effectValue * lifeValue, base.getMinValue(), base.getMaxValue() );
 }
 
 //------------------------------------------------------------------------------
@@ -681,6 +813,9 @@ void ParticleAssetField::onTamlCustomRead( const TamlCustomNode* pCustomNode )
 
     // Set the data keys.
     mDataKeys = keys;
+
+    // Bake the lookup table from the loaded keys.
+    bakeLookupTable();
 }
 
 //-----------------------------------------------------------------------------
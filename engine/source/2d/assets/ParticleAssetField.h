@@ -31,6 +31,10 @@
 #include "persistence/taml/tamlCustom.h"
 #endif
 
+#ifndef _MRANDOM_H_
+#include "math/mRandom.h"
+#endif
+
 ///-----------------------------------------------------------------------------
 
 class ParticleAssetField
@@ -58,6 +62,9 @@ public:
 
     static ParticleAssetField::DataKey BadDataKey;
 
+    /// The number of lookup table intervals the field is baked into.
+    static const U32 LookupTableResolution = 128;
+
 private:
     StringTableEntry mFieldName;
     F32 mRepeatTime;
@@ -71,6 +78,9 @@ private:
 
     Vector<DataKey> mDataKeys;
 
+    F32 mLookupScale;
+    F32 mLookupTable[LookupTableResolution+1];
+
 public:
     ParticleAssetField();
     virtual ~ParticleAssetField();
@@ -105,14 +115,27 @@ public:
     const DataKey& getDataKey( const U32 index ) const;
     inline F32 getFieldValue( F32 time ) const;
 
-    static F32 calculateFieldBV( const ParticleAssetField& base, const ParticleAssetField& variation, const F32 effectAge, const bool modulate = false, const F32 modulo = 0.0f );
-    static F32 calculateFieldBVE( const ParticleAssetField& base, const ParticleAssetField& variation, const ParticleAssetField& effect, const F32 effectAge, const bool modulate = false, const F32 modulo = 0.0f );
-    static F32 calculateFieldBVLE( const ParticleAssetField& base, const ParticleAssetField& variation, const ParticleAssetField& overlife, const ParticleAssetField& effect, const F32 effectTime, const F32 particleAge, const bool modulate = false, const F32 modulo = 0.0f );
+    /// Lookup table.
+    inline F32 sampleLookupTable( const F32 time ) const
+    {
+        const F32 cellTime = getMin( getMax( 0.0f, time ), mMaxTime ) * mLookupScale;
+        const U32 cell = getMin( (U32)cellTime, LookupTableResolution-1 );
+        const F32 lerp = cellTime - (F32)cell;
+        return mLookupTable[cell] + ((mLookupTable[cell+1] - mLookupTable[cell]) * lerp);
+    }
+    void sampleLookupTable( const F32* pTimes, const F32* pScales, const F32 scale, const F32 minValue, const F32 maxValue, F32* pValues, const U32 count ) const;
+
+    static F32 calculateFieldBV( const ParticleAssetField& base, const ParticleAssetField& variation, const F32 effectAge, RandomGeneratorBase& random, const bool modulate = false, const F32 modulo = 0.0f );
+    static F32 calculateFieldBVE( const ParticleAssetField& base, const ParticleAssetField& variation, const ParticleAssetField& effect, const F32 effectAge, RandomGeneratorBase& random, const bool modulate = false, const F32 modulo = 0.0f );
+    static F32 calculateFieldBVLE( const ParticleAssetField& base, const ParticleAssetField& variation, const ParticleAssetField& overlife, const ParticleAssetField& effect, const F32 effectTime, const F32 particleAge, RandomGeneratorBase& random, const bool modulate = false, const F32 modulo = 0.0f );
 
     void onTamlCustomWrite( TamlCustomNode* pCustomNode  );
     void onTamlCustomRead( const TamlCustomNode* pCustomNode );
 
     void WriteCustomTamlSchema( const AbstractClassRep* pClassRep, TiXmlElement* pParentElement );
+
+private:
+    void bakeLookupTable( void );
 };
 
 //-----------------------------------------------------------------------------
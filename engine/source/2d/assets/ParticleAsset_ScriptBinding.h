@@ -20,6 +20,12 @@
 // IN THE SOFTWARE.
 //-----------------------------------------------------------------------------
 
+//-----------------------------------------------------------------------------
+
+#ifndef _MRANDOM_H_
+#include "math/mRandom.h"
+#endif
+
 //-----------------------------------------------------------------------------
 /// Particle asset accessors.
 //-----------------------------------------------------------------------------
@@ -399,3 +405,97 @@ ConsoleMethod(ParticleAsset, moveEmitter, void, 4, 4, "(fromEmitterIndex, toEmit
    // Move Emitter Object.
    object->moveEmitter( dAtoi(argv[2]), dAtoi(argv[3]) );
 }
+
+//-----------------------------------------------------------------------------
+
+ConsoleMethod(ParticleAsset, benchmarkLifeFields, const char*, 2, 4,    "([particleCount], [iterations]) Times sampling the emitter life fields from their lookup tables against evaluating their data keys.\n"
+                                                                        "Both paths sample the same random particle ages and the largest difference between them is reported.\n"
+                                                                        "@param particleCount The number of particles to sample per emitter.  Defaults to 10000.\n"
+                                                                        "@param iterations The number of times to sample the particles.  Defaults to 10.\n"
+                                                                        "@return (tableTime keyTime maxError) The average cost per particle in nanoseconds for each path and the largest difference, or an empty string on failure.")
+{
+   const S32 particleCount = argc >= 3 ? dAtoi(argv[2]) : 10000;
+   const S32 iterations = argc >= 4 ? dAtoi(argv[3]) : 10;
+
+   // Sanity!
+   if ( particleCount <= 0 || iterations <= 0 || object->getEmitterCount() == 0 )
+   {
+      Con::warnf( "ParticleAsset::benchmarkLifeFields() - Invalid particle count, iterations or no emitters." );
+      return StringTable->EmptyString;
+   }
+
+   // Generate the normalized particle ages.
+   RandomLCG random( 12345 );
+   Vector<F32> particleAges;
+   particleAges.setSize( particleCount );
+   for ( S32 index = 0; index < particleCount; ++index )
+      particleAges[index] = random.randF();
+
+   Vector<F32> tableValues;
+   Vector<F32> keyValues;
+   tableValues.setSize( particleCount );
+   keyValues.setSize( particleCount );
+
+   F32 tableTime = 0.0f;
+   F32 keyTime = 0.0f;
+   F32 maxError = 0.0f;
+   U32 sampleCount = 0;
+
+   for ( U32 emitterIndex = 0; emitterIndex < object->getEmitterCount(); ++emitterIndex )
+   {
+      ParticleAssetEmitter* pEmitter = object->getEmitter( emitterIndex );
+
+      // Fetch the life fields sampled when integrating particles.
+      const ParticleAssetField* lifeFields[] =
+      {
+         &pEmitter->getSizeXLifeField(),
+         &pEmitter->getSizeYLifeField(),
+         &pEmitter->getSpeedLifeField(),
+         &pEmitter->getFixedForceLifeField(),
+         &pEmitter->getRandomMotionLifeField(),
+         &pEmitter->getSpinLifeField(),
+         &pEmitter->getRedChannelLifeField(),
+         &pEmitter->getGreenChannelLifeField(),
+         &pEmitter->getBlueChannelLifeField(),
+         &pEmitter->getAlphaChannelLifeField(),
+      };
+      const U32 lifeFieldCount = sizeof(lifeFields) / sizeof(lifeFields[0]);
+
+      for ( S32 iteration = 0; iteration < iterations; ++iteration )
+      {
+         F64 startTime = Platform::getHighResolutionMilliseconds();
+         for ( U32 fieldIndex = 0; fieldIndex < lifeFieldCount; ++fieldIndex )
+            lifeFields[fieldIndex]->sampleLookupTable( particleAges.address(), NULL, 1.0f, -F32_MAX, F32_MAX, tableValues.address(), particleCount );
+         tableTime += (F32)(Platform::getHighResolutionMilliseconds() - startTime);
+
+         startTime = Platform::getHighResolutionMilliseconds();
+         for ( U32 fieldIndex = 0; fieldIndex < lifeFieldCount; ++fieldIndex )
+         {
+            for ( S32 index = 0; index < particleCount; ++index )
+               keyValues[index] = lifeFields[fieldIndex]->getFieldValue( particleAges[index] );
+         }
+         keyTime += (F32)(Platform::getHighResolutionMilliseconds() - startTime);
+      }
+
+      // Find the largest difference.
+      for ( U32 fieldIndex = 0; fieldIndex < lifeFieldCount; ++fieldIndex )
+      {
+         lifeFields[fieldIndex]->sampleLookupTable( particleAges.address(), NULL, 1.0f, -F32_MAX, F32_MAX, tableValues.address(), particleCount );
+         for ( S32 index = 0; index < particleCount; ++index )
+            maxError = getMax( maxError, mFabs( tableValues[index] - lifeFields[fieldIndex]->getFieldValue( particleAges[index] ) ) );
+      }
+
+      sampleCount += particleCount * iterations;
+   }
+
+   // Calculate the cost per particle.
+   const F32 tableCost = tableTime * 1000000.0f / sampleCount;
+   const F32 keyCost = keyTime * 1000000.0f / sampleCount;
+   Con::printf( "ParticleAsset::benchmarkLifeFields() - %d particles over %d emitter(s): tables %.1fns, keys %.1fns (%.1fx) per particle, max error %g.",
+      particleCount, object->getEmitterCount(), tableCost, keyCost, tableCost > 0.0f ? keyCost / tableCost : 0.0f, maxError );
+
+   // Format Buffer.
+   char* pBuffer = Con::getReturnBuffer(64);
+   dSprintf( pBuffer, 64, "%g %g %g", tableCost, keyCost, maxError );
+   return pBuffer;
+}
@@ -3,6 +3,12 @@
 // Debug Profiling.
 #include "debug/profiler.h"
 
+#include "assets/assetManager.h"
+#include "io/fileStream.h"
+#include "algorithm/crc.h"
+#include "console/consoleTypes.h"
+#include "platform/threads/threadPool.h"
+
 #include "TmxMapAsset_ScriptBinding.h"
 
 //------------------------------------------------------------------------------
@@ -58,6 +64,7 @@ IMPLEMENT_CONOBJECT(TmxMapAsset);
 //------------------------------------------------------------------------------
 
 TmxMapAsset::TmxMapAsset() :  mMapFile(StringTable->EmptyString),
+	mMapCache(false),
 	mParser(NULL)
 
 {
@@ -82,6 +89,7 @@ void TmxMapAsset::initPersistFields()
 
 	// Fields.
 	addProtectedField("MapFile", TypeAssetLooseFilePath, Offset(mMapFile, TmxMapAsset), &setMapFile, &getMapFile, &defaultProtectedWriteFn, "");
+	addField("MapCache", TypeBool, Offset(mMapCache, TmxMapAsset), &writeMapCache, "Whether to write a precompiled copy of the map next to the map file whenever the map file has to be parsed. Precompiled copies are always used when they are up to date.");
 
 }
 
@@ -177,15 +185,49 @@ void TmxMapAsset::onTamlPostWrite( void )
 
 //----------------------------------------------------------------------------
 
+void TmxMapAsset::parallelForLayers( Tmx::ParallelForJob job, void* context, unsigned int count )
+{
+	ThreadPool* pThreadPool = ThreadPool::getGlobal();
+	if (pThreadPool == NULL)
+	{
+		for (U32 i = 0; i < count; ++i)
+			job( context, i );
+		return;
+	}
+
+	pThreadPool->parallelFor( job, context, count );
+}
+
+//----------------------------------------------------------------------------
+
 void TmxMapAsset::calculateMap()
 {
+	// Debug Profiling.
+	PROFILE_SCOPE(TmxMapAsset_CalculateMap);
+
 	if (mParser)
 	{
 		delete mParser;
 		mParser = NULL;
 	}
+	mTilesetAssets.clear();
+	mLayerIndices.clear();
+	mPropertyIndices.clear();
+	mTilesetProperties.clear();
+
+	//an up to date precompiled map skips parsing and decoding the xml entirely.
+	U32 sourceSize = 0;
+	FileTime sourceTime;
+	const bool found = statMapFile( sourceSize, sourceTime );
+	if (found && readMapCache( sourceSize, sourceTime ))
+	{
+		buildPropertyIndex();
+		return;
+	}
 
+	//layers are base64 decoded and inflated on the worker threads.
 	mParser = new Tmx::Map();
+	mParser->SetParallelFor( &parallelForLayers );
 	mParser->ParseFile( mMapFile );
 
 	if (mParser->HasError())
@@ -196,6 +238,390 @@ void TmxMapAsset::calculateMap()
 		mParser = NULL;
 		return;
 	}
+
+	resolveTilesetAssets();
+	buildPropertyIndex();
+
+	U32 sourceHash = 0;
+	if (mMapCache && found && hashMapFile( sourceHash ))
+		writeMapCache( sourceSize, sourceTime, sourceHash );
+}
+
+bool TmxMapAsset::compileMap()
+{
+	if (!isAssetValid())
+		return false;
+
+	U32 sourceSize = 0;
+	FileTime sourceTime;
+	U32 sourceHash = 0;
+	if (!statMapFile( sourceSize, sourceTime ) || !hashMapFile( sourceHash ))
+		return false;
+
+	return writeMapCache( sourceSize, sourceTime, sourceHash );
+}
+
+StringTableEntry TmxMapAsset::getTilesetAsset( S32 tilesetIndex ) const
+{
+	if (tilesetIndex < 0 || tilesetIndex >= mTilesetAssets.size())
+		return StringTable->EmptyString;
+
+	return mTilesetAssets[tilesetIndex];
+}
+
+void TmxMapAsset::resolveTilesetAssets()
+{
+	StringTableEntry lastImage = StringTable->EmptyString;
+	StringTableEntry lastAsset = StringTable->EmptyString;
+
+	mTilesetAssets.setSize( mParser->GetNumTilesets() );
+	for (S32 i = 0; i < mTilesetAssets.size(); ++i)
+	{
+		mTilesetAssets[i] = resolveTilesetAsset( mParser->GetTileset(i), lastImage, lastAsset );
+	}
+}
+
+StringTableEntry TmxMapAsset::resolveTilesetAsset( const Tmx::Tileset* tileSet, StringTableEntry& lastImage, StringTableEntry& lastAsset )
+{
+	StringTableEntry assetName = StringTable->insert( tileSet->GetProperties().GetLiteralProperty(TMX_MAP_TILESET_ASSETNAME_PROP).c_str() );
+	if (assetName == StringTable->EmptyString && tileSet->GetImage() != NULL)
+	{
+		//we fall back to using the image filename as an asset name query.
+		//if that comes back with any hits, we use the first one.
+		//If you don't want to name your asset the same as your art tile set name, 
+		//you need to set a custom "AssetName" property on the tile set to override this.
+
+		const char* imageSource = tileSet->GetImage()->GetSource().c_str();
+		const char* imageFile = dStrrchr(imageSource, '\\');
+		if (imageFile == NULL)
+			imageFile = dStrrchr(imageSource, '/');
+		imageFile = imageFile == NULL ? imageSource : imageFile + 1;
+
+		char imageName[1024];
+		dStrncpy(imageName, imageFile, sizeof(imageName) - 1);
+		imageName[sizeof(imageName) - 1] = 0;
+		char* pDot = dStrrchr(imageName, '.');
+		if (pDot != NULL)
+			*pDot = 0;
+
+		StringTableEntry image = StringTable->insert( imageName );
+		if (image == lastImage)
+		{
+			//this is a quick memoize optimization to cut down on asset queries.
+			//if we are requesting the same assetName from what we already found, we just return that.
+			return lastAsset;
+		}
+
+		lastImage = image;
+		lastAsset = StringTable->EmptyString;
+
+		AssetQuery query;
+		S32 count = AssetDatabase.findAssetName(&query, image);
+		if (count > 0)
+		{
+			assetName = StringTable->insert( query.first() );
+			lastAsset = assetName;
+		}
+	}
+
+	return assetName;
+}
+
+void TmxMapAsset::buildPropertyIndex()
+{
+	// Debug Profiling.
+	PROFILE_SCOPE(TmxMapAsset_BuildPropertyIndex);
+
+	for (S32 i = 0; i < mParser->GetNumLayers(); ++i)
+	{
+		StringTableEntry layerName = StringTable->insert( mParser->GetLayer(i)->GetName().c_str() );
+
+		//the first layer wins when names are repeated, as it did with the old linear search.
+		if (mLayerIndices.find( layerName ) == mLayerIndices.end())
+			mLayerIndices.insert( layerName, i );
+	}
+
+	//number every property name used by any tile, and size each tileset by the highest tile id with properties.
+	mTilesetProperties.setSize( mParser->GetNumTilesets() );
+	for (S32 i = 0; i < mTilesetProperties.size(); ++i)
+	{
+		TilesetProperties& tilesetProperties = mTilesetProperties[i];
+		tilesetProperties.mTileCount = 0;
+
+		auto tileItr = mParser->GetTileset(i)->GetTiles().begin();
+		for (tileItr; tileItr != mParser->GetTileset(i)->GetTiles().end(); ++tileItr)
+		{
+			const Tmx::Tile* tile = *tileItr;
+			const std::map< std::string, std::string >& properties = tile->GetProperties().GetList();
+			if (properties.empty() || tile->GetId() < 0)
+				continue;
+
+			tilesetProperties.mTileCount = getMax( tilesetProperties.mTileCount, tile->GetId() + 1 );
+
+			auto propertyItr = properties.begin();
+			for (propertyItr; propertyItr != properties.end(); ++propertyItr)
+			{
+				StringTableEntry propertyName = StringTable->insert( propertyItr->first.c_str() );
+				if (mPropertyIndices.find( propertyName ) == mPropertyIndices.end())
+					mPropertyIndices.insert( propertyName, mPropertyIndices.size() );
+			}
+		}
+	}
+
+	//fill the property columns.
+	const S32 propertyCount = mPropertyIndices.size();
+	for (S32 i = 0; i < mTilesetProperties.size(); ++i)
+	{
+		TilesetProperties& tilesetProperties = mTilesetProperties[i];
+		const S32 valueCount = propertyCount * tilesetProperties.mTileCount;
+		tilesetProperties.mValues.setSize( valueCount );
+		for (S32 n = 0; n < valueCount; ++n)
+			tilesetProperties.mValues[n] = StringTable->EmptyString;
+
+		auto tileItr = mParser->GetTileset(i)->GetTiles().begin();
+		for (tileItr; tileItr != mParser->GetTileset(i)->GetTiles().end(); ++tileItr)
+		{
+			const Tmx::Tile* tile = *tileItr;
+			if (tile->GetId() < 0)
+				continue;
+
+			const std::map< std::string, std::string >& properties = tile->GetProperties().GetList();
+			auto propertyItr = properties.begin();
+			for (propertyItr; propertyItr != properties.end(); ++propertyItr)
+			{
+				const S32 propertyIndex = mPropertyIndices.find( StringTable->insert( propertyItr->first.c_str() ) )->value;
+				tilesetProperties.mValues[propertyIndex * tilesetProperties.mTileCount + tile->GetId()] = StringTable->insert( propertyItr->second.c_str() );
+			}
+		}
+	}
+}
+
+S32 TmxMapAsset::getLayerIndex( StringTableEntry layerName ) const
+{
+	typeNameIndexHash::const_iterator itr = mLayerIndices.find( layerName );
+	return itr == mLayerIndices.end() ? -1 : itr->value;
+}
+
+S32 TmxMapAsset::getPropertyIndex( StringTableEntry propertyName ) const
+{
+	typeNameIndexHash::const_iterator itr = mPropertyIndices.find( propertyName );
+	return itr == mPropertyIndices.end() ? -1 : itr->value;
+}
+
+StringTableEntry TmxMapAsset::getTileProperty( S32 layerIndex, S32 propertyIndex, S32 x, S32 y ) const
+{
+	if (mParser == NULL || layerIndex < 0 || layerIndex >= mParser->GetNumLayers() || propertyIndex < 0)
+		return StringTable->EmptyString;
+
+	const Tmx::Layer* layer = mParser->GetLayer(layerIndex);
+	if (x < 0 || y < 0 || x >= layer->GetWidth() || y >= layer->GetHeight())
+		return StringTable->EmptyString;
+
+	const Tmx::MapTile& tile = layer->GetTile(x, y);
+	if (tile.tilesetId < 0 || tile.tilesetId >= mTilesetProperties.size())
+		return StringTable->EmptyString;
+
+	const TilesetProperties& tilesetProperties = mTilesetProperties[tile.tilesetId];
+	if ((S32)tile.id >= tilesetProperties.mTileCount)
+		return StringTable->EmptyString;
+
+	return tilesetProperties.mValues[propertyIndex * tilesetProperties.mTileCount + tile.id];
+}
+
+bool TmxMapAsset::getTilePropertyRegion( S32 layerIndex, S32 propertyIndex, S32 x, S32 y, S32 width, S32 height, StringTableEntry* pValues ) const
+{
+	// Sanity!
+	AssertFatal( pValues != NULL, "TmxMapAsset::getTilePropertyRegion() - Cannot use a NULL value buffer." );
+
+	if (mParser == NULL || layerIndex < 0 || layerIndex >= mParser->GetNumLayers() || width <= 0 || height <= 0)
+		return false;
+
+	const Tmx::Layer* layer = mParser->GetLayer(layerIndex);
+	const S32 layerWidth = layer->GetWidth();
+	const S32 layerHeight = layer->GetHeight();
+
+	//cells outside the layer, without a tile or whose tile does not have the property are empty.
+	for (S32 row = 0; row < height; ++row)
+	{
+		const S32 tileY = y + row;
+		for (S32 column = 0; column < width; ++column, ++pValues)
+		{
+			const S32 tileX = x + column;
+			*pValues = StringTable->EmptyString;
+
+			if (propertyIndex < 0 || tileX < 0 || tileY < 0 || tileX >= layerWidth || tileY >= layerHeight)
+				continue;
+
+			const Tmx::MapTile& tile = layer->GetTile(tileX, tileY);
+			if (tile.tilesetId < 0 || tile.tilesetId >= mTilesetProperties.size())
+				continue;
+
+			const TilesetProperties& tilesetProperties = mTilesetProperties[tile.tilesetId];
+			if ((S32)tile.id < tilesetProperties.mTileCount)
+				*pValues = tilesetProperties.mValues[propertyIndex * tilesetProperties.mTileCount + tile.id];
+		}
+	}
+
+	return true;
+}
+
+const char* TmxMapAsset::getCachePath( char* pBuffer, U32 bufferSize ) const
+{
+	dSprintf( pBuffer, bufferSize, "%s%s", mMapFile, TMX_MAP_CACHE_EXTENSION );
+	return pBuffer;
+}
+
+bool TmxMapAsset::readMapFile( Vector<char>& buffer, const char* pFilePath ) const
+{
+	FileStream stream;
+	if (!stream.open( pFilePath, FileStream::Read ))
+		return false;
+
+	//the whole file is read in one go so the binary reader can work on it in place.
+	const U32 size = stream.getStreamSize();
+	buffer.setSize( size );
+	const bool status = size == 0 || stream.read( size, buffer.address() );
+	stream.close();
+
+	return status;
+}
+
+bool TmxMapAsset::statMapFile( U32& sourceSize, FileTime& sourceTime ) const
+{
+	const S32 size = Platform::getFileSize( mMapFile );
+	if (size < 0 || !Platform::getFileTimes( mMapFile, NULL, &sourceTime ))
+		return false;
+
+	sourceSize = (U32)size;
+	return true;
+}
+
+bool TmxMapAsset::hashMapFile( U32& sourceHash ) const
+{
+	// Debug Profiling.
+	PROFILE_SCOPE(TmxMapAsset_HashMapFile);
+
+	Vector<char> source;
+	if (!readMapFile( source, mMapFile ))
+		return false;
+
+	sourceHash = calculateCRC( source.address(), source.size() );
+	return true;
+}
+
+bool TmxMapAsset::readMapCache( const U32 sourceSize, const FileTime& sourceTime )
+{
+	// Debug Profiling.
+	PROFILE_SCOPE(TmxMapAsset_ReadMapCache);
+
+	char cachePath[1024];
+	getCachePath( cachePath, sizeof(cachePath) );
+	if (!Platform::isFile( cachePath ))
+		return false;
+
+	Vector<char> cache;
+	if (!readMapFile( cache, cachePath ))
+		return false;
+
+	Tmx::BinaryReader reader( cache.address(), cache.size() );
+
+	//the cache is stale if it was written by another version, for another tile layout or from another map file.
+	const char* pMagic = reader.ReadBytes( 4 );
+	if (pMagic == NULL || dStrncmp( pMagic, "TMXC", 4 ) != 0 ||
+		reader.ReadUnsigned() != TMX_MAP_CACHE_VERSION ||
+		reader.ReadUnsigned() != sizeof(Tmx::MapTile) ||
+		reader.ReadUnsigned() != sourceSize )
+		return false;
+
+	const char* pCacheTime = reader.ReadBytes( sizeof(FileTime) );
+	const U32 cacheHash = reader.ReadUnsigned();
+	if (pCacheTime == NULL)
+		return false;
+
+	//the map file is only hashed when it has been touched since the cache was written.
+	const bool touched = dMemcmp( pCacheTime, &sourceTime, sizeof(FileTime) ) != 0;
+	if (touched)
+	{
+		U32 sourceHash = 0;
+		if (!hashMapFile( sourceHash ) || sourceHash != cacheHash)
+			return false;
+	}
+
+	Vector<StringTableEntry> tilesetAssets;
+	tilesetAssets.setSize( reader.ReadCount( sizeof(U32) ) );
+	for (S32 i = 0; i < tilesetAssets.size(); ++i)
+	{
+		tilesetAssets[i] = StringTable->insert( reader.ReadString().c_str() );
+	}
+
+	if (reader.HasError())
+		return false;
+
+	Tmx::Map* pParser = new Tmx::Map();
+	pParser->ParseBinary( mMapFile, cache.address() + reader.GetPosition(), cache.size() - reader.GetPosition() );
+
+	if (pParser->HasError() || pParser->GetNumTilesets() != tilesetAssets.size())
+	{
+		Con::warnf( "Map '%s' has a corrupt precompiled map and will be parsed instead.", getAssetId() );
+		delete pParser;
+		return false;
+	}
+
+	mParser = pParser;
+	mTilesetAssets = tilesetAssets;
+
+	//tileset assets resolved when the cache was written may since have been removed.
+	StringTableEntry lastImage = StringTable->EmptyString;
+	StringTableEntry lastAsset = StringTable->EmptyString;
+	for (S32 i = 0; i < mTilesetAssets.size(); ++i)
+	{
+		if (mTilesetAssets[i] == StringTable->EmptyString || !AssetDatabase.isDeclaredAsset( mTilesetAssets[i] ))
+			mTilesetAssets[i] = resolveTilesetAsset( mParser->GetTileset(i), lastImage, lastAsset );
+	}
+
+	//restamp a touched but unchanged map so the next load does not hash it again.
+	if (touched && mMapCache)
+		writeMapCache( sourceSize, sourceTime, cacheHash );
+
+	return true;
+}
+
+bool TmxMapAsset::writeMapCache( const U32 sourceSize, const FileTime& sourceTime, const U32 sourceHash )
+{
+	// Debug Profiling.
+	PROFILE_SCOPE(TmxMapAsset_WriteMapCache);
+
+	Tmx::BinaryWriter writer;
+	writer.WriteBytes( "TMXC", 4 );
+	writer.WriteUnsigned( TMX_MAP_CACHE_VERSION );
+	writer.WriteUnsigned( sizeof(Tmx::MapTile) );
+	writer.WriteUnsigned( sourceSize );
+	writer.WriteBytes( &sourceTime, sizeof(FileTime) );
+	writer.WriteUnsigned( sourceHash );
+
+	writer.WriteInt( mTilesetAssets.size() );
+	for (S32 i = 0; i < mTilesetAssets.size(); ++i)
+	{
+		writer.WriteString( mTilesetAssets[i] );
+	}
+
+	mParser->WriteBinary( writer );
+
+	char cachePath[1024];
+	getCachePath( cachePath, sizeof(cachePath) );
+
+	FileStream stream;
+	if (!stream.open( cachePath, FileStream::Write ))
+	{
+		Con::warnf( "Map '%s' could not write its precompiled map to '%s'.", getAssetId(), cachePath );
+		return false;
+	}
+
+	const std::string& buffer = writer.GetBuffer();
+	const bool status = stream.write( (U32)buffer.size(), buffer.data() );
+	stream.close();
+
+	return status;
 }
 
 bool TmxMapAsset::isAssetValid()
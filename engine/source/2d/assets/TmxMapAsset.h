@@ -5,10 +5,23 @@
 #include "assets/assetPtr.h"
 #endif
 
+#ifndef _HASHTABLE_H
+#include "collection/hashTable.h"
+#endif
+
 #include <Tmx.h>
 
 //-----------------------------------------------------------------------------
 
+//tilesets can name the image asset they use with this property, otherwise it is looked up by image file name.
+#define TMX_MAP_TILESET_ASSETNAME_PROP "AssetName"
+
+//the precompiled map is written next to the tmx file with this appended to its name.
+#define TMX_MAP_CACHE_EXTENSION ".cache"
+#define TMX_MAP_CACHE_VERSION 2
+
+//-----------------------------------------------------------------------------
+
 DefineConsoleType( TypeTmxMapAssetPtr )
 
 //-----------------------------------------------------------------------------
@@ -39,23 +52,57 @@ private:
 
 	/// Configuration.
 	StringTableEntry            mMapFile;
+	bool                        mMapCache;
 
 public:
 
 	void                    setMapFile( const char* pMapFile );
 	inline StringTableEntry getMapFile( void ) const                      { return mMapFile; };
+	inline void             setMapCache( const bool mapCache )            { mMapCache = mapCache; }
+	inline bool             getMapCache( void ) const                     { return mMapCache; }
 
 
 	StringTableEntry getOrientation();
 	int				 getLayerCount();
 
 	Tmx::Map*		 getParser();
+	StringTableEntry getTilesetAsset( S32 tilesetIndex ) const;
+	bool			 compileMap();
+
+	/// Tile properties.
+	S32				 getLayerIndex( StringTableEntry layerName ) const;
+	S32				 getPropertyIndex( StringTableEntry propertyName ) const;
+	StringTableEntry getTileProperty( S32 layerIndex, S32 propertyIndex, S32 x, S32 y ) const;
+	bool			 getTilePropertyRegion( S32 layerIndex, S32 propertyIndex, S32 x, S32 y, S32 width, S32 height, StringTableEntry* pValues ) const;
 
 private:
 
 	Tmx::Map*					mParser;
+	Vector<StringTableEntry>	mTilesetAssets;		//image asset for each tileset, resolved once per load.
+
+	/// Tile property values for a tileset, one column per property indexed by tile id.
+	struct TilesetProperties
+	{
+		S32							mTileCount;
+		Vector<StringTableEntry>	mValues;		//mValues[propertyIndex * mTileCount + tileId], empty when the tile does not have the property.
+	};
+
+	typedef HashMap<StringTableEntry, S32> typeNameIndexHash;
+	typeNameIndexHash			mLayerIndices;
+	typeNameIndexHash			mPropertyIndices;
+	Vector<TilesetProperties>	mTilesetProperties;
 
 	void calculateMap( void );
+	static void parallelForLayers( Tmx::ParallelForJob job, void* context, unsigned int count );
+	void buildPropertyIndex( void );
+	void resolveTilesetAssets( void );
+	StringTableEntry resolveTilesetAsset( const Tmx::Tileset* tileSet, StringTableEntry& lastImage, StringTableEntry& lastAsset );
+	const char* getCachePath( char* pBuffer, U32 bufferSize ) const;
+	bool readMapFile( Vector<char>& buffer, const char* pFilePath ) const;
+	bool statMapFile( U32& sourceSize, FileTime& sourceTime ) const;
+	bool hashMapFile( U32& sourceHash ) const;
+	bool readMapCache( const U32 sourceSize, const FileTime& sourceTime );
+	bool writeMapCache( const U32 sourceSize, const FileTime& sourceTime, const U32 sourceHash );
 	virtual bool isAssetValid();
 
 protected:
@@ -71,6 +118,7 @@ protected:
 
 	static bool setMapFile( void* obj, const char* data )                 { static_cast<TmxMapAsset*>(obj)->setMapFile(data); return false; }
 	static const char* getMapFile(void* obj, const char* data)            { return static_cast<TmxMapAsset*>(obj)->getMapFile(); }
+	static bool writeMapCache( void* obj, StringTableEntry pFieldName )   { return static_cast<TmxMapAsset*>(obj)->getMapCache(); }
 
 };
 
@@ -23,4 +23,11 @@ ConsoleMethod(TmxMapAsset, getLayerCount, S32, 2, 2,  "() Gets the number of til
 	"@return Returns the numer of tile layers in the map.")
 {
 	return object->getLayerCount();
-}
\ No newline at end of file
+}
+
+ConsoleMethod(TmxMapAsset, compileMap, bool, 2, 2,  "() Writes a precompiled copy of the map next to the map file.\n"
+	"The precompiled map is used instead of parsing the map file for as long as the map file is unchanged.\n"
+	"@return Returns whether the precompiled map was written or not.")
+{
+	return object->compileMap();
+}
@@ -32,12 +32,11 @@
 //-----------------------------------------------------------------------------
 
 BatchRender::BatchRender() :
-    mQuadCount( 0 ),
-    mVertexCount( 0 ),
-    mTextureResidentCount( 0 ),
-    mIndexCount( 0 ),
-    mColorCount( 0 ),
+    mVertexPacker( BATCHRENDER_MAXQUADS ),
     NoColor( -1.0f, -1.0f, -1.0f ),
+    mVertexBufferObject( 0 ),
+    mIndexBufferObject( 0 ),
+    mVertexBufferOffset( 0 ),
     mStrictOrderMode( false ),
     mpDebugStats( NULL ),
     mBlendMode( true ),
@@ -48,25 +47,20 @@ BatchRender::BatchRender() :
     mWireframeMode( false ),
     mBatchEnabled( true )
 {
+    // Register for texture events so we know when the buffer objects are lost.
+    mTextureEventKey = TextureManager::registerEventCallback( textureEventCallback, this );
 }
 
 //-----------------------------------------------------------------------------
 
 BatchRender::~BatchRender()
 {
-    // Destroy index vectors in texture batch map.
-    for ( textureBatchType::iterator itr = mTextureBatchMap.begin(); itr != mTextureBatchMap.end(); ++itr )
-    {
-        delete itr->value;
-    }
-    mTextureBatchMap.clear();
+    // Unregister for texture events.
+    TextureManager::unregisterEventCallback( mTextureEventKey );
 
-    // Destroy index vectors in index vector pool.
-    for ( VectorPtr< indexVectorType* >::iterator itr = mIndexVectorPool.begin(); itr != mIndexVectorPool.end(); ++itr )
-    {
-        delete (*itr);
-    }
-    mIndexVectorPool.clear();
+    // Destroy the buffer objects if we can still render.
+    if ( TextureManager::mDGLRender )
+        destroyBufferObjects();
 }
 
 //-----------------------------------------------------------------------------
@@ -116,33 +110,12 @@ void BatchRender::SubmitQuad(
 
     PROFILE_START(BatchRender_SubmitQuad);
 
-    // Do we have anything batched?
-    if ( mQuadCount > 0 )
-    {
-        // Yes, so do we have any existing colors?
-        if ( mColorCount == 0 )
-        {
-            // No, so flush if color is specified.
-            if ( color != NoColor  )
-                flush( mpDebugStats->batchColorStateFlush );
-        }
-        else
-        {
-            // Yes, so flush if color is not specified.
-            if ( color == NoColor  )
-                flush( mpDebugStats->batchColorStateFlush );
-        }
-    }
-
     // Is a color specified?
-    if ( color != NoColor )
-    {
-        // Yes, so add colors.
-        mColorBuffer[mColorCount++] = color;
-        mColorBuffer[mColorCount++] = color;
-        mColorBuffer[mColorCount++] = color;
-        mColorBuffer[mColorCount++] = color;
-    }
+    const bool colored = color != NoColor;
+
+    // Flush if the color usage changes.
+    if ( mVertexPacker.getQuadCount() > 0 && colored != mVertexPacker.getColored() )
+        flush( mpDebugStats->batchColorStateFlush );
 
     // Strict order mode?
     if ( mStrictOrderMode )
@@ -154,78 +127,32 @@ void BatchRender::SubmitQuad(
             flush( mpDebugStats->batchTextureChangeFlush );
         }
 
-        // Add new indices.
-        mIndexBuffer[mIndexCount++] = (U16)mVertexCount++;
-        mIndexBuffer[mIndexCount++] = (U16)mVertexCount++;
-        mIndexBuffer[mIndexCount++] = (U16)mVertexCount++;
-        mIndexBuffer[mIndexCount++] = (U16)mVertexCount--;
-        mIndexBuffer[mIndexCount++] = (U16)mVertexCount--;
-        mIndexBuffer[mIndexCount++] = (U16)mVertexCount--;
-
         // Set strict order mode texture handle.
         mStrictOrderTextureHandle = texture;
     }
-    else
-    {
-        // No, so fetch texture binding.
-        const U32 textureBinding = texture.getGLName();
-
-        indexVectorType* pIndexVector = NULL;
-
-        // Find texture binding.
-        textureBatchType::iterator itr = mTextureBatchMap.find( textureBinding );
-
-        // Did we find a texture binding?
-        if ( itr == mTextureBatchMap.end() )
-        {
-            // No, so fetch index vector pool count.
-            const U32 indexVectorPoolCount = mIndexVectorPool.size();
-
-            // Do we have any in the index vector pool?
-            if ( indexVectorPoolCount > 0 )
-            {
-                // Yes, so use it.
-                pIndexVector = mIndexVectorPool[indexVectorPoolCount-1];
-                mIndexVectorPool.pop_back();
-            }
-            else
-            {
-                // No, so generate one.
-                pIndexVector = new indexVectorType( 6 * 6 );
-            }
-
-            // Insert into texture batch map.
-            mTextureBatchMap.insert( textureBinding, pIndexVector );
-        }
-        else
-        {
-            // Yes, so fetch it.
-            pIndexVector = itr->value;
-        }
 
-        // Add vertex start.
-        pIndexVector->push_back( mVertexCount );       
+    // Fetch the vertex color.
+    ColorI vertexColor( 255, 255, 255, 255 );
+    if ( colored )
+    {
+        ColorF clampedColor = color;
+        clampedColor.clamp();
+        vertexColor = clampedColor;
+        mVertexPacker.setColored( true );
     }
 
-    // Add textured vertices.
-    // NOTE: We swap #2/#3 here.
-    mVertexBuffer[mVertexCount++]   = vertexPos0;
-    mVertexBuffer[mVertexCount++]   = vertexPos1;
-    mVertexBuffer[mVertexCount++]   = vertexPos3;
-    mVertexBuffer[mVertexCount++]   = vertexPos2;
-    mTextureBuffer[mTextureResidentCount++] = texturePos0;
-    mTextureBuffer[mTextureResidentCount++] = texturePos1;
-    mTextureBuffer[mTextureResidentCount++] = texturePos3;
-    mTextureBuffer[mTextureResidentCount++] = texturePos2;
+    // Add textured quad to its texture batch.
+    mVertexPacker.addQuad(
+        texture.getGLName(),
+        vertexPos0, vertexPos1, vertexPos2, vertexPos3,
+        texturePos0, texturePos1, texturePos2, texturePos3,
+        vertexColor );
 
     // Stats.
     mpDebugStats->batchTrianglesSubmitted+=2;
 
-    // Increase quad count.
-    mQuadCount++;
-
     // Have we reached the buffer limit?
-    if ( mQuadCount == BATCHRENDER_MAXQUADS )
+    if ( mVertexPacker.isFull() )
     {
         // Yes, so flush.
         flush( mpDebugStats->batchBufferFullFlush );
@@ -248,7 +175,7 @@ void BatchRender::SubmitQuad(
 void BatchRender::flush( U32& reasonMetric )
 {
     // Finish if no quads to flush.
-    if ( mQuadCount == 0 )
+    if ( mVertexPacker.getQuadCount() == 0 )
         return;
 
     // Increase reason metric.
@@ -263,7 +190,7 @@ void BatchRender::flush( U32& reasonMetric )
 void BatchRender::flush( void )
 {
     // Finish if no quads to flush.
-    if ( mQuadCount == 0 )
+    if ( mVertexPacker.getQuadCount() == 0 )
         return;
 
     // Increase reason metric.
@@ -278,7 +205,7 @@ void BatchRender::flush( void )
 void BatchRender::flushInternal( void )
 {
     // Finish if no quads to flush.
-    if ( mQuadCount == 0 )
+    if ( mVertexPacker.getQuadCount() == 0 )
         return;
 
     PROFILE_START(T2D_BatchRender_flush);
@@ -328,23 +255,37 @@ void BatchRender::flushInternal( void )
         glDisable( GL_ALPHA_TEST );
     }
 
+    // Pack the quads grouped by texture.
+    const U32 quadCount = mVertexPacker.getQuadCount();
+    const U32 vertexCount = mVertexPacker.pack( mVertexBuffer );
+
+    // Fetch the vertex and index sources.
+    // NOTE: These are offsets into the bound buffer objects if we're streaming.
+    const bool streaming = dglDoesSupportARBVertexBufferObject();
+    const U8* pVertexSource = streaming ? streamVertices( vertexCount ) : (const U8*)mVertexBuffer;
+    const U8* pIndexSource = streaming ? NULL : (const U8*)getQuadIndices();
+
     // Enable vertex and texture arrays.
     glEnableClientState( GL_VERTEX_ARRAY );
-    glVertexPointer( 2, GL_FLOAT, 0, mVertexBuffer );
-    glTexCoordPointer( 2, GL_FLOAT, 0, mTextureBuffer );
+    glVertexPointer( 2, GL_FLOAT, sizeof(BatchVertex), pVertexSource );
+    glTexCoordPointer( 2, GL_FLOAT, sizeof(BatchVertex), pVertexSource + sizeof(Vector2) );
 
     // Use the texture coordinates if not in wireframe mode.
     if ( !mWireframeMode )
         glEnableClientState( GL_TEXTURE_COORD_ARRAY );
 
     // Do we have any colors?
-    if ( mColorCount > 0 )
+    if ( mVertexPacker.getColored() )
     {
         // Yes, so enable color array.
         glEnableClientState( GL_COLOR_ARRAY );
-        glColorPointer( 4, GL_FLOAT, 0, mColorBuffer );
+        glColorPointer( 4, GL_UNSIGNED_BYTE, sizeof(BatchVertex), pVertexSource + (sizeof(Vector2) * 2) );
     }
 
+    // Stats.
+    if ( vertexCount > mpDebugStats->batchMaxVertexBuffer )
+        mpDebugStats->batchMaxVertexBuffer = vertexCount;
+
     // Strict order mode?
     if ( mStrictOrderMode )
     {
@@ -353,9 +294,9 @@ void BatchRender::flushInternal( void )
             glBindTexture( GL_TEXTURE_2D, mStrictOrderTextureHandle.getGLName() );
 
         // Yes, so do we have a single quad?
-        if ( mQuadCount == 1 )
+        if ( quadCount == 1 )
         {
-            // Yes, so draw the quad using a triangle-strip with indexes.
+            // Yes, so draw the quad using a triangle-strip.
             glDrawArrays( GL_TRIANGLE_STRIP, 0, 4 );    
 
             // Stats.
@@ -368,79 +309,42 @@ void BatchRender::flushInternal( void )
         else
         {
             // Draw the quads using triangles with indexes.
-            glDrawElements( GL_TRIANGLES, mIndexCount, GL_UNSIGNED_SHORT, mIndexBuffer );
+            glDrawElements( GL_TRIANGLES, quadCount * BatchVertexPacker::QuadIndexCount, GL_UNSIGNED_SHORT, pIndexSource );
 
             // Stats.
             mpDebugStats->batchDrawCallsStrictMultiple++;
 
             // Stats.
-            const U32 trianglesDrawn = mIndexCount / 3;
+            const U32 trianglesDrawn = quadCount * 2;
             if ( trianglesDrawn > mpDebugStats->batchMaxTriangleDrawn )
                 mpDebugStats->batchMaxTriangleDrawn = trianglesDrawn;
         }
-
-        // Stats.
-        if ( mVertexCount > mpDebugStats->batchMaxVertexBuffer )
-            mpDebugStats->batchMaxVertexBuffer = mVertexCount;
     }
     else
     {
-        // No, so iterate texture batch map.
-        for( textureBatchType::iterator batchItr = mTextureBatchMap.begin(); batchItr != mTextureBatchMap.end(); ++batchItr )
+        // No, so iterate texture batches.
+        const BatchVertexPacker::typeTextureBatchVector& textureBatches = mVertexPacker.getTextureBatches();
+        for( BatchVertexPacker::typeTextureBatchVector::const_iterator batchItr = textureBatches.begin(); batchItr != textureBatches.end(); ++batchItr )
         {
-            // Fetch texture binding.
-            const U32 textureBinding = batchItr->key;
-
-            // Fetch index vector.
-            indexVectorType* pIndexVector = batchItr->value;
-
-            // Reset index count.
-            mIndexCount = 0;
-
-            // Iterate indexes.
-            for( indexVectorType::iterator indexItr = pIndexVector->begin(); indexItr != pIndexVector->end(); ++indexItr )
-            {
-                // Fetch quad index.
-                U32 quadIndex = (*indexItr);
-
-                // Add new indices.
-                mIndexBuffer[mIndexCount++] = (U16)quadIndex++;
-                mIndexBuffer[mIndexCount++] = (U16)quadIndex++;
-                mIndexBuffer[mIndexCount++] = (U16)quadIndex++;
-                mIndexBuffer[mIndexCount++] = (U16)quadIndex--;
-                mIndexBuffer[mIndexCount++] = (U16)quadIndex--;
-                mIndexBuffer[mIndexCount++] = (U16)quadIndex;
-            }
-
             // Sanity!
-            AssertFatal( mIndexCount > 0, "No batching indexes are present." );
+            AssertFatal( batchItr->mQuadCount > 0, "No batching quads are present." );
 
             // Bind the texture if not in wireframe mode.
             if ( !mWireframeMode )
-                glBindTexture( GL_TEXTURE_2D, textureBinding );
+                glBindTexture( GL_TEXTURE_2D, batchItr->mTextureBinding );
 
-            // Draw the quads using triangles with indexes.
-            glDrawElements( GL_TRIANGLES, mIndexCount, GL_UNSIGNED_SHORT, mIndexBuffer );
+            // Draw the quads using triangles with indexes offset to the batch.
+            const U32 firstIndex = batchItr->mFirstQuad * BatchVertexPacker::QuadIndexCount;
+            glDrawElements( GL_TRIANGLES, batchItr->mQuadCount * BatchVertexPacker::QuadIndexCount, GL_UNSIGNED_SHORT, pIndexSource + (firstIndex * sizeof(U16)) );
 
             // Stats.
             mpDebugStats->batchDrawCallsSorted++;
 
             // Stats.
-            if ( mVertexCount > mpDebugStats->batchMaxVertexBuffer )
-                mpDebugStats->batchMaxVertexBuffer = mVertexCount;
-
-            // Stats.
-            const U32 trianglesDrawn = mIndexCount / 3;
+            const U32 trianglesDrawn = batchItr->mQuadCount * 2;
             if ( trianglesDrawn > mpDebugStats->batchMaxTriangleDrawn )
                 mpDebugStats->batchMaxTriangleDrawn = trianglesDrawn;
-
-            // Return index vector to pool.
-            pIndexVector->clear();
-            mIndexVectorPool.push_back( pIndexVector );
         }
-
-        // Clear texture batch map.
-        mTextureBatchMap.clear();
     }
 
     // Reset common render state.
@@ -452,18 +356,112 @@ void BatchRender::flushInternal( void )
     glDisable( GL_TEXTURE_2D );
     glPolygonMode( GL_FRONT_AND_BACK, GL_FILL );
 
+    // Unbind the buffer objects so client arrays work elsewhere.
+    if ( streaming )
+    {
+        glBindBufferARB( GL_ARRAY_BUFFER_ARB, 0 );
+        glBindBufferARB( GL_ELEMENT_ARRAY_BUFFER_ARB, 0 );
+    }
+
     // Reset batch state.
-    mQuadCount = 0;
-    mVertexCount = 0;
-    mTextureResidentCount = 0;
-    mIndexCount = 0;
-    mColorCount = 0;
+    mVertexPacker.clear();
 
     PROFILE_END();   // T2D_BatchRender_flush
 }
 
 //-----------------------------------------------------------------------------
 
+const U8* BatchRender::streamVertices( const U32 vertexCount )
+{
+    // Create the buffer objects if we've not got them.
+    if ( mVertexBufferObject == 0 )
+        createBufferObjects();
+
+    // Bind the buffer objects.
+    glBindBufferARB( GL_ARRAY_BUFFER_ARB, mVertexBufferObject );
+    glBindBufferARB( GL_ELEMENT_ARRAY_BUFFER_ARB, mIndexBufferObject );
+
+    // Is there space left in the stream?
+    const U32 vertexSize = vertexCount * sizeof(BatchVertex);
+    if ( mVertexBufferOffset + vertexSize > BATCHRENDER_STREAMSIZE )
+    {
+        // No, so orphan the storage so the driver can keep drawing from the old storage while we write to new storage.
+        glBufferDataARB( GL_ARRAY_BUFFER_ARB, BATCHRENDER_STREAMSIZE, NULL, GL_STREAM_DRAW_ARB );
+        mVertexBufferOffset = 0;
+    }
+
+    // Write the vertices after those already drawn this time around.
+    glBufferSubDataARB( GL_ARRAY_BUFFER_ARB, mVertexBufferOffset, vertexSize, mVertexBuffer );
+
+    const U8* pVertexSource = (const U8*)(size_t)mVertexBufferOffset;
+    mVertexBufferOffset += vertexSize;
+
+    return pVertexSource;
+}
+
+//-----------------------------------------------------------------------------
+
+void BatchRender::createBufferObjects( void )
+{
+    // Create the vertex stream.
+    glGenBuffersARB( 1, &mVertexBufferObject );
+    glBindBufferARB( GL_ARRAY_BUFFER_ARB, mVertexBufferObject );
+    glBufferDataARB( GL_ARRAY_BUFFER_ARB, BATCHRENDER_STREAMSIZE, NULL, GL_STREAM_DRAW_ARB );
+    mVertexBufferOffset = 0;
+
+    // Create the quad indices.  These never change.
+    glGenBuffersARB( 1, &mIndexBufferObject );
+    glBindBufferARB( GL_ELEMENT_ARRAY_BUFFER_ARB, mIndexBufferObject );
+    glBufferDataARB( GL_ELEMENT_ARRAY_BUFFER_ARB, BATCHRENDER_MAXQUADS * BatchVertexPacker::QuadIndexCount * sizeof(U16), getQuadIndices(), GL_STATIC_DRAW_ARB );
+}
+
+//-----------------------------------------------------------------------------
+
+void BatchRender::destroyBufferObjects( void )
+{
+    if ( mVertexBufferObject != 0 )
+    {
+        glDeleteBuffersARB( 1, &mVertexBufferObject );
+        mVertexBufferObject = 0;
+    }
+
+    if ( mIndexBufferObject != 0 )
+    {
+        glDeleteBuffersARB( 1, &mIndexBufferObject );
+        mIndexBufferObject = 0;
+    }
+
+    mVertexBufferOffset = 0;
+}
+
+//-----------------------------------------------------------------------------
+
+void BatchRender::textureEventCallback( const TextureManager::TextureEventCode eventCode, void* userData )
+{
+    // Destroy the buffer objects with the textures.  They're created again when next used.
+    if ( eventCode == TextureManager::BeginZombification )
+        static_cast<BatchRender*>( userData )->destroyBufferObjects();
+}
+
+//-----------------------------------------------------------------------------
+
+const U16* BatchRender::getQuadIndices( void )
+{
+    static U16 quadIndices[ BATCHRENDER_MAXQUADS * BatchVertexPacker::QuadIndexCount ];
+    static bool quadIndicesBuilt = false;
+
+    // Build the quad indices once.
+    if ( !quadIndicesBuilt )
+    {
+        BatchVertexPacker::buildQuadIndices( quadIndices, BATCHRENDER_MAXQUADS );
+        quadIndicesBuilt = true;
+    }
+
+    return quadIndices;
+}
+
+//-----------------------------------------------------------------------------
+
 void BatchRender::RenderQuad(
         const Vector2& vertexPos0,
         const Vector2& vertexPos1,
@@ -39,8 +39,8 @@
 #include "graphics/TextureManager.h"
 #endif
 
-#ifndef _HASHTABLE_H
-#include "collection/hashTable.h"
+#ifndef _BATCH_VERTEX_PACKER_H_
+#include "2d/core/BatchVertexPacker.h"
 #endif
 
 #ifndef _COLOR_H_
@@ -51,6 +51,7 @@
 
 #define BATCHRENDER_BUFFERSIZE      (65535)
 #define BATCHRENDER_MAXQUADS        (BATCHRENDER_BUFFERSIZE/6)
+#define BATCHRENDER_STREAMSIZE      (BATCHRENDER_MAXQUADS*4*sizeof(BatchVertex)*2)
 
 //-----------------------------------------------------------------------------
 
@@ -212,25 +213,24 @@ private:
     /// Flush (render) any pending batches.
     void flushInternal( void );
 
-private:
-    typedef Vector<U32> indexVectorType;
-    typedef HashMap<U32, indexVectorType*> textureBatchType;
+    /// Streaming buffer objects.
+    const U8* streamVertices( const U32 vertexCount );
+    void createBufferObjects( void );
+    void destroyBufferObjects( void );
+    static void textureEventCallback( const TextureManager::TextureEventCode eventCode, void* userData );
+    static const U16* getQuadIndices( void );
 
-    VectorPtr< indexVectorType* > mIndexVectorPool;
-    textureBatchType    mTextureBatchMap;
+private:
+    BatchVertexPacker   mVertexPacker;
 
     const ColorF        NoColor;
 
-    Vector2             mVertexBuffer[ BATCHRENDER_BUFFERSIZE ];
-    Vector2             mTextureBuffer[ BATCHRENDER_BUFFERSIZE ];
-    U16                 mIndexBuffer[ BATCHRENDER_BUFFERSIZE ];
-    ColorF              mColorBuffer[ BATCHRENDER_BUFFERSIZE ];
-   
-    U32                 mQuadCount;
-    U32                 mVertexCount;
-    U32                 mTextureResidentCount;
-    U32                 mIndexCount;
-    U32                 mColorCount;
+    BatchVertex         mVertexBuffer[ BATCHRENDER_MAXQUADS * 4 ];
+
+    GLuint              mVertexBufferObject;
+    GLuint              mIndexBufferObject;
+    U32                 mVertexBufferOffset;
+    U32                 mTextureEventKey;
 
     bool                mBlendMode;
     GLenum              mSrcBlendFactor;
@@ -0,0 +1,177 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _BATCH_VERTEX_PACKER_H_
+#include "2d/core/BatchVertexPacker.h"
+#endif
+
+// Debug Profiling.
+#include "debug/profiler.h"
+
+//-----------------------------------------------------------------------------
+
+BatchVertexPacker::BatchVertexPacker( const U32 quadCapacity ) :
+    mQuadCapacity( quadCapacity ),
+    mQuadCount( 0 ),
+    mColored( false ),
+    mLastBatch( 0 )
+{
+    mQuadVertices.setSize( quadCapacity * 4 );
+    mQuadBatches.setSize( quadCapacity );
+}
+
+//-----------------------------------------------------------------------------
+
+void BatchVertexPacker::addQuad(
+        const U32 textureBinding,
+        const Vector2& vertexPos0,
+        const Vector2& vertexPos1,
+        const Vector2& vertexPos2,
+        const Vector2& vertexPos3,
+        const Vector2& texturePos0,
+        const Vector2& texturePos1,
+        const Vector2& texturePos2,
+        const Vector2& texturePos3,
+        const ColorI& color )
+{
+    // Sanity!
+    AssertFatal( mQuadCount < mQuadCapacity, "BatchVertexPacker::addQuad() - The quad capacity has been exceeded." );
+
+    // Is the quad in the same batch as the last quad?
+    if ( mTextureBatches.size() == 0 || mTextureBatches[mLastBatch].mTextureBinding != textureBinding )
+    {
+        // No, so find the texture batch.
+        typeTextureBatchMap::iterator itr = mTextureBatchMap.find( textureBinding );
+
+        // Did we find the texture batch?
+        if ( itr == mTextureBatchMap.end() )
+        {
+            // No, so add one.
+            TextureBatch textureBatch;
+            textureBatch.mTextureBinding = textureBinding;
+            textureBatch.mFirstQuad = 0;
+            textureBatch.mQuadCount = 0;
+            mLastBatch = mTextureBatches.size();
+            mTextureBatches.push_back( textureBatch );
+            mTextureBatchMap.insert( textureBinding, mLastBatch );
+        }
+        else
+        {
+            // Yes, so use it.
+            mLastBatch = itr->value;
+        }
+    }
+
+    // Add to the batch.
+    mTextureBatches[mLastBatch].mQuadCount++;
+    mQuadBatches[mQuadCount] = mLastBatch;
+
+    // Add textured vertices.
+    // NOTE: We swap #2/#3 here.
+    BatchVertex* pVertex = mQuadVertices.address() + (mQuadCount * 4);
+    pVertex[0].mPosition = vertexPos0;
+    pVertex[1].mPosition = vertexPos1;
+    pVertex[2].mPosition = vertexPos3;
+    pVertex[3].mPosition = vertexPos2;
+    pVertex[0].mTexturePosition = texturePos0;
+    pVertex[1].mTexturePosition = texturePos1;
+    pVertex[2].mTexturePosition = texturePos3;
+    pVertex[3].mTexturePosition = texturePos2;
+    pVertex[0].mColor = color;
+    pVertex[1].mColor = color;
+    pVertex[2].mColor = color;
+    pVertex[3].mColor = color;
+
+    mQuadCount++;
+}
+
+//-----------------------------------------------------------------------------
+
+U32 BatchVertexPacker::pack( BatchVertex* pVertices )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(BatchVertexPacker_Pack);
+
+    const U32 batchCount = mTextureBatches.size();
+
+    // A single batch is already in order.
+    if ( batchCount == 1 )
+    {
+        mTextureBatches[0].mFirstQuad = 0;
+        dMemcpy( pVertices, mQuadVertices.address(), mQuadCount * 4 * sizeof(BatchVertex) );
+        return mQuadCount * 4;
+    }
+
+    // Place the batches one after another.
+    mBatchCursors.setSize( batchCount );
+    U32 firstQuad = 0;
+    for ( U32 batchIndex = 0; batchIndex < batchCount; ++batchIndex )
+    {
+        TextureBatch& textureBatch = mTextureBatches[batchIndex];
+        textureBatch.mFirstQuad = firstQuad;
+        mBatchCursors[batchIndex] = firstQuad;
+        firstQuad += textureBatch.mQuadCount;
+    }
+
+    // Scatter the quads into their batches.
+    const BatchVertex* pQuadVertices = mQuadVertices.address();
+    const U32* pQuadBatches = mQuadBatches.address();
+    U32* pBatchCursors = mBatchCursors.address();
+    for ( U32 quadIndex = 0; quadIndex < mQuadCount; ++quadIndex, pQuadVertices += 4 )
+    {
+        BatchVertex* pVertex = pVertices + (pBatchCursors[pQuadBatches[quadIndex]]++ * 4);
+        pVertex[0] = pQuadVertices[0];
+        pVertex[1] = pQuadVertices[1];
+        pVertex[2] = pQuadVertices[2];
+        pVertex[3] = pQuadVertices[3];
+    }
+
+    return mQuadCount * 4;
+}
+
+//-----------------------------------------------------------------------------
+
+void BatchVertexPacker::clear( void )
+{
+    mQuadCount = 0;
+    mColored = false;
+    mTextureBatches.clear();
+    mTextureBatchMap.clear();
+    mLastBatch = 0;
+}
+
+//-----------------------------------------------------------------------------
+
+void BatchVertexPacker::buildQuadIndices( U16* pIndices, const U32 quadCount )
+{
+    // Vertices were packed as 0, 1, 3, 2 so the triangles are (0,1,3) and (2,3,1) in quad order.
+    for ( U32 quadIndex = 0; quadIndex < quadCount; ++quadIndex )
+    {
+        const U16 vertexIndex = (U16)(quadIndex * 4);
+        *pIndices++ = vertexIndex;
+        *pIndices++ = (U16)(vertexIndex + 1);
+        *pIndices++ = (U16)(vertexIndex + 2);
+        *pIndices++ = (U16)(vertexIndex + 3);
+        *pIndices++ = (U16)(vertexIndex + 2);
+        *pIndices++ = (U16)(vertexIndex + 1);
+    }
+}
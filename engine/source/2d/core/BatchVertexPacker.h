@@ -0,0 +1,127 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _BATCH_VERTEX_PACKER_H_
+#define _BATCH_VERTEX_PACKER_H_
+
+#ifndef _VECTOR2_H_
+#include "2d/core/Vector2.h"
+#endif
+
+#ifndef _HASHTABLE_H
+#include "collection/hashTable.h"
+#endif
+
+#ifndef _COLOR_H_
+#include "graphics/color.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+/// Interleaved batch vertex.
+struct BatchVertex
+{
+    Vector2     mPosition;
+    Vector2     mTexturePosition;
+    ColorI      mColor;
+};
+
+//-----------------------------------------------------------------------------
+
+/// Stages batched quads and packs them into interleaved vertices grouped by texture.
+///
+/// Quads are staged in submission order along with the texture batch they belong to.
+/// Packing writes each texture batch as a contiguous run of quads (keeping submission
+/// order within a batch) so a batch can be drawn with a single offset into a shared
+/// quad index pattern.  Nothing here touches the render device.
+class BatchVertexPacker
+{
+public:
+    struct TextureBatch
+    {
+        U32     mTextureBinding;
+        U32     mFirstQuad;
+        U32     mQuadCount;
+    };
+
+    typedef Vector<TextureBatch> typeTextureBatchVector;
+
+    /// Indices per quad.
+    static const U32 QuadIndexCount = 6;
+
+private:
+    typedef HashMap<U32, U32> typeTextureBatchMap;
+
+    Vector<BatchVertex>     mQuadVertices;
+    Vector<U32>             mQuadBatches;
+    Vector<U32>             mBatchCursors;
+    U32                     mQuadCapacity;
+    U32                     mQuadCount;
+    bool                    mColored;
+
+    typeTextureBatchVector  mTextureBatches;
+    typeTextureBatchMap     mTextureBatchMap;
+    U32                     mLastBatch;
+
+public:
+    BatchVertexPacker( const U32 quadCapacity );
+    virtual ~BatchVertexPacker() {}
+
+    /// Stage a quad.
+    /// Vertex and textures are indexed as:
+    ///  3 ___ 2
+    ///   |\  |
+    ///   | \ |
+    ///  0| _\|1
+    void addQuad(
+            const U32 textureBinding,
+            const Vector2& vertexPos0,
+            const Vector2& vertexPos1,
+            const Vector2& vertexPos2,
+            const Vector2& vertexPos3,
+            const Vector2& texturePos0,
+            const Vector2& texturePos1,
+            const Vector2& texturePos2,
+            const Vector2& texturePos3,
+            const ColorI& color );
+
+    /// Set whether the staged quads use their colors or not.
+    inline void setColored( const bool colored )                    { mColored = colored; }
+    inline bool getColored( void ) const                            { return mColored; }
+
+    inline U32 getQuadCount( void ) const                           { return mQuadCount; }
+    inline U32 getQuadCapacity( void ) const                        { return mQuadCapacity; }
+    inline bool isFull( void ) const                                { return mQuadCount == mQuadCapacity; }
+    inline const typeTextureBatchVector& getTextureBatches( void ) const { return mTextureBatches; }
+
+    /// Packs the staged quads grouped by texture batch.  Four vertices are written per quad.
+    /// Returns the number of vertices written.
+    U32 pack( BatchVertex* pVertices );
+
+    /// Clears the staged quads.
+    void clear( void );
+
+    /// Writes the triangle indices for consecutive quads.
+    static void buildQuadIndices( U16* pIndices, const U32 quadCount );
+};
+
+#endif // _BATCH_VERTEX_PACKER_H_
@@ -0,0 +1,427 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _COLLISION_BAKER_H_
+#include "2d/core/CollisionBaker.h"
+#endif
+
+#ifndef _SCENE_OBJECT_H_
+#include "2d/sceneobject/SceneObject.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+static S32 QSORT_CALLBACK coordinateSort( const void* a, const void* b )
+{
+    const F32 coordinateA = *(const F32*)a;
+    const F32 coordinateB = *(const F32*)b;
+
+    return coordinateA < coordinateB ? -1 : coordinateA > coordinateB ? 1 : 0;
+}
+
+//-----------------------------------------------------------------------------
+
+// Boundary edge of the rectangle union running between two grid vertices.
+// Directions are +x, +y, -x, -y so a left turn is the next direction.
+struct BoundaryEdge
+{
+    S32     mFrom;
+    S32     mTo;
+    U32     mDirection;
+    bool    mUsed;
+};
+
+//-----------------------------------------------------------------------------
+
+CollisionBaker::CollisionBaker() :
+    mWeldTolerance( b2_linearSlop )
+{
+}
+
+//-----------------------------------------------------------------------------
+
+void CollisionBaker::addRectangle( const b2Vec2& lower, const b2Vec2& upper )
+{
+    b2AABB rectangle;
+    rectangle.lowerBound.Set( getMin( lower.x, upper.x ), getMin( lower.y, upper.y ) );
+    rectangle.upperBound.Set( getMax( lower.x, upper.x ), getMax( lower.y, upper.y ) );
+
+    // Ignore degenerate rectangles.
+    if ( rectangle.upperBound.x - rectangle.lowerBound.x <= mWeldTolerance ||
+         rectangle.upperBound.y - rectangle.lowerBound.y <= mWeldTolerance )
+        return;
+
+    mRectangles.push_back( rectangle );
+}
+
+//-----------------------------------------------------------------------------
+
+void CollisionBaker::addPolyline( const U32 pointCount, const b2Vec2* pPoints )
+{
+    // Sanity!
+    AssertFatal( pPoints != NULL || pointCount == 0, "CollisionBaker::addPolyline() - Cannot use NULL points." );
+
+    if ( pointCount < 2 )
+        return;
+
+    mPolylines.increment();
+    Polyline& polyline = mPolylines.last();
+    polyline.mPoints.setSize( pointCount );
+    dMemcpy( polyline.mPoints.address(), pPoints, pointCount * sizeof(b2Vec2) );
+}
+
+//-----------------------------------------------------------------------------
+
+void CollisionBaker::clear( void )
+{
+    mRectangles.clear();
+    mPolylines.clear();
+}
+
+//-----------------------------------------------------------------------------
+
+U32 CollisionBaker::bake( SceneObject* pSceneObject )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(CollisionBaker_Bake);
+
+    // Sanity!
+    AssertFatal( pSceneObject != NULL, "CollisionBaker::bake() - Cannot bake into a NULL object." );
+
+    return bakeRectangles( pSceneObject ) + bakePolylines( pSceneObject );
+}
+
+//-----------------------------------------------------------------------------
+
+U32 CollisionBaker::bakeRectangles( SceneObject* pSceneObject )
+{
+    if ( mRectangles.size() == 0 )
+        return 0;
+
+    // Gather the distinct rectangle edge coordinates on each axis.
+    Vector<F32> coordinatesX;
+    Vector<F32> coordinatesY;
+    coordinatesX.reserve( mRectangles.size() * 2 );
+    coordinatesY.reserve( mRectangles.size() * 2 );
+    for ( S32 index = 0; index < mRectangles.size(); ++index )
+    {
+        const b2AABB& rectangle = mRectangles[index];
+        coordinatesX.push_back( rectangle.lowerBound.x );
+        coordinatesX.push_back( rectangle.upperBound.x );
+        coordinatesY.push_back( rectangle.lowerBound.y );
+        coordinatesY.push_back( rectangle.upperBound.y );
+    }
+
+    Vector<F32>* pAxes[2] = { &coordinatesX, &coordinatesY };
+    for ( U32 axis = 0; axis < 2; ++axis )
+    {
+        Vector<F32>& coordinates = *pAxes[axis];
+        dQsort( coordinates.address(), coordinates.size(), sizeof(F32), coordinateSort );
+
+        // Weld coordinates within tolerance of the previous distinct coordinate.
+        S32 distinctCount = 1;
+        for ( S32 index = 1; index < coordinates.size(); ++index )
+        {
+            if ( coordinates[index] - coordinates[distinctCount-1] > mWeldTolerance )
+                coordinates[distinctCount++] = coordinates[index];
+        }
+        coordinates.setSize( distinctCount );
+    }
+
+    // Mark the cells of the compressed grid covered by any rectangle.
+    const S32 vertexWidth = coordinatesX.size();
+    const S32 vertexHeight = coordinatesY.size();
+    const S32 cellWidth = vertexWidth - 1;
+    const S32 cellHeight = vertexHeight - 1;
+
+    Vector<U8> cells;
+    cells.setSize( cellWidth * cellHeight );
+    dMemset( cells.address(), 0, cells.size() );
+
+    for ( S32 index = 0; index < mRectangles.size(); ++index )
+    {
+        const b2AABB& rectangle = mRectangles[index];
+        const S32 minX = findCoordinate( coordinatesX, rectangle.lowerBound.x );
+        const S32 maxX = findCoordinate( coordinatesX, rectangle.upperBound.x );
+        const S32 minY = findCoordinate( coordinatesY, rectangle.lowerBound.y );
+        const S32 maxY = findCoordinate( coordinatesY, rectangle.upperBound.y );
+
+        for ( S32 y = minY; y < maxY; ++y )
+        {
+            U8* pCell = cells.address() + y * cellWidth + minX;
+            for ( S32 x = minX; x < maxX; ++x )
+                *pCell++ = 1;
+        }
+    }
+
+    // Find the edges between covered and uncovered cells, wound with the covered side on the left.
+    Vector<BoundaryEdge> edges;
+    Vector<S32> outgoingEdges;
+    outgoingEdges.setSize( vertexWidth * vertexHeight * 2 );
+    dMemset( outgoingEdges.address(), -1, outgoingEdges.size() * sizeof(S32) );
+
+    for ( S32 y = 0; y < cellHeight; ++y )
+    {
+        for ( S32 x = 0; x < cellWidth; ++x )
+        {
+            if ( cells[y * cellWidth + x] == 0 )
+                continue;
+
+            const S32 lowerLeft = y * vertexWidth + x;
+            const S32 lowerRight = lowerLeft + 1;
+            const S32 upperLeft = lowerLeft + vertexWidth;
+            const S32 upperRight = upperLeft + 1;
+
+            BoundaryEdge sides[4] =
+            {
+                { lowerLeft, lowerRight, 0, y == 0 || cells[(y-1) * cellWidth + x] == 0 },
+                { lowerRight, upperRight, 1, x == cellWidth-1 || cells[y * cellWidth + x + 1] == 0 },
+                { upperRight, upperLeft, 2, y == cellHeight-1 || cells[(y+1) * cellWidth + x] == 0 },
+                { upperLeft, lowerLeft, 3, x == 0 || cells[y * cellWidth + x - 1] == 0 },
+            };
+
+            for ( U32 side = 0; side < 4; ++side )
+            {
+                // The used flag temporarily records whether the side is on the boundary.
+                if ( !sides[side].mUsed )
+                    continue;
+
+                sides[side].mUsed = false;
+                const S32 slot = outgoingEdges[sides[side].mFrom * 2] == -1 ? 0 : 1;
+                outgoingEdges[sides[side].mFrom * 2 + slot] = edges.size();
+                edges.push_back( sides[side] );
+            }
+        }
+    }
+
+    // Trace each boundary loop, keeping only the vertices where the direction changes.
+    U32 shapeCount = 0;
+    Vector<b2Vec2> points;
+    for ( S32 startEdge = 0; startEdge < edges.size(); ++startEdge )
+    {
+        if ( edges[startEdge].mUsed )
+            continue;
+
+        points.clear();
+        S32 edgeIndex = startEdge;
+        U32 previousDirection = U32_MAX;
+        while ( !edges[edgeIndex].mUsed )
+        {
+            BoundaryEdge& edge = edges[edgeIndex];
+            edge.mUsed = true;
+
+            if ( edge.mDirection != previousDirection )
+                points.push_back( b2Vec2( coordinatesX[edge.mFrom % vertexWidth], coordinatesY[edge.mFrom / vertexWidth] ) );
+            previousDirection = edge.mDirection;
+
+            // Where regions touch at a corner there are two ways on so turn left to stay on the same region.
+            const S32 firstEdge = outgoingEdges[edge.mTo * 2];
+            const S32 secondEdge = outgoingEdges[edge.mTo * 2 + 1];
+            edgeIndex = firstEdge;
+            if ( secondEdge != -1 && edges[secondEdge].mDirection == ((edge.mDirection + 1) & 3) )
+                edgeIndex = secondEdge;
+        }
+
+        // A loop started part-way along a straight run has a redundant first point which is simplified away.
+        if ( createChain( pSceneObject, points, true ) != -1 )
+            shapeCount++;
+    }
+
+    return shapeCount;
+}
+
+//-----------------------------------------------------------------------------
+
+U32 CollisionBaker::bakePolylines( SceneObject* pSceneObject )
+{
+    if ( mPolylines.size() == 0 )
+        return 0;
+
+    const F32 toleranceSquared = mWeldTolerance * mWeldTolerance;
+
+    Vector<bool> consumed;
+    consumed.setSize( mPolylines.size() );
+    for ( S32 index = 0; index < consumed.size(); ++index )
+        consumed[index] = false;
+
+    U32 shapeCount = 0;
+    Vector<b2Vec2> points;
+    for ( S32 index = 0; index < mPolylines.size(); ++index )
+    {
+        if ( consumed[index] )
+            continue;
+
+        consumed[index] = true;
+        points = mPolylines[index].mPoints;
+
+        // Grow the chain from either end with any polyline sharing that end-point until it closes or nothing more joins it.
+        bool loop = false;
+        for ( U32 end = 0; end < 2 && !loop; ++end )
+        {
+            bool joined = true;
+            while ( joined && !loop )
+            {
+                joined = false;
+                const b2Vec2 endPoint = end == 0 ? points.last() : points.first();
+
+                for ( S32 other = index + 1; other < mPolylines.size(); ++other )
+                {
+                    if ( consumed[other] )
+                        continue;
+
+                    const Vector<b2Vec2>& otherPoints = mPolylines[other].mPoints;
+                    const bool matchFirst = b2DistanceSquared( otherPoints.first(), endPoint ) <= toleranceSquared;
+                    const bool matchLast = !matchFirst && b2DistanceSquared( otherPoints.last(), endPoint ) <= toleranceSquared;
+                    if ( !matchFirst && !matchLast )
+                        continue;
+
+                    // Join without repeating the shared point.
+                    const S32 count = otherPoints.size();
+                    for ( S32 pointIndex = 1; pointIndex < count; ++pointIndex )
+                    {
+                        const b2Vec2& point = otherPoints[matchFirst ? pointIndex : count - 1 - pointIndex];
+                        if ( end == 0 )
+                            points.push_back( point );
+                        else
+                            points.push_front( point );
+                    }
+
+                    consumed[other] = true;
+                    joined = true;
+                    loop = b2DistanceSquared( points.first(), points.last() ) <= toleranceSquared;
+                    break;
+                }
+            }
+        }
+
+        // A polyline may also have been drawn closed.
+        if ( !loop && points.size() > 3 )
+            loop = b2DistanceSquared( points.first(), points.last() ) <= toleranceSquared;
+
+        if ( loop )
+            points.pop_back();
+
+        if ( createChain( pSceneObject, points, loop ) != -1 )
+            shapeCount++;
+    }
+
+    return shapeCount;
+}
+
+//-----------------------------------------------------------------------------
+
+S32 CollisionBaker::findCoordinate( const Vector<F32>& coordinates, const F32 value ) const
+{
+    // Binary search for the first welded coordinate that is not below the value.
+    S32 lower = 0;
+    S32 upper = coordinates.size() - 1;
+    const F32 target = value - mWeldTolerance;
+    while ( lower < upper )
+    {
+        const S32 middle = (lower + upper) / 2;
+        if ( coordinates[middle] < target )
+            lower = middle + 1;
+        else
+            upper = middle;
+    }
+
+    return lower;
+}
+
+//-----------------------------------------------------------------------------
+
+void CollisionBaker::simplifyPoints( Vector<b2Vec2>& points, const bool loop ) const
+{
+    const F32 toleranceSquared = mWeldTolerance * mWeldTolerance;
+
+    // Remove repeated points.
+    S32 count = 0;
+    for ( S32 index = 0; index < points.size(); ++index )
+    {
+        if ( count == 0 || b2DistanceSquared( points[index], points[count-1] ) > toleranceSquared )
+            points[count++] = points[index];
+    }
+    if ( loop && count > 1 && b2DistanceSquared( points[0], points[count-1] ) <= toleranceSquared )
+        count--;
+    points.setSize( count );
+
+    // Remove vertices lying on the line between their neighbours and heading the same way.
+    bool removed = true;
+    while ( removed && points.size() > (loop ? 3 : 2) )
+    {
+        removed = false;
+        const S32 pointCount = points.size();
+        count = 0;
+        for ( S32 index = 0; index < pointCount; ++index )
+        {
+            const b2Vec2 current = points[index];
+
+            // The ends of an open chain always stay.
+            if ( !loop && (index == 0 || index == pointCount-1) )
+            {
+                points[count++] = current;
+                continue;
+            }
+
+            const b2Vec2 previous = count > 0 ? points[count-1] : points[pointCount-1];
+            const b2Vec2 next = points[(index + 1) % pointCount];
+
+            const b2Vec2 span = next - previous;
+            const F32 spanLength = span.Length();
+            const bool collinear =
+                spanLength > mWeldTolerance &&
+                mFabs( b2Cross( current - previous, span ) ) <= mWeldTolerance * spanLength &&
+                b2Dot( current - previous, next - current ) > 0.0f;
+
+            // Keep enough points for a valid chain.
+            if ( collinear && pointCount - (index - count) > (loop ? 3 : 2) )
+            {
+                removed = true;
+                continue;
+            }
+
+            points[count++] = current;
+        }
+        points.setSize( count );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+S32 CollisionBaker::createChain( SceneObject* pSceneObject, const Vector<b2Vec2>& points, const bool loop ) const
+{
+    Vector<b2Vec2> chainPoints = points;
+    simplifyPoints( chainPoints, loop );
+
+    if ( chainPoints.size() < (loop ? 3 : 2) )
+        return -1;
+
+    if ( !loop )
+        return pSceneObject->createChainCollisionShape( chainPoints.size(), chainPoints.address() );
+
+    // Close the loop and give its ends their neighbours so nothing catches on the seam.
+    const b2Vec2 previous = chainPoints.last();
+    const b2Vec2 next = chainPoints[1];
+    chainPoints.push_back( chainPoints.first() );
+
+    return pSceneObject->createChainCollisionShape( chainPoints.size(), chainPoints.address(), true, true, previous, next );
+}
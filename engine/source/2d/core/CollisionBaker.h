@@ -0,0 +1,80 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _COLLISION_BAKER_H_
+#define _COLLISION_BAKER_H_
+
+#ifndef _UTILITY_H_
+#include "2d/core/Utility.h"
+#endif
+
+#ifndef BOX2D_H
+#include "box2d/Box2D.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+/// Welds static collision geometry into as few chain shapes as possible.
+///
+/// Axis-aligned rectangles are unioned and their outline traced into closed chains so
+/// a solid region produces one loop whatever the number of rectangles it was made from.
+/// Polylines sharing end-points are joined into longer chains.  Collinear vertices are
+/// removed from both so each straight run of wall is a single edge.
+class CollisionBaker
+{
+private:
+    struct Polyline
+    {
+        Vector<b2Vec2> mPoints;
+    };
+
+    Vector<b2AABB>      mRectangles;
+    Vector<Polyline>    mPolylines;
+    F32                 mWeldTolerance;
+
+public:
+    CollisionBaker();
+    virtual ~CollisionBaker() {}
+
+    /// Geometry.
+    void addRectangle( const b2Vec2& lower, const b2Vec2& upper );
+    void addPolyline( const U32 pointCount, const b2Vec2* pPoints );
+    void clear( void );
+    inline U32 getRectangleCount( void ) const              { return (U32)mRectangles.size(); }
+    inline U32 getPolylineCount( void ) const               { return (U32)mPolylines.size(); }
+
+    /// Points closer than this are considered the same point.
+    inline void setWeldTolerance( const F32 tolerance )     { mWeldTolerance = tolerance; }
+    inline F32 getWeldTolerance( void ) const               { return mWeldTolerance; }
+
+    /// Creates chain collision shapes on the object.  Returns the number of shapes created.
+    U32 bake( SceneObject* pSceneObject );
+
+private:
+    U32 bakeRectangles( SceneObject* pSceneObject );
+    U32 bakePolylines( SceneObject* pSceneObject );
+    S32 findCoordinate( const Vector<F32>& coordinates, const F32 value ) const;
+    void simplifyPoints( Vector<b2Vec2>& points, const bool loop ) const;
+    S32 createChain( SceneObject* pSceneObject, const Vector<b2Vec2>& points, const bool loop ) const;
+};
+
+#endif // _COLLISION_BAKER_H_
@@ -408,6 +408,20 @@ bool ImageFrameProviderCore::playAnimation( const AssetPtr<AnimationAsset>& anim
     // Debug Profiling.
     PROFILE_SCOPE(AnimationController_PlayAnimation);
 
+    // Play the animation.
+    if ( playAnimation( animationAsset, CoreMath::gRandomGenerator ) )
+        return true;
+
+    // Warn.
+    Con::warnf( "ImageFrameProviderCore::playAnimation() - Cannot play AnimationAsset '%s' - Animation has no validated frames!", animationAsset.getAssetId() );
+
+    return false;
+}
+
+//-----------------------------------------------------------------------------
+
+bool ImageFrameProviderCore::playAnimation( const AssetPtr<AnimationAsset>& animationAsset, RandomGeneratorBase& random )
+{
     // Stop animation.
     stopAnimation();
 
@@ -421,15 +435,15 @@ bool ImageFrameProviderCore::playAnimation( const AssetPtr<AnimationAsset>& anim
     // Fetch validated frames.
     const Vector<S32>& validatedFrames = animationAsset->getValidatedAnimationFrames();
 
-    // Check we've got some frames.
+    // Finish if there are no frames.
+    // NOTE:-   The caller warns as this can run on a worker thread.
     if ( validatedFrames.size() == 0 )
-    {
-        Con::warnf( "ImageFrameProviderCore::playAnimation() - Cannot play AnimationAsset '%s' - Animation has no validated frames!", mpAnimationAsset->getAssetId() );
         return false;
-    }
 
-    // Set animation asset.
-    mpAnimationAsset->setAssetId( animationAsset.getAssetId() );
+    // Set animation asset if it's not the one we already reference.
+    // NOTE: Particles reference their emitters animation asset directly so this avoids touching the asset database.
+    if ( mpAnimationAsset != &animationAsset )
+        mpAnimationAsset->setAssetId( animationAsset.getAssetId() );
 
     // Set Maximum Frame Index.
     mMaxFrameIndex = validatedFrames.size()-1;
@@ -444,7 +458,7 @@ bool ImageFrameProviderCore::playAnimation( const AssetPtr<AnimationAsset>& anim
     if ( (*mpAnimationAsset)->getRandomStart() )
     {
         // Yes, so calculate start time.
-        mCurrentTime = CoreMath::mGetRandomF(0.0f, mTotalIntegrationTime*0.999f);
+        mCurrentTime = random.randRangeF(0.0f, mTotalIntegrationTime*0.999f);
     }
     else
     {
@@ -456,7 +470,7 @@ bool ImageFrameProviderCore::playAnimation( const AssetPtr<AnimationAsset>& anim
     mAnimationFinished = false;
 
     // Do an initial animation update.
-    updateAnimation(0.0f);
+    stepAnimation(0.0f);
 
     // Return Okay.
     return true;
@@ -469,6 +483,13 @@ bool ImageFrameProviderCore::updateAnimation( const F32 elapsedTime )
     // Debug Profiling.
     PROFILE_SCOPE(AnimationController_UpdateAnimation);
 
+    return stepAnimation( elapsedTime );
+}
+
+//-----------------------------------------------------------------------------
+
+bool ImageFrameProviderCore::stepAnimation( const F32 elapsedTime )
+{
     // Finish if animation asset is not valid.
     if ( mpAnimationAsset->isNull() || (*mpAnimationAsset)->getImage().isNull() )
         return false;
@@ -51,6 +51,10 @@
 #include "gui/guiControl.h"
 #endif
 
+#ifndef _MRANDOM_H_
+#include "math/mRandom.h"
+#endif
+
 ///-----------------------------------------------------------------------------
 
 class ImageFrameProviderCore :
@@ -96,6 +100,9 @@ public:
     virtual void setProcessTicks( bool tick  ) { Tickable::setProcessTicks( mSelfTick ? tick : false ); }
     bool updateAnimation( const F32 elapsedTime );
 
+    /// Unprofiled animation update that can run on a worker thread.
+    bool stepAnimation( const F32 elapsedTime );
+
     virtual bool validRender( void ) const;
 
     virtual void render(
@@ -123,6 +130,10 @@ public:
     void setAnimationTimeScale( const F32 scale ) { mAnimationTimeScale = scale; }
     inline F32 getAnimationTimeScale( void ) const { return mAnimationTimeScale; }
     bool playAnimation( const AssetPtr<AnimationAsset>& animationAsset);
+
+    /// Plays the animation without profiling or warning so it can run on a worker thread.
+    /// Returns false if the animation has no validated frames.
+    bool playAnimation( const AssetPtr<AnimationAsset>& animationAsset, RandomGeneratorBase& random );
     inline void pauseAnimation( const bool animationPaused ) { mAnimationPaused = animationPaused; }
     inline void stopAnimation( void ) { mAnimationFinished = true; mAnimationPaused = false; }
     inline void resetAnimationTime( void ) { mCurrentTime = 0.0f; }
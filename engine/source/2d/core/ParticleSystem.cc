@@ -45,90 +45,318 @@ void ParticleSystem::destroy( void )
 
 //------------------------------------------------------------------------------
 
-ParticleSystem::ParticleSystem() :
-                    mParticlePoolBlockSize(512)
+ParticleSystem::ParticleSystem()
 {
-    // Reset the free particle head.
-    mpFreeParticleNodes = NULL;
-
-    // Reset the active particle count.
-    mActiveParticleCount = 0;
 }
 
 //------------------------------------------------------------------------------
 
 ParticleSystem::~ParticleSystem()
 {
-    // Destroy all the particle pool blocks.
-    for ( U32 n = 0; n < (U32)mParticlePool.size(); n++ )
-        delete [] mParticlePool[n];
+    // Sanity!
+    AssertWarn( mParticleStores.size() == 0, "ParticleSystem::~ParticleSystem() - Particle stores are still registered." );
+
+    // Clear the particle stores.
+    mParticleStores.clear();
+}
 
-    // Clear the particle pool.
-    mParticlePool.clear();
+//------------------------------------------------------------------------------
 
-    // Reset the free particle head.
-    mpFreeParticleNodes = NULL;
+void ParticleSystem::registerParticleStore( ParticleStore* pParticleStore )
+{
+    mParticleStores.push_back( pParticleStore );
 }
 
 //------------------------------------------------------------------------------
 
-ParticleSystem::ParticleNode* ParticleSystem::createParticle( void )
+void ParticleSystem::unregisterParticleStore( ParticleStore* pParticleStore )
 {
-    // Have we got any free particle nodes?
-    if ( mpFreeParticleNodes == NULL )
+    for ( S32 n = 0; n < mParticleStores.size(); ++n )
     {
-        // No, so generate a new free pool block.
-        ParticleNode* pFreePoolBlock = new ParticleNode[mParticlePoolBlockSize];
+        if ( mParticleStores[n] != pParticleStore )
+            continue;
+
+        mParticleStores.erase_fast( n );
+        return;
+    }
+}
+
+//------------------------------------------------------------------------------
+
+U32 ParticleSystem::getActiveParticleCount( void ) const
+{
+    U32 activeParticleCount = 0;
+    for ( S32 n = 0; n < mParticleStores.size(); ++n )
+        activeParticleCount += mParticleStores[n]->getParticleCount();
+
+    return activeParticleCount;
+}
+
+//------------------------------------------------------------------------------
+
+U32 ParticleSystem::getAllocatedParticleCount( void ) const
+{
+    U32 allocatedParticleCount = 0;
+    for ( S32 n = 0; n < mParticleStores.size(); ++n )
+        allocatedParticleCount += mParticleStores[n]->getParticleCapacity();
+
+    return allocatedParticleCount;
+}
+
+//------------------------------------------------------------------------------
+
+F32* ParticleSystem::ParticleStore::* const ParticleSystem::ParticleStore::FloatComponents[] =
+{
+    &ParticleSystem::ParticleStore::mParticleAge,
+    &ParticleSystem::ParticleStore::mParticleLifetime,
+    &ParticleSystem::ParticleStore::mPositionX,
+    &ParticleSystem::ParticleStore::mPositionY,
+    &ParticleSystem::ParticleStore::mVelocityX,
+    &ParticleSystem::ParticleStore::mVelocityY,
+    &ParticleSystem::ParticleStore::mOrientationAngle,
+    &ParticleSystem::ParticleStore::mRotationCos,
+    &ParticleSystem::ParticleStore::mRotationSin,
+    &ParticleSystem::ParticleStore::mRenderSizeX,
+    &ParticleSystem::ParticleStore::mRenderSizeY,
+    &ParticleSystem::ParticleStore::mRenderSpeed,
+    &ParticleSystem::ParticleStore::mRenderSpin,
+    &ParticleSystem::ParticleStore::mRenderFixedForce,
+    &ParticleSystem::ParticleStore::mRenderRandomMotion,
+    &ParticleSystem::ParticleStore::mRed,
+    &ParticleSystem::ParticleStore::mGreen,
+    &ParticleSystem::ParticleStore::mBlue,
+    &ParticleSystem::ParticleStore::mAlpha,
+    &ParticleSystem::ParticleStore::mSizeX,
+    &ParticleSystem::ParticleStore::mSizeY,
+    &ParticleSystem::ParticleStore::mSpeed,
+    &ParticleSystem::ParticleStore::mSpin,
+    &ParticleSystem::ParticleStore::mFixedForce,
+    &ParticleSystem::ParticleStore::mRandomMotion,
+    &ParticleSystem::ParticleStore::mPreTickPositionX,
+    &ParticleSystem::ParticleStore::mPreTickPositionY,
+};
+
+//------------------------------------------------------------------------------
+
+ParticleSystem::ParticleStore::ParticleStore() :
+    mRenderOOBB( NULL ),
+    mParticleLifeAge( NULL ),
+    mFrameProviders( NULL ),
+    mParticleCount( 0 ),
+    mParticleCapacity( 0 ),
+    mpStorage( NULL ),
+    mpSurvivors( NULL )
+{
+    // Reset the float components.
+    for ( U32 n = 0; n < sizeof(FloatComponents)/sizeof(FloatComponents[0]); ++n )
+        this->*FloatComponents[n] = NULL;
+
+    // Register with the particle system.
+    if ( ParticleSystem::Instance != NULL )
+        ParticleSystem::Instance->registerParticleStore( this );
+}
+
+//------------------------------------------------------------------------------
+
+ParticleSystem::ParticleStore::~ParticleStore()
+{
+    // Free all the particles.
+    freeAllParticles();
+
+    // Unregister from the particle system.
+    if ( ParticleSystem::Instance != NULL )
+        ParticleSystem::Instance->unregisterParticleStore( this );
+
+    // Destroy the frame provider blocks.
+    for ( S32 n = 0; n < mFrameProviderBlocks.size(); ++n )
+        delete [] mFrameProviderBlocks[n];
+
+    // Free the storage.
+    if ( mpStorage != NULL )
+        dFree( mpStorage );
+}
+
+//------------------------------------------------------------------------------
+
+U32 ParticleSystem::ParticleStore::createParticle( void )
+{
+    // Grow the storage if it's full.
+    ensureCapacity( mParticleCount + 1 );
 
-        // Store new free pool block.
-        mParticlePool.push_back( pFreePoolBlock );
+    // Fetch the particle index.
+    // NOTE:-   The frame provider in this slot is already free and reset.
+    const U32 particleIndex = mParticleCount++;
 
-        // Initialise Free Pool Block.
-        for ( U32 n = 0; n < (mParticlePoolBlockSize-1); n++ )
+    // Reset the motion.
+    // NOTE:-   Single particles are never given any motion so we must ensure it's at rest.
+    mVelocityX[particleIndex] = 0.0f;
+    mVelocityY[particleIndex] = 0.0f;
+    mSpeed[particleIndex] = 0.0f;
+    mRandomMotion[particleIndex] = 0.0f;
+
+    return particleIndex;
+}
+
+//------------------------------------------------------------------------------
+
+U32 ParticleSystem::ParticleStore::freeExpiredParticles( const bool singleParticle )
+{
+    // Fetch the particle count.
+    const U32 particleCount = mParticleCount;
+
+    const F32* pParticleAge = mParticleAge;
+    const F32* pParticleLifetime = mParticleLifetime;
+    U32* pSurvivors = mpSurvivors;
+    U32 survivorCount = 0;
+
+    // Find the surviving particles.
+    for ( U32 particleIndex = 0; particleIndex < particleCount; ++particleIndex )
+    {
+        // Has the particle expired?
+        // NOTE:-   If we're in single-particle mode then the particle lives as long as the particle player does.
+        if (    ( !singleParticle && pParticleAge[particleIndex] > pParticleLifetime[particleIndex] ) ||
+                ( mIsZero(pParticleLifetime[particleIndex]) ) )
+        {
+            // Yes, so deallocate the assets and reset the frame provider.
+            ImageFrameProviderCore* pFrameProvider = mFrameProviders[particleIndex];
+            pFrameProvider->deallocateAssets();
+            pFrameProvider->resetState();
+        }
+        else
         {
-            pFreePoolBlock[n].mPreviousNode = NULL;
-            pFreePoolBlock[n].mNextNode     = pFreePoolBlock+n+1;
+            // No, so note the survivor.
+            pSurvivors[survivorCount++] = particleIndex;
         }
+    }
+
+    // Finish if nothing expired.
+    if ( survivorCount == particleCount )
+        return 0;
 
-        // Insert Last Node Preceding any existing free nodes.
-        pFreePoolBlock[mParticlePoolBlockSize-1].mPreviousNode = NULL;
-        pFreePoolBlock[mParticlePoolBlockSize-1].mNextNode = mpFreeParticleNodes;
+    // Find the first survivor that needs to move.
+    U32 firstMoved = 0;
+    while ( firstMoved < survivorCount && pSurvivors[firstMoved] == firstMoved )
+        ++firstMoved;
 
-        // Set Free References.
-        mpFreeParticleNodes = pFreePoolBlock;
+    // Compact the float components.
+    // NOTE:-   We keep the survivors in order so that oldest/newest rendering order is preserved.
+    for ( U32 n = 0; n < sizeof(FloatComponents)/sizeof(FloatComponents[0]); ++n )
+    {
+        F32* pComponent = this->*FloatComponents[n];
+        for ( U32 survivorIndex = firstMoved; survivorIndex < survivorCount; ++survivorIndex )
+            pComponent[survivorIndex] = pComponent[pSurvivors[survivorIndex]];
     }
 
-    // Fetch a free node,
-    ParticleNode* pFreeParticleNode = mpFreeParticleNodes;
+    // Compact the render OOBB and frame providers.
+    // NOTE:-   Frame providers are swapped so that the expired ones end up in the free slots.
+    for ( U32 survivorIndex = firstMoved; survivorIndex < survivorCount; ++survivorIndex )
+    {
+        const U32 particleIndex = pSurvivors[survivorIndex];
+        dMemcpy( mRenderOOBB + survivorIndex*4, mRenderOOBB + particleIndex*4, sizeof(Vector2)*4 );
+        ImageFrameProviderCore* pFrameProvider = mFrameProviders[survivorIndex];
+        mFrameProviders[survivorIndex] = mFrameProviders[particleIndex];
+        mFrameProviders[particleIndex] = pFrameProvider;
+    }
 
-    // Set the new free node reference.
-    mpFreeParticleNodes = mpFreeParticleNodes->mNextNode;
+    // Set the new particle count.
+    mParticleCount = survivorCount;
 
-    // Reset any previous or next node references.
-    pFreeParticleNode->mNextNode        = NULL;
-    pFreeParticleNode->mPreviousNode    = NULL;
+    return particleCount - survivorCount;
+}
 
-    // Increase the active particle count.
-    mActiveParticleCount++;
+//------------------------------------------------------------------------------
 
-    return pFreeParticleNode;
+void ParticleSystem::ParticleStore::freeAllParticles( void )
+{
+    // Free all the frame providers.
+    for ( U32 particleIndex = 0; particleIndex < mParticleCount; ++particleIndex )
+    {
+        ImageFrameProviderCore* pFrameProvider = mFrameProviders[particleIndex];
+        pFrameProvider->deallocateAssets();
+        pFrameProvider->resetState();
+    }
+
+    // Reset the particle count.
+    mParticleCount = 0;
 }
 
 //------------------------------------------------------------------------------
 
-void ParticleSystem::freeParticle( ParticleNode* pParticleNode )
+void ParticleSystem::ParticleStore::ensureCapacity( const U32 particleCount )
 {
-    // Reset the particle.
-    pParticleNode->resetState();
-
-    // Remove the previous node reference.
-    pParticleNode->mPreviousNode = NULL;
-    
-    // Insert the node into the free pool.
-    pParticleNode->mNextNode = mpFreeParticleNodes;
-    mpFreeParticleNodes = pParticleNode;
+    // Finish if we already have the capacity.
+    if ( particleCount <= mParticleCapacity )
+        return;
 
-    // Decrease the active particle count.
-    mActiveParticleCount--;
+    // Grow the storage geometrically.
+    reserve( getMax( particleCount, getMax( mParticleCapacity * 2, (U32)64 ) ) );
 }
 
+//------------------------------------------------------------------------------
+
+void ParticleSystem::ParticleStore::reserve( const U32 particleCapacity )
+{
+    // Round the capacity up so that each component array stays 16-byte aligned.
+    const U32 capacity = (particleCapacity + 3) & ~3;
+
+    // Finish if we already have the capacity.
+    if ( capacity <= mParticleCapacity )
+        return;
+
+    const U32 floatComponentCount = sizeof(FloatComponents)/sizeof(FloatComponents[0]);
+
+    // Calculate the component sizes.
+    const dsize_t floatComponentSize = capacity * sizeof(F32);
+    const dsize_t renderOOBBSize = capacity * 4 * sizeof(Vector2);
+    const dsize_t frameProvidersSize = capacity * sizeof(ImageFrameProviderCore*);
+    const dsize_t survivorsSize = capacity * sizeof(U32);
+
+    // Allocate the new storage.
+    U8* pStorage = (U8*)dMalloc( floatComponentSize * (floatComponentCount + 1) + renderOOBBSize + frameProvidersSize + survivorsSize );
+    U8* pCursor = pStorage;
+
+    // Move the float components.
+    for ( U32 n = 0; n < floatComponentCount; ++n )
+    {
+        F32* pComponent = (F32*)pCursor;
+        if ( mParticleCount > 0 )
+            dMemcpy( pComponent, this->*FloatComponents[n], mParticleCount * sizeof(F32) );
+        this->*FloatComponents[n] = pComponent;
+        pCursor += floatComponentSize;
+    }
+
+    // Move the render OOBB.
+    Vector2* pRenderOOBB = (Vector2*)pCursor;
+    if ( mParticleCount > 0 )
+        dMemcpy( pRenderOOBB, mRenderOOBB, mParticleCount * 4 * sizeof(Vector2) );
+    mRenderOOBB = pRenderOOBB;
+    pCursor += renderOOBBSize;
+
+    // Set the normalized age scratch.
+    mParticleLifeAge = (F32*)pCursor;
+    pCursor += floatComponentSize;
+
+    // Move the frame providers.
+    ImageFrameProviderCore** pFrameProviders = (ImageFrameProviderCore**)pCursor;
+    if ( mParticleCapacity > 0 )
+        dMemcpy( pFrameProviders, mFrameProviders, mParticleCapacity * sizeof(ImageFrameProviderCore*) );
+    mFrameProviders = pFrameProviders;
+    pCursor += frameProvidersSize;
+
+    // Allocate a frame provider block for the new slots.
+    ImageFrameProviderCore* pFrameProviderBlock = new ImageFrameProviderCore[capacity - mParticleCapacity];
+    mFrameProviderBlocks.push_back( pFrameProviderBlock );
+    for ( U32 n = mParticleCapacity; n < capacity; ++n )
+        mFrameProviders[n] = pFrameProviderBlock + (n - mParticleCapacity);
+
+    // Set the survivors scratch.
+    mpSurvivors = (U32*)pCursor;
+
+    // Free the old storage.
+    if ( mpStorage != NULL )
+        dFree( mpStorage );
+
+    // Set the new storage.
+    mpStorage = pStorage;
+    mParticleCapacity = capacity;
+}
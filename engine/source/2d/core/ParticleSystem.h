@@ -32,59 +32,83 @@
 class ParticleSystem
 {
 public:
-    /// Particle node.
-    struct ParticleNode : public IFactoryObjectReset
+    /// Particle store.
+    /// Particles are held as a structure-of-arrays in the order they were created (oldest first).
+    class ParticleStore
     {
-        /// Particle Node Linkages.
-        ParticleNode*           mPreviousNode;
-        ParticleNode*           mNextNode;
-
-        /// Suppress Movement.
-        bool                    mSuppressMovement;
-
+    public:
         /// Particle Components.
-        F32                     mParticleLifetime;
-        F32                     mParticleAge;
-        Vector2                 mPosition;
-        Vector2                 mVelocity;
-        F32                     mOrientationAngle;
-        Vector2                 mRenderOOBB[4];
-        b2Transform             mTransform;
-        ImageFrameProviderCore  mFrameProvider;
+        F32*                        mParticleAge;
+        F32*                        mParticleLifetime;
+        F32*                        mPositionX;
+        F32*                        mPositionY;
+        F32*                        mVelocityX;
+        F32*                        mVelocityY;
+        F32*                        mOrientationAngle;
+        F32*                        mRotationCos;
+        F32*                        mRotationSin;
 
         /// Render Properties.
-        Vector2                 mRenderSize;
-        F32                     mRenderSpeed;
-        F32                     mRenderSpin;
-        F32                     mRenderFixedForce;
-        F32                     mRenderRandomMotion;
+        F32*                        mRenderSizeX;
+        F32*                        mRenderSizeY;
+        F32*                        mRenderSpeed;
+        F32*                        mRenderSpin;
+        F32*                        mRenderFixedForce;
+        F32*                        mRenderRandomMotion;
+        F32*                        mRed;
+        F32*                        mGreen;
+        F32*                        mBlue;
+        F32*                        mAlpha;
 
         /// Base Properties.
-        Vector2                 mSize;
-        F32                     mSpeed;
-        F32                     mSpin;
-        F32                     mFixedForce;
-        F32                     mRandomMotion;
-        ColorF                  mColor;    
+        F32*                        mSizeX;
+        F32*                        mSizeY;
+        F32*                        mSpeed;
+        F32*                        mSpin;
+        F32*                        mFixedForce;
+        F32*                        mRandomMotion;
 
         /// Interpolated Tick Position.
-        Vector2                 mPreTickPosition;
-        Vector2                 mPostTickPosition;
-        Vector2                 mRenderTickPosition;
+        F32*                        mPreTickPositionX;
+        F32*                        mPreTickPositionY;
+
+        /// Render OOBB (four vertices per particle).
+        Vector2*                    mRenderOOBB;
+
+        /// Normalized particle age scratch (not preserved when particles expire).
+        F32*                        mParticleLifeAge;
+
+        /// Frame providers.
+        /// NOTE:-   Slots beyond the particle count hold this stores free frame providers.
+        ImageFrameProviderCore**    mFrameProviders;
+
+    private:
+        U32                         mParticleCount;
+        U32                         mParticleCapacity;
+        U8*                         mpStorage;
+        U32*                        mpSurvivors;
+        Vector<ImageFrameProviderCore*> mFrameProviderBlocks;
+
+        static F32* ParticleStore::* const FloatComponents[];
+
+    public:
+        ParticleStore();
+        ~ParticleStore();
+
+        inline U32 getParticleCount( void ) const { return mParticleCount; }
+        inline U32 getParticleCapacity( void ) const { return mParticleCapacity; }
 
-        ParticleNode() { constructInPlace<ImageFrameProviderCore>(&mFrameProvider); resetState(); }
+        U32 createParticle( void );
+        U32 freeExpiredParticles( const bool singleParticle );
+        void freeAllParticles( void );
+        void ensureCapacity( const U32 particleCount );
 
-        virtual void resetState( void )
-        {
-            mFrameProvider.resetState();
-        }
+    private:
+        void reserve( const U32 particleCapacity );
     };
 
 private:
-    const U32               mParticlePoolBlockSize;
-    Vector<ParticleNode*>   mParticlePool;
-    ParticleNode*           mpFreeParticleNodes;
-    U32                     mActiveParticleCount;
+    Vector<ParticleStore*>          mParticleStores;
 
 public:
     static void Init( void );
@@ -94,11 +118,11 @@ public:
     ParticleSystem();
     ~ParticleSystem();
 
-    ParticleNode* createParticle( void );
-    void freeParticle( ParticleNode* pParticleNode );
+    void registerParticleStore( ParticleStore* pParticleStore );
+    void unregisterParticleStore( ParticleStore* pParticleStore );
 
-    inline U32 getActiveParticleCount( void ) const { return mActiveParticleCount; };
-    inline U32 getAllocatedParticleCount( void ) const { return (U32)mParticlePool.size() * mParticlePoolBlockSize; }
+    U32 getActiveParticleCount( void ) const;
+    U32 getAllocatedParticleCount( void ) const;
 };
 
 #endif // _PARTICLE_SYSTEM_H_
\ No newline at end of file
@@ -72,6 +72,26 @@ void SpriteBase::integrateObject( const F32 totalTime, const F32 elapsedTime, De
 
 //------------------------------------------------------------------------------
 
+bool SpriteBase::getTickRequired( void ) const
+{
+    // Ticks are required whilst an animation is playing.
+    return Parent::getTickRequired() || ( !isStaticFrameProvider() && !isAnimationFinished() );
+}
+
+//------------------------------------------------------------------------------
+
+void SpriteBase::setProcessTicks( bool tick )
+{
+    // Call image frame provider.
+    ImageFrameProvider::setProcessTicks( tick );
+
+    // The animation is driven by our ticks so make sure we're ticked.
+    if ( tick )
+        setTickActive();
+}
+
+//------------------------------------------------------------------------------
+
 bool SpriteBase::validRender( void ) const
 {
     return ImageFrameProvider::validRender();
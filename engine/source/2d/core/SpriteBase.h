@@ -44,6 +44,8 @@ public:
     static void initPersistFields();
 
     virtual void integrateObject( const F32 totalTime, const F32 elapsedTime, DebugStats* pDebugStats );
+    virtual bool getTickRequired( void ) const;
+    virtual void setProcessTicks( bool tick );
 
     virtual bool validRender( void ) const;
     virtual bool shouldRender( void ) const { return true; }
@@ -719,7 +719,7 @@ void SceneWindow::mount( SceneObject* pSceneObject, const Vector2& mountOffset,
     if ( sendToMount )
     {
         // Fetch Mount Position.
-        const Vector2& mountPos = mpMountedTo->getBody()->GetWorldPoint( mountOffset );
+        const Vector2& mountPos = mpMountedTo->getWorldPoint( mountOffset );
 
         // Calculate Window Half-Dimensions.
         const F32 halfWidth = mCameraCurrent.mSourceArea.len_x() * 0.5f;
@@ -1317,7 +1317,7 @@ void SceneWindow::calculateCameraMount( const F32 elapsedTime )
     PROFILE_SCOPE(SceneWindow_CalculateCameraMount);
 
     // Fetch Mount Position.
-    const Vector2& mountPos = mpMountedTo->getBody()->GetWorldPoint( mMountOffset );
+    const Vector2& mountPos = mpMountedTo->getWorldPoint( mMountOffset );
 
     // Set Pre-Tick Position.
     mPreTickPosition = mPostTickPosition;
@@ -1779,7 +1779,7 @@ void SceneWindow::renderMetricsOverlay( Point2I offset, const RectI& updateRect
     const S32 metricsOffset = (S32)font->getStrWidth( "WWWWWWWWWWWW" );
 
     // Set Banner Height.
-    F32 bannerLineHeight = fullMetrics ? 17.0f : 1.0f;
+    F32 bannerLineHeight = fullMetrics ? 19.0f : 1.0f;
 
     // Add an extra line if we're monitoring a scene object.
     if ( pDebugSceneObject != NULL )
@@ -1824,6 +1824,15 @@ void SceneWindow::renderMetricsOverlay( Point2I offset, const RectI& updateRect
         dglDrawText( font, bannerOffset + Point2I(metricsOffset,(S32)linePositionY), mDebugText, NULL );
         linePositionY += linePositionOffsetY;
 
+        // Coherent layer sorting.
+        dglDrawText( font, bannerOffset + Point2I(0,(S32)linePositionY), "Sorting", NULL );
+        dSprintf( mDebugText, sizeof( mDebugText ), "- CoherentLayers Reused=%d<%d>, Patched=%d<%d>, Resorted=%d<%d>",
+            debugStats.renderSortsReused, debugStats.maxRenderSortsReused,
+            debugStats.renderSortsPatched, debugStats.maxRenderSortsPatched,
+            debugStats.renderSortsResorted, debugStats.maxRenderSortsResorted );
+        dglDrawText( font, bannerOffset + Point2I(metricsOffset,(S32)linePositionY), mDebugText, NULL );
+        linePositionY += linePositionOffsetY;
+
         // Scene.
         dglDrawText( font, bannerOffset + Point2I(0,(S32)linePositionY), "Scene", NULL );
         dSprintf( mDebugText, sizeof( mDebugText ), "- Count=%d, Index=%d, Time=%0.1fs, Objects=%d<%d>(Global=%d), Enabled=%d<%d>, Visible=%d<%d>, Awake=%d<%d>, Controllers=%d",
@@ -1965,6 +1974,15 @@ void SceneWindow::renderMetricsOverlay( Point2I offset, const RectI& updateRect
         dglDrawText( font, bannerOffset + Point2I(metricsOffset,(S32)linePositionY), mDebugText, NULL );
         linePositionY += linePositionOffsetY;
 
+        // Tile chunks.
+        dglDrawText( font, bannerOffset + Point2I(0,(S32)linePositionY), "Tiles", NULL );
+        dSprintf( mDebugText, sizeof( mDebugText ), "- ChunksResident=%d<%d>, ChunksBuilt=%d<%d>, ChunksEvicted=%d<%d>",
+            debugStats.tileChunksResident, debugStats.maxTileChunksResident,
+            debugStats.tileChunksBuilt, debugStats.maxTileChunksBuilt,
+            debugStats.tileChunksEvicted, debugStats.maxTileChunksEvicted );
+        dglDrawText( font, bannerOffset + Point2I(metricsOffset,(S32)linePositionY), mDebugText, NULL );
+        linePositionY += linePositionOffsetY;
+
         // Asset Manager.
         dglDrawText( font, bannerOffset + Point2I(0,(S32)linePositionY), "Assets", NULL );
         dSprintf( mDebugText, sizeof( mDebugText ), "- AcquiredRefs=%d, Declared=%d, Referenced=%d, LoadedInternal=%d<%d>, LoadedExternal=%d<%d>, LoadedPrivate=%d<%d>",
@@ -78,6 +78,9 @@ public:
         if ( renderPicked > maxRenderPicked ) maxRenderPicked = renderPicked;
         if ( renderRequests > maxRenderRequests ) maxRenderRequests = renderRequests;
         if ( renderFallbacks > maxRenderFallbacks ) maxRenderFallbacks = renderFallbacks;
+        if ( renderSortsReused > maxRenderSortsReused ) maxRenderSortsReused = renderSortsReused;
+        if ( renderSortsPatched > maxRenderSortsPatched ) maxRenderSortsPatched = renderSortsPatched;
+        if ( renderSortsResorted > maxRenderSortsResorted ) maxRenderSortsResorted = renderSortsResorted;
 
         // Batching.
         if ( batchTrianglesSubmitted > maxBatchTrianglesSubmitted ) maxBatchTrianglesSubmitted = batchTrianglesSubmitted;
@@ -98,6 +101,11 @@ public:
         // Particles.
         if ( particlesUsed > maxParticlesUsed ) maxParticlesUsed = particlesUsed;
 
+        // Tile chunks.
+        if ( tileChunksBuilt > maxTileChunksBuilt ) maxTileChunksBuilt = tileChunksBuilt;
+        if ( tileChunksEvicted > maxTileChunksEvicted ) maxTileChunksEvicted = tileChunksEvicted;
+        if ( tileChunksResident > maxTileChunksResident ) maxTileChunksResident = tileChunksResident;
+
         // World profile.
         if ( worldProfile.step > maxWorldProfile.step ) maxWorldProfile.step = worldProfile.step;
         if ( worldProfile.collide > maxWorldProfile.collide ) maxWorldProfile.collide = worldProfile.collide;
@@ -133,6 +141,15 @@ public:
         renderFallbacks = 0;
         maxRenderFallbacks = 0;
 
+        renderSortsReused = 0;
+        maxRenderSortsReused = 0;
+
+        renderSortsPatched = 0;
+        maxRenderSortsPatched = 0;
+
+        renderSortsResorted = 0;
+        maxRenderSortsResorted = 0;
+
         bodyCount = 0;
         maxBodyCount = 0;
 
@@ -195,6 +212,15 @@ public:
         particlesUsed = 0;
         maxParticlesUsed = 0;
 
+        tileChunksBuilt = 0;
+        maxTileChunksBuilt = 0;
+
+        tileChunksEvicted = 0;
+        maxTileChunksEvicted = 0;
+
+        tileChunksResident = 0;
+        maxTileChunksResident = 0;
+
         fps = 0.0f;
         minFPS = 10000.0f;
         maxFPS = 0.0f;
@@ -226,6 +252,15 @@ public:
     U32     renderFallbacks;
     U32     maxRenderFallbacks;
 
+    U32     renderSortsReused;
+    U32     maxRenderSortsReused;
+
+    U32     renderSortsPatched;
+    U32     maxRenderSortsPatched;
+
+    U32     renderSortsResorted;
+    U32     maxRenderSortsResorted;
+
     U32     bodyCount;
     U32     maxBodyCount;
 
@@ -288,6 +323,15 @@ public:
     U32     particlesUsed;
     U32     maxParticlesUsed;
 
+    U32     tileChunksBuilt;
+    U32     maxTileChunksBuilt;
+
+    U32     tileChunksEvicted;
+    U32     maxTileChunksEvicted;
+
+    U32     tileChunksResident;
+    U32     maxTileChunksResident;
+
     F32     fps;
     F32     minFPS;
     F32     maxFPS;
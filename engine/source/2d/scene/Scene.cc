@@ -56,6 +56,14 @@
 #include "2d/core/particleSystem.h"
 #endif
 
+#ifndef _PLATFORM_THREADS_THREADPOOL_H_
+#include "platform/threads/threadPool.h"
+#endif
+
+#ifndef _CONSOLE_NAMESPACE_H
+#include "console/consoleNamespace.h"
+#endif
+
 // Script bindings.
 #include "Scene_ScriptBinding.h"
 
@@ -152,6 +160,14 @@ Scene::Scene() :
     mWorldGravity(0.0f, 0.0f),
     mVelocityIterations(8),
     mPositionIterations(3),
+    mParallelPhysics(false),
+    mpPhysicsTask(NULL),
+    mpPhysicsTaskContext(NULL),
+
+    /// Scene occupancy.
+    mJoinTickedSceneObjects(false),
+    mEnabledObjectCount(0),
+    mVisibleObjectCount(0),
 
     /// Joint access.
     mJointMasterId(1),
@@ -171,18 +187,30 @@ Scene::Scene() :
     mIsEditorScene(0),
     mUpdateCallback(false),
     mRenderCallback(false),
+    mBatchCollisionCallbacks(false),
     mSceneIndex(0)
 {
     // Set Vector Associations.
     VECTOR_SET_ASSOCIATION( mSceneObjects );
+    VECTOR_SET_ASSOCIATION( mActiveSceneObjects );
     VECTOR_SET_ASSOCIATION( mDeleteRequests );
     VECTOR_SET_ASSOCIATION( mDeleteRequestsTemp );
+    VECTOR_SET_ASSOCIATION( mBeginContacts );
     VECTOR_SET_ASSOCIATION( mEndContacts );
+    VECTOR_SET_ASSOCIATION( mContactListeners );
+    VECTOR_SET_ASSOCIATION( mCollisionBatchRecords );
+    VECTOR_SET_ASSOCIATION( mCollisionBatchSorted );
+    VECTOR_SET_ASSOCIATION( mCollisionBatchObjects );
+    VECTOR_SET_ASSOCIATION( mCollisionBatchOffsets );
+    VECTOR_SET_ASSOCIATION( mCollisionBatchBuffer );
     VECTOR_SET_ASSOCIATION( mAssetPreloads );
      
     // Initialize layer sort mode.
     for ( U32 n = 0; n < MAX_LAYERS_SUPPORTED; ++n )
+    {
        mLayerSortModes[n] = SceneRenderQueue::RENDER_SORT_NEWEST;
+       mLayerSortCoherent[n] = false;
+    }
 
     // Set debug stats for batch renderer.
     mBatchRenderer.setDebugStats( &mDebugStats );
@@ -228,6 +256,9 @@ bool Scene::onAdd()
     // Set destruction listener.
     mpWorld->SetDestructionListener( this );
 
+    // Set wake listener.
+    mpWorld->SetWakeListener( this );
+
     // Create ground body.
     b2BodyDef groundBodyDef;
     groundBodyDef.userData = static_cast<PhysicsProxy*>(this);
@@ -306,6 +337,7 @@ void Scene::initPersistFields()
     addProtectedField("Gravity", TypeVector2, Offset(mWorldGravity, Scene), &setGravity, &getGravity, &writeGravity, "" );
     addField("VelocityIterations", TypeS32, Offset(mVelocityIterations, Scene), &writeVelocityIterations, "" );
     addField("PositionIterations", TypeS32, Offset(mPositionIterations, Scene), &writePositionIterations, "" );
+    addField("ParallelPhysics", TypeBool, Offset(mParallelPhysics, Scene), &writeParallelPhysics, "" );
 
     // Layer sort modes.
     char buffer[64];
@@ -315,11 +347,19 @@ void Scene::initPersistFields()
        addField( buffer, TypeEnum, OffsetNonConst(mLayerSortModes[n], Scene), &writeLayerSortMode, 1, &SceneRenderQueue::renderSortTable, "");
     }
 
+    // Layer coherent sorting.
+    for ( U32 n = 0; n < MAX_LAYERS_SUPPORTED; n++ )
+    {
+       dSprintf( buffer, 64, "layerSortCoherent%d", n );
+       addField( buffer, TypeBool, OffsetNonConst(mLayerSortCoherent[n], Scene), &writeLayerSortCoherent, "");
+    }
+
     addProtectedField("Controllers", TypeSimObjectPtr, Offset(mControllers, Scene), &defaultProtectedNotSetFn, &defaultProtectedGetFn, &defaultProtectedNotWriteFn, "The scene controllers to use.");
     
     // Callbacks.
     addField("UpdateCallback", TypeBool, Offset(mUpdateCallback, Scene), &writeUpdateCallback, "");
     addField("RenderCallback", TypeBool, Offset(mRenderCallback, Scene), &writeRenderCallback, "");
+    addField("BatchCollisionCallbacks", TypeBool, Offset(mBatchCollisionCallbacks, Scene), &writeBatchCollisionCallbacks, "");
 }
 
 //-----------------------------------------------------------------------------
@@ -356,7 +396,8 @@ void Scene::BeginContact( b2Contact* pContact )
     tickContact.initialize( pContact, pSceneObjectA, pSceneObjectB, pFixtureA, pFixtureB );
 
     // Add contact.
-    mBeginContacts.insert( pContact, tickContact );
+    mBeginContactIndices.insert( pContact, (U32)mBeginContacts.size() );
+    mBeginContacts.push_back( tickContact );
 }
 
 //-----------------------------------------------------------------------------
@@ -397,14 +438,14 @@ void Scene::EndContact( b2Contact* pContact )
 void Scene::PostSolve( b2Contact* pContact, const b2ContactImpulse* pImpulse )
 {
     // Find contact mapping.
-    typeContactHash::iterator contactItr = mBeginContacts.find( pContact );
+    typeContactIndexHash::iterator contactItr = mBeginContactIndices.find( pContact );
 
     // Finish if we didn't find the contact.
-    if ( contactItr == mBeginContacts.end() )
+    if ( contactItr == mBeginContactIndices.end() )
         return;
 
     // Fetch contact.
-    TickContact& tickContact = contactItr->value;
+    TickContact& tickContact = mBeginContacts[contactItr->value];
 
     // Add the impulse.
     for ( U32 index = 0; index < b2_maxManifoldPoints; ++index )
@@ -416,6 +457,64 @@ void Scene::PostSolve( b2Contact* pContact, const b2ContactImpulse* pImpulse )
 
 //-----------------------------------------------------------------------------
 
+void Scene::ParallelFor( b2TaskFunction* task, void* context, int32 count )
+{
+    // Box2D only runs one batch of tasks at a time.
+    mpPhysicsTask = task;
+    mpPhysicsTaskContext = context;
+
+    ThreadPool* pThreadPool = ThreadPool::getGlobal();
+    if ( pThreadPool == NULL )
+    {
+        for ( S32 i = 0; i < count; ++i )
+            physicsTaskJob( this, (U32)i );
+    }
+    else
+    {
+        pThreadPool->parallelFor( &physicsTaskJob, this, (U32)count );
+    }
+
+    mpPhysicsTask = NULL;
+    mpPhysicsTaskContext = NULL;
+}
+
+//-----------------------------------------------------------------------------
+
+int32 Scene::GetThreadCount( void ) const
+{
+    ThreadPool* pThreadPool = ThreadPool::getGlobal();
+    return pThreadPool == NULL ? 1 : (int32)pThreadPool->getWorkerCount() + 1;
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::physicsTaskJob( void* context, U32 jobIndex )
+{
+    // Fetch the scene.
+    Scene* pScene = static_cast<Scene*>( context );
+
+    // Run the task.
+    // NOTE:-   This runs on a worker thread so must only touch the physics world.
+    pScene->mpPhysicsTask( pScene->mpPhysicsTaskContext, (int32)jobIndex );
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::BodyWoken( b2Body* pBody )
+{
+    // Fetch physics proxy.
+    PhysicsProxy* pPhysicsProxy = static_cast<PhysicsProxy*>(pBody->GetUserData());
+
+    // Ignore if not a scene object.
+    if ( pPhysicsProxy == NULL || pPhysicsProxy->getPhysicsProxyType() != PhysicsProxy::PHYSIC_PROXY_SCENEOBJECT )
+        return;
+
+    // The object can move again so make sure it's ticked.
+    static_cast<SceneObject*>(pPhysicsProxy)->setTickActive();
+}
+
+//-----------------------------------------------------------------------------
+
 void Scene::forwardContacts( void )
 {
     // Debug Profiling.
@@ -433,10 +532,10 @@ void Scene::forwardContacts( void )
     }
 
     // Iterate begin contacts.
-    for( typeContactHash::iterator contactItr = mBeginContacts.begin(); contactItr != mBeginContacts.end(); ++contactItr )
+    for( typeContactVector::iterator contactItr = mBeginContacts.begin(); contactItr != mBeginContacts.end(); ++contactItr )
     {
         // Fetch tick contact.
-        TickContact& tickContact = contactItr->value;
+        TickContact& tickContact = *contactItr;
 
         // Inform the scene objects.
         tickContact.mpSceneObjectA->onBeginCollision( tickContact );
@@ -446,6 +545,130 @@ void Scene::forwardContacts( void )
 
 //-----------------------------------------------------------------------------
 
+void Scene::addContactListener( SceneContactListener* pContactListener )
+{
+    // Sanity!
+    AssertFatal( pContactListener != NULL, "Scene::addContactListener() - Cannot add a NULL contact listener." );
+
+    // Ignore if already added.
+    for ( typeContactListenerVector::iterator listenerItr = mContactListeners.begin(); listenerItr != mContactListeners.end(); ++listenerItr )
+    {
+        if ( *listenerItr == pContactListener )
+            return;
+    }
+
+    mContactListeners.push_back( pContactListener );
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::removeContactListener( SceneContactListener* pContactListener )
+{
+    for ( typeContactListenerVector::iterator listenerItr = mContactListeners.begin(); listenerItr != mContactListeners.end(); ++listenerItr )
+    {
+        if ( *listenerItr != pContactListener )
+            continue;
+
+        mContactListeners.erase( listenerItr );
+        return;
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+Scene::CollisionReceiver Scene::findCollisionReceiver( BehaviorComponent* pObject, StringTableEntry callbackName )
+{
+    // Does the object itself handle the callback?
+    Namespace* pNamespace = pObject->getNamespace();
+    if ( pNamespace != NULL && pNamespace->lookup( callbackName ) != NULL )
+        return COLLISION_RECEIVER_OBJECT;
+
+    // Does any behavior handle the callback?
+    const U32 behaviorCount = pObject->getBehaviorCount();
+    for( U32 behaviorIndex = 0; behaviorIndex < behaviorCount; ++behaviorIndex )
+    {
+        Namespace* pBehaviorNamespace = pObject->getBehavior( behaviorIndex )->getNamespace();
+        if ( pBehaviorNamespace != NULL && pBehaviorNamespace->lookup( callbackName ) != NULL )
+            return COLLISION_RECEIVER_BEHAVIORS;
+    }
+
+    // Let any components decide if there are no behaviors.
+    if ( behaviorCount == 0 && pObject->getComponentCount() > 0 )
+        return COLLISION_RECEIVER_BEHAVIORS;
+
+    return COLLISION_RECEIVER_NONE;
+}
+
+//-----------------------------------------------------------------------------
+
+Scene::CollisionReceiver Scene::findCachedCollisionReceiver( SceneObject* pSceneObject, StringTableEntry callbackName )
+{
+    // Have we already resolved this scene object?
+    typeCollisionReceiverHash::iterator receiverItr = mCollisionReceivers.find( pSceneObject );
+    if ( receiverItr != mCollisionReceivers.end() )
+        return (CollisionReceiver)receiverItr->value;
+
+    // No, so resolve and cache it.
+    const CollisionReceiver collisionReceiver = findCollisionReceiver( pSceneObject, callbackName );
+    mCollisionReceivers.insert( pSceneObject, (U32)collisionReceiver );
+    return collisionReceiver;
+}
+
+//-----------------------------------------------------------------------------
+
+static void formatContactInformation( const TickContact& tickContact, const S32 shapeIndexA, const S32 shapeIndexB, const bool includeManifold, char* pBuffer, const U32 bufferSize )
+{
+    // Fetch normal and contact points.
+    const U32 pointCount = includeManifold ? tickContact.mPointCount : 0;
+    const b2Vec2& normal = tickContact.mWorldManifold.normal;
+    const b2Vec2& point1 = tickContact.mWorldManifold.points[0];
+    const b2Vec2& point2 = tickContact.mWorldManifold.points[1];
+
+    if ( pointCount == 2 )
+    {
+        dSprintf(pBuffer, bufferSize,
+            "%d %d %0.4f %0.4f %0.4f %0.4f %0.4f %0.4f %0.4f %0.4f %0.4f %0.4f",
+            shapeIndexA, shapeIndexB,
+            normal.x, normal.y,
+            point1.x, point1.y,
+            tickContact.mNormalImpulses[0],
+            tickContact.mTangentImpulses[0],
+            point2.x, point2.y,
+            tickContact.mNormalImpulses[1],
+            tickContact.mTangentImpulses[1] );
+    }
+    else if ( pointCount == 1 )
+    {
+        dSprintf(pBuffer, bufferSize,
+            "%d %d %0.4f %0.4f %0.4f %0.4f %0.4f %0.4f",
+            shapeIndexA, shapeIndexB,
+            normal.x, normal.y,
+            point1.x, point1.y,
+            tickContact.mNormalImpulses[0],
+            tickContact.mTangentImpulses[0] );
+    }
+    else
+    {
+        dSprintf(pBuffer, bufferSize,
+            "%d %d",
+            shapeIndexA, shapeIndexB );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+// Collision callback names.
+static StringTableEntry collisionCallbackName                   = StringTable->insert("onCollision");
+static StringTableEntry endCollisionCallbackName                = StringTable->insert("onEndCollision");
+static StringTableEntry sceneCollisionCallbackName              = StringTable->insert("onSceneCollision");
+static StringTableEntry sceneEndCollisionCallbackName           = StringTable->insert("onSceneEndCollision");
+static StringTableEntry collisionBatchCallbackName              = StringTable->insert("onCollisionBatch");
+static StringTableEntry endCollisionBatchCallbackName           = StringTable->insert("onEndCollisionBatch");
+static StringTableEntry sceneCollisionBatchCallbackName         = StringTable->insert("onSceneCollisionBatch");
+static StringTableEntry sceneEndCollisionBatchCallbackName      = StringTable->insert("onSceneEndCollisionBatch");
+
+//-----------------------------------------------------------------------------
+
 void Scene::dispatchBeginContactCallbacks( void )
 {
     // Debug Profiling.
@@ -454,18 +677,62 @@ void Scene::dispatchBeginContactCallbacks( void )
     // Sanity!
     AssertFatal( b2_maxManifoldPoints == 2, "Scene::dispatchBeginContactCallbacks() - Invalid assumption about max manifold points." );
 
-    // Fetch contact count.
-    const U32 contactCount = mBeginContacts.size();
+    // Finish if no contacts.
+    if ( mBeginContacts.size() == 0 )
+        return;
+
+    // Inform the native contact listeners.
+    for ( S32 n = 0; n < mContactListeners.size(); ++n )
+        mContactListeners[n]->onSceneBeginContacts( this, mBeginContacts.address(), (U32)mBeginContacts.size() );
+
+    // Dispatch the script callbacks.
+    if ( mBatchCollisionCallbacks )
+        dispatchBatchedContactCallbacks( mBeginContacts, sceneCollisionBatchCallbackName, collisionBatchCallbackName, true );
+    else
+        dispatchContactCallbacks( mBeginContacts, sceneCollisionCallbackName, collisionCallbackName, true );
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::dispatchEndContactCallbacks( void )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(Scene_DispatchEndContactCallbacks);
+
+    // Sanity!
+    AssertFatal( b2_maxManifoldPoints == 2, "Scene::dispatchEndContactCallbacks() - Invalid assumption about max manifold points." );
 
     // Finish if no contacts.
-    if ( contactCount == 0 )
+    if ( mEndContacts.size() == 0 )
         return;
 
+    // Inform the native contact listeners.
+    for ( S32 n = 0; n < mContactListeners.size(); ++n )
+        mContactListeners[n]->onSceneEndContacts( this, mEndContacts.address(), (U32)mEndContacts.size() );
+
+    // Dispatch the script callbacks.
+    if ( mBatchCollisionCallbacks )
+        dispatchBatchedContactCallbacks( mEndContacts, sceneEndCollisionBatchCallbackName, endCollisionBatchCallbackName, false );
+    else
+        dispatchContactCallbacks( mEndContacts, sceneEndCollisionCallbackName, endCollisionCallbackName, false );
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::dispatchContactCallbacks( const typeContactVector& contacts, StringTableEntry sceneCallbackName, StringTableEntry objectCallbackName, const bool includeManifold )
+{
+    // Resolve the scene receiver once.
+    const CollisionReceiver sceneReceiver = findCollisionReceiver( this, sceneCallbackName );
+
+    // Reset the object receivers.
+    mCollisionReceivers.clear();
+
     // Iterate all contacts.
-    for ( typeContactHash::iterator contactItr = mBeginContacts.begin(); contactItr != mBeginContacts.end(); ++contactItr )
+    // NOTE:-   Contacts can be added by the callbacks so we cannot cache the contact count.
+    for ( S32 contactIndex = 0; contactIndex < contacts.size(); ++contactIndex )
     {
         // Fetch contact.
-        const TickContact& tickContact = contactItr->value;
+        const TickContact& tickContact = contacts[contactIndex];
 
         // Fetch scene objects.
         SceneObject* pSceneObjectA = tickContact.mpSceneObjectA;
@@ -479,23 +746,29 @@ void Scene::dispatchBeginContactCallbacks( void )
         if ( !pSceneObjectA->getCollisionCallback() && !pSceneObjectB->getCollisionCallback() )
             continue;
 
-        // Fetch normal and contact points.
-        const U32& pointCount = tickContact.mPointCount;
-        const b2Vec2& normal = tickContact.mWorldManifold.normal;
-        const b2Vec2& point1 = tickContact.mWorldManifold.points[0];
-        const b2Vec2& point2 = tickContact.mWorldManifold.points[1];
+        // Is object A allowed to collide with object B?
+        const bool collideA =   (pSceneObjectA->mCollisionGroupMask & pSceneObjectB->mSceneGroupMask) != 0 &&
+                                (pSceneObjectA->mCollisionLayerMask & pSceneObjectB->mSceneLayerMask) != 0;
+
+        // Is object B allowed to collide with object A?
+        const bool collideB =   (pSceneObjectB->mCollisionGroupMask & pSceneObjectA->mSceneGroupMask) != 0 &&
+                                (pSceneObjectB->mCollisionLayerMask & pSceneObjectA->mSceneLayerMask) != 0;
+
+        // Find the object receivers.
+        const CollisionReceiver receiverA = collideA ? findCachedCollisionReceiver( pSceneObjectA, objectCallbackName ) : COLLISION_RECEIVER_NONE;
+        const CollisionReceiver receiverB = collideB ? findCachedCollisionReceiver( pSceneObjectB, objectCallbackName ) : COLLISION_RECEIVER_NONE;
+
+        // Skip formatting if nothing will receive the callback.
+        if ( sceneReceiver == COLLISION_RECEIVER_NONE && receiverA == COLLISION_RECEIVER_NONE && receiverB == COLLISION_RECEIVER_NONE )
+            continue;
+
+        // Fetch the shape indices.
         const S32 shapeIndexA = pSceneObjectA->getCollisionShapeIndex( tickContact.mpFixtureA );
         const S32 shapeIndexB = pSceneObjectB->getCollisionShapeIndex( tickContact.mpFixtureB );
 
         // Sanity!
-        AssertFatal( shapeIndexA >= 0, "Scene::dispatchBeginContactCallbacks() - Cannot find shape index reported on physics proxy of a fixture." );
-        AssertFatal( shapeIndexB >= 0, "Scene::dispatchBeginContactCallbacks() - Cannot find shape index reported on physics proxy of a fixture." );
-
-        // Fetch collision impulse information
-        const F32 normalImpulse1 = tickContact.mNormalImpulses[0];
-        const F32 normalImpulse2 = tickContact.mNormalImpulses[1];
-        const F32 tangentImpulse1 = tickContact.mTangentImpulses[0];
-        const F32 tangentImpulse2 = tickContact.mTangentImpulses[1];
+        AssertFatal( shapeIndexA >= 0, "Scene::dispatchContactCallbacks() - Cannot find shape index reported on physics proxy of a fixture." );
+        AssertFatal( shapeIndexB >= 0, "Scene::dispatchContactCallbacks() - Cannot find shape index reported on physics proxy of a fixture." );
 
         // Format objects.
         char sceneObjectABuffer[16];
@@ -505,117 +778,98 @@ void Scene::dispatchBeginContactCallbacks( void )
 
         // Format miscellaneous information.
         char miscInfoBuffer[128];
-        if ( pointCount == 2 )
-        {
-            dSprintf(miscInfoBuffer, sizeof(miscInfoBuffer),
-                "%d %d %0.4f %0.4f %0.4f %0.4f %0.4f %0.4f %0.4f %0.4f %0.4f %0.4f",
-                shapeIndexA, shapeIndexB,
-                normal.x, normal.y,
-                point1.x, point1.y,
-                normalImpulse1,
-                tangentImpulse1,
-                point2.x, point2.y,
-                normalImpulse2,
-                tangentImpulse2 );
-        }
-        else if ( pointCount == 1 )
-        {
-            dSprintf(miscInfoBuffer, sizeof(miscInfoBuffer),
-                "%d %d %0.4f %0.4f %0.4f %0.4f %0.4f %0.4f",
-                shapeIndexA, shapeIndexB,
-                normal.x, normal.y,
-                point1.x, point1.y,
-                normalImpulse1,
-                tangentImpulse1 );
-        }
-        else
-        {
-            dSprintf(miscInfoBuffer, sizeof(miscInfoBuffer),
-                "%d %d",
-                shapeIndexA, shapeIndexB );
-        }
+        formatContactInformation( tickContact, shapeIndexA, shapeIndexB, includeManifold, miscInfoBuffer, sizeof(miscInfoBuffer) );
 
         // Does the scene handle the collision callback?
-        Namespace* pNamespace = getNamespace();
-        if ( pNamespace != NULL && pNamespace->lookup( StringTable->insert( "onSceneCollision" ) ) != NULL )
+        if ( sceneReceiver == COLLISION_RECEIVER_OBJECT )
         {
             // Yes, so perform script callback on the Scene.
-            Con::executef( this, 4, "onSceneCollision",
+            Con::executef( this, 4, sceneCallbackName,
                 sceneObjectABuffer,
                 sceneObjectBBuffer,
                 miscInfoBuffer );
         }
-        else
+        else if ( sceneReceiver == COLLISION_RECEIVER_BEHAVIORS )
         {
             // No, so call it on its behaviors.
-            const char* args[5] = { "onSceneCollision", "", sceneObjectABuffer, sceneObjectBBuffer, miscInfoBuffer };
+            const char* args[5] = { sceneCallbackName, "", sceneObjectABuffer, sceneObjectBBuffer, miscInfoBuffer };
             callOnBehaviors( 5, args );
         }
 
-        // Is object A allowed to collide with object B?
-        if (    (pSceneObjectA->mCollisionGroupMask & pSceneObjectB->mSceneGroupMask) != 0 &&
-                (pSceneObjectA->mCollisionLayerMask & pSceneObjectB->mSceneLayerMask) != 0 )
+        // Does object A handle the collision callback?
+        if ( receiverA == COLLISION_RECEIVER_OBJECT )
         {
-            // Yes, so does it handle the collision callback?
-            if ( pSceneObjectA->isMethod("onCollision") )            
-            {
-                // Yes, so perform the script callback on it.
-                Con::executef( pSceneObjectA, 3, "onCollision",
-                    sceneObjectBBuffer,
-                    miscInfoBuffer );
-            }
-            else
-            {
-                // No, so call it on its behaviors.
-                const char* args[4] = { "onCollision", "", sceneObjectBBuffer, miscInfoBuffer };
-                pSceneObjectA->callOnBehaviors( 4, args );
-            }
+            // Yes, so perform the script callback on it.
+            Con::executef( pSceneObjectA, 3, objectCallbackName,
+                sceneObjectBBuffer,
+                miscInfoBuffer );
+        }
+        else if ( receiverA == COLLISION_RECEIVER_BEHAVIORS )
+        {
+            // No, so call it on its behaviors.
+            const char* args[4] = { objectCallbackName, "", sceneObjectBBuffer, miscInfoBuffer };
+            pSceneObjectA->callOnBehaviors( 4, args );
         }
 
-        // Is object B allowed to collide with object A?
-        if (    (pSceneObjectB->mCollisionGroupMask & pSceneObjectA->mSceneGroupMask) != 0 &&
-                (pSceneObjectB->mCollisionLayerMask & pSceneObjectA->mSceneLayerMask) != 0 )
+        // Does object B handle the collision callback?
+        if ( receiverB == COLLISION_RECEIVER_OBJECT )
         {
-            // Yes, so does it handle the collision callback?
-            if ( pSceneObjectB->isMethod("onCollision") )            
-            {
-                // Yes, so perform the script callback on it.
-                Con::executef( pSceneObjectB, 3, "onCollision",
-                    sceneObjectABuffer,
-                    miscInfoBuffer );
-            }
-            else
-            {
-                // No, so call it on its behaviors.
-                const char* args[4] = { "onCollision", "", sceneObjectABuffer, miscInfoBuffer };
-                pSceneObjectB->callOnBehaviors( 4, args );
-            }
+            // Yes, so perform the script callback on it.
+            Con::executef( pSceneObjectB, 3, objectCallbackName,
+                sceneObjectABuffer,
+                miscInfoBuffer );
+        }
+        else if ( receiverB == COLLISION_RECEIVER_BEHAVIORS )
+        {
+            // No, so call it on its behaviors.
+            const char* args[4] = { objectCallbackName, "", sceneObjectABuffer, miscInfoBuffer };
+            pSceneObjectB->callOnBehaviors( 4, args );
         }
     }
 }
 
 //-----------------------------------------------------------------------------
 
-void Scene::dispatchEndContactCallbacks( void )
+void Scene::appendCollisionBatchRecord( const char* pRecord )
+{
+    // Append the record and its terminating new-line.
+    const U32 recordLength = dStrlen( pRecord );
+    const U32 offset = mCollisionBatchBuffer.size();
+    mCollisionBatchBuffer.setSize( offset + recordLength + 1 );
+    dMemcpy( mCollisionBatchBuffer.address() + offset, pRecord, recordLength );
+    mCollisionBatchBuffer[offset + recordLength] = '\n';
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::dispatchBatchedContactCallbacks( const typeContactVector& contacts, StringTableEntry sceneCallbackName, StringTableEntry objectCallbackName, const bool includeManifold )
 {
     // Debug Profiling.
-    PROFILE_SCOPE(Scene_DispatchEndContactCallbacks);
+    PROFILE_SCOPE(Scene_DispatchBatchedContactCallbacks);
 
-    // Sanity!
-    AssertFatal( b2_maxManifoldPoints == 2, "Scene::dispatchEndContactCallbacks() - Invalid assumption about max manifold points." );
+    // Resolve the scene receiver once.
+    const CollisionReceiver sceneReceiver = findCollisionReceiver( this, sceneCallbackName );
 
-    // Fetch contact count.
-    const U32 contactCount = mEndContacts.size();
+    // Reset the batches.
+    mCollisionReceivers.clear();
+    mCollisionBatchRecords.clear();
+    mCollisionBatchObjects.clear();
+    mCollisionBatchIndices.clear();
+    mCollisionBatchBuffer.clear();
 
-    // Finish if no contacts.
-    if ( contactCount == 0 )
-        return;
+    // Fetch the contact count.
+    // NOTE:-   Contacts added by the batch callbacks are not part of this batch.
+    const U32 contactCount = (U32)contacts.size();
 
-    // Iterate all contacts.
-    for ( typeContactVector::iterator contactItr = mEndContacts.begin(); contactItr != mEndContacts.end(); ++contactItr )
+    U32 sceneRecordCount = 0;
+    char recordBuffer[160];
+    char miscInfoBuffer[128];
+
+    // Gather the contacts.
+    for ( U32 contactIndex = 0; contactIndex < contactCount; ++contactIndex )
     {
         // Fetch contact.
-        const TickContact& tickContact = *contactItr;
+        const TickContact& tickContact = contacts[contactIndex];
 
         // Fetch scene objects.
         SceneObject* pSceneObjectA = tickContact.mpSceneObjectA;
@@ -629,81 +883,259 @@ void Scene::dispatchEndContactCallbacks( void )
         if ( !pSceneObjectA->getCollisionCallback() && !pSceneObjectB->getCollisionCallback() )
             continue;
 
-        // Fetch shape index.
-        const S32 shapeIndexA = pSceneObjectA->getCollisionShapeIndex( tickContact.mpFixtureA );
-        const S32 shapeIndexB = pSceneObjectB->getCollisionShapeIndex( tickContact.mpFixtureB );
+        // Is object A allowed to collide with object B?
+        const bool collideA =   (pSceneObjectA->mCollisionGroupMask & pSceneObjectB->mSceneGroupMask) != 0 &&
+                                (pSceneObjectA->mCollisionLayerMask & pSceneObjectB->mSceneLayerMask) != 0;
 
-        // Sanity!
-        AssertFatal( shapeIndexA >= 0, "Scene::dispatchEndContactCallbacks() - Cannot find shape index reported on physics proxy of a fixture." );
-        AssertFatal( shapeIndexB >= 0, "Scene::dispatchEndContactCallbacks() - Cannot find shape index reported on physics proxy of a fixture." );
+        // Is object B allowed to collide with object A?
+        const bool collideB =   (pSceneObjectB->mCollisionGroupMask & pSceneObjectA->mSceneGroupMask) != 0 &&
+                                (pSceneObjectB->mCollisionLayerMask & pSceneObjectA->mSceneLayerMask) != 0;
 
-        // Format objects.
-        char sceneObjectABuffer[16];
-        char sceneObjectBBuffer[16];
-        dSprintf( sceneObjectABuffer, sizeof(sceneObjectABuffer), "%d", pSceneObjectA->getId() );
-        dSprintf( sceneObjectBBuffer, sizeof(sceneObjectBBuffer), "%d", pSceneObjectB->getId() );
+        // Add a record for each object receiver.
+        for ( U32 side = 0; side < 2; ++side )
+        {
+            SceneObject* pSceneObject = side == 0 ? pSceneObjectA : pSceneObjectB;
 
-        // Format miscellaneous information.
-        char miscInfoBuffer[32];
-        dSprintf(miscInfoBuffer, sizeof(miscInfoBuffer), "%d %d", shapeIndexA, shapeIndexB );
+            if ( !(side == 0 ? collideA : collideB) || findCachedCollisionReceiver( pSceneObject, objectCallbackName ) == COLLISION_RECEIVER_NONE )
+                continue;
+
+            // Find the batch for the object, adding one if needed.
+            U32 batchIndex;
+            typeCollisionBatchHash::iterator batchItr = mCollisionBatchIndices.find( pSceneObject );
+            if ( batchItr == mCollisionBatchIndices.end() )
+            {
+                batchIndex = (U32)mCollisionBatchObjects.size();
+                mCollisionBatchObjects.push_back( pSceneObject );
+                mCollisionBatchIndices.insert( pSceneObject, batchIndex );
+            }
+            else
+            {
+                batchIndex = batchItr->value;
+            }
+
+            CollisionBatchRecord batchRecord;
+            batchRecord.mBatchIndex = batchIndex;
+            batchRecord.mContactIndex = contactIndex;
+            batchRecord.mpCollideWith = side == 0 ? pSceneObjectB : pSceneObjectA;
+            mCollisionBatchRecords.push_back( batchRecord );
+        }
+
+        // Add a scene record if the scene receives the callback.
+        if ( sceneReceiver != COLLISION_RECEIVER_NONE )
+        {
+            formatContactInformation( tickContact, pSceneObjectA->getCollisionShapeIndex( tickContact.mpFixtureA ), pSceneObjectB->getCollisionShapeIndex( tickContact.mpFixtureB ), includeManifold, miscInfoBuffer, sizeof(miscInfoBuffer) );
+            dSprintf( recordBuffer, sizeof(recordBuffer), "%d %d %s", pSceneObjectA->getId(), pSceneObjectB->getId(), miscInfoBuffer );
+            appendCollisionBatchRecord( recordBuffer );
+            sceneRecordCount++;
+        }
+    }
+
+    // Perform the scene batch callback.
+    if ( sceneRecordCount > 0 )
+    {
+        // Terminate the records.
+        mCollisionBatchBuffer.last() = '\0';
+
+        char countBuffer[16];
+        dSprintf( countBuffer, sizeof(countBuffer), "%d", sceneRecordCount );
 
         // Does the scene handle the collision callback?
-        Namespace* pNamespace = getNamespace();
-        if ( pNamespace != NULL && pNamespace->lookup( StringTable->insert( "onSceneEndCollision" ) ) != NULL )
+        if ( sceneReceiver == COLLISION_RECEIVER_OBJECT )
         {
-            // Yes, so does the scene handle the collision callback?
-            Con::executef( this, 4, "onSceneEndCollision",
-                sceneObjectABuffer,
-                sceneObjectBBuffer,
-                miscInfoBuffer );
+            // Yes, so perform script callback on the Scene.
+            Con::executef( this, 3, sceneCallbackName, countBuffer, mCollisionBatchBuffer.address() );
         }
         else
         {
             // No, so call it on its behaviors.
-            const char* args[5] = { "onSceneEndCollision", "", sceneObjectABuffer, sceneObjectBBuffer, miscInfoBuffer };
-            callOnBehaviors( 5, args );
+            const char* args[4] = { sceneCallbackName, "", countBuffer, mCollisionBatchBuffer.address() };
+            callOnBehaviors( 4, args );
         }
+    }
 
-        // Is object A allowed to collide with object B?
-        if (    (pSceneObjectA->mCollisionGroupMask & pSceneObjectB->mSceneGroupMask) != 0 &&
-                (pSceneObjectA->mCollisionLayerMask & pSceneObjectB->mSceneLayerMask) != 0 )
+    // Finish if there are no object batches.
+    const U32 batchCount = (U32)mCollisionBatchObjects.size();
+    if ( batchCount == 0 )
+        return;
+
+    // Group the records by batch keeping them in contact order.
+    mCollisionBatchOffsets.setSize( batchCount + 1 );
+    dMemset( mCollisionBatchOffsets.address(), 0, (batchCount + 1) * sizeof(U32) );
+    for ( S32 n = 0; n < mCollisionBatchRecords.size(); ++n )
+        mCollisionBatchOffsets[mCollisionBatchRecords[n].mBatchIndex + 1]++;
+    for ( U32 n = 1; n <= batchCount; ++n )
+        mCollisionBatchOffsets[n] += mCollisionBatchOffsets[n-1];
+    mCollisionBatchSorted.setSize( mCollisionBatchRecords.size() );
+    for ( S32 n = 0; n < mCollisionBatchRecords.size(); ++n )
+        mCollisionBatchSorted[mCollisionBatchOffsets[mCollisionBatchRecords[n].mBatchIndex]++] = mCollisionBatchRecords[n];
+
+    // Perform the object batch callbacks.
+    // NOTE:-   The offsets now mark the end of each batch.
+    U32 recordStart = 0;
+    for ( U32 batchIndex = 0; batchIndex < batchCount; ++batchIndex )
+    {
+        const U32 recordEnd = mCollisionBatchOffsets[batchIndex];
+        const U32 batchStart = recordStart;
+        recordStart = recordEnd;
+
+        // Fetch the scene object.
+        SceneObject* pSceneObject = mCollisionBatchObjects[batchIndex];
+
+        // Skip if the object is being deleted.
+        if ( pSceneObject->isBeingDeleted() )
+            continue;
+
+        // Format the records.
+        mCollisionBatchBuffer.clear();
+        U32 recordCount = 0;
+        for ( U32 recordIndex = batchStart; recordIndex < recordEnd; ++recordIndex )
         {
-            // Yes, so does it handle the collision callback?
-            if ( pSceneObjectA->isMethod("onEndCollision") )            
-            {
-                // Yes, so perform the script callback on it.
-                Con::executef( pSceneObjectA, 3, "onEndCollision",
-                    sceneObjectBBuffer,
-                    miscInfoBuffer );
-            }
-            else
-            {
-                // No, so call it on its behaviors.
-                const char* args[4] = { "onEndCollision", "", sceneObjectBBuffer, miscInfoBuffer };
-                pSceneObjectA->callOnBehaviors( 4, args );
-            }
+            const CollisionBatchRecord& batchRecord = mCollisionBatchSorted[recordIndex];
+
+            // Skip if the other object has since been deleted.
+            if ( batchRecord.mpCollideWith->isBeingDeleted() )
+                continue;
+
+            const TickContact& tickContact = contacts[batchRecord.mContactIndex];
+            formatContactInformation( tickContact, tickContact.mpSceneObjectA->getCollisionShapeIndex( tickContact.mpFixtureA ), tickContact.mpSceneObjectB->getCollisionShapeIndex( tickContact.mpFixtureB ), includeManifold, miscInfoBuffer, sizeof(miscInfoBuffer) );
+            dSprintf( recordBuffer, sizeof(recordBuffer), "%d %s", batchRecord.mpCollideWith->getId(), miscInfoBuffer );
+            appendCollisionBatchRecord( recordBuffer );
+            recordCount++;
         }
 
-        // Is object B allowed to collide with object A?
-        if (    (pSceneObjectB->mCollisionGroupMask & pSceneObjectA->mSceneGroupMask) != 0 &&
-                (pSceneObjectB->mCollisionLayerMask & pSceneObjectA->mSceneLayerMask) != 0 )
+        // Skip if no records remain.
+        if ( recordCount == 0 )
+            continue;
+
+        // Terminate the records.
+        mCollisionBatchBuffer.last() = '\0';
+
+        char countBuffer[16];
+        dSprintf( countBuffer, sizeof(countBuffer), "%d", recordCount );
+
+        // Does the object handle the collision callback?
+        if ( findCachedCollisionReceiver( pSceneObject, objectCallbackName ) == COLLISION_RECEIVER_OBJECT )
         {
-            // Yes, so does it handle the collision callback?
-            if ( pSceneObjectB->isMethod("onEndCollision") )            
-            {
-                // Yes, so perform the script callback on it.
-                Con::executef( pSceneObjectB, 3, "onEndCollision",
-                    sceneObjectABuffer,
-                    miscInfoBuffer );
-            }
-            else
-            {
-                // No, so call it on its behaviors.
-                const char* args[4] = { "onEndCollision", "", sceneObjectABuffer, miscInfoBuffer };
-                pSceneObjectB->callOnBehaviors( 4, args );
-            }
+            // Yes, so perform the script callback on it.
+            Con::executef( pSceneObject, 3, objectCallbackName, countBuffer, mCollisionBatchBuffer.address() );
         }
+        else
+        {
+            // No, so call it on its behaviors.
+            const char* args[4] = { objectCallbackName, "", countBuffer, mCollisionBatchBuffer.address() };
+            pSceneObject->callOnBehaviors( 4, args );
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+// Namespaces of the private benchmark scene and its objects.
+static StringTableEntry sceneCollisionBenchmarkNamespace        = StringTable->insert("SceneCollisionBenchmark");
+static StringTableEntry sceneObjectCollisionBenchmarkNamespace  = StringTable->insert("SceneObjectCollisionBenchmark");
+
+// Receives the benchmark collision callbacks and does nothing.
+static void collisionBenchmarkCallback( SimObject* pObject, S32 argc, const char* argv[] )
+{
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::benchmarkCollisionCallbacks( const U32 contactCount, const U32 iterations, F32& perContactTime, F32& batchedTime )
+{
+    perContactTime = 0.0f;
+    batchedTime = 0.0f;
+
+    // Finish if there's nothing to measure.
+    if ( contactCount == 0 || iterations == 0 )
+        return;
+
+    // Add the no-op callbacks.
+    // NOTE:-   These shadow any callbacks defined by the game so no game code runs.
+    Namespace* pSceneNamespace = Namespace::find( sceneCollisionBenchmarkNamespace );
+    pSceneNamespace->addCommand( sceneCollisionCallbackName, collisionBenchmarkCallback, "", 0, 0 );
+    pSceneNamespace->addCommand( sceneEndCollisionCallbackName, collisionBenchmarkCallback, "", 0, 0 );
+    pSceneNamespace->addCommand( sceneCollisionBatchCallbackName, collisionBenchmarkCallback, "", 0, 0 );
+    pSceneNamespace->addCommand( sceneEndCollisionBatchCallbackName, collisionBenchmarkCallback, "", 0, 0 );
+    Namespace* pObjectNamespace = Namespace::find( sceneObjectCollisionBenchmarkNamespace );
+    pObjectNamespace->addCommand( collisionCallbackName, collisionBenchmarkCallback, "", 0, 0 );
+    pObjectNamespace->addCommand( endCollisionCallbackName, collisionBenchmarkCallback, "", 0, 0 );
+    pObjectNamespace->addCommand( collisionBatchCallbackName, collisionBenchmarkCallback, "", 0, 0 );
+    pObjectNamespace->addCommand( endCollisionBatchCallbackName, collisionBenchmarkCallback, "", 0, 0 );
+
+    // Create a private scene so no real scene, contact or callback is involved.
+    Scene* pScene = new Scene();
+    pScene->setClassNamespace( sceneCollisionBenchmarkNamespace );
+    pScene->registerObject();
+
+    // Create the objects, about four contacts each.
+    // NOTE:-   At least four objects are needed for a handful of contacts to be between distinct pairs.
+    const U32 objectCount = getMax( contactCount / 2, (U32)4 );
+    Vector<SceneObject*> sceneObjects;
+    sceneObjects.reserve( objectCount );
+    for ( U32 objectIndex = 0; objectIndex < objectCount; ++objectIndex )
+    {
+        SceneObject* pSceneObject = new SceneObject();
+        pSceneObject->setClassNamespace( sceneObjectCollisionBenchmarkNamespace );
+        pSceneObject->registerObject();
+        pScene->addToScene( pSceneObject );
+        pSceneObject->setCollisionCallback( true );
+        pSceneObject->createPolygonBoxCollisionShape( 1.0f, 1.0f );
+        sceneObjects.push_back( pSceneObject );
+    }
+
+    // Create synthetic two-point contacts between distinct pairs of objects.
+    typeContactVector contacts;
+    contacts.reserve( contactCount );
+    for ( U32 contactIndex = 0; contactIndex < contactCount; ++contactIndex )
+    {
+        SceneObject* pSceneObjectA = sceneObjects[contactIndex % objectCount];
+        SceneObject* pSceneObjectB = sceneObjects[(contactIndex + 1 + contactIndex / objectCount) % objectCount];
+
+        TickContact tickContact;
+        tickContact.initialize( NULL, pSceneObjectA, pSceneObjectB, pSceneObjectA->getBody()->GetFixtureList(), pSceneObjectB->getBody()->GetFixtureList() );
+        tickContact.mPointCount = 2;
+        tickContact.mWorldManifold.normal.Set( 0.0f, 1.0f );
+        tickContact.mWorldManifold.points[0].Set( -0.5f, 0.5f );
+        tickContact.mWorldManifold.points[1].Set( 0.5f, 0.5f );
+        contacts.push_back( tickContact );
+    }
+
+    // Time the per-contact callbacks.
+    F64 startTime = Platform::getHighResolutionMilliseconds();
+    for ( U32 iteration = 0; iteration < iterations; ++iteration )
+    {
+        pScene->dispatchContactCallbacks( contacts, sceneCollisionCallbackName, collisionCallbackName, true );
+        pScene->dispatchContactCallbacks( contacts, sceneEndCollisionCallbackName, endCollisionCallbackName, false );
     }
+    perContactTime = (F32)((Platform::getHighResolutionMilliseconds() - startTime) * 1000000.0 / (iterations * contactCount * 2));
+
+    // Time the batched callbacks.
+    startTime = Platform::getHighResolutionMilliseconds();
+    for ( U32 iteration = 0; iteration < iterations; ++iteration )
+    {
+        pScene->dispatchBatchedContactCallbacks( contacts, sceneCollisionBatchCallbackName, collisionBatchCallbackName, true );
+        pScene->dispatchBatchedContactCallbacks( contacts, sceneEndCollisionBatchCallbackName, endCollisionBatchCallbackName, false );
+    }
+    batchedTime = (F32)((Platform::getHighResolutionMilliseconds() - startTime) * 1000000.0 / (iterations * contactCount * 2));
+
+    // Delete the scene and its objects.
+    pScene->deleteObject();
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::integrateObjectJob( void* context, U32 jobIndex )
+{
+    // Fetch the scene.
+    Scene* pScene = static_cast<Scene*>( context );
+
+    // Fetch the integration job.
+    const IntegrationJob& integrationJob = pScene->mIntegrationJobs[jobIndex];
+
+    // Integrate.
+    // NOTE:-   This can run on a worker thread.
+    integrationJob.mpSceneObject->integrateJob( integrationJob.mJobIndex, pScene->mSceneTime, Tickable::smTickSec );
 }
 
 //-----------------------------------------------------------------------------
@@ -739,8 +1171,6 @@ void Scene::processTick( void )
     if ( !getScenePause() )
     {
         // Reset object stats.
-        U32 objectsEnabled = 0;
-        U32 objectsVisible = 0;
         U32 objectsAwake   = 0;
 
         // Fetch if a "normal" i.e. non-editor scene.
@@ -752,43 +1182,44 @@ void Scene::processTick( void )
         // Clear ticked scene objects.
         mTickedSceneObjects.clear();
 
-        // Iterate scene objects.
-        for( S32 n = 0; n < mSceneObjects.size(); ++n )
+        // Iterate active scene objects.
+        // NOTE:-   Objects at rest are not in the active set so there is nothing to tick for them.
+        for( S32 n = 0; n < mActiveSceneObjects.size(); ++n )
         {
             // Fetch scene object.
-            SceneObject* pSceneObject = mSceneObjects[n];
+            SceneObject* pSceneObject = mActiveSceneObjects[n];
 
-            // Update awake/asleep counts.
+            // Skip if the scene object is not eligible for ticking.
+            if ( !pSceneObject->isEnabled() || pSceneObject->isBeingDeleted() )
+                continue;
+
+            // Update awake count.
             if ( pSceneObject->getAwake() )
                 objectsAwake++;
 
-            // Update visible.
-            if ( pSceneObject->getVisible() )
-                objectsVisible++;
-
-            // Push scene object if it's eligible for ticking.
-            if ( pSceneObject->isEnabled() )
-            {
-                // Update enabled.
-                objectsEnabled++;
-
-                // Add to ticked objects if object is not being deleted and this is a "normal" scene or
-                // the object is marked as allowing editor ticks.
-                if ( !pSceneObject->isBeingDeleted() && (isNormalScene || pSceneObject->getIsEditorTickAllowed() )  )
-                    mTickedSceneObjects.push_back( pSceneObject );
-            }
+            // Add to ticked objects if this is a "normal" scene or the object is marked as allowing editor ticks.
+            if ( isNormalScene || pSceneObject->getIsEditorTickAllowed() )
+                mTickedSceneObjects.push_back( pSceneObject );
         }
 
         // Update object stats.
-        mDebugStats.objectsEnabled = objectsEnabled;
-        mDebugStats.objectsVisible = objectsVisible;
+        mDebugStats.objectsEnabled = mEnabledObjectCount;
+        mDebugStats.objectsVisible = mVisibleObjectCount;
         mDebugStats.objectsAwake   = objectsAwake;
 
+        // Reset tile chunk stats.
+        mDebugStats.tileChunksBuilt    = 0;
+        mDebugStats.tileChunksEvicted  = 0;
+        mDebugStats.tileChunksResident = 0;
+
         // Debug Status Reference.
         DebugStats* pDebugStats = &mDebugStats;
 
+        // Objects activated before integration join the ticked objects.
+        mJoinTickedSceneObjects = true;
+
         // Fetch ticked scene object count.
-        const S32 tickedSceneObjectCount = mTickedSceneObjects.size();
+        S32 tickedSceneObjectCount = mTickedSceneObjects.size();
 
         // ****************************************************
         // Pre-integrate objects.
@@ -840,11 +1271,15 @@ void Scene::processTick( void )
 
         // Reset contacts.
         mBeginContacts.clear();
+        mBeginContactIndices.clear();
         mEndContacts.clear();
 
         // Only step the physics if a "normal" scene.
         if ( isNormalScene )
         {
+            // Collide and solve on the thread pool if requested.
+            mpWorld->SetTaskExecutor( mParallelPhysics && ThreadPool::getGlobal() != NULL ? this : NULL );
+
             // Step the physics.
             mpWorld->Step( Tickable::smTickSec, mVelocityIterations, mPositionIterations );
         }
@@ -855,6 +1290,11 @@ void Scene::processTick( void )
         // Forward the contacts.
         forwardContacts();
 
+        // Stop joining the ticked objects and include any that were woken.
+        // NOTE:-   Woken objects were at rest so have nothing to pre-integrate.
+        mJoinTickedSceneObjects = false;
+        tickedSceneObjectCount = mTickedSceneObjects.size();
+
         // ****************************************************
         // Integrate objects.
         // ****************************************************
@@ -869,6 +1309,46 @@ void Scene::processTick( void )
             mTickedSceneObjects[i]->integrateObject( mSceneTime, Tickable::smTickSec, pDebugStats );
         }
 
+        // ****************************************************
+        // Integration jobs.
+        // ****************************************************
+
+        // Gather the integration jobs the ticked scene objects have requested.
+        mIntegrationJobs.clear();
+        for ( S32 i = 0; i < tickedSceneObjectCount; ++i )
+        {
+            // Fetch the scene object.
+            SceneObject* pSceneObject = mTickedSceneObjects[i];
+
+            // Add its jobs.
+            const U32 jobCount = pSceneObject->getIntegrationJobCount();
+            for ( U32 jobIndex = 0; jobIndex < jobCount; ++jobIndex )
+            {
+                IntegrationJob integrationJob;
+                integrationJob.mpSceneObject = pSceneObject;
+                integrationJob.mJobIndex = jobIndex;
+                mIntegrationJobs.push_back( integrationJob );
+            }
+        }
+
+        // Run the integration jobs.
+        if ( mIntegrationJobs.size() > 0 )
+        {
+            // Debug Profiling.
+            PROFILE_SCOPE(Scene_IntegrationJobs);
+
+            ThreadPool* pThreadPool = ThreadPool::getGlobal();
+            if ( pThreadPool == NULL )
+            {
+                for ( U32 i = 0; i < (U32)mIntegrationJobs.size(); ++i )
+                    integrateObjectJob( this, i );
+            }
+            else
+            {
+                pThreadPool->parallelFor( &integrateObjectJob, this, (U32)mIntegrationJobs.size() );
+            }
+        }
+
         // ****************************************************
         // Post-Integrate Stage.
         // ****************************************************
@@ -900,6 +1380,12 @@ void Scene::processTick( void )
             dispatchBeginContactCallbacks();
         }
 
+        // Remove scene objects that have come to rest from the active set.
+        pruneActiveSceneObjects();
+
+        // Rebuild the world query snapshot if enough has moved.
+        mpWorldQuery->updateSnapshot();
+
         // Clear ticked scene objects.
         mTickedSceneObjects.clear();
     }
@@ -922,14 +1408,14 @@ void Scene::interpolateTick( F32 timeDelta )
     // Interpolate scene objects.
     // ****************************************************
 
-    // Fetch the scene object count.
-    const S32 sceneObjectCount = mSceneObjects.size();
+    // Fetch the active scene object count.
+    const S32 activeSceneObjectCount = mActiveSceneObjects.size();
 
-    // Iterate scene objects.
-    for( S32 n = 0; n < sceneObjectCount; ++n )
+    // Iterate active scene objects.
+    for( S32 n = 0; n < activeSceneObjectCount; ++n )
     {
         // Fetch scene object.
-        SceneObject* pSceneObject = mSceneObjects[n];
+        SceneObject* pSceneObject = mActiveSceneObjects[n];
 
         // Skip interpolation of scene object if it's not eligible.
         if ( !pSceneObject->isEnabled() || pSceneObject->isBeingDeleted() )
@@ -953,6 +1439,9 @@ void Scene::sceneRender( const SceneRenderState* pSceneRenderState )
     pDebugStats->renderPicked                   = 0;
     pDebugStats->renderRequests                 = 0;
     pDebugStats->renderFallbacks                = 0;
+    pDebugStats->renderSortsReused              = 0;
+    pDebugStats->renderSortsPatched             = 0;
+    pDebugStats->renderSortsResorted            = 0;
     pDebugStats->batchTrianglesSubmitted        = 0;
     pDebugStats->batchDrawCallsStrictSingle     = 0;
     pDebugStats->batchDrawCallsStrictMultiple   = 0;
@@ -1090,8 +1579,28 @@ void Scene::sceneRender( const SceneRenderState* pSceneRenderState )
                     // Set render queue mode.
                     pSceneRenderQueue->setSortMode( mode );
 
-                    // Sort the render requests.
-                    pSceneRenderQueue->sort();
+                    // Is the layer sorting coherently?
+                    if ( mLayerSortCoherent[layer] )
+                    {
+                        // Yes, so sort the render requests starting from last frame's order.
+                        switch( pSceneRenderQueue->sortCoherent( mLayerSortHistory[layer] ) )
+                        {
+                            case SceneRenderQueue::COHERENT_SORT_REUSED:    pDebugStats->renderSortsReused++; break;
+                            case SceneRenderQueue::COHERENT_SORT_PATCHED:   pDebugStats->renderSortsPatched++; break;
+                            case SceneRenderQueue::COHERENT_SORT_RESORTED:  pDebugStats->renderSortsResorted++; break;
+                            default: break;
+                        }
+                    }
+                    else
+                    {
+                        // No, so sort the render requests.
+                        pSceneRenderQueue->sort();
+                    }
+                }
+                else
+                {
+                    // No, so forget the layer order.
+                    mLayerSortHistory[layer].clear();
                 }
 
                 // Iterate render requests.
@@ -1339,6 +1848,15 @@ void Scene::addToScene( SceneObject* pSceneObject )
     // Register with the scene.
     pSceneObject->OnRegisterScene( this );
 
+    // Update object counts.
+    if ( pSceneObject->isEnabled() )
+        mEnabledObjectCount++;
+    if ( pSceneObject->getVisible() )
+        mVisibleObjectCount++;
+
+    // New objects are always ticked.
+    addActiveSceneObject( pSceneObject );
+
     // Perform callback only if properly added to the simulation.
     if ( pSceneObject->isProperlyAdded() )
     {
@@ -1384,6 +1902,16 @@ void Scene::removeFromScene( SceneObject* pSceneObject )
     // Unregister from scene.
     pSceneObject->OnUnregisterScene( this );
 
+    // Remove from the active set.
+    // NOTE:-   This must happen after unregistering as destroying the body can wake it.
+    removeActiveSceneObject( pSceneObject );
+
+    // Update object counts.
+    if ( pSceneObject->isEnabled() )
+        mEnabledObjectCount--;
+    if ( pSceneObject->getVisible() )
+        mVisibleObjectCount--;
+
     // Find scene object and remove it quickly.
     for ( S32 n = 0; n < mSceneObjects.size(); ++n )
     {
@@ -1400,6 +1928,78 @@ void Scene::removeFromScene( SceneObject* pSceneObject )
 
 //-----------------------------------------------------------------------------
 
+void Scene::addActiveSceneObject( SceneObject* pSceneObject )
+{
+    // Sanity!
+    AssertFatal( pSceneObject->getScene() == this, "Scene::addActiveSceneObject() - Object is not in this scene." );
+
+    // Finish if already active.
+    if ( pSceneObject->mActiveIndex != -1 )
+        return;
+
+    // Add to the active set.
+    pSceneObject->mActiveIndex = mActiveSceneObjects.size();
+    mActiveSceneObjects.push_back( pSceneObject );
+
+    // Finish if the ticked objects are not being joined.
+    // NOTE:-   This lets objects woken by the physics step be integrated in the same tick.
+    if ( !mJoinTickedSceneObjects )
+        return;
+
+    // Add to ticked objects if eligible in the same way as the active set is gathered.
+    if ( pSceneObject->isEnabled() && !pSceneObject->isBeingDeleted() && ( !getIsEditorScene() || pSceneObject->getIsEditorTickAllowed() ) )
+        mTickedSceneObjects.push_back( pSceneObject );
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::removeActiveSceneObject( SceneObject* pSceneObject )
+{
+    // Fetch the active index.
+    const S32 activeIndex = pSceneObject->mActiveIndex;
+
+    // Finish if not active.
+    if ( activeIndex == -1 )
+        return;
+
+    // Sanity!
+    AssertFatal( mActiveSceneObjects[activeIndex] == pSceneObject, "Scene::removeActiveSceneObject() - The active set has become corrupt." );
+
+    // Remove quickly, moving the last active object into its place.
+    mActiveSceneObjects.erase_fast( activeIndex );
+    if ( activeIndex < mActiveSceneObjects.size() )
+        mActiveSceneObjects[activeIndex]->mActiveIndex = activeIndex;
+
+    pSceneObject->mActiveIndex = -1;
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::pruneActiveSceneObjects( void )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(Scene_PruneActiveSceneObjects);
+
+    S32 n = 0;
+    while ( n < mActiveSceneObjects.size() )
+    {
+        // Fetch scene object.
+        SceneObject* pSceneObject = mActiveSceneObjects[n];
+
+        // Keep the scene object if it still needs ticking.
+        if ( pSceneObject->isEnabled() && !pSceneObject->isBeingDeleted() && pSceneObject->getTickRequired() )
+        {
+            ++n;
+            continue;
+        }
+
+        // Remove it; the last active object takes its place so don't advance.
+        removeActiveSceneObject( pSceneObject );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
 SceneObject* Scene::getSceneObject( const U32 objectIndex ) const
 {
     // Sanity!
@@ -1455,6 +2055,52 @@ U32 Scene::getSceneObjects( typeSceneObjectVector& objects, const U32 sceneLayer
 
 //-----------------------------------------------------------------------------
 
+U32 Scene::pickAABBs( const b2AABB* pAABBs, const U32 count, const U32 sceneGroupMask, const U32 sceneLayerMask, const PickMode pickMode )
+{
+    // Is the pick mode supported?
+    if ( pickMode != PICK_AABB && pickMode != PICK_OOBB )
+    {
+        // No, so warn.
+        Con::warnf( "Scene::pickAABBs() - Unsupported pick mode '%s'.", getPickModeDescription( pickMode ) );
+        return 0;
+    }
+
+    // Fetch world query and clear results.
+    WorldQuery* pWorldQuery = getWorldQuery( true );
+
+    // Set filter.
+    WorldQueryFilter queryFilter( sceneLayerMask, sceneGroupMask, true, false, true, true );
+    pWorldQuery->setQueryFilter( queryFilter );
+
+    // Perform query.
+    return pickMode == PICK_AABB ? pWorldQuery->aabbQueryAABBs( pAABBs, count ) : pWorldQuery->oobbQueryAABBs( pAABBs, count );
+}
+
+//-----------------------------------------------------------------------------
+
+U32 Scene::pickRays( const Vector2* pPoints1, const Vector2* pPoints2, const U32 count, const U32 sceneGroupMask, const U32 sceneLayerMask, const PickMode pickMode )
+{
+    // Is the pick mode supported?
+    if ( pickMode != PICK_AABB && pickMode != PICK_OOBB )
+    {
+        // No, so warn.
+        Con::warnf( "Scene::pickRays() - Unsupported pick mode '%s'.", getPickModeDescription( pickMode ) );
+        return 0;
+    }
+
+    // Fetch world query and clear results.
+    WorldQuery* pWorldQuery = getWorldQuery( true );
+
+    // Set filter.
+    WorldQueryFilter queryFilter( sceneLayerMask, sceneGroupMask, true, false, true, true );
+    pWorldQuery->setQueryFilter( queryFilter );
+
+    // Perform query.
+    return pickMode == PICK_AABB ? pWorldQuery->aabbQueryRays( pPoints1, pPoints2, count ) : pWorldQuery->oobbQueryRays( pPoints1, pPoints2, count );
+}
+
+//-----------------------------------------------------------------------------
+
 const AssetPtr<AssetBase>* Scene::getAssetPreload( const S32 index ) const
 {
     // Is the index valid?
@@ -1659,6 +2305,10 @@ bool Scene::hasJoints( SceneObject* pSceneObject )
     // Fetch body.
     b2Body* pBody = pSceneObject->getBody();
 
+    // Render-only objects have no joints.
+    if ( pBody == NULL )
+        return false;
+
     // Fetch joint edge.
     b2JointEdge* pJointEdge = pBody->GetJointList();
 
@@ -1672,7 +2322,7 @@ bool Scene::hasJoints( SceneObject* pSceneObject )
 //-----------------------------------------------------------------------------
 
 S32 Scene::createDistanceJoint(
-    const SceneObject* pSceneObjectA, const SceneObject* pSceneObjectB,
+    SceneObject* pSceneObjectA, SceneObject* pSceneObjectB,
     const b2Vec2& localAnchorA, const b2Vec2& localAnchorB,
     const F32 length,
     const F32 frequency,
@@ -1696,8 +2346,8 @@ S32 Scene::createDistanceJoint(
     }
 
     // Fetch bodies.
-    b2Body* pBodyA = pSceneObjectA != NULL ? pSceneObjectA->getBody() : getGroundBody();
-    b2Body* pBodyB = pSceneObjectB != NULL ? pSceneObjectB->getBody() : getGroundBody();
+    b2Body* pBodyA = pSceneObjectA != NULL ? pSceneObjectA->getPhysicsBody() : getGroundBody();
+    b2Body* pBodyB = pSceneObjectB != NULL ? pSceneObjectB->getPhysicsBody() : getGroundBody();
     
     // Populate definition.
     b2DistanceJointDef jointDef;
@@ -1886,7 +2536,7 @@ F32 Scene::getDistanceJointDampingRatio( const U32 jointId )
 //-----------------------------------------------------------------------------
 
 S32 Scene::createRopeJoint(
-        const SceneObject* pSceneObjectA, const SceneObject* pSceneObjectB,
+        SceneObject* pSceneObjectA, SceneObject* pSceneObjectB,
         const b2Vec2& localAnchorA, const b2Vec2& localAnchorB,
         const F32 maxLength,
         const bool collideConnected )
@@ -1908,8 +2558,8 @@ S32 Scene::createRopeJoint(
     }
 
     // Fetch bodies.
-    b2Body* pBodyA = pSceneObjectA != NULL ? pSceneObjectA->getBody() : getGroundBody();
-    b2Body* pBodyB = pSceneObjectB != NULL ? pSceneObjectB->getBody() : getGroundBody();
+    b2Body* pBodyA = pSceneObjectA != NULL ? pSceneObjectA->getPhysicsBody() : getGroundBody();
+    b2Body* pBodyB = pSceneObjectB != NULL ? pSceneObjectB->getPhysicsBody() : getGroundBody();
     
     // Populate definition.
     b2RopeJointDef jointDef;
@@ -1984,7 +2634,7 @@ F32 Scene::getRopeJointMaxLength( const U32 jointId )
 //-----------------------------------------------------------------------------
 
 S32 Scene::createRevoluteJoint(
-        const SceneObject* pSceneObjectA, const SceneObject* pSceneObjectB,
+        SceneObject* pSceneObjectA, SceneObject* pSceneObjectB,
         const b2Vec2& localAnchorA, const b2Vec2& localAnchorB,
         const bool collideConnected )
 {
@@ -2005,8 +2655,8 @@ S32 Scene::createRevoluteJoint(
     }
 
     // Fetch bodies.
-    b2Body* pBodyA = pSceneObjectA != NULL ? pSceneObjectA->getBody() : getGroundBody();
-    b2Body* pBodyB = pSceneObjectB != NULL ? pSceneObjectB->getBody() : getGroundBody();
+    b2Body* pBodyA = pSceneObjectA != NULL ? pSceneObjectA->getPhysicsBody() : getGroundBody();
+    b2Body* pBodyB = pSceneObjectB != NULL ? pSceneObjectB->getPhysicsBody() : getGroundBody();
     
     // Populate definition.
     b2RevoluteJointDef jointDef;
@@ -2212,7 +2862,7 @@ F32	Scene::getRevoluteJointSpeed( const U32 jointId )
 //-----------------------------------------------------------------------------
 
 S32 Scene::createWeldJoint(
-        const SceneObject* pSceneObjectA, const SceneObject* pSceneObjectB,
+        SceneObject* pSceneObjectA, SceneObject* pSceneObjectB,
         const b2Vec2& localAnchorA, const b2Vec2& localAnchorB,
         const F32 frequency,
         const F32 dampingRatio,
@@ -2235,8 +2885,8 @@ S32 Scene::createWeldJoint(
     }
 
     // Fetch bodies.
-    b2Body* pBodyA = pSceneObjectA != NULL ? pSceneObjectA->getBody() : getGroundBody();
-    b2Body* pBodyB = pSceneObjectB != NULL ? pSceneObjectB->getBody() : getGroundBody();
+    b2Body* pBodyA = pSceneObjectA != NULL ? pSceneObjectA->getPhysicsBody() : getGroundBody();
+    b2Body* pBodyB = pSceneObjectB != NULL ? pSceneObjectB->getPhysicsBody() : getGroundBody();
     
     // Populate definition.
     b2WeldJointDef jointDef;
@@ -2370,7 +3020,7 @@ F32 Scene::getWeldJointDampingRatio( const U32 jointId )
 //-----------------------------------------------------------------------------
 
 S32 Scene::createWheelJoint(
-        const SceneObject* pSceneObjectA, const SceneObject* pSceneObjectB,
+        SceneObject* pSceneObjectA, SceneObject* pSceneObjectB,
         const b2Vec2& localAnchorA, const b2Vec2& localAnchorB,
         const b2Vec2& worldAxis,
         const bool collideConnected )
@@ -2392,8 +3042,8 @@ S32 Scene::createWheelJoint(
     }
 
     // Fetch bodies.
-    b2Body* pBodyA = pSceneObjectA != NULL ? pSceneObjectA->getBody() : getGroundBody();
-    b2Body* pBodyB = pSceneObjectB != NULL ? pSceneObjectB->getBody() : getGroundBody();
+    b2Body* pBodyA = pSceneObjectA != NULL ? pSceneObjectA->getPhysicsBody() : getGroundBody();
+    b2Body* pBodyB = pSceneObjectB != NULL ? pSceneObjectB->getPhysicsBody() : getGroundBody();
     
     // Populate definition.
     b2WheelJointDef jointDef;
@@ -2592,7 +3242,7 @@ F32 Scene::getWheelJointDampingRatio( const U32 jointId )
 //-----------------------------------------------------------------------------
 
 S32 Scene::createFrictionJoint(
-        const SceneObject* pSceneObjectA, const SceneObject* pSceneObjectB,
+        SceneObject* pSceneObjectA, SceneObject* pSceneObjectB,
         const b2Vec2& localAnchorA, const b2Vec2& localAnchorB,
         const F32 maxForce,
         const F32 maxTorque,
@@ -2615,8 +3265,8 @@ S32 Scene::createFrictionJoint(
     }
 
     // Fetch bodies.
-    b2Body* pBodyA = pSceneObjectA != NULL ? pSceneObjectA->getBody() : getGroundBody();
-    b2Body* pBodyB = pSceneObjectB != NULL ? pSceneObjectB->getBody() : getGroundBody();
+    b2Body* pBodyA = pSceneObjectA != NULL ? pSceneObjectA->getPhysicsBody() : getGroundBody();
+    b2Body* pBodyB = pSceneObjectB != NULL ? pSceneObjectB->getPhysicsBody() : getGroundBody();
     
     // Populate definition.
     b2FrictionJointDef jointDef;
@@ -2749,7 +3399,7 @@ F32 Scene::getFrictionJointMaxTorque( const U32 jointId )
 //-----------------------------------------------------------------------------
 
 S32 Scene::createPrismaticJoint(
-        const SceneObject* pSceneObjectA, const SceneObject* pSceneObjectB,
+        SceneObject* pSceneObjectA, SceneObject* pSceneObjectB,
         const b2Vec2& localAnchorA, const b2Vec2& localAnchorB,
         const b2Vec2& worldAxis,
         const bool collideConnected )
@@ -2771,8 +3421,8 @@ S32 Scene::createPrismaticJoint(
     }
 
     // Fetch bodies.
-    b2Body* pBodyA = pSceneObjectA != NULL ? pSceneObjectA->getBody() : getGroundBody();
-    b2Body* pBodyB = pSceneObjectB != NULL ? pSceneObjectB->getBody() : getGroundBody();
+    b2Body* pBodyA = pSceneObjectA != NULL ? pSceneObjectA->getPhysicsBody() : getGroundBody();
+    b2Body* pBodyB = pSceneObjectB != NULL ? pSceneObjectB->getPhysicsBody() : getGroundBody();
     
     // Populate definition.
     b2PrismaticJointDef jointDef;
@@ -2925,7 +3575,7 @@ bool Scene::getPrismaticJointMotor(
 //-----------------------------------------------------------------------------
 
 S32 Scene::createPulleyJoint(
-        const SceneObject* pSceneObjectA, const SceneObject* pSceneObjectB,
+        SceneObject* pSceneObjectA, SceneObject* pSceneObjectB,
         const b2Vec2& localAnchorA, const b2Vec2& localAnchorB,
         const b2Vec2& worldGroundAnchorA, const b2Vec2& worldGroundAnchorB,
         const F32 ratio,
@@ -2949,8 +3599,8 @@ S32 Scene::createPulleyJoint(
     }
 
     // Fetch bodies.
-    b2Body* pBodyA = pSceneObjectA != NULL ? pSceneObjectA->getBody() : getGroundBody();
-    b2Body* pBodyB = pSceneObjectB != NULL ? pSceneObjectB->getBody() : getGroundBody();
+    b2Body* pBodyA = pSceneObjectA != NULL ? pSceneObjectA->getPhysicsBody() : getGroundBody();
+    b2Body* pBodyB = pSceneObjectB != NULL ? pSceneObjectB->getPhysicsBody() : getGroundBody();
     
     // Populate definition.
     b2PulleyJointDef jointDef;
@@ -2973,7 +3623,7 @@ S32 Scene::createPulleyJoint(
 //-----------------------------------------------------------------------------
 
 S32 Scene::createTargetJoint(
-        const SceneObject* pSceneObject,
+        SceneObject* pSceneObject,
         const b2Vec2& worldTarget,
         const F32 maxForce,
         const bool useCenterOfMass,
@@ -2997,7 +3647,7 @@ S32 Scene::createTargetJoint(
     }
 
     // Fetch bodies.
-    b2Body* pBody = pSceneObject->getBody();
+    b2Body* pBody = pSceneObject->getPhysicsBody();
     
     // Populate definition.
     b2MouseJointDef jointDef;
@@ -3254,7 +3904,7 @@ F32 Scene::getTargetJointDampingRatio( const U32 jointId )
 //-----------------------------------------------------------------------------
 
 S32 Scene::createMotorJoint(
-            const SceneObject* pSceneObjectA, const SceneObject* pSceneObjectB,
+            SceneObject* pSceneObjectA, SceneObject* pSceneObjectB,
             const b2Vec2 linearOffset,
             const F32 angularOffset,
             const F32 maxForce,
@@ -3279,8 +3929,8 @@ S32 Scene::createMotorJoint(
     }
 
     // Fetch bodies.
-    b2Body* pBodyA = pSceneObjectA != NULL ? pSceneObjectA->getBody() : getGroundBody();
-    b2Body* pBodyB = pSceneObjectB != NULL ? pSceneObjectB->getBody() : getGroundBody();
+    b2Body* pBodyA = pSceneObjectA != NULL ? pSceneObjectA->getPhysicsBody() : getGroundBody();
+    b2Body* pBodyB = pSceneObjectB != NULL ? pSceneObjectB->getPhysicsBody() : getGroundBody();
     
     // Populate definition.
     b2MotorJointDef jointDef;
@@ -3589,6 +4239,41 @@ SceneRenderQueue::RenderSort Scene::getLayerSortMode( const U32 layer )
 
 //-----------------------------------------------------------------------------
 
+void Scene::setLayerSortCoherent( const U32 layer, const bool coherent )
+{
+    // Is the layer valid?
+    if ( layer >= MAX_LAYERS_SUPPORTED )
+    {
+        // No, so warn.
+        Con::warnf( "Scene::setLayerSortCoherent() - Layer '%d' is out of range.", layer );
+
+        return;
+    }
+
+    mLayerSortCoherent[layer] = coherent;
+
+    // Forget the layer order.
+    mLayerSortHistory[layer].clear();
+}
+
+//-----------------------------------------------------------------------------
+
+bool Scene::getLayerSortCoherent( const U32 layer )
+{
+    // Is the layer valid?
+    if ( layer >= MAX_LAYERS_SUPPORTED )
+    {
+        // No, so warn.
+        Con::warnf( "Scene::getLayerSortCoherent() - Layer '%d' is out of range.", layer );
+
+        return false;
+    }
+
+    return mLayerSortCoherent[layer];
+}
+
+//-----------------------------------------------------------------------------
+
 void Scene::attachSceneWindow( SceneWindow* pSceneWindow2D )
 {
     // Ignore if already attached.
@@ -81,6 +81,7 @@ extern EnumTable jointTypeTable;
 
 ///-----------------------------------------------------------------------------
 
+class Scene;
 class SceneObject;
 class SceneWindow;
 
@@ -157,12 +158,27 @@ struct TickContact
 
 ///-----------------------------------------------------------------------------
 
+/// Native contact listener.
+/// Receives each ticks contacts as a contiguous buffer before any script callbacks are dispatched.
+class SceneContactListener
+{
+public:
+    virtual ~SceneContactListener() {}
+
+    virtual void onSceneBeginContacts( Scene* pScene, const TickContact* pContacts, const U32 contactCount ) {}
+    virtual void onSceneEndContacts( Scene* pScene, const TickContact* pContacts, const U32 contactCount ) {}
+};
+
+///-----------------------------------------------------------------------------
+
 class Scene :
     public BehaviorComponent,
     public TamlChildren,
     public PhysicsProxy,
     public b2ContactListener,
     public b2DestructionListener,
+    public b2TaskExecutor,
+    public b2WakeListener,
     public virtual Tickable
 {
 public:
@@ -170,7 +186,10 @@ public:
     typedef HashMap<U32, S32>                   typeReverseJointHash;
     typedef Vector<tDeleteRequest>              typeDeleteVector;
     typedef Vector<TickContact>                 typeContactVector;
-    typedef HashMap<b2Contact*, TickContact>    typeContactHash;
+    typedef HashMap<b2Contact*, U32>            typeContactIndexHash;
+    typedef Vector<SceneContactListener*>       typeContactListenerVector;
+    typedef HashMap<SceneObject*, U32>          typeCollisionReceiverHash;
+    typedef HashMap<SceneObject*, U32>          typeCollisionBatchHash;
     typedef Vector<AssetPtr<AssetBase>*>        typeAssetPtrVector;
 
     /// Scene Debug Options.
@@ -210,18 +229,35 @@ private:
     typedef BehaviorComponent   Parent;
     typedef SceneObject         Children;
 
+    /// Integration job.
+    struct IntegrationJob
+    {
+        SceneObject*    mpSceneObject;
+        U32             mJobIndex;
+    };
+
+    typedef Vector<IntegrationJob>  typeIntegrationJobVector;
+
     /// World.
     b2World*                    mpWorld;
     WorldQuery*                 mpWorldQuery;
     b2Vec2                      mWorldGravity;
     S32                         mVelocityIterations;
     S32                         mPositionIterations;
+    bool                        mParallelPhysics;
+    b2TaskFunction*             mpPhysicsTask;
+    void*                       mpPhysicsTaskContext;
     b2BlockAllocator            mBlockAllocator;
     b2Body*                     mpGroundBody;
 
     /// Scene occupancy.
     typeSceneObjectVector       mSceneObjects;
     typeSceneObjectVector       mTickedSceneObjects;
+    typeSceneObjectVector       mActiveSceneObjects;
+    bool                        mJoinTickedSceneObjects;
+    U32                         mEnabledObjectCount;
+    U32                         mVisibleObjectCount;
+    typeIntegrationJobVector    mIntegrationJobs;
 
     /// Joint access.
     typeJointHash               mJoints;
@@ -245,6 +281,8 @@ private:
 
     /// Layer sorting and draw order.
     SceneRenderQueue::RenderSort mLayerSortModes[MAX_LAYERS_SUPPORTED];
+    bool                        mLayerSortCoherent[MAX_LAYERS_SUPPORTED];
+    SceneRenderQueue::SortHistory mLayerSortHistory[MAX_LAYERS_SUPPORTED];
 
     /// Batch rendering.
     BatchRender                 mBatchRenderer;
@@ -263,15 +301,56 @@ private:
     S32                         mIsEditorScene;
     bool                        mUpdateCallback;
     bool                        mRenderCallback;
-    typeContactHash             mBeginContacts;
+    typeContactVector           mBeginContacts;
+    typeContactIndexHash        mBeginContactIndices;
     typeContactVector           mEndContacts;
+    typeContactListenerVector   mContactListeners;
+    typeCollisionReceiverHash   mCollisionReceivers;
+
+    /// Batched collision callbacks.
+    struct CollisionBatchRecord
+    {
+        U32             mBatchIndex;
+        U32             mContactIndex;
+        SceneObject*    mpCollideWith;
+    };
+    bool                        mBatchCollisionCallbacks;
+    Vector<CollisionBatchRecord> mCollisionBatchRecords;
+    Vector<CollisionBatchRecord> mCollisionBatchSorted;
+    Vector<SceneObject*>        mCollisionBatchObjects;
+    Vector<U32>                 mCollisionBatchOffsets;
+    typeCollisionBatchHash      mCollisionBatchIndices;
+    Vector<char>                mCollisionBatchBuffer;
     U32                         mSceneIndex;
 
 private:   
     /// Contacts.
+    enum CollisionReceiver
+    {
+        COLLISION_RECEIVER_NONE,
+        COLLISION_RECEIVER_OBJECT,
+        COLLISION_RECEIVER_BEHAVIORS,
+    };
+
     void                        forwardContacts( void );
+
+    /// Active set.
+    void                        removeActiveSceneObject( SceneObject* pSceneObject );
+    void                        pruneActiveSceneObjects( void );
+
     void                        dispatchBeginContactCallbacks( void );
     void                        dispatchEndContactCallbacks( void );
+    CollisionReceiver           findCollisionReceiver( BehaviorComponent* pObject, StringTableEntry callbackName );
+    CollisionReceiver           findCachedCollisionReceiver( SceneObject* pSceneObject, StringTableEntry callbackName );
+    void                        dispatchContactCallbacks( const typeContactVector& contacts, StringTableEntry sceneCallbackName, StringTableEntry objectCallbackName, const bool includeManifold );
+    void                        dispatchBatchedContactCallbacks( const typeContactVector& contacts, StringTableEntry sceneCallbackName, StringTableEntry objectCallbackName, const bool includeManifold );
+    void                        appendCollisionBatchRecord( const char* pRecord );
+
+    /// Integration jobs.
+    static void                 integrateObjectJob( void* context, U32 jobIndex );
+
+    /// Physics tasks.
+    static void                 physicsTaskJob( void* context, U32 jobIndex );
 
     /// Joint definition.
     struct CommonJointDefinition
@@ -316,9 +395,18 @@ public:
     virtual void            PostSolve( b2Contact* pContact, const b2ContactImpulse* pImpulse );
     virtual void            BeginContact( b2Contact* pContact );
     virtual void            EndContact( b2Contact* pContact );
-    const typeContactHash&  getBeginContacts( void ) const              { return mBeginContacts; }
+    const typeContactVector& getBeginContacts( void ) const             { return mBeginContacts; }
     const typeContactVector& getEndContacts( void ) const               { return mEndContacts; }
 
+    /// Physics task execution.
+    virtual void            ParallelFor( b2TaskFunction* task, void* context, int32 count );
+    virtual int32           GetThreadCount( void ) const;
+
+    /// Body waking.
+    virtual void            BodyWoken( b2Body* pBody );
+    void                    addContactListener( SceneContactListener* pContactListener );
+    void                    removeContactListener( SceneContactListener* pContactListener );
+
     /// Integration.
     virtual void            processTick();
     virtual void            interpolateTick( F32 delta );
@@ -339,18 +427,31 @@ public:
     inline S32              getVelocityIterations( void ) const         { return mVelocityIterations; }
     inline void             setPositionIterations( const S32 iterations ) { mPositionIterations = iterations; }
     inline S32              getPositionIterations( void ) const         { return mPositionIterations; }
+    inline void             setParallelPhysics( const bool parallel )   { mParallelPhysics = parallel; }
+    inline bool             getParallelPhysics( void ) const            { return mParallelPhysics; }
 
     /// Scene occupancy.
     void                    clearScene( bool deleteObjects = true );
     void                    addToScene( SceneObject* pSceneObject );
     void                    removeFromScene( SceneObject* pSceneObject );
 
+    void                    addActiveSceneObject( SceneObject* pSceneObject );
+    inline U32              getActiveSceneObjectCount( void ) const     { return mActiveSceneObjects.size(); }
+    inline void             updateEnabledObjectCount( const bool enabled ) { if ( enabled ) mEnabledObjectCount++; else mEnabledObjectCount--; }
+    inline void             updateVisibleObjectCount( const bool visible ) { if ( visible ) mVisibleObjectCount++; else mVisibleObjectCount--; }
+
     inline typeSceneObjectVectorConstRef getSceneObjects( void ) const  { return mSceneObjects; }
     inline U32              getSceneObjectCount( void ) const           { return mSceneObjects.size(); }
     SceneObject*            getSceneObject( const U32 objectIndex ) const;
     U32                     getSceneObjects( typeSceneObjectVector& objects ) const;
     U32                     getSceneObjects( typeSceneObjectVector& objects, const U32 sceneLayer ) const;
 
+    /// Batched picking.
+    /// These pick many areas or rays in a single pass leaving each query's results in the world query batch results.
+    /// Only the 'aabb' and 'oobb' pick modes are supported and ray results are not sorted by distance.
+    U32                     pickAABBs( const b2AABB* pAABBs, const U32 count, const U32 sceneGroupMask, const U32 sceneLayerMask, const PickMode pickMode );
+    U32                     pickRays( const Vector2* pPoints1, const Vector2* pPoints2, const U32 count, const U32 sceneGroupMask, const U32 sceneLayerMask, const PickMode pickMode );
+
     void                    mergeScene( const Scene* pScene );
 
     inline SimSet*			getControllers( void )						{ return mControllers; }
@@ -377,7 +478,7 @@ public:
 
     /// Distance joint.
     S32                     createDistanceJoint(
-                                const SceneObject* pSceneObjectA, const SceneObject* pSceneObjectB,
+                                SceneObject* pSceneObjectA, SceneObject* pSceneObjectB,
                                 const b2Vec2& localAnchorA = b2Vec2_zero, const b2Vec2& localAnchorB = b2Vec2_zero,
                                 const F32 length = -1.0f,
                                 const F32 frequency = 0.0f,
@@ -404,7 +505,7 @@ public:
 
     /// Rope joint.
     S32                     createRopeJoint(
-                                const SceneObject* pSceneObjectA, const SceneObject* pSceneObjectB,
+                                SceneObject* pSceneObjectA, SceneObject* pSceneObjectB,
                                 const b2Vec2& localAnchorA = b2Vec2_zero, const b2Vec2& localAnchorB = b2Vec2_zero,
                                 const F32 maxLength = -1.0f,
                                 const bool collideConnected = false );
@@ -417,7 +518,7 @@ public:
 
     /// Revolute joint.
     S32                     createRevoluteJoint(
-                                const SceneObject* pSceneObjectA, const SceneObject* pSceneObjectB,
+                                SceneObject* pSceneObjectA, SceneObject* pSceneObjectB,
                                 const b2Vec2& localAnchorA = b2Vec2_zero, const b2Vec2& localAnchorB = b2Vec2_zero,
                                 const bool collideConnected = false );
 
@@ -448,7 +549,7 @@ public:
 
     /// Weld joint.
     S32                     createWeldJoint(
-                                const SceneObject* pSceneObjectA, const SceneObject* pSceneObjectB,
+                                SceneObject* pSceneObjectA, SceneObject* pSceneObjectB,
                                 const b2Vec2& localAnchorA = b2Vec2_zero, const b2Vec2& localAnchorB = b2Vec2_zero,
                                 const F32 frequency = 0.0f,
                                 const F32 dampingRatio = 0.0f,
@@ -468,7 +569,7 @@ public:
 
     /// Wheel joint.
     S32                     createWheelJoint(
-                                const SceneObject* pSceneObjectA, const SceneObject* pSceneObjectB,
+                                SceneObject* pSceneObjectA, SceneObject* pSceneObjectB,
                                 const b2Vec2& localAnchorA, const b2Vec2& localAnchorB,
                                 const b2Vec2& worldAxis,
                                 const bool collideConnected = false );
@@ -499,7 +600,7 @@ public:
 
     /// Friction joint.
     S32                     createFrictionJoint(
-                                const SceneObject* pSceneObjectA,const  SceneObject* pSceneObjectB,
+                                SceneObject* pSceneObjectA, SceneObject* pSceneObjectB,
                                 const b2Vec2& localAnchorA = b2Vec2_zero, const b2Vec2& localAnchorB = b2Vec2_zero,
                                 const F32 maxForce = 0.0f,
                                 const F32 maxTorque = 0.0f,
@@ -519,7 +620,7 @@ public:
 
     /// Prismatic joint.
     S32                     createPrismaticJoint(
-                                const SceneObject* pSceneObjectA, const SceneObject* pSceneObjectB,
+                                SceneObject* pSceneObjectA, SceneObject* pSceneObjectB,
                                 const b2Vec2& localAnchorA, const b2Vec2& localAnchorB,
                                 const b2Vec2& worldAxis,
                                 const bool collideConnected = false );
@@ -548,7 +649,7 @@ public:
 
     /// Pulley joint.
     S32                     createPulleyJoint(
-                                const SceneObject* pSceneObjectA, const SceneObject* pSceneObjectB,
+                                SceneObject* pSceneObjectA, SceneObject* pSceneObjectB,
                                 const b2Vec2& localAnchorA, const b2Vec2& localAnchorB,
                                 const b2Vec2& worldGroundAnchorA, const b2Vec2& worldGroundAnchorB,
                                 const F32 ratio,
@@ -557,7 +658,7 @@ public:
 
     /// Target (a.k.a Mouse) joint.
     S32                     createTargetJoint(
-                                const SceneObject* pSceneObject,
+                                SceneObject* pSceneObject,
                                 const b2Vec2& worldTarget,
                                 const F32 maxForce,
                                 const bool useCenterOfMass = false,
@@ -591,7 +692,7 @@ public:
 
     /// Motor Joint.
     S32                     createMotorJoint(
-                                const SceneObject* pSceneObjectA, const SceneObject* pSceneObjectB,
+                                SceneObject* pSceneObjectA, SceneObject* pSceneObjectB,
                                 const b2Vec2 linearOffset = b2Vec2_zero,
                                 const F32 angularOffset = 0.0f,
                                 const F32 maxForce = 1.0f,
@@ -635,6 +736,8 @@ public:
     /// Layer sorting.
     void setLayerSortMode( const U32 layer, const SceneRenderQueue::RenderSort sortMode );
     SceneRenderQueue::RenderSort getLayerSortMode( const U32 layer );
+    void setLayerSortCoherent( const U32 layer, const bool coherent );
+    bool getLayerSortCoherent( const U32 layer );
 
     /// Window attachments.
     void                    attachSceneWindow( SceneWindow* pSceneWindow2D );
@@ -664,6 +767,9 @@ public:
     inline bool             getUpdateCallback( void ) const             { return mUpdateCallback; }
     inline void             setRenderCallback( const bool callback )    { mRenderCallback = callback; }
     inline bool             getRenderCallback( void ) const             { return mRenderCallback; }
+    inline void             setBatchCollisionCallbacks( const bool batch ) { mBatchCollisionCallbacks = batch; }
+    inline bool             getBatchCollisionCallbacks( void ) const    { return mBatchCollisionCallbacks; }
+    static void             benchmarkCollisionCallbacks( const U32 contactCount, const U32 iterations, F32& perContactTime, F32& batchedTime );
     static SceneRenderRequest* createDefaultRenderRequest( SceneRenderQueue* pSceneRenderQueue, SceneObject* pSceneObject  );
 
     /// Taml children.
@@ -688,10 +794,35 @@ protected:
     static bool writeGravity( void* obj, StringTableEntry pFieldName )              { return Vector2(static_cast<Scene*>(obj)->getGravity()).notEqual( Vector2::getZero() ); }
     static bool writeVelocityIterations( void* obj, StringTableEntry pFieldName )   { return static_cast<Scene*>(obj)->getVelocityIterations() != 8; }
     static bool writePositionIterations( void* obj, StringTableEntry pFieldName )   { return static_cast<Scene*>(obj)->getPositionIterations() != 3; }
+    static bool writeParallelPhysics( void* obj, StringTableEntry pFieldName )      { return static_cast<Scene*>(obj)->getParallelPhysics(); }
 
     static bool writeLayerSortMode( void* obj, StringTableEntry pFieldName )
     {
-        // Find the layer index portion of the layer sort mode field.
+        // Fetch layer number.
+        const U32 layer = getFieldLayer( pFieldName );
+
+        // Just allow the write if an bad parse.
+        if ( layer > MAX_LAYERS_SUPPORTED )
+            return true;
+
+        return static_cast<Scene*>(obj)->getLayerSortMode( layer ) != SceneRenderQueue::RENDER_SORT_NEWEST;
+    }
+
+    static bool writeLayerSortCoherent( void* obj, StringTableEntry pFieldName )
+    {
+        // Fetch layer number.
+        const U32 layer = getFieldLayer( pFieldName );
+
+        // Just allow the write if an bad parse.
+        if ( layer >= MAX_LAYERS_SUPPORTED )
+            return true;
+
+        return static_cast<Scene*>(obj)->getLayerSortCoherent( layer );
+    }
+
+    static U32 getFieldLayer( StringTableEntry pFieldName )
+    {
+        // Find the layer index portion of the layer field.
         const char* pLayerNumber = pFieldName;
         while( true )
         {
@@ -707,21 +838,15 @@ protected:
         };
 
         // Sanity!
-        AssertFatal( *pLayerNumber != 0, "Scene::writeLayerSortMode() - Could not find the layer index portion of the layer sort mode field." );
-
-        // Fetch layer number.
-        const U32 layer = dAtoi(pLayerNumber);
-
-        // Just allow the write if an bad parse.
-        if ( layer > MAX_LAYERS_SUPPORTED )
-            return true;
+        AssertFatal( *pLayerNumber != 0, "Scene::getFieldLayer() - Could not find the layer index portion of the layer field." );
 
-        return static_cast<Scene*>(obj)->getLayerSortMode( layer ) != SceneRenderQueue::RENDER_SORT_NEWEST;
+        return dAtoi(pLayerNumber);
     }
 
     // Callbacks.
     static bool writeUpdateCallback( void* obj, StringTableEntry pFieldName )       { return static_cast<Scene*>(obj)->getUpdateCallback(); }
     static bool writeRenderCallback( void* obj, StringTableEntry pFieldName )       { return static_cast<Scene*>(obj)->getRenderCallback(); }
+    static bool writeBatchCollisionCallbacks( void* obj, StringTableEntry pFieldName ) { return static_cast<Scene*>(obj)->getBatchCollisionCallbacks(); }
 
 public:
     static SimObjectPtr<Scene> LoadingScene;
@@ -28,6 +28,9 @@
 #include "2d/scene/SceneRenderObject.h"
 #endif
 
+// Script bindings.
+#include "SceneRenderQueue_ScriptBinding.h"
+
 //-----------------------------------------------------------------------------
 
 static EnumTable::Enums renderSortLookup[] =
@@ -81,6 +84,589 @@ const char* SceneRenderQueue::getRenderSortDescription( const RenderSort& sortMo
 
 //-----------------------------------------------------------------------------
 
+// Maps a float to an unsigned key with the same ordering.
+static inline U32 floatSortKey( const F32 value )
+{
+    // Treat negative zero as zero as the comparisons do.
+    union { F32 mFloat; U32 mBits; } key;
+    key.mFloat = value == 0.0f ? 0.0f : value;
+
+    return (key.mBits & 0x80000000) ? ~key.mBits : key.mBits | 0x80000000;
+}
+
+// Maps a serial Id to an unsigned key with the same ordering.
+static inline U32 serialSortKey( const S32 serialId )
+{
+    return (U32)serialId ^ 0x80000000;
+}
+
+//-----------------------------------------------------------------------------
+
+void SceneRenderQueue::sort( void )
+{
+    // Finish if not sorting.
+    if ( mSortMode == RENDER_SORT_OFF || mSortMode == RENDER_SORT_INVALID )
+        return;
+
+    // Batching means we don't need strict order.
+    if ( mSortMode == RENDER_SORT_BATCH )
+        mStrictOrderMode = false;
+
+    // Finish if nothing to sort.
+    const U32 requestCount = mRenderRequests.size();
+    if ( requestCount < 2 )
+        return;
+
+    // Debug Profiling.
+    PROFILE_SCOPE(SceneRenderQueue_Sort);
+
+    // The scratch space is only used for the duration of a sort so is shared by all queues.
+    static typeSortKeyVector sortKeys;
+    static typeSortKeyVector scratchKeys;
+
+    // Build the keys.
+    sortKeys.setSize( requestCount );
+    const U32 primaryBytes = buildSortKeys( sortKeys );
+
+    // Sort the keys.
+    radixSort( sortKeys, scratchKeys, primaryBytes );
+
+    // Reorder the requests.
+    applySortKeys( sortKeys );
+}
+
+//-----------------------------------------------------------------------------
+
+SceneRenderQueue::CoherentSort SceneRenderQueue::sortCoherent( SortHistory& sortHistory )
+{
+    // Finish if not sorting.
+    if ( mSortMode == RENDER_SORT_OFF || mSortMode == RENDER_SORT_INVALID )
+    {
+        sortHistory.clear();
+        return COHERENT_SORT_NONE;
+    }
+
+    // Batching means we don't need strict order.
+    if ( mSortMode == RENDER_SORT_BATCH )
+        mStrictOrderMode = false;
+
+    // Finish if nothing to sort.
+    const U32 requestCount = mRenderRequests.size();
+    if ( requestCount < 2 )
+    {
+        sortHistory.clear();
+        return COHERENT_SORT_NONE;
+    }
+
+    // Debug Profiling.
+    PROFILE_SCOPE(SceneRenderQueue_SortCoherent);
+
+    // The scratch space is only used for the duration of a sort so is shared by all queues.
+    static typeSortKeyVector sortKeys;
+    static typeSortKeyVector rankedKeys;
+    static typeSortKeyVector orderedKeys;
+    static typeSortKeyVector addedKeys;
+    static typeSortKeyVector scratchKeys;
+
+    // Build the keys.
+    sortKeys.setSize( requestCount );
+    const U32 primaryBytes = buildSortKeys( sortKeys );
+
+    // Only a few requests can have been added for the previous order to be worth starting from.
+    const U32 historyCount = sortHistory.getCount();
+    const U32 changeLimit = requestCount / 4;
+    bool coherent = sortHistory.mSortMode == mSortMode && historyCount > 0 && historyCount + changeLimit >= requestCount;
+
+    CoherentSort result = COHERENT_SORT_RESORTED;
+
+    if ( coherent )
+    {
+        // Place each request at its previous rank, unmatched requests go last.
+        SortKey emptyKey;
+        emptyKey.mPrimary = 0;
+        emptyKey.mSecondary = 0;
+        emptyKey.mIndex = U32_MAX;
+        rankedKeys.setSize( historyCount );
+        for ( U32 rank = 0; rank < historyCount; ++rank )
+            rankedKeys[rank] = emptyKey;
+
+        addedKeys.clear();
+        const SortKey* pSortKey = sortKeys.address();
+        for ( U32 index = 0; index < requestCount; ++index, ++pSortKey )
+        {
+            // Requests sharing an identity take their previous ranks in order.
+            const SceneRenderRequest* pSceneRenderRequest = mRenderRequests[pSortKey->mIndex];
+            S32 rank = sortHistory.findRank( pSceneRenderRequest, 0 );
+            while ( rank >= 0 && rankedKeys[rank].mIndex != U32_MAX )
+                rank = sortHistory.findRank( pSceneRenderRequest, rank + 1 );
+
+            if ( rank >= 0 )
+                rankedKeys[rank] = *pSortKey;
+            else
+                addedKeys.push_back( *pSortKey );
+        }
+
+        const U32 matchedCount = requestCount - addedKeys.size();
+
+        // Give up if too much has changed.
+        if ( addedKeys.size() > changeLimit || historyCount - matchedCount > changeLimit )
+        {
+            coherent = false;
+        }
+        else
+        {
+            orderedKeys.clear();
+            orderedKeys.reserve( requestCount );
+            for ( U32 rank = 0; rank < historyCount; ++rank )
+            {
+                if ( rankedKeys[rank].mIndex != U32_MAX )
+                    orderedKeys.push_back( rankedKeys[rank] );
+            }
+            for ( U32 index = 0; index < (U32)addedKeys.size(); ++index )
+                orderedKeys.push_back( addedKeys[index] );
+
+            // Patch the order, giving up if the keys have moved too far for it to be cheaper than sorting.
+            const bool unchanged = matchedCount == historyCount && addedKeys.size() == 0;
+            bool reordered = false;
+            coherent = patchSortKeys( orderedKeys, requestCount, reordered );
+            if ( coherent )
+                result = unchanged && !reordered ? COHERENT_SORT_REUSED : COHERENT_SORT_PATCHED;
+        }
+    }
+
+    if ( coherent )
+    {
+        // Reorder the requests.
+        applySortKeys( orderedKeys );
+    }
+    else
+    {
+        // Sort the keys.
+        radixSort( sortKeys, scratchKeys, primaryBytes );
+
+        // Reorder the requests.
+        applySortKeys( sortKeys );
+    }
+
+    // Record the order for the next frame.
+    sortHistory.record( mRenderRequests, mSortMode );
+
+    return result;
+}
+
+//-----------------------------------------------------------------------------
+
+void SceneRenderQueue::applySortKeys( const typeSortKeyVector& sortKeys )
+{
+    static typeRenderRequestVector scratchRequests;
+
+    const U32 requestCount = mRenderRequests.size();
+    scratchRequests.setSize( requestCount );
+    SceneRenderRequest** pRequests = mRenderRequests.address();
+    SceneRenderRequest** pSortedRequests = scratchRequests.address();
+    const SortKey* pSortKey = sortKeys.address();
+    for ( U32 index = 0; index < requestCount; ++index, ++pSortKey )
+        pSortedRequests[index] = pRequests[pSortKey->mIndex];
+
+    dMemcpy( pRequests, pSortedRequests, requestCount * sizeof(SceneRenderRequest*) );
+}
+
+//-----------------------------------------------------------------------------
+
+bool SceneRenderQueue::patchSortKeys( typeSortKeyVector& sortKeys, const U32 moveBudget, bool& reordered )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(SceneRenderQueue_PatchSortKeys);
+
+    const U32 keyCount = sortKeys.size();
+    SortKey* pKeys = sortKeys.address();
+    U32 moves = 0;
+
+    // Insertion pass.  This is linear when the keys are already (or nearly) in order.
+    for ( U32 index = 1; index < keyCount; ++index )
+    {
+        if ( !isKeyBefore( pKeys[index], pKeys[index-1] ) )
+            continue;
+
+        const SortKey key = pKeys[index];
+        S32 slot = index - 1;
+        while ( slot >= 0 && isKeyBefore( key, pKeys[slot] ) )
+        {
+            // Give up if the keys have moved too far.
+            if ( ++moves > moveBudget )
+                return false;
+
+            pKeys[slot+1] = pKeys[slot];
+            slot--;
+        }
+        pKeys[slot+1] = key;
+    }
+
+    reordered = moves > 0;
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+void SceneRenderQueue::SortHistory::record( const typeRenderRequestVector& renderRequests, const RenderSort sortMode )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(SceneRenderQueue_RecordSortHistory);
+
+    mSortMode = sortMode;
+    mCount = renderRequests.size();
+
+    // Size the table so it is at most half full.
+    U32 capacity = 16;
+    while ( capacity < mCount * 2 )
+        capacity <<= 1;
+
+    Entry emptyEntry;
+    emptyEntry.mpSceneRenderObject = NULL;
+    emptyEntry.mSerialId = 0;
+    emptyEntry.mRank = U32_MAX;
+    mEntries.setSize( capacity );
+    for ( U32 index = 0; index < capacity; ++index )
+        mEntries[index] = emptyEntry;
+
+    // Insert the requests by rank.
+    const U32 mask = capacity - 1;
+    for ( U32 rank = 0; rank < mCount; ++rank )
+    {
+        const SceneRenderRequest* pSceneRenderRequest = renderRequests[rank];
+        U32 slot = hash( pSceneRenderRequest->mpSceneRenderObject, pSceneRenderRequest->mSerialId ) & mask;
+        while ( mEntries[slot].mRank != U32_MAX )
+            slot = (slot + 1) & mask;
+
+        Entry& entry = mEntries[slot];
+        entry.mpSceneRenderObject = pSceneRenderRequest->mpSceneRenderObject;
+        entry.mSerialId = pSceneRenderRequest->mSerialId;
+        entry.mRank = rank;
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+S32 SceneRenderQueue::SortHistory::findRank( const SceneRenderRequest* pSceneRenderRequest, const U32 firstRank ) const
+{
+    if ( mCount == 0 )
+        return -1;
+
+    const SceneRenderObject* pSceneRenderObject = pSceneRenderRequest->mpSceneRenderObject;
+    const S32 serialId = pSceneRenderRequest->mSerialId;
+
+    // Requests sharing an identity were inserted in rank order so are probed in rank order.
+    const U32 mask = mEntries.size() - 1;
+    U32 slot = hash( pSceneRenderObject, serialId ) & mask;
+    while ( mEntries[slot].mRank != U32_MAX )
+    {
+        const Entry& entry = mEntries[slot];
+        if ( entry.mpSceneRenderObject == pSceneRenderObject && entry.mSerialId == serialId && entry.mRank >= firstRank )
+            return entry.mRank;
+
+        slot = (slot + 1) & mask;
+    }
+
+    return -1;
+}
+
+//-----------------------------------------------------------------------------
+
+U32 SceneRenderQueue::buildSortKeys( typeSortKeyVector& sortKeys ) const
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(SceneRenderQueue_BuildSortKeys);
+
+    const U32 requestCount = mRenderRequests.size();
+    SceneRenderRequest* const* pRequests = mRenderRequests.address();
+    SortKey* pSortKey = sortKeys.address();
+
+    // The secondary key is always the serial Id (the age) so equal requests keep a stable order.
+    for ( U32 index = 0; index < requestCount; ++index, ++pSortKey )
+    {
+        pSortKey->mIndex = index;
+        pSortKey->mSecondary = serialSortKey( pRequests[index]->mSerialId );
+    }
+    pSortKey = sortKeys.address();
+
+    switch( mSortMode )
+    {
+        case RENDER_SORT_NEWEST:
+            {
+                for ( U32 index = 0; index < requestCount; ++index, ++pSortKey )
+                    pSortKey->mPrimary = 0;
+                return 0;
+            }
+
+        case RENDER_SORT_OLDEST:
+            {
+                for ( U32 index = 0; index < requestCount; ++index, ++pSortKey )
+                {
+                    pSortKey->mPrimary = 0;
+                    pSortKey->mSecondary = ~pSortKey->mSecondary;
+                }
+                return 0;
+            }
+
+        case RENDER_SORT_BATCH:
+            {
+                // Render isolated requests first.
+                for ( U32 index = 0; index < requestCount; ++index, ++pSortKey )
+                    pSortKey->mPrimary = pRequests[index]->mpSceneRenderObject->getBatchIsolated() ? 0 : 1;
+                return 1;
+            }
+
+        case RENDER_SORT_GROUP:
+            {
+                // Sort by render group (address, arbitrary but static).
+                for ( U32 index = 0; index < requestCount; ++index, ++pSortKey )
+                    pSortKey->mPrimary = (U64)(size_t)pRequests[index]->mRenderGroup;
+                return sizeof(StringTableEntry);
+            }
+
+        case RENDER_SORT_XAXIS:
+        case RENDER_SORT_INVERSE_XAXIS:
+            {
+                const U32 invert = mSortMode == RENDER_SORT_INVERSE_XAXIS ? U32_MAX : 0;
+                for ( U32 index = 0; index < requestCount; ++index, ++pSortKey )
+                {
+                    const SceneRenderRequest* pRequest = pRequests[index];
+                    pSortKey->mPrimary = floatSortKey( pRequest->mWorldPosition.x + pRequest->mSortPoint.x ) ^ invert;
+                }
+                return 4;
+            }
+
+        case RENDER_SORT_YAXIS:
+        case RENDER_SORT_INVERSE_YAXIS:
+            {
+                const U32 invert = mSortMode == RENDER_SORT_INVERSE_YAXIS ? U32_MAX : 0;
+                for ( U32 index = 0; index < requestCount; ++index, ++pSortKey )
+                {
+                    const SceneRenderRequest* pRequest = pRequests[index];
+                    pSortKey->mPrimary = floatSortKey( pRequest->mWorldPosition.y + pRequest->mSortPoint.y ) ^ invert;
+                }
+                return 4;
+            }
+
+        case RENDER_SORT_ZAXIS:
+        case RENDER_SORT_INVERSE_ZAXIS:
+            {
+                // Higher depths are sorted first.
+                const U32 invert = mSortMode == RENDER_SORT_ZAXIS ? U32_MAX : 0;
+                for ( U32 index = 0; index < requestCount; ++index, ++pSortKey )
+                    pSortKey->mPrimary = floatSortKey( pRequests[index]->mDepth ) ^ invert;
+                return 4;
+            }
+
+        default:
+            break;
+    };
+
+    for ( U32 index = 0; index < requestCount; ++index, ++pSortKey )
+        pSortKey->mPrimary = 0;
+    return 0;
+}
+
+//-----------------------------------------------------------------------------
+
+void SceneRenderQueue::radixSort( typeSortKeyVector& sortKeys, typeSortKeyVector& scratchKeys, const U32 primaryBytes )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(SceneRenderQueue_RadixSort);
+
+    const U32 keyCount = sortKeys.size();
+    const U32 passCount = 4 + primaryBytes;
+
+    // Stable insertion sort is quicker for only a few keys.
+    if ( keyCount <= 16 )
+    {
+        SortKey* pKeys = sortKeys.address();
+        for ( U32 index = 1; index < keyCount; ++index )
+        {
+            const SortKey key = pKeys[index];
+            S32 slot = index - 1;
+            while ( slot >= 0 && (pKeys[slot].mPrimary > key.mPrimary || (pKeys[slot].mPrimary == key.mPrimary && pKeys[slot].mSecondary > key.mSecondary)) )
+            {
+                pKeys[slot+1] = pKeys[slot];
+                slot--;
+            }
+            pKeys[slot+1] = key;
+        }
+        return;
+    }
+
+    // Histogram every byte of the keys in one pass, least significant (secondary) byte first.
+    U32 histograms[12][256];
+    dMemset( histograms, 0, sizeof(U32) * 256 * passCount );
+    const SortKey* pKey = sortKeys.address();
+    for ( U32 index = 0; index < keyCount; ++index, ++pKey )
+    {
+        for ( U32 pass = 0; pass < 4; ++pass )
+            histograms[pass][(pKey->mSecondary >> (pass * 8)) & 0xFF]++;
+        for ( U32 pass = 4; pass < passCount; ++pass )
+            histograms[pass][(U32)(pKey->mPrimary >> ((pass - 4) * 8)) & 0xFF]++;
+    }
+
+    scratchKeys.setSize( keyCount );
+    SortKey* pSource = sortKeys.address();
+    SortKey* pDestination = scratchKeys.address();
+
+    for ( U32 pass = 0; pass < passCount; ++pass )
+    {
+        U32* pHistogram = histograms[pass];
+
+        // Skip the pass if every key has the same byte.
+        const U32 firstByte = pass < 4 ? (pSource->mSecondary >> (pass * 8)) & 0xFF : (U32)(pSource->mPrimary >> ((pass - 4) * 8)) & 0xFF;
+        if ( pHistogram[firstByte] == keyCount )
+            continue;
+
+        // Turn the counts into offsets.
+        U32 offset = 0;
+        for ( U32 bucket = 0; bucket < 256; ++bucket )
+        {
+            const U32 count = pHistogram[bucket];
+            pHistogram[bucket] = offset;
+            offset += count;
+        }
+
+        // Scatter.
+        const SortKey* pSourceKey = pSource;
+        if ( pass < 4 )
+        {
+            const U32 shift = pass * 8;
+            for ( U32 index = 0; index < keyCount; ++index, ++pSourceKey )
+                pDestination[pHistogram[(pSourceKey->mSecondary >> shift) & 0xFF]++] = *pSourceKey;
+        }
+        else
+        {
+            const U32 shift = (pass - 4) * 8;
+            for ( U32 index = 0; index < keyCount; ++index, ++pSourceKey )
+                pDestination[pHistogram[(U32)(pSourceKey->mPrimary >> shift) & 0xFF]++] = *pSourceKey;
+        }
+
+        SortKey* pSwap = pSource;
+        pSource = pDestination;
+        pDestination = pSwap;
+    }
+
+    // Make sure the sorted keys end up in the keys.
+    if ( pSource != sortKeys.address() )
+        dMemcpy( sortKeys.address(), pSource, keyCount * sizeof(SortKey) );
+}
+
+//-----------------------------------------------------------------------------
+
+void SceneRenderQueue::sortReference( void )
+{
+    // Sort layer appropriately.
+    switch( mSortMode )
+    {
+        case RENDER_SORT_NEWEST:
+            {
+                // Debug Profiling.
+                PROFILE_SCOPE(SceneRenderQueue_SortNewest);
+
+                dQsort( mRenderRequests.address(), mRenderRequests.size(), sizeof(SceneRenderRequest*), layeredNewFrontSort );
+                return;
+            }
+
+        case RENDER_SORT_OLDEST:
+            {
+                // Debug Profiling.
+                PROFILE_SCOPE(SceneRenderQueue_SortOldest);
+
+                dQsort( mRenderRequests.address(), mRenderRequests.size(), sizeof(SceneRenderRequest*), layeredOldFrontSort );
+                return;
+            }
+
+        case RENDER_SORT_BATCH:
+            {
+                // Debug Profiling.
+                PROFILE_SCOPE(SceneRenderQueue_SortBatch);
+
+                dQsort( mRenderRequests.address(), mRenderRequests.size(), sizeof(SceneRenderRequest*), layerBatchOrderSort );
+
+                // Batching means we don't need strict order.
+                mStrictOrderMode = false;
+                return;
+            }
+
+        case RENDER_SORT_GROUP:
+            {
+                // Debug Profiling.
+                PROFILE_SCOPE(SceneRenderQueue_SortGroup);
+
+                dQsort( mRenderRequests.address(), mRenderRequests.size(), sizeof(SceneRenderRequest*), layerGroupOrderSort );
+                return;
+            }
+
+        case RENDER_SORT_XAXIS:
+            {
+                // Debug Profiling.
+                PROFILE_SCOPE(SceneRenderQueue_SortXAxis);
+
+                dQsort( mRenderRequests.address(), mRenderRequests.size(), sizeof(SceneRenderRequest*), layeredXSortPointSort);
+                return;
+            }
+
+        case RENDER_SORT_YAXIS:
+            {
+                // Debug Profiling.
+                PROFILE_SCOPE(SceneRenderQueue_SortYAxis);
+
+                dQsort( mRenderRequests.address(), mRenderRequests.size(), sizeof(SceneRenderRequest*), layeredYSortPointSort );
+                return;
+            }
+
+        case RENDER_SORT_ZAXIS:
+            {
+                // Debug Profiling.
+                PROFILE_SCOPE(SceneRenderQueue_SortZAxis);
+
+                dQsort( mRenderRequests.address(), mRenderRequests.size(), sizeof(SceneRenderRequest*), layeredDepthSort );
+                return;
+            }
+
+        case RENDER_SORT_INVERSE_XAXIS:
+            {
+                // Debug Profiling.
+                PROFILE_SCOPE(SceneRenderQueue_SortInverseXAxis);
+
+                dQsort( mRenderRequests.address(), mRenderRequests.size(), sizeof(SceneRenderRequest*), layeredInverseXSortPointSort );
+                return;
+            }
+
+        case RENDER_SORT_INVERSE_YAXIS:
+            {
+                // Debug Profiling.
+                PROFILE_SCOPE(SceneRenderQueue_SortInverseYAxis);
+
+                dQsort( mRenderRequests.address(), mRenderRequests.size(), sizeof(SceneRenderRequest*), layeredInverseYSortPointSort );
+                return;
+            }
+
+        case RENDER_SORT_INVERSE_ZAXIS:
+            {
+                // Debug Profiling.
+                PROFILE_SCOPE(SceneRenderQueue_SortInverseZAxis);
+
+                dQsort( mRenderRequests.address(), mRenderRequests.size(), sizeof(SceneRenderRequest*), layeredInverseDepthSort );
+                return;
+            }
+
+        case RENDER_SORT_OFF:
+            {
+                return;
+            }
+
+        default:
+            break;
+    };
+}
+
+//-----------------------------------------------------------------------------
+
 S32 QSORT_CALLBACK SceneRenderQueue::layeredNewFrontSort(const void* a, const void* b)
 {
     // Fetch scene render requests.
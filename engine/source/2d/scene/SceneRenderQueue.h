@@ -55,12 +55,77 @@ public:
         RENDER_SORT_INVERSE_ZAXIS,
     };
 
+    // Frame-coherent sort outcome.
+    enum CoherentSort
+    {
+        COHERENT_SORT_NONE,
+        COHERENT_SORT_REUSED,
+        COHERENT_SORT_PATCHED,
+        COHERENT_SORT_RESORTED,
+    };
+
+    /// The order a queue was sorted into so the next frame can start from it.
+    /// Requests are identified by their render object and serial Id.
+    class SortHistory
+    {
+        friend class SceneRenderQueue;
+
+    private:
+        struct Entry
+        {
+            const SceneRenderObject*    mpSceneRenderObject;
+            S32                         mSerialId;
+            U32                         mRank;
+        };
+
+        Vector<Entry>   mEntries;
+        U32             mCount;
+        RenderSort      mSortMode;
+
+    public:
+        SortHistory() : mCount(0), mSortMode(RENDER_SORT_INVALID) {}
+
+        inline void clear( void ) { mEntries.clear(); mCount = 0; mSortMode = RENDER_SORT_INVALID; }
+        inline U32 getCount( void ) const { return mCount; }
+
+    private:
+        void record( const typeRenderRequestVector& renderRequests, const RenderSort sortMode );
+        S32 findRank( const SceneRenderRequest* pSceneRenderRequest, const U32 firstRank ) const;
+        static inline U32 hash( const SceneRenderObject* pSceneRenderObject, const S32 serialId )
+        {
+            return ((U32)(size_t)pSceneRenderObject >> 3) * 2654435761u ^ (U32)serialId * 2246822519u;
+        }
+    };
+
 private: 
     typeRenderRequestVector mRenderRequests;
     RenderSort              mSortMode;
     bool                    mStrictOrderMode;
 
+    /// Packed sort key.  Requests are ordered by the primary then secondary key.
+    struct SortKey
+    {
+        U64     mPrimary;
+        U32     mSecondary;
+        U32     mIndex;
+    };
+
+    typedef Vector<SortKey> typeSortKeyVector;
+
 private:
+    U32 buildSortKeys( typeSortKeyVector& sortKeys ) const;
+    void applySortKeys( const typeSortKeyVector& sortKeys );
+    static bool patchSortKeys( typeSortKeyVector& sortKeys, const U32 moveBudget, bool& reordered );
+    static inline bool isKeyBefore( const SortKey& keyA, const SortKey& keyB )
+    {
+        if ( keyA.mPrimary != keyB.mPrimary )
+            return keyA.mPrimary < keyB.mPrimary;
+        if ( keyA.mSecondary != keyB.mSecondary )
+            return keyA.mSecondary < keyB.mSecondary;
+        return keyA.mIndex < keyB.mIndex;
+    }
+    static void radixSort( typeSortKeyVector& sortKeys, typeSortKeyVector& scratchKeys, const U32 primaryBytes );
+
     static S32 QSORT_CALLBACK layeredNewFrontSort(const void* a, const void* b);
     static S32 QSORT_CALLBACK layeredOldFrontSort(const void* a, const void* b);
     static S32 QSORT_CALLBACK layeredDepthSort(const void* a, const void* b);
@@ -123,113 +188,18 @@ public:
     inline void setStrictOrderMode( const bool strictOrderMode ) { mStrictOrderMode = strictOrderMode; }
     inline bool getStrictOrderMode( void ) const { return mStrictOrderMode; }
 
-    void sort( void )
-    {
-        // Sort layer appropriately.
-        switch( mSortMode )
-        {
-            case RENDER_SORT_NEWEST:
-                {
-                    // Debug Profiling.
-                    PROFILE_SCOPE(SceneRenderQueue_SortNewest);
-
-                    dQsort( mRenderRequests.address(), mRenderRequests.size(), sizeof(SceneRenderRequest*), layeredNewFrontSort );
-                    return;
-                }
-
-            case RENDER_SORT_OLDEST:
-                {
-                    // Debug Profiling.
-                    PROFILE_SCOPE(SceneRenderQueue_SortOldest);
-
-                    dQsort( mRenderRequests.address(), mRenderRequests.size(), sizeof(SceneRenderRequest*), layeredOldFrontSort );
-                    return;
-                }
-
-            case RENDER_SORT_BATCH:
-                {
-                    // Debug Profiling.
-                    PROFILE_SCOPE(SceneRenderQueue_SortBatch);
-
-                    dQsort( mRenderRequests.address(), mRenderRequests.size(), sizeof(SceneRenderRequest*), layerBatchOrderSort );
-
-                    // Batching means we don't need strict order.
-                    mStrictOrderMode = false;
-                    return;
-                }
-
-            case RENDER_SORT_GROUP:
-                {
-                    // Debug Profiling.
-                    PROFILE_SCOPE(SceneRenderQueue_SortGroup);
-
-                    dQsort( mRenderRequests.address(), mRenderRequests.size(), sizeof(SceneRenderRequest*), layerGroupOrderSort );
-                    return;
-                }
-
-            case RENDER_SORT_XAXIS:
-                {
-                    // Debug Profiling.
-                    PROFILE_SCOPE(SceneRenderQueue_SortXAxis);
-
-                    dQsort( mRenderRequests.address(), mRenderRequests.size(), sizeof(SceneRenderRequest*), layeredXSortPointSort);
-                    return;
-                }
-
-            case RENDER_SORT_YAXIS:
-                {
-                    // Debug Profiling.
-                    PROFILE_SCOPE(SceneRenderQueue_SortYAxis);
-
-                    dQsort( mRenderRequests.address(), mRenderRequests.size(), sizeof(SceneRenderRequest*), layeredYSortPointSort );
-                    return;
-                }
-
-            case RENDER_SORT_ZAXIS:
-                {
-                    // Debug Profiling.
-                    PROFILE_SCOPE(SceneRenderQueue_SortZAxis);
-
-                    dQsort( mRenderRequests.address(), mRenderRequests.size(), sizeof(SceneRenderRequest*), layeredDepthSort );
-                    return;
-                }
-
-            case RENDER_SORT_INVERSE_XAXIS:
-                {
-                    // Debug Profiling.
-                    PROFILE_SCOPE(SceneRenderQueue_SortInverseXAxis);
-
-                    dQsort( mRenderRequests.address(), mRenderRequests.size(), sizeof(SceneRenderRequest*), layeredInverseXSortPointSort );
-                    return;
-                }
-
-            case RENDER_SORT_INVERSE_YAXIS:
-                {
-                    // Debug Profiling.
-                    PROFILE_SCOPE(SceneRenderQueue_SortInverseYAxis);
-
-                    dQsort( mRenderRequests.address(), mRenderRequests.size(), sizeof(SceneRenderRequest*), layeredInverseYSortPointSort );
-                    return;
-                }
-
-            case RENDER_SORT_INVERSE_ZAXIS:
-                {
-                    // Debug Profiling.
-                    PROFILE_SCOPE(SceneRenderQueue_SortInverseZAxis);
-
-                    dQsort( mRenderRequests.address(), mRenderRequests.size(), sizeof(SceneRenderRequest*), layeredInverseDepthSort );
-                    return;
-                }
-
-            case RENDER_SORT_OFF:
-                {
-                    return;
-                }
-
-            default:
-                break;
-        };
-    }
+    /// Sorts the requests using packed sort keys and a stable radix sort.
+    void sort( void );
+
+    /// Sorts the requests starting from the order recorded in the history, then records the new order.
+    /// If the requests and their keys are unchanged the previous order is reused, if only a few have
+    /// changed the order is patched with an insertion pass, otherwise the requests are fully sorted.
+    /// The resulting order is always identical to that of sort().
+    CoherentSort sortCoherent( SortHistory& sortHistory );
+
+    /// Sorts the requests using the comparison callbacks.
+    /// This is the reference the radix sort is benchmarked and validated against.
+    void sortReference( void );
 
     static RenderSort getRenderSortEnum(const char* label);
     static const char* getRenderSortDescription( const RenderSort& sortMode );
@@ -0,0 +1,134 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _MRANDOM_H_
+#include "math/mRandom.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+// Stands in for scene objects when benchmarking the render sort.
+class BenchmarkRenderObject : public SceneRenderObject
+{
+public:
+    BenchmarkRenderObject( const bool batchIsolated ) : mBatchIsolated( batchIsolated ) {}
+
+    virtual bool isBatchRendered( void ) { return true; }
+    virtual bool getBatchIsolated( void ) { return mBatchIsolated; }
+    virtual bool validRender( void ) const { return true; }
+    virtual bool shouldRender( void ) const { return true; }
+    virtual void scenePrepareRender(const SceneRenderState* pSceneRenderState, SceneRenderQueue* pSceneRenderQueue ) {}
+    virtual void sceneRender( const SceneRenderState* pSceneRenderState, const SceneRenderRequest* pSceneRenderRequest, BatchRender* pBatchRenderer ) {}
+    virtual void sceneRenderFallback( const SceneRenderState* pSceneRenderState, const SceneRenderRequest* pSceneRenderRequest, BatchRender* pBatchRenderer ) {}
+
+private:
+    bool mBatchIsolated;
+};
+
+//-----------------------------------------------------------------------------
+
+ConsoleFunction( benchmarkRenderSort, const char*, 2, 4,    "(requestCount, [sortMode], [iterations]) - Times the radix render sort against the comparison sort it replaced.\n"
+                                                            "Both sorts are run on the same randomly generated render requests and their results are checked to be identical.\n"
+                                                            "@param requestCount The number of render requests to sort.\n"
+                                                            "@param sortMode The render sort mode to use.  Defaults to 'Z'.\n"
+                                                            "@param iterations The number of times to run each sort.  Defaults to 10.\n"
+                                                            "@return (radixTime qsortTime) The average time for each sort in milliseconds or an empty string on failure." )
+{
+    const S32 requestCount = dAtoi(argv[1]);
+    const SceneRenderQueue::RenderSort sortMode = argc >= 3 ? SceneRenderQueue::getRenderSortEnum( argv[2] ) : SceneRenderQueue::RENDER_SORT_ZAXIS;
+    const S32 iterations = argc >= 4 ? dAtoi(argv[3]) : 10;
+
+    // Sanity!
+    if ( requestCount <= 0 || iterations <= 0 || sortMode == SceneRenderQueue::RENDER_SORT_INVALID )
+    {
+        Con::warnf( "benchmarkRenderSort() - Invalid request count, sort mode or iterations." );
+        return StringTable->EmptyString;
+    }
+
+    BenchmarkRenderObject isolatedObject( true );
+    BenchmarkRenderObject batchedObject( false );
+    StringTableEntry renderGroups[4] = { StringTable->EmptyString, StringTable->insert("a"), StringTable->insert("b"), StringTable->insert("c") };
+
+    // Generate the requests, repeating depths and positions so there are plenty of ties.
+    // Serial Ids are unique so both sorts have exactly one correct order.
+    RandomLCG random( 12345 );
+    SceneRenderQueue* pSceneRenderQueue = SceneRenderQueueFactory.createObject();
+    for ( S32 index = 0; index < requestCount; ++index )
+    {
+        pSceneRenderQueue->createRenderRequest()->set(
+            random.randRangeI( 0, 3 ) == 0 ? (SceneRenderObject*)&isolatedObject : (SceneRenderObject*)&batchedObject,
+            Vector2( (F32)random.randRangeI( -100, 100 ), random.randRangeF( -100.0f, 100.0f ) ),
+            (F32)random.randRangeI( -10, 10 ),
+            Vector2::getZero(),
+            index,
+            renderGroups[random.randRangeI( 0, 3 )] );
+    }
+
+    SceneRenderQueue::typeRenderRequestVector& renderRequests = pSceneRenderQueue->getRenderRequests();
+    SceneRenderQueue::typeRenderRequestVector unsortedRequests = renderRequests;
+    for ( S32 index = requestCount - 1; index > 0; --index )
+    {
+        const S32 swapIndex = random.randRangeI( 0, index );
+        SceneRenderRequest* pSwap = unsortedRequests[index];
+        unsortedRequests[index] = unsortedRequests[swapIndex];
+        unsortedRequests[swapIndex] = pSwap;
+    }
+    SceneRenderQueue::typeRenderRequestVector radixRequests;
+
+    // Time each sort from the same unsorted order.
+    F32 radixTime = 0.0f;
+    F32 qsortTime = 0.0f;
+    for ( S32 iteration = 0; iteration < iterations; ++iteration )
+    {
+        renderRequests = unsortedRequests;
+        pSceneRenderQueue->setSortMode( sortMode );
+        F64 startTime = Platform::getHighResolutionMilliseconds();
+        pSceneRenderQueue->sort();
+        radixTime += (F32)(Platform::getHighResolutionMilliseconds() - startTime);
+        radixRequests = renderRequests;
+
+        renderRequests = unsortedRequests;
+        startTime = Platform::getHighResolutionMilliseconds();
+        pSceneRenderQueue->sortReference();
+        qsortTime += (F32)(Platform::getHighResolutionMilliseconds() - startTime);
+    }
+
+    // Check the sorts agree.
+    S32 mismatches = 0;
+    for ( S32 index = 0; index < requestCount; ++index )
+    {
+        if ( radixRequests[index] != renderRequests[index] )
+            mismatches++;
+    }
+
+    SceneRenderQueueFactory.cacheObject( pSceneRenderQueue );
+
+    radixTime /= iterations;
+    qsortTime /= iterations;
+    Con::printf( "benchmarkRenderSort() - %d requests sorted by '%s': radix %.3fms, qsort %.3fms (%.1fx), %d mismatches.",
+        requestCount, SceneRenderQueue::getRenderSortDescription( sortMode ), radixTime, qsortTime, radixTime > 0.0f ? qsortTime / radixTime : 0.0f, mismatches );
+
+    // Format Buffer.
+    char* pBuffer = Con::getReturnBuffer(64);
+    dSprintf( pBuffer, 64, "%g %g", radixTime, qsortTime );
+    return pBuffer;
+}
@@ -100,6 +100,24 @@ ConsoleMethod(Scene, getPositionIterations, S32, 2, 2,  "() Gets the number of p
 
 //-----------------------------------------------------------------------------
 
+ConsoleMethod(Scene, setParallelPhysics, void, 3, 3,    "(bool parallel) Sets whether the physics world collides contacts and solves islands on the thread pool.\n"
+                                                        "The simulation is the same either way; this only changes how long a step takes.\n"
+                                                        "@param parallel Whether to step the physics on the thread pool or not.\n"
+                                                        "@return No return value.")
+{
+    object->setParallelPhysics( dAtob(argv[2]) );
+}
+
+//-----------------------------------------------------------------------------
+
+ConsoleMethod(Scene, getParallelPhysics, bool, 2, 2,    "() Gets whether the physics world collides contacts and solves islands on the thread pool.\n"
+                                                        "@return Whether the physics is stepped on the thread pool or not.")
+{
+    return object->getParallelPhysics();
+}
+
+//-----------------------------------------------------------------------------
+
 ConsoleMethod(Scene, add, void, 3, 3,   "(sceneObject) Add the SceneObject to the scene.\n"
                                         "@param sceneObject The SceneObject to add to the scene.\n"
                                         "@return No return value.")
@@ -366,6 +384,54 @@ ConsoleMethod(Scene, getScenePause, bool, 2, 2, "() Gets scene pause status.\n"
 
 //-----------------------------------------------------------------------------
 
+ConsoleMethod(Scene, setBatchCollisionCallbacks, void, 3, 3, "(bool batch) Sets whether collision callbacks are batched into one callback per object per tick.\n"
+                                                            "When batched, objects receive 'onCollisionBatch(count, records)' and 'onEndCollisionBatch(count, records)' and the scene receives "
+                                                            "'onSceneCollisionBatch(count, records)' and 'onSceneEndCollisionBatch(count, records)' instead of a callback per contact.\n"
+                                                            "The records are new-line separated with each holding the same fields the per-contact callbacks receive.\n"
+                                                            "@param batch Whether to batch the collision callbacks or not.\n"
+                                                            "@return No return value.")
+{
+    object->setBatchCollisionCallbacks( dAtob(argv[2]) );
+}
+
+//-----------------------------------------------------------------------------
+
+ConsoleMethod(Scene, getBatchCollisionCallbacks, bool, 2, 2, "() Gets whether collision callbacks are batched into one callback per object per tick.\n"
+                                                            "@return Whether collision callbacks are batched or not.")
+{
+    return object->getBatchCollisionCallbacks();
+}
+
+//-----------------------------------------------------------------------------
+
+ConsoleFunction(benchmarkCollisionCallbacks, const char*, 1, 3,    "([contactCount], [iterations]) Times dispatching contacts as per-contact callbacks against batched callbacks.\n"
+                                                                    "Synthetic contacts between dedicated objects in a private scene are dispatched to no-op callbacks so no game code runs.\n"
+                                                                    "@param contactCount The number of contacts to dispatch.  Defaults to 100.\n"
+                                                                    "@param iterations The number of times to dispatch the contacts.  Defaults to 100.\n"
+                                                                    "@return (perContactTime batchedTime) The average cost per contact in nanoseconds for each mode, or an empty string on failure.")
+{
+    const S32 contactCount = argc >= 2 ? dAtoi(argv[1]) : 100;
+    const S32 iterations = argc >= 3 ? dAtoi(argv[2]) : 100;
+
+    // Sanity!
+    if ( contactCount <= 0 || contactCount > 10000 || iterations <= 0 )
+    {
+        Con::warnf( "benchmarkCollisionCallbacks() - Invalid contact count or iterations." );
+        return StringTable->EmptyString;
+    }
+
+    F32 perContactTime;
+    F32 batchedTime;
+    Scene::benchmarkCollisionCallbacks( (U32)contactCount, (U32)iterations, perContactTime, batchedTime );
+
+    // Format Buffer.
+    char* pBuffer = Con::getReturnBuffer(64);
+    dSprintf( pBuffer, 64, "%g %g", perContactTime, batchedTime );
+    return pBuffer;
+}
+
+//-----------------------------------------------------------------------------
+
 ConsoleMethod(Scene, getJointCount, S32, 2, 2,  "() Gets the joint count.\n"
                                                         "@return Returns no value")
 {
@@ -2931,6 +2997,194 @@ ConsoleMethod(Scene, pickCircle, const char*, 4, 8, "(x / y, radius, [sceneGroup
 }
 
 
+//-----------------------------------------------------------------------------
+
+ConsoleMethod(Scene, pickAreas, const char*, 3, 6, "(areas, [sceneGroupMask], [sceneLayerMask], [pickMode] ) Picks objects intersecting each of the specified areas in a single pass with optional group/layer masks.\n"
+              "@param areas The areas as a list of start and end points (\"x1 y1 x2 y2 x1 y1 x2 y2 ...\").\n"
+              "@param sceneGroupMask Optional scene group mask.  (-1) or empty string selects all groups.\n"
+              "@param sceneLayerMask Optional scene layer mask.  (-1) or empty string selects all layers.\n"
+              "@param pickMode Optional mode 'aabb' or 'oobb' (default is 'oobb').\n"
+              "@return Returns a record (new-line separated) for each area holding its list of object IDs.")
+{
+    // Fetch the area element count.
+    const U32 elementCount = Utility::mGetStringElementCount(argv[2]);
+
+    // Check the areas.
+    if ( elementCount == 0 || (elementCount % 4) != 0 )
+    {
+        Con::warnf("Scene::pickAreas() - Areas must be a list of start and end points!");
+        return NULL;
+    }
+
+    // Calculate scene group mask.
+    U32 sceneGroupMask = MASK_ALL;
+    if ( argc > 3 && *argv[3] != 0 )
+        sceneGroupMask = dAtoi(argv[3]);
+
+    // Calculate scene layer mask.
+    U32 sceneLayerMask = MASK_ALL;
+    if ( argc > 4 && *argv[4] != 0 )
+        sceneLayerMask = dAtoi(argv[4]);
+
+    // Calculate pick mode.
+    Scene::PickMode pickMode = Scene::PICK_OOBB;
+    if ( argc > 5 )
+    {
+        pickMode = Scene::getPickModeEnum(argv[5]);
+    }
+    if ( pickMode != Scene::PICK_AABB && pickMode != Scene::PICK_OOBB )
+    {
+        Con::warnf("Scene::pickAreas() - Invalid pick mode of %s", argv[5]);
+        pickMode = Scene::PICK_OOBB;
+    }
+
+    // Calculate normalized AABBs.
+    const U32 areaCount = elementCount / 4;
+    Vector<b2AABB> aabbs( areaCount );
+    for ( U32 n = 0; n < areaCount; ++n )
+    {
+        const Vector2 v1 = Utility::mGetStringElementVector(argv[2], n * 4);
+        const Vector2 v2 = Utility::mGetStringElementVector(argv[2], n * 4 + 2);
+
+        b2AABB aabb;
+        aabb.lowerBound.x = getMin( v1.x, v2.x );
+        aabb.lowerBound.y = getMin( v1.y, v2.y );
+        aabb.upperBound.x = getMax( v1.x, v2.x );
+        aabb.upperBound.y = getMax( v1.y, v2.y );
+        aabbs.push_back( aabb );
+    }
+
+    // Perform query.
+    object->pickAABBs( aabbs.address(), areaCount, sceneGroupMask, sceneLayerMask, pickMode );
+
+    // Fetch world query.
+    WorldQuery* pWorldQuery = object->getWorldQuery();
+
+    // Set Max Buffer Size.
+    const U32 maxBufferSize = 4096;
+
+    // Create Returnable Buffer.
+    char* pBuffer = Con::getReturnBuffer(maxBufferSize);
+
+    // Set Buffer Counter.
+    U32 bufferCount = 0;
+    pBuffer[0] = 0;
+
+    // Add picked objects for each area.
+    for ( U32 queryIndex = 0; queryIndex < areaCount && bufferCount < maxBufferSize; ++queryIndex )
+    {
+        // Separate the records.
+        if ( queryIndex > 0 )
+            bufferCount += dSprintf( pBuffer + bufferCount, maxBufferSize-bufferCount, "\n" );
+
+        const U32 resultCount = pWorldQuery->getBatchQueryResultsCount( queryIndex );
+        const WorldQueryResult* pQueryResults = pWorldQuery->getBatchQueryResults( queryIndex );
+        for ( U32 n = 0; n < resultCount && bufferCount < maxBufferSize; n++ )
+        {
+            // Output Object ID.
+            bufferCount += dSprintf( pBuffer + bufferCount, maxBufferSize-bufferCount, n == 0 ? "%d" : " %d", pQueryResults[n].mpSceneObject->getId() );
+        }
+    }
+
+    // Warn if we ran out of buffer space.
+    if ( bufferCount >= maxBufferSize )
+        Con::warnf("Scene::pickAreas() - Too many items picked to return to scripts!");
+
+    // Return buffer.
+    return pBuffer;
+}
+
+//-----------------------------------------------------------------------------
+
+ConsoleMethod(Scene, pickRays, const char*, 3, 6, "(rays, [sceneGroupMask], [sceneLayerMask], [pickMode] ) Picks objects intersecting each of the specified rays in a single pass with optional group/layer masks.\n"
+              "@param rays The rays as a list of start and end points (\"x1 y1 x2 y2 x1 y1 x2 y2 ...\").\n"
+              "@param sceneGroupMask Optional scene group mask.  (-1) or empty string selects all groups.\n"
+              "@param sceneLayerMask Optional scene layer mask.  (-1) or empty string selects all layers.\n"
+              "@param pickMode Optional mode 'aabb' or 'oobb' (default is 'oobb').\n"
+              "@return Returns a record (new-line separated) for each ray holding its list of object IDs.  Unlike 'pickRay', these are not sorted by distance.")
+{
+    // Fetch the ray element count.
+    const U32 elementCount = Utility::mGetStringElementCount(argv[2]);
+
+    // Check the rays.
+    if ( elementCount == 0 || (elementCount % 4) != 0 )
+    {
+        Con::warnf("Scene::pickRays() - Rays must be a list of start and end points!");
+        return NULL;
+    }
+
+    // Calculate scene group mask.
+    U32 sceneGroupMask = MASK_ALL;
+    if ( argc > 3 && *argv[3] != 0 )
+        sceneGroupMask = dAtoi(argv[3]);
+
+    // Calculate scene layer mask.
+    U32 sceneLayerMask = MASK_ALL;
+    if ( argc > 4 && *argv[4] != 0 )
+        sceneLayerMask = dAtoi(argv[4]);
+
+    // Calculate pick mode.
+    Scene::PickMode pickMode = Scene::PICK_OOBB;
+    if ( argc > 5 )
+    {
+        pickMode = Scene::getPickModeEnum(argv[5]);
+    }
+    if ( pickMode != Scene::PICK_AABB && pickMode != Scene::PICK_OOBB )
+    {
+        Con::warnf("Scene::pickRays() - Invalid pick mode of %s", argv[5]);
+        pickMode = Scene::PICK_OOBB;
+    }
+
+    // Fetch the ray points.
+    const U32 rayCount = elementCount / 4;
+    Vector<Vector2> points1( rayCount );
+    Vector<Vector2> points2( rayCount );
+    for ( U32 n = 0; n < rayCount; ++n )
+    {
+        points1.push_back( Utility::mGetStringElementVector(argv[2], n * 4) );
+        points2.push_back( Utility::mGetStringElementVector(argv[2], n * 4 + 2) );
+    }
+
+    // Perform query.
+    object->pickRays( points1.address(), points2.address(), rayCount, sceneGroupMask, sceneLayerMask, pickMode );
+
+    // Fetch world query.
+    WorldQuery* pWorldQuery = object->getWorldQuery();
+
+    // Set Max Buffer Size.
+    const U32 maxBufferSize = 4096;
+
+    // Create Returnable Buffer.
+    char* pBuffer = Con::getReturnBuffer(maxBufferSize);
+
+    // Set Buffer Counter.
+    U32 bufferCount = 0;
+    pBuffer[0] = 0;
+
+    // Add picked objects for each ray.
+    for ( U32 queryIndex = 0; queryIndex < rayCount && bufferCount < maxBufferSize; ++queryIndex )
+    {
+        // Separate the records.
+        if ( queryIndex > 0 )
+            bufferCount += dSprintf( pBuffer + bufferCount, maxBufferSize-bufferCount, "\n" );
+
+        const U32 resultCount = pWorldQuery->getBatchQueryResultsCount( queryIndex );
+        const WorldQueryResult* pQueryResults = pWorldQuery->getBatchQueryResults( queryIndex );
+        for ( U32 n = 0; n < resultCount && bufferCount < maxBufferSize; n++ )
+        {
+            // Output Object ID.
+            bufferCount += dSprintf( pBuffer + bufferCount, maxBufferSize-bufferCount, n == 0 ? "%d" : " %d", pQueryResults[n].mpSceneObject->getId() );
+        }
+    }
+
+    // Warn if we ran out of buffer space.
+    if ( bufferCount >= maxBufferSize )
+        Con::warnf("Scene::pickRays() - Too many items picked to return to scripts!");
+
+    // Return buffer.
+    return pBuffer;
+}
+
 //-----------------------------------------------------------------------------
 
 ConsoleMethod(Scene, pickRayCollision, const char*, 4, 8, "(startx/y, endx/y, [sceneGroupMask], [sceneLayerMask] ) Picks objects with collision shapes intersecting the specified ray with optional group/layer masks.\n"
@@ -3300,6 +3554,32 @@ ConsoleMethod(Scene, getLayerSortMode, const char*, 3, 3,   "(layer) Gets the re
 
 //-----------------------------------------------------------------------------
 
+ConsoleMethod(Scene, setLayerSortCoherent, void, 4, 4,  "(layer, coherent) Sets whether the layer sorts starting from the previous frame's order or not.\n"
+                                                        "This is quicker when few render requests change order between frames.\n"
+                                                        "@param layer The layer to modify.\n"
+                                                        "@param coherent Whether the layer sorts coherently or not.\n"
+                                                        "@return No return value." )
+{
+    // Fetch the layer.
+    const U32 layer = dAtoi(argv[2]);
+
+    object->setLayerSortCoherent( layer, dAtob(argv[3]) );
+}
+
+//-----------------------------------------------------------------------------
+
+ConsoleMethod(Scene, getLayerSortCoherent, bool, 3, 3,  "(layer) Gets whether the layer sorts starting from the previous frame's order or not.\n"
+                                                        "@param layer The layer to retrieve.\n"
+                                                        "@return Whether the layer sorts coherently or not." )
+{
+    // Fetch the layer.
+    const U32 layer = dAtoi(argv[2]);
+
+    return object->getLayerSortCoherent( layer );
+}
+
+//-----------------------------------------------------------------------------
+
 ConsoleMethod(Scene, resetDebugStats, void, 2, 2,   "() Resets the debug statistics.\n"
                                                             "@return No return value." )
 {
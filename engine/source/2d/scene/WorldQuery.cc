@@ -35,14 +35,15 @@
 
 //-----------------------------------------------------------------------------
 
-WorldQuery::WorldQuery( Scene* pScene ) :
-        mpScene(pScene),
-        mIsRaycastQueryResult(false),
-        mMasterQueryKey(0),
+WorldQueryContext::WorldQueryContext( WorldQuery* pWorldQuery ) :
+        mpWorldQuery(pWorldQuery),
         mCheckPoint(false),
         mCheckAABB(false),
         mCheckOOBB(false),
-        mCheckCircle(false)
+        mCheckCircle(false),
+        mIsRaycastQueryResult(false),
+        mQueryKey(0),
+        mBatchBase(0)
 {
     // Set debug associations.
     for ( U32 n = 0; n < MAX_LAYERS_SUPPORTED; n++ )
@@ -50,6 +51,12 @@ WorldQuery::WorldQuery( Scene* pScene ) :
         VECTOR_SET_ASSOCIATION( mLayeredQueryResults[n] );
     }
     VECTOR_SET_ASSOCIATION( mQueryResults );
+    VECTOR_SET_ASSOCIATION( mProxyQueryKeys );
+    VECTOR_SET_ASSOCIATION( mSnapshotProxies );
+    VECTOR_SET_ASSOCIATION( mBatchHits );
+    VECTOR_SET_ASSOCIATION( mBatchSortedObjects );
+    VECTOR_SET_ASSOCIATION( mBatchResultOffsets );
+    VECTOR_SET_ASSOCIATION( mBatchQueryResults );
 
     // Clear the query.
     clearQuery();
@@ -57,12 +64,26 @@ WorldQuery::WorldQuery( Scene* pScene ) :
 
 //-----------------------------------------------------------------------------
 
+WorldQuery::WorldQuery( Scene* pScene ) :
+        WorldQueryContext(this),
+        mpScene(pScene),
+        mSnapshot(this)
+{
+}
+
+//-----------------------------------------------------------------------------
+
 S32 WorldQuery::add( SceneObject* pSceneObject )
 {
     // Debug Profiling.
     PROFILE_SCOPE(WorldQuery_Add);
 
-    return CreateProxy( pSceneObject->getAABB(), static_cast<PhysicsProxy*>(pSceneObject) );
+    const S32 proxyId = CreateProxy( pSceneObject->getAABB(), static_cast<PhysicsProxy*>(pSceneObject) );
+
+    // Track in the snapshot.
+    mSnapshot.addProxy( proxyId );
+
+    return proxyId;
 }
 
 //-----------------------------------------------------------------------------
@@ -72,6 +93,7 @@ void WorldQuery::remove( SceneObject* pSceneObject )
     // Debug Profiling.
     PROFILE_SCOPE(WorldQuery_Remove);
 
+    mSnapshot.removeProxy( pSceneObject->getWorldProxy() );
     DestroyProxy( pSceneObject->getWorldProxy() );
 }
 
@@ -82,7 +104,24 @@ bool WorldQuery::update( SceneObject* pSceneObject, const b2AABB& aabb, const b2
     // Debug Profiling.
     PROFILE_SCOPE(WorldQuery_Update);
 
-    return MoveProxy( pSceneObject->getWorldProxy(), aabb, displacement );
+    // Finish if the fat AABB still contains the object.
+    if ( !MoveProxy( pSceneObject->getWorldProxy(), aabb, displacement ) )
+        return false;
+
+    // Evict from the snapshot.
+    mSnapshot.moveProxy( pSceneObject->getWorldProxy() );
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+void WorldQuery::updateSnapshot( void )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(WorldQuery_UpdateSnapshot);
+
+    mSnapshot.update();
 }
 
 //-----------------------------------------------------------------------------
@@ -132,12 +171,12 @@ void WorldQuery::removeAlwaysInScope( SceneObject* pSceneObject )
 
 //-----------------------------------------------------------------------------
 
-U32 WorldQuery::collisionQueryAABB( const b2AABB& aabb )
+U32 WorldQueryContext::collisionQueryAABB( const b2AABB& aabb )
 {
     // Debug Profiling.
     PROFILE_SCOPE(WorldQuery_collisionQueryAABB);
 
-    mMasterQueryKey++;
+    mQueryKey++;
 
     // Flag as not a ray-cast query result.
     mIsRaycastQueryResult = false;
@@ -151,7 +190,7 @@ U32 WorldQuery::collisionQueryAABB( const b2AABB& aabb )
     mComparePolygonShape.Set( verts, 4 );
     mCompareTransform.SetIdentity();
     mCheckAABB = true;
-    mpScene->getWorld()->QueryAABB( this, aabb );
+    mpWorldQuery->getScene()->getWorld()->QueryAABB( this, aabb );
     mCheckAABB = false;
 
     // Inject always-in-scope.
@@ -162,18 +201,18 @@ U32 WorldQuery::collisionQueryAABB( const b2AABB& aabb )
 
 //-----------------------------------------------------------------------------
 
-U32 WorldQuery::collisionQueryRay( const Vector2& point1, const Vector2& point2 )
+U32 WorldQueryContext::collisionQueryRay( const Vector2& point1, const Vector2& point2 )
 {
     // Debug Profiling.
     PROFILE_SCOPE(WorldQuery_CollisionQueryRay);
 
-    mMasterQueryKey++;
+    mQueryKey++;
 
     // Flag as a ray-cast query result.
     mIsRaycastQueryResult = true;
 
     // Query.
-    mpScene->getWorld()->RayCast( this, point1, point2 );
+    mpWorldQuery->getScene()->getWorld()->RayCast( this, point1, point2 );
 
     // Inject always-in-scope.
     injectAlwaysInScope();
@@ -183,12 +222,12 @@ U32 WorldQuery::collisionQueryRay( const Vector2& point1, const Vector2& point2
 
 //-----------------------------------------------------------------------------
 
-U32 WorldQuery::collisionQueryPoint( const Vector2& point )
+U32 WorldQueryContext::collisionQueryPoint( const Vector2& point )
 {
     // Debug Profiling.
     PROFILE_SCOPE(WorldQuery_CollisionQueryPoint);
 
-    mMasterQueryKey++;
+    mQueryKey++;
 
     // Flag as not a ray-cast query result.
     mIsRaycastQueryResult = false;
@@ -199,7 +238,7 @@ U32 WorldQuery::collisionQueryPoint( const Vector2& point )
     aabb.upperBound = point;
     mCheckPoint = true;
     mComparePoint = point;
-    mpScene->getWorld()->QueryAABB( this, aabb );
+    mpWorldQuery->getScene()->getWorld()->QueryAABB( this, aabb );
     mCheckPoint = false;
 
     // Inject always-in-scope.
@@ -210,12 +249,12 @@ U32 WorldQuery::collisionQueryPoint( const Vector2& point )
 
 //-----------------------------------------------------------------------------
 
-U32 WorldQuery::collisionQueryCircle( const Vector2& centroid, const F32 radius )
+U32 WorldQueryContext::collisionQueryCircle( const Vector2& centroid, const F32 radius )
 {
     // Debug Profiling.
     PROFILE_SCOPE(WorldQuery_CollisionQueryCircle);
 
-    mMasterQueryKey++;
+    mQueryKey++;
 
     // Flag as not a ray-cast query result.
     mIsRaycastQueryResult = false;
@@ -227,7 +266,7 @@ U32 WorldQuery::collisionQueryCircle( const Vector2& centroid, const F32 radius
     mCompareCircleShape.m_radius = radius;
     mCompareCircleShape.ComputeAABB( &aabb, mCompareTransform, 0 );
     mCheckCircle = true;
-    mpScene->getWorld()->QueryAABB( this, aabb );
+    mpWorldQuery->getScene()->getWorld()->QueryAABB( this, aabb );
     mCheckCircle = false;
 
     // Inject always-in-scope.
@@ -238,18 +277,18 @@ U32 WorldQuery::collisionQueryCircle( const Vector2& centroid, const F32 radius
 
 //-----------------------------------------------------------------------------
 
-U32 WorldQuery::aabbQueryAABB( const b2AABB& aabb )
+U32 WorldQueryContext::aabbQueryAABB( const b2AABB& aabb )
 {
     // Debug Profiling.
     PROFILE_SCOPE(WorldQuery_aabbQueryAABB);
 
-    mMasterQueryKey++;
+    mQueryKey++;
 
     // Flag as not a ray-cast query result.
     mIsRaycastQueryResult = false;
 
     // Query.
-    Query( this, aabb );
+    queryAABB( aabb );
 
     // Inject always-in-scope.
     injectAlwaysInScope();
@@ -259,12 +298,12 @@ U32 WorldQuery::aabbQueryAABB( const b2AABB& aabb )
 
 //-----------------------------------------------------------------------------
 
-U32 WorldQuery::aabbQueryRay( const Vector2& point1, const Vector2& point2 )
+U32 WorldQueryContext::aabbQueryRay( const Vector2& point1, const Vector2& point2 )
 {
     // Debug Profiling.
     PROFILE_SCOPE(WorldQuery_AABBQueryRay);
 
-    mMasterQueryKey++;
+    mQueryKey++;
 
     // Flag as a ray-cast query result.
     mIsRaycastQueryResult = true;
@@ -274,7 +313,7 @@ U32 WorldQuery::aabbQueryRay( const Vector2& point1, const Vector2& point2 )
     mCompareRay.p2 = point2;
     mCompareRay.maxFraction = 1.0f;
     mCompareTransform.SetIdentity();
-    RayCast( this, mCompareRay );
+    mpWorldQuery->RayCast( this, mCompareRay );
 
     // Inject always-in-scope.
     injectAlwaysInScope();
@@ -284,12 +323,12 @@ U32 WorldQuery::aabbQueryRay( const Vector2& point1, const Vector2& point2 )
 
 //-----------------------------------------------------------------------------
 
-U32 WorldQuery::aabbQueryPoint( const Vector2& point )
+U32 WorldQueryContext::aabbQueryPoint( const Vector2& point )
 {
     // Debug Profiling.
     PROFILE_SCOPE(WorldQuery_AABBQueryPoint);
 
-    mMasterQueryKey++;
+    mQueryKey++;
 
     // Flag as not a ray-cast query result.
     mIsRaycastQueryResult = false;
@@ -298,7 +337,7 @@ U32 WorldQuery::aabbQueryPoint( const Vector2& point )
     b2AABB aabb;
     aabb.lowerBound = point;
     aabb.upperBound = point;
-    Query( this, aabb );
+    queryAABB( aabb );
 
     // Inject always-in-scope.
     injectAlwaysInScope();
@@ -308,12 +347,12 @@ U32 WorldQuery::aabbQueryPoint( const Vector2& point )
 
 //-----------------------------------------------------------------------------
 
-U32 WorldQuery::aabbQueryCircle( const Vector2& centroid, const F32 radius )
+U32 WorldQueryContext::aabbQueryCircle( const Vector2& centroid, const F32 radius )
 {
     // Debug Profiling.
     PROFILE_SCOPE(WorldQuery_AABBQueryCircle);
 
-    mMasterQueryKey++;
+    mQueryKey++;
 
     // Flag as not a ray-cast query result.
     mIsRaycastQueryResult = false;
@@ -325,7 +364,7 @@ U32 WorldQuery::aabbQueryCircle( const Vector2& centroid, const F32 radius )
     mCompareCircleShape.m_radius = radius;
     mCompareCircleShape.ComputeAABB( &aabb, mCompareTransform, 0 );
     mCheckCircle = true;
-    Query( this, aabb );
+    queryAABB( aabb );
     mCheckCircle = false;
 
     // Inject always-in-scope.
@@ -336,12 +375,12 @@ U32 WorldQuery::aabbQueryCircle( const Vector2& centroid, const F32 radius )
 
 //-----------------------------------------------------------------------------
 
-U32 WorldQuery::oobbQueryAABB( const b2AABB& aabb )
+U32 WorldQueryContext::oobbQueryAABB( const b2AABB& aabb )
 {
     // Debug Profiling.
     PROFILE_SCOPE(WorldQuery_aabbQueryAABB);
 
-    mMasterQueryKey++;
+    mQueryKey++;
 
     // Flag as not a ray-cast query result.
     mIsRaycastQueryResult = false;
@@ -356,7 +395,7 @@ U32 WorldQuery::oobbQueryAABB( const b2AABB& aabb )
     mCompareTransform.SetIdentity();
     mCheckOOBB = true;
     mCheckAABB = true;
-    Query( this, aabb );
+    queryAABB( aabb );
     mCheckAABB = false;
     mCheckOOBB = false;
 
@@ -368,12 +407,12 @@ U32 WorldQuery::oobbQueryAABB( const b2AABB& aabb )
 
 //-----------------------------------------------------------------------------
 
-U32 WorldQuery::oobbQueryRay( const Vector2& point1, const Vector2& point2 )
+U32 WorldQueryContext::oobbQueryRay( const Vector2& point1, const Vector2& point2 )
 {
     // Debug Profiling.
     PROFILE_SCOPE(WorldQuery_AABBQueryRay);
 
-    mMasterQueryKey++;
+    mQueryKey++;
 
     // Flag as a ray-cast query result.
     mIsRaycastQueryResult = true;
@@ -384,7 +423,7 @@ U32 WorldQuery::oobbQueryRay( const Vector2& point1, const Vector2& point2 )
     mCompareRay.maxFraction = 1.0f;
     mCompareTransform.SetIdentity();
     mCheckOOBB = true;
-    RayCast( this, mCompareRay );
+    mpWorldQuery->RayCast( this, mCompareRay );
     mCheckOOBB = false;
 
     // Inject always-in-scope.
@@ -395,12 +434,12 @@ U32 WorldQuery::oobbQueryRay( const Vector2& point1, const Vector2& point2 )
 
 //-----------------------------------------------------------------------------
 
-U32 WorldQuery::oobbQueryPoint( const Vector2& point )
+U32 WorldQueryContext::oobbQueryPoint( const Vector2& point )
 {
     // Debug Profiling.
     PROFILE_SCOPE(WorldQuery_AABBQueryPoint);
 
-    mMasterQueryKey++;
+    mQueryKey++;
 
     // Flag as not a ray-cast query result.
     mIsRaycastQueryResult = false;
@@ -413,7 +452,7 @@ U32 WorldQuery::oobbQueryPoint( const Vector2& point )
     mCompareTransform.SetIdentity();
     mCheckOOBB = true;
     mCheckPoint = true;
-    Query( this, aabb );
+    queryAABB( aabb );
     mCheckPoint = false;
     mCheckOOBB = false;
 
@@ -425,12 +464,12 @@ U32 WorldQuery::oobbQueryPoint( const Vector2& point )
 
 //-----------------------------------------------------------------------------
 
-U32 WorldQuery::oobbQueryCircle( const Vector2& centroid, const F32 radius )
+U32 WorldQueryContext::oobbQueryCircle( const Vector2& centroid, const F32 radius )
 {
     // Debug Profiling.
     PROFILE_SCOPE(WorldQuery_OOBBQueryCircle);
 
-    mMasterQueryKey++;
+    mQueryKey++;
 
     // Flag as not a ray-cast query result.
     mIsRaycastQueryResult = false;
@@ -443,7 +482,7 @@ U32 WorldQuery::oobbQueryCircle( const Vector2& centroid, const F32 radius )
     mCompareCircleShape.ComputeAABB( &aabb, mCompareTransform, 0 );
     mCheckOOBB = true;
     mCheckCircle = true;
-    Query( this, aabb );
+    queryAABB( aabb );
     mCheckCircle = false;
     mCheckOOBB = false;
 
@@ -455,14 +494,14 @@ U32 WorldQuery::oobbQueryCircle( const Vector2& centroid, const F32 radius )
 
 //-----------------------------------------------------------------------------
 
-U32 WorldQuery::anyQueryAABB( const b2AABB& aabb )
+U32 WorldQueryContext::anyQueryAABB( const b2AABB& aabb )
 {
     // Debug Profiling.
     PROFILE_SCOPE(WorldQuery_anyQueryAABBAABB);
 
     // Query.
     oobbQueryAABB( aabb );
-    mMasterQueryKey--;
+    mQueryKey--;
     collisionQueryAABB( aabb );
 
     // Inject always-in-scope.
@@ -473,14 +512,14 @@ U32 WorldQuery::anyQueryAABB( const b2AABB& aabb )
 
 //-----------------------------------------------------------------------------
 
-U32 WorldQuery::anyQueryRay( const Vector2& point1, const Vector2& point2 )
+U32 WorldQueryContext::anyQueryRay( const Vector2& point1, const Vector2& point2 )
 {
     // Debug Profiling.
     PROFILE_SCOPE(WorldQuery_AnyQueryRay);
 
     // Query.
     oobbQueryRay( point1, point2 );
-    mMasterQueryKey--;
+    mQueryKey--;
     collisionQueryRay( point1, point2 );
 
     // Inject always-in-scope.
@@ -491,14 +530,14 @@ U32 WorldQuery::anyQueryRay( const Vector2& point1, const Vector2& point2 )
 
 //-----------------------------------------------------------------------------
 
-U32 WorldQuery::anyQueryPoint( const Vector2& point )
+U32 WorldQueryContext::anyQueryPoint( const Vector2& point )
 {
     // Debug Profiling.
     PROFILE_SCOPE(WorldQuery_AnyQueryPoint);
 
     // Query.
     oobbQueryPoint( point );
-    mMasterQueryKey--;
+    mQueryKey--;
     collisionQueryPoint( point );
 
     // Inject always-in-scope.
@@ -509,14 +548,14 @@ U32 WorldQuery::anyQueryPoint( const Vector2& point )
 
 //-----------------------------------------------------------------------------
 
-U32 WorldQuery::anyQueryCircle( const Vector2& centroid, const F32 radius )
+U32 WorldQueryContext::anyQueryCircle( const Vector2& centroid, const F32 radius )
 {
     // Debug Profiling.
     PROFILE_SCOPE(WorldQuery_AnyQueryCircle);
 
     // Query.
     oobbQueryCircle( centroid, radius );
-    mMasterQueryKey--;
+    mQueryKey--;
     collisionQueryCircle( centroid, radius );
 
     // Inject always-in-scope.
@@ -527,7 +566,153 @@ U32 WorldQuery::anyQueryCircle( const Vector2& centroid, const F32 radius )
 
 //-----------------------------------------------------------------------------
 
-void WorldQuery::clearQuery( void )
+U32 WorldQueryContext::aabbQueryAABBs( const b2AABB* pAABBs, const U32 count )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(WorldQuery_AABBQueryAABBs);
+
+    return batchQuery( pAABBs, NULL, NULL, count );
+}
+
+//-----------------------------------------------------------------------------
+
+U32 WorldQueryContext::aabbQueryRays( const Vector2* pPoints1, const Vector2* pPoints2, const U32 count )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(WorldQuery_AABBQueryRays);
+
+    return batchQuery( NULL, pPoints1, pPoints2, count );
+}
+
+//-----------------------------------------------------------------------------
+
+U32 WorldQueryContext::oobbQueryAABBs( const b2AABB* pAABBs, const U32 count )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(WorldQuery_OOBBQueryAABBs);
+
+    mCheckOOBB = true;
+    const U32 resultCount = batchQuery( pAABBs, NULL, NULL, count );
+    mCheckOOBB = false;
+
+    return resultCount;
+}
+
+//-----------------------------------------------------------------------------
+
+U32 WorldQueryContext::oobbQueryRays( const Vector2* pPoints1, const Vector2* pPoints2, const U32 count )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(WorldQuery_OOBBQueryRays);
+
+    mCheckOOBB = true;
+    const U32 resultCount = batchQuery( NULL, pPoints1, pPoints2, count );
+    mCheckOOBB = false;
+
+    return resultCount;
+}
+
+//-----------------------------------------------------------------------------
+
+U32 WorldQueryContext::batchQuery( const b2AABB* pAABBs, const Vector2* pPoints1, const Vector2* pPoints2, const U32 count )
+{
+    // Reset the batch.
+    mBatchHits.clear();
+    mBatchQueryResults.clear();
+    mBatchResultOffsets.setSize( count + 1 );
+    dMemset( mBatchResultOffsets.address(), 0, mBatchResultOffsets.size() * sizeof(U32) );
+    mCompareTransform.SetIdentity();
+
+    // Walk the tree once for each group of queries.
+    for ( mBatchBase = 0; mBatchBase < count; mBatchBase += b2_maxBatchQueries )
+    {
+        const U32 queryCount = getMin( count - mBatchBase, (U32)b2_maxBatchQueries );
+
+        if ( pAABBs != NULL )
+        {
+            // Set the areas as polygons for the OOBB checks.
+            if ( mCheckOOBB )
+            {
+                for ( U32 n = 0; n < queryCount; ++n )
+                {
+                    const b2AABB& aabb = pAABBs[mBatchBase + n];
+                    b2Vec2 verts[4];
+                    verts[0].Set( aabb.lowerBound.x, aabb.lowerBound.y );
+                    verts[1].Set( aabb.upperBound.x, aabb.lowerBound.y );
+                    verts[2].Set( aabb.upperBound.x, aabb.upperBound.y );
+                    verts[3].Set( aabb.lowerBound.x, aabb.upperBound.y );
+                    mBatchPolygons[n].Set( verts, 4 );
+                }
+            }
+
+            mpWorldQuery->QueryBatch( this, pAABBs + mBatchBase, (int32)queryCount );
+        }
+        else
+        {
+            // Set the rays.
+            for ( U32 n = 0; n < queryCount; ++n )
+            {
+                mBatchRays[n].p1 = pPoints1[mBatchBase + n];
+                mBatchRays[n].p2 = pPoints2[mBatchBase + n];
+                mBatchRays[n].maxFraction = 1.0f;
+            }
+
+            mpWorldQuery->RayCastBatch( this, mBatchRays, (int32)queryCount );
+        }
+    }
+
+    // The hits arrive in tree order so group them by query.
+    // Count the hits for each query then turn the counts into offsets.
+    U32* pOffsets = mBatchResultOffsets.address();
+    for ( S32 n = 0; n < mBatchHits.size(); ++n )
+        pOffsets[mBatchHits[n].mQueryIndex + 1]++;
+    for ( U32 n = 0; n < count; ++n )
+        pOffsets[n + 1] += pOffsets[n];
+
+    // Place the hits.  This leaves each offset at the end of its query's hits.
+    mBatchSortedObjects.setSize( mBatchHits.size() );
+    for ( S32 n = 0; n < mBatchHits.size(); ++n )
+        mBatchSortedObjects[pOffsets[mBatchHits[n].mQueryIndex]++] = mBatchHits[n].mpSceneObject;
+
+    // Produce the results for each query, injecting always-in-scope.
+    U32 hitStart = 0;
+    for ( U32 queryIndex = 0; queryIndex < count; ++queryIndex )
+    {
+        const U32 hitEnd = pOffsets[queryIndex];
+        pOffsets[queryIndex] = mBatchQueryResults.size();
+
+        mQueryKey++;
+
+        for ( U32 n = hitStart; n < hitEnd; ++n )
+        {
+            SceneObject* pSceneObject = mBatchSortedObjects[n];
+            mBatchQueryResults.push_back( WorldQueryResult( pSceneObject ) );
+            setProxyQueried( pSceneObject->getWorldProxy() );
+        }
+
+        hitStart = hitEnd;
+
+        // Skip always-in-scope if filtering it.
+        if ( mQueryFilter.mAlwaysInScopeFilter )
+            continue;
+
+        const typeSceneObjectVector& alwaysInScopeSet = mpWorldQuery->mAlwaysInScopeSet;
+        for( typeSceneObjectVector::const_iterator itr = alwaysInScopeSet.begin(); itr != alwaysInScopeSet.end(); ++itr )
+        {
+            SceneObject* pSceneObject = (*itr);
+
+            if ( !getProxyQueried( pSceneObject->getWorldProxy() ) && getFilterPassed( pSceneObject ) )
+                mBatchQueryResults.push_back( WorldQueryResult( pSceneObject ) );
+        }
+    }
+    pOffsets[count] = mBatchQueryResults.size();
+
+    return mBatchQueryResults.size();
+}
+
+//-----------------------------------------------------------------------------
+
+void WorldQueryContext::clearQuery( void )
 {
     // Debug Profiling.
     PROFILE_SCOPE(WorldQuery_ClearQuery);
@@ -542,17 +727,17 @@ void WorldQuery::clearQuery( void )
 
 //-----------------------------------------------------------------------------
 
-typeWorldQueryResultVector& WorldQuery::getLayeredQueryResults( const U32 layer ) 
+typeWorldQueryResultVector& WorldQueryContext::getLayeredQueryResults( const U32 layer ) 
 {
     // Sanity!
-    AssertFatal( layer < MAX_LAYERS_SUPPORTED, "WorldQuery::getResults() - Layer out of range." );
+    AssertFatal( layer < MAX_LAYERS_SUPPORTED, "WorldQueryContext::getResults() - Layer out of range." );
 
     return mLayeredQueryResults[ layer ];
 }
 
 //-----------------------------------------------------------------------------
 
-void WorldQuery::sortRaycastQueryResult( void )
+void WorldQueryContext::sortRaycastQueryResult( void )
 {
     // Debug Profiling.
     PROFILE_SCOPE(WorldQuery_SortRayCastQueryResult);
@@ -580,7 +765,7 @@ void WorldQuery::sortRaycastQueryResult( void )
 
 //-----------------------------------------------------------------------------
 
-bool WorldQuery::ReportFixture( b2Fixture* fixture )
+bool WorldQueryContext::ReportFixture( b2Fixture* fixture )
 {
     // Debug Profiling.
     PROFILE_SCOPE(WorldQuery_ReportFixture);
@@ -594,7 +779,7 @@ bool WorldQuery::ReportFixture( b2Fixture* fixture )
     SceneObject* pSceneObject = static_cast<SceneObject*>(pPhysicsProxy);
 
     // Ignore if already tagged with the world query key.
-    if ( pSceneObject->getWorldQueryKey() == mMasterQueryKey )
+    if ( getProxyQueried( pSceneObject->getWorldProxy() ) )
         return true;
 
     // Enabled filter.
@@ -635,7 +820,7 @@ bool WorldQuery::ReportFixture( b2Fixture* fixture )
         mQueryResults.push_back( queryResult );
 
         // Tag with world query key.
-        pSceneObject->setWorldQueryKey( mMasterQueryKey );
+        setProxyQueried( pSceneObject->getWorldProxy() );
     }
 
     return true;
@@ -643,7 +828,7 @@ bool WorldQuery::ReportFixture( b2Fixture* fixture )
 
 //-----------------------------------------------------------------------------
 
-F32 WorldQuery::ReportFixture( b2Fixture* fixture, const b2Vec2& point, const b2Vec2& normal, F32 fraction )
+F32 WorldQueryContext::ReportFixture( b2Fixture* fixture, const b2Vec2& point, const b2Vec2& normal, F32 fraction )
 {
     // Debug Profiling.
     PROFILE_SCOPE(WorldQuery_ReportFixtureRay);
@@ -657,7 +842,7 @@ F32 WorldQuery::ReportFixture( b2Fixture* fixture, const b2Vec2& point, const b2
     SceneObject* pSceneObject = static_cast<SceneObject*>(pPhysicsProxy);
 
     // Ignore if already tagged with the world query key.
-    if ( pSceneObject->getWorldQueryKey() == mMasterQueryKey )
+    if ( getProxyQueried( pSceneObject->getWorldProxy() ) )
         return 1.0f;
 
     // Enabled filter.
@@ -680,7 +865,7 @@ F32 WorldQuery::ReportFixture( b2Fixture* fixture, const b2Vec2& point, const b2
     const S32 shapeIndex = pSceneObject->getCollisionShapeIndex( fixture );
 
     // Sanity!
-    AssertFatal( shapeIndex >= 0, "WorldQuery::ReportFixture() - Cannot find shape index reported on physics proxy of a fixture." );
+    AssertFatal( shapeIndex >= 0, "WorldQueryContext::ReportFixture() - Cannot find shape index reported on physics proxy of a fixture." );
 
     // Compare masks and report.
     if ( (mQueryFilter.mSceneLayerMask & sceneLayerMask) != 0 && (mQueryFilter.mSceneGroupMask & sceneGroupMask) != 0 )
@@ -690,7 +875,7 @@ F32 WorldQuery::ReportFixture( b2Fixture* fixture, const b2Vec2& point, const b2
         mQueryResults.push_back( queryResult );
 
         // Tag with world query key.
-        pSceneObject->setWorldQueryKey( mMasterQueryKey );
+        setProxyQueried( pSceneObject->getWorldProxy() );
     }
 
     return 1.0f;
@@ -698,13 +883,13 @@ F32 WorldQuery::ReportFixture( b2Fixture* fixture, const b2Vec2& point, const b2
 
 //-----------------------------------------------------------------------------
 
-bool WorldQuery::QueryCallback( S32 proxyId )
+bool WorldQueryContext::QueryCallback( S32 proxyId )
 {    
     // Debug Profiling.
     PROFILE_SCOPE(WorldQuery_QueryCallback);
 
     // If not the correct proxy then ignore.
-    PhysicsProxy* pPhysicsProxy = static_cast<PhysicsProxy*>(GetUserData( proxyId ));
+    PhysicsProxy* pPhysicsProxy = static_cast<PhysicsProxy*>(mpWorldQuery->GetUserData( proxyId ));
     if ( pPhysicsProxy->getPhysicsProxyType() != PhysicsProxy::PHYSIC_PROXY_SCENEOBJECT )
         return true;
 
@@ -712,7 +897,7 @@ bool WorldQuery::QueryCallback( S32 proxyId )
     SceneObject* pSceneObject = static_cast<SceneObject*>(pPhysicsProxy);
 
     // Ignore if already tagged with the world query key.
-    if ( pSceneObject->getWorldQueryKey() == mMasterQueryKey )
+    if ( getProxyQueried( pSceneObject->getWorldProxy() ) )
         return true;
 
     // Enabled filter.
@@ -782,7 +967,7 @@ bool WorldQuery::QueryCallback( S32 proxyId )
         mQueryResults.push_back( queryResult );
 
         // Tag with world query key.
-        pSceneObject->setWorldQueryKey( mMasterQueryKey );
+        setProxyQueried( pSceneObject->getWorldProxy() );
     }
 
     return true;
@@ -790,13 +975,13 @@ bool WorldQuery::QueryCallback( S32 proxyId )
 
 //-----------------------------------------------------------------------------
 
-F32 WorldQuery::RayCastCallback( const b2RayCastInput& input, S32 proxyId )
+F32 WorldQueryContext::RayCastCallback( const b2RayCastInput& input, S32 proxyId )
 {
     // Debug Profiling.
     PROFILE_SCOPE(WorldQuery_RayCastCallback);
 
     // If not the correct proxy then ignore.
-    PhysicsProxy* pPhysicsProxy = static_cast<PhysicsProxy*>(GetUserData( proxyId ));
+    PhysicsProxy* pPhysicsProxy = static_cast<PhysicsProxy*>(mpWorldQuery->GetUserData( proxyId ));
     if ( pPhysicsProxy->getPhysicsProxyType() != PhysicsProxy::PHYSIC_PROXY_SCENEOBJECT )
         return 1.0f;
 
@@ -804,7 +989,7 @@ F32 WorldQuery::RayCastCallback( const b2RayCastInput& input, S32 proxyId )
     SceneObject* pSceneObject = static_cast<SceneObject*>(pPhysicsProxy);
 
     // Ignore if already tagged with the world query key.
-    if ( pSceneObject->getWorldQueryKey() == mMasterQueryKey )
+    if ( getProxyQueried( pSceneObject->getWorldProxy() ) )
         return 1.0f;
 
     // Enabled filter.
@@ -842,7 +1027,7 @@ F32 WorldQuery::RayCastCallback( const b2RayCastInput& input, S32 proxyId )
         mQueryResults.push_back( queryResult );
 
         // Tag with world query key.
-        pSceneObject->setWorldQueryKey( mMasterQueryKey );
+        setProxyQueried( pSceneObject->getWorldProxy() );
     }
 
     return 1.0f;
@@ -850,7 +1035,155 @@ F32 WorldQuery::RayCastCallback( const b2RayCastInput& input, S32 proxyId )
 
 //-----------------------------------------------------------------------------
 
-void WorldQuery::injectAlwaysInScope( void )
+bool WorldQueryContext::QueryBatchCallback( S32 proxyId, U32 queryMask )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(WorldQuery_QueryBatchCallback);
+
+    // If not the correct proxy then ignore.
+    PhysicsProxy* pPhysicsProxy = static_cast<PhysicsProxy*>(mpWorldQuery->GetUserData( proxyId ));
+    if ( pPhysicsProxy->getPhysicsProxyType() != PhysicsProxy::PHYSIC_PROXY_SCENEOBJECT )
+        return true;
+
+    // Fetch scene object.
+    SceneObject* pSceneObject = static_cast<SceneObject*>(pPhysicsProxy);
+
+    // Ignore if filtered.
+    if ( !getFilterPassed( pSceneObject ) )
+        return true;
+
+    // Fetch the shapes render OOBB.
+    b2PolygonShape oobb;
+    if ( mCheckOOBB )
+        oobb.Set( pSceneObject->getRenderOOBB(), 4);
+
+    // Report to each query.
+    for ( U32 n = 0; n < b2_maxBatchQueries; ++n )
+    {
+        // Skip if the query didn't overlap.
+        if ( (queryMask & (1u << n)) == 0 )
+            continue;
+
+        // Check OOBB.
+        if ( mCheckOOBB && !b2TestOverlap( &mBatchPolygons[n], 0, &oobb, 0, mCompareTransform, mCompareTransform ) )
+            continue;
+
+        BatchHit batchHit;
+        batchHit.mQueryIndex = mBatchBase + n;
+        batchHit.mpSceneObject = pSceneObject;
+        mBatchHits.push_back( batchHit );
+    }
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+bool WorldQueryContext::RayCastBatchCallback( S32 proxyId, U32 queryMask )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(WorldQuery_RayCastBatchCallback);
+
+    // If not the correct proxy then ignore.
+    PhysicsProxy* pPhysicsProxy = static_cast<PhysicsProxy*>(mpWorldQuery->GetUserData( proxyId ));
+    if ( pPhysicsProxy->getPhysicsProxyType() != PhysicsProxy::PHYSIC_PROXY_SCENEOBJECT )
+        return true;
+
+    // Fetch scene object.
+    SceneObject* pSceneObject = static_cast<SceneObject*>(pPhysicsProxy);
+
+    // Ignore if filtered.
+    if ( !getFilterPassed( pSceneObject ) )
+        return true;
+
+    // Fetch the shapes render OOBB.
+    b2PolygonShape oobb;
+    if ( mCheckOOBB )
+        oobb.Set( pSceneObject->getRenderOOBB(), 4);
+
+    // Report to each query.
+    for ( U32 n = 0; n < b2_maxBatchQueries; ++n )
+    {
+        // Skip if the ray didn't hit.
+        if ( (queryMask & (1u << n)) == 0 )
+            continue;
+
+        // Check OOBB.
+        b2RayCastOutput rayOutput;
+        if ( mCheckOOBB && !oobb.RayCast( &rayOutput, mBatchRays[n], mCompareTransform, 0 ) )
+            continue;
+
+        BatchHit batchHit;
+        batchHit.mQueryIndex = mBatchBase + n;
+        batchHit.mpSceneObject = pSceneObject;
+        mBatchHits.push_back( batchHit );
+    }
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+bool WorldQueryContext::getFilterPassed( SceneObject* pSceneObject ) const
+{
+    // Enabled filter.
+    if ( mQueryFilter.mEnabledFilter && !pSceneObject->isEnabled() )
+        return false;
+
+    // Visible filter.
+    if ( mQueryFilter.mVisibleFilter && !pSceneObject->getVisible() )
+        return false;
+
+    // Picking allowed filter.
+    if ( mQueryFilter.mPickingAllowedFilter && !pSceneObject->getPickingAllowed() )
+        return false;
+
+    // Compare masks.
+    return (mQueryFilter.mSceneLayerMask & pSceneObject->getSceneLayerMask()) != 0 && (mQueryFilter.mSceneGroupMask & pSceneObject->getSceneGroupMask()) != 0;
+}
+
+//-----------------------------------------------------------------------------
+
+void WorldQueryContext::setProxyQueried( const S32 proxyId )
+{
+    // Grow the query keys to cover the proxy.
+    if ( (U32)proxyId >= mProxyQueryKeys.size() )
+    {
+        const U32 oldSize = mProxyQueryKeys.size();
+        mProxyQueryKeys.setSize( getMax( (U32)proxyId + 1, oldSize * 2 ) );
+        dMemset( mProxyQueryKeys.address() + oldSize, 0, (mProxyQueryKeys.size() - oldSize) * sizeof(U32) );
+    }
+
+    // Tag with the query key.
+    mProxyQueryKeys[proxyId] = mQueryKey;
+}
+
+//-----------------------------------------------------------------------------
+
+void WorldQueryContext::queryAABB( const b2AABB& aabb )
+{
+    // Query the tree if the snapshot isn't usable.
+    const WorldQuerySnapshot& snapshot = mpWorldQuery->mSnapshot;
+    if ( !snapshot.getActive() )
+    {
+        mpWorldQuery->Query( this, aabb );
+        return;
+    }
+
+    // Query the snapshot.
+    mSnapshotProxies.clear();
+    snapshot.query( aabb, mSnapshotProxies );
+
+    // Report the proxies.
+    for ( S32 n = 0; n < mSnapshotProxies.size(); ++n )
+    {
+        QueryCallback( mSnapshotProxies[n] );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void WorldQueryContext::injectAlwaysInScope( void )
 {
     // Debug Profiling.
     PROFILE_SCOPE(WorldQuery_InjectAlwaysInScope);
@@ -860,13 +1193,13 @@ void WorldQuery::injectAlwaysInScope( void )
         return;
 
     // Iterate always-in-scope.
-    for( typeSceneObjectVector::iterator itr = mAlwaysInScopeSet.begin(); itr != mAlwaysInScopeSet.end(); ++itr )
+    for( typeSceneObjectVector::iterator itr = mpWorldQuery->mAlwaysInScopeSet.begin(); itr != mpWorldQuery->mAlwaysInScopeSet.end(); ++itr )
     {
         // Fetch scene object.
         SceneObject* pSceneObject = (*itr);
 
         // Ignore if already tagged with the world query key.
-        if ( pSceneObject->getWorldQueryKey() == mMasterQueryKey )
+        if ( getProxyQueried( pSceneObject->getWorldProxy() ) )
             continue;
 
         // Enabled filter.
@@ -893,14 +1226,14 @@ void WorldQuery::injectAlwaysInScope( void )
             mQueryResults.push_back( queryResult );
 
             // Tag with world query key.
-            pSceneObject->setWorldQueryKey( mMasterQueryKey );
+            setProxyQueried( pSceneObject->getWorldProxy() );
         }
     }
 }
 
 //-----------------------------------------------------------------------------
 
-S32 QSORT_CALLBACK WorldQuery::rayCastFractionSort(const void* a, const void* b)
+S32 QSORT_CALLBACK WorldQueryContext::rayCastFractionSort(const void* a, const void* b)
 {
     // Debug Profiling.
     PROFILE_SCOPE(WorldQuery_RayCastFractionSort);
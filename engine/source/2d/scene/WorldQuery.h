@@ -31,30 +31,28 @@
 #include "2d/scene/WorldQueryResult.h"
 #endif
 
+#ifndef _WORLD_QUERY_SNAPSHOT_H_
+#include "2d/scene/WorldQuerySnapshot.h"
+#endif
+
 ///-----------------------------------------------------------------------------
 
 class Scene;
+class WorldQuery;
 
 ///-----------------------------------------------------------------------------
 
-class WorldQuery :
-    protected b2DynamicTree,
+/// A world query context owns everything a query needs: its filter, its results and the state used to
+/// stop objects being reported twice.  Queries on separate contexts of the same world query can therefore
+/// run concurrently, or be nested inside callbacks, as long as nothing modifies the scene whilst they run
+/// (for instance from integration jobs or between ticks).  A single context must only be used by one thread at a time.
+class WorldQueryContext :
     public b2QueryCallback,
-    public b2RayCastCallback,
-    public SimObject
+    public b2RayCastCallback
 {
 public:
-    WorldQuery( Scene* pScene );
-    virtual         ~WorldQuery() {}
-
-    /// Standard scope.
-    S32             add( SceneObject* pSceneObject );
-    void            remove( SceneObject* pSceneObject );
-    bool            update( SceneObject* pSceneObject, const b2AABB& aabb, const b2Vec2& displacement );
-
-    /// Always in scope.
-    void            addAlwaysInScope( SceneObject* pSceneObject );
-    void            removeAlwaysInScope( SceneObject* pSceneObject );
+    WorldQueryContext( WorldQuery* pWorldQuery );
+    virtual         ~WorldQueryContext() {}
 
     /// World collision-shape queries.
     U32             collisionQueryAABB( const b2AABB& aabb );
@@ -80,6 +78,13 @@ public:
     U32             anyQueryPoint( const Vector2& point );
     U32             anyQueryCircle( const Vector2& centroid, const F32 radius );
 
+    /// Batched queries.
+    /// These walk the tree once for many areas or rays and replace the previous batch results, not the query results.
+    U32             aabbQueryAABBs( const b2AABB* pAABBs, const U32 count );
+    U32             aabbQueryRays( const Vector2* pPoints1, const Vector2* pPoints2, const U32 count );
+    U32             oobbQueryAABBs( const b2AABB* pAABBs, const U32 count );
+    U32             oobbQueryRays( const Vector2* pPoints1, const Vector2* pPoints2, const U32 count );
+
     /// Filtering.
     inline void     setQueryFilter( const WorldQueryFilter& queryFilter ) { mQueryFilter = queryFilter; }
    
@@ -91,18 +96,38 @@ public:
     inline bool     getIsRaycastQueryResult( void ) const { return mIsRaycastQueryResult; }
     void            sortRaycastQueryResult( void );
 
+    /// Batch results.
+    inline U32      getBatchQueryCount( void ) const { return mBatchResultOffsets.size() == 0 ? 0 : mBatchResultOffsets.size() - 1; }
+    inline U32      getBatchQueryResultsCount( const U32 queryIndex ) const { return mBatchResultOffsets[queryIndex+1] - mBatchResultOffsets[queryIndex]; }
+    inline const WorldQueryResult* getBatchQueryResults( const U32 queryIndex ) const { return mBatchQueryResults.address() + mBatchResultOffsets[queryIndex]; }
+
     /// Callbacks.
     virtual bool    ReportFixture( b2Fixture* fixture );
     virtual F32     ReportFixture( b2Fixture* fixture, const b2Vec2& point, const b2Vec2& normal, F32 fraction );
     bool            QueryCallback( S32 proxyId );
     F32             RayCastCallback( const b2RayCastInput& input, S32 proxyId );
+    bool            QueryBatchCallback( S32 proxyId, U32 queryMask );
+    bool            RayCastBatchCallback( S32 proxyId, U32 queryMask );
 
 private:
+    struct BatchHit
+    {
+        U32             mQueryIndex;
+        SceneObject*    mpSceneObject;
+    };
+
+    void            queryAABB( const b2AABB& aabb );
     void            injectAlwaysInScope( void );
+    bool            getFilterPassed( SceneObject* pSceneObject ) const;
+    inline bool     getProxyQueried( const S32 proxyId ) const { return (U32)proxyId < mProxyQueryKeys.size() && mProxyQueryKeys[proxyId] == mQueryKey; }
+    void            setProxyQueried( const S32 proxyId );
+    U32             batchQuery( const b2AABB* pAABBs, const Vector2* pPoints1, const Vector2* pPoints2, const U32 count );
     static S32      QSORT_CALLBACK rayCastFractionSort(const void* a, const void* b);
 
+protected:
+    WorldQuery*                 mpWorldQuery;
+
 private:
-    Scene*                      mpScene;
     WorldQueryFilter            mQueryFilter;
     b2PolygonShape              mComparePolygonShape;
     b2CircleShape               mCompareCircleShape;
@@ -116,8 +141,54 @@ private:
     typeWorldQueryResultVector  mLayeredQueryResults[MAX_LAYERS_SUPPORTED];
     typeWorldQueryResultVector  mQueryResults;
     bool                        mIsRaycastQueryResult;
+    Vector<U32>                 mProxyQueryKeys;
+    U32                         mQueryKey;
+    Vector<S32>                 mSnapshotProxies;
+
+    /// Batch state.
+    U32                         mBatchBase;
+    b2PolygonShape              mBatchPolygons[b2_maxBatchQueries];
+    b2RayCastInput              mBatchRays[b2_maxBatchQueries];
+    Vector<BatchHit>            mBatchHits;
+    Vector<SceneObject*>        mBatchSortedObjects;
+    Vector<U32>                 mBatchResultOffsets;
+    typeWorldQueryResultVector  mBatchQueryResults;
+};
+
+///-----------------------------------------------------------------------------
+
+/// The world query holds the spatial tree of scene objects along with a flattened snapshot of it used
+/// for area queries.  It is also a query context itself so existing single-threaded queries can be run directly on it.
+class WorldQuery :
+    protected b2DynamicTree,
+    public WorldQueryContext,
+    public SimObject
+{
+    friend class WorldQueryContext;
+
+public:
+    WorldQuery( Scene* pScene );
+    virtual         ~WorldQuery() {}
+
+    /// Standard scope.
+    S32             add( SceneObject* pSceneObject );
+    void            remove( SceneObject* pSceneObject );
+    bool            update( SceneObject* pSceneObject, const b2AABB& aabb, const b2Vec2& displacement );
+
+    /// Always in scope.
+    void            addAlwaysInScope( SceneObject* pSceneObject );
+    void            removeAlwaysInScope( SceneObject* pSceneObject );
+
+    /// Snapshot.
+    void            updateSnapshot( void );
+    inline const WorldQuerySnapshot& getSnapshot( void ) const { return mSnapshot; }
+
+    inline Scene*   getScene( void ) const { return mpScene; }
+
+private:
+    Scene*                      mpScene;
     typeSceneObjectVector       mAlwaysInScopeSet;
-    U32                         mMasterQueryKey;
+    WorldQuerySnapshot          mSnapshot;
 };
 
 #endif // _WORLD_QUERY_H_
\ No newline at end of file
@@ -0,0 +1,471 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#include "2d/scene/WorldQuerySnapshot.h"
+
+// Debug Profiling.
+#include "debug/profiler.h"
+
+// Select the SIMD node test.
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define WORLD_QUERY_SNAPSHOT_SSE
+#include <emmintrin.h>
+#elif defined(__ARM_NEON__) || defined(__ARM_NEON)
+#define WORLD_QUERY_SNAPSHOT_NEON
+#include <arm_neon.h>
+#endif
+
+//-----------------------------------------------------------------------------
+
+// Spreads the low 16 bits of a value to the even bits.
+static inline U32 spreadMortonBits( U32 value )
+{
+    value &= 0x0000ffff;
+    value = (value | (value << 8)) & 0x00ff00ff;
+    value = (value | (value << 4)) & 0x0f0f0f0f;
+    value = (value | (value << 2)) & 0x33333333;
+    value = (value | (value << 1)) & 0x55555555;
+    return value;
+}
+
+//-----------------------------------------------------------------------------
+
+WorldQuerySnapshot::WorldQuerySnapshot( const b2DynamicTree* pTree ) :
+        mpTree( pTree ),
+        mEvictedLeafCount( 0 ),
+        mUpdateCount( 1 )
+{
+    // Set debug associations.
+    VECTOR_SET_ASSOCIATION( mNodes );
+    VECTOR_SET_ASSOCIATION( mLeafProxies );
+    VECTOR_SET_ASSOCIATION( mOverflowProxies );
+    VECTOR_SET_ASSOCIATION( mProxyLeaves );
+    VECTOR_SET_ASSOCIATION( mProxyOverflows );
+    VECTOR_SET_ASSOCIATION( mProxyMoveUpdates );
+    VECTOR_SET_ASSOCIATION( mBuildEntries );
+    VECTOR_SET_ASSOCIATION( mSortEntries );
+}
+
+//-----------------------------------------------------------------------------
+
+void WorldQuerySnapshot::addProxy( const S32 proxyId )
+{
+    growProxies( proxyId );
+
+    // New proxies wait in the overflow until the next rebuild.
+    mProxyLeaves[proxyId] = b2_nullNode;
+    mProxyMoveUpdates[proxyId] = 0;
+    addOverflow( proxyId );
+}
+
+//-----------------------------------------------------------------------------
+
+void WorldQuerySnapshot::removeProxy( const S32 proxyId )
+{
+    evictLeaf( proxyId );
+    removeOverflow( proxyId );
+}
+
+//-----------------------------------------------------------------------------
+
+void WorldQuerySnapshot::moveProxy( const S32 proxyId )
+{
+    // Move the proxy to the overflow.
+    evictLeaf( proxyId );
+    addOverflow( proxyId );
+
+    // Note when it moved.
+    mProxyMoveUpdates[proxyId] = mUpdateCount;
+}
+
+//-----------------------------------------------------------------------------
+
+bool WorldQuerySnapshot::update( void )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(WorldQuerySnapshot_Update);
+
+    mUpdateCount++;
+
+    // Count the overflow proxies that have settled.
+    U32 settledCount = 0;
+    for ( S32 n = 0; n < mOverflowProxies.size(); ++n )
+    {
+        if ( getProxySettled( mOverflowProxies[n] ) )
+            settledCount++;
+    }
+
+    // Finish if a rebuild would gain little.
+    if ( mEvictedLeafCount + settledCount <= getRebuildThreshold() )
+        return false;
+
+    rebuild();
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+U32 WorldQuerySnapshot::query( const b2AABB& aabb, Vector<S32>& proxies ) const
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(WorldQuerySnapshot_Query);
+
+    const U32 startCount = proxies.size();
+
+    if ( mNodes.size() > 0 )
+    {
+#if defined(WORLD_QUERY_SNAPSHOT_SSE)
+        const __m128 queryMinX = _mm_set1_ps( aabb.lowerBound.x );
+        const __m128 queryMinY = _mm_set1_ps( aabb.lowerBound.y );
+        const __m128 queryMaxX = _mm_set1_ps( aabb.upperBound.x );
+        const __m128 queryMaxY = _mm_set1_ps( aabb.upperBound.y );
+#elif defined(WORLD_QUERY_SNAPSHOT_NEON)
+        const float32x4_t queryMinX = vdupq_n_f32( aabb.lowerBound.x );
+        const float32x4_t queryMinY = vdupq_n_f32( aabb.lowerBound.y );
+        const float32x4_t queryMaxX = vdupq_n_f32( aabb.upperBound.x );
+        const float32x4_t queryMaxY = vdupq_n_f32( aabb.upperBound.y );
+#endif
+
+        // Each node pushes at most its width so this covers any practical depth.
+        S32 stack[256];
+        S32 stackCount = 0;
+        stack[stackCount++] = 0;
+
+        while ( stackCount > 0 )
+        {
+            const Node& node = mNodes[stack[--stackCount]];
+
+            // Test the children.
+#if defined(WORLD_QUERY_SNAPSHOT_SSE)
+            const __m128 overlap = _mm_and_ps(
+                _mm_and_ps( _mm_cmple_ps( _mm_loadu_ps( node.mMinX ), queryMaxX ), _mm_cmpge_ps( _mm_loadu_ps( node.mMaxX ), queryMinX ) ),
+                _mm_and_ps( _mm_cmple_ps( _mm_loadu_ps( node.mMinY ), queryMaxY ), _mm_cmpge_ps( _mm_loadu_ps( node.mMaxY ), queryMinY ) ) );
+            const U32 overlapMask = (U32)_mm_movemask_ps( overlap );
+#elif defined(WORLD_QUERY_SNAPSHOT_NEON)
+            const uint32x4_t overlap = vandq_u32(
+                vandq_u32( vcleq_f32( vld1q_f32( node.mMinX ), queryMaxX ), vcgeq_f32( vld1q_f32( node.mMaxX ), queryMinX ) ),
+                vandq_u32( vcleq_f32( vld1q_f32( node.mMinY ), queryMaxY ), vcgeq_f32( vld1q_f32( node.mMaxY ), queryMinY ) ) );
+            const U32 overlapMask =
+                (vgetq_lane_u32( overlap, 0 ) & 1) | (vgetq_lane_u32( overlap, 1 ) & 2) |
+                (vgetq_lane_u32( overlap, 2 ) & 4) | (vgetq_lane_u32( overlap, 3 ) & 8);
+#else
+            U32 overlapMask = 0;
+            for ( U32 lane = 0; lane < NodeWidth; ++lane )
+            {
+                if ( node.mMinX[lane] <= aabb.upperBound.x && node.mMaxX[lane] >= aabb.lowerBound.x &&
+                     node.mMinY[lane] <= aabb.upperBound.y && node.mMaxY[lane] >= aabb.lowerBound.y )
+                    overlapMask |= 1 << lane;
+            }
+#endif
+
+            for ( U32 lane = 0; lane < node.mChildCount; ++lane )
+            {
+                // Skip if not overlapping.
+                if ( (overlapMask & (1 << lane)) == 0 )
+                    continue;
+
+                const S32 child = node.mChildren[lane];
+
+                // Descend into nodes.
+                if ( child >= 0 )
+                {
+                    AssertFatal( stackCount < 256, "WorldQuerySnapshot::query() - Stack overflow." );
+                    stack[stackCount++] = child;
+                    continue;
+                }
+
+                // Report leaves that haven't been evicted.
+                const S32 proxyId = mLeafProxies[-(child + 1)];
+                if ( proxyId != b2_nullNode )
+                    proxies.push_back( proxyId );
+            }
+        }
+    }
+
+    // Test the overflow against the tree.
+    for ( S32 n = 0; n < mOverflowProxies.size(); ++n )
+    {
+        const S32 proxyId = mOverflowProxies[n];
+        if ( b2TestOverlap( mpTree->GetFatAABB( proxyId ), aabb ) )
+            proxies.push_back( proxyId );
+    }
+
+    return proxies.size() - startCount;
+}
+
+//-----------------------------------------------------------------------------
+
+void WorldQuerySnapshot::growProxies( const S32 proxyId )
+{
+    // Finish if the proxy is covered.
+    const U32 oldSize = mProxyLeaves.size();
+    if ( (U32)proxyId < oldSize )
+        return;
+
+    // Grow the per-proxy state.
+    const U32 newSize = getMax( (U32)proxyId + 1, oldSize * 2 );
+    mProxyLeaves.setSize( newSize );
+    mProxyOverflows.setSize( newSize );
+    mProxyMoveUpdates.setSize( newSize );
+    for ( U32 n = oldSize; n < newSize; ++n )
+    {
+        mProxyLeaves[n] = b2_nullNode;
+        mProxyOverflows[n] = b2_nullNode;
+        mProxyMoveUpdates[n] = 0;
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void WorldQuerySnapshot::addOverflow( const S32 proxyId )
+{
+    // Finish if already in the overflow.
+    if ( mProxyOverflows[proxyId] != b2_nullNode )
+        return;
+
+    mProxyOverflows[proxyId] = mOverflowProxies.size();
+    mOverflowProxies.push_back( proxyId );
+}
+
+//-----------------------------------------------------------------------------
+
+void WorldQuerySnapshot::removeOverflow( const S32 proxyId )
+{
+    // Finish if not in the overflow.
+    const S32 overflowIndex = mProxyOverflows[proxyId];
+    if ( overflowIndex == b2_nullNode )
+        return;
+
+    // Swap the last proxy into its place.
+    const S32 lastProxyId = mOverflowProxies.last();
+    mOverflowProxies[overflowIndex] = lastProxyId;
+    mProxyOverflows[lastProxyId] = overflowIndex;
+    mOverflowProxies.pop_back();
+
+    mProxyOverflows[proxyId] = b2_nullNode;
+}
+
+//-----------------------------------------------------------------------------
+
+void WorldQuerySnapshot::evictLeaf( const S32 proxyId )
+{
+    // Finish if not a leaf.
+    const S32 leafIndex = mProxyLeaves[proxyId];
+    if ( leafIndex == b2_nullNode )
+        return;
+
+    // Leave the leaf in place but stop reporting it.
+    mLeafProxies[leafIndex] = b2_nullNode;
+    mProxyLeaves[proxyId] = b2_nullNode;
+    mEvictedLeafCount++;
+}
+
+//-----------------------------------------------------------------------------
+
+void WorldQuerySnapshot::rebuild( void )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(WorldQuerySnapshot_Rebuild);
+
+    mBuildEntries.clear();
+    mBuildEntries.reserve( mLeafProxies.size() - mEvictedLeafCount + mOverflowProxies.size() );
+
+    // Gather the leaves that haven't been evicted.
+    for ( S32 n = 0; n < mLeafProxies.size(); ++n )
+    {
+        const S32 proxyId = mLeafProxies[n];
+        if ( proxyId == b2_nullNode )
+            continue;
+
+        BuildEntry entry;
+        entry.mAABB = mpTree->GetFatAABB( proxyId );
+        entry.mProxyId = proxyId;
+        mBuildEntries.push_back( entry );
+    }
+
+    // Gather the settled overflow, leaving the moving proxies there.
+    for ( S32 n = 0; n < mOverflowProxies.size(); )
+    {
+        const S32 proxyId = mOverflowProxies[n];
+        if ( !getProxySettled( proxyId ) )
+        {
+            ++n;
+            continue;
+        }
+
+        BuildEntry entry;
+        entry.mAABB = mpTree->GetFatAABB( proxyId );
+        entry.mProxyId = proxyId;
+        mBuildEntries.push_back( entry );
+
+        removeOverflow( proxyId );
+    }
+
+    // Reset the nodes.
+    mNodes.clear();
+    mLeafProxies.clear();
+    mEvictedLeafCount = 0;
+    mNodes.reserve( mBuildEntries.size() / (NodeWidth - 1) + 1 );
+    mLeafProxies.reserve( mBuildEntries.size() );
+
+    // Build the nodes.
+    if ( mBuildEntries.size() > 0 )
+    {
+        sortEntries();
+
+        b2AABB bounds;
+        buildNode( 0, mBuildEntries.size(), bounds );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+S32 WorldQuerySnapshot::buildNode( const U32 first, const U32 count, b2AABB& nodeBounds )
+{
+    // Allocate the node.  Children are built after it so the nodes are stored depth first.
+    const S32 nodeIndex = mNodes.size();
+    mNodes.increment();
+
+    // Divide the sorted entries into at most four groups.  Groups are sized to whole powers of the node width
+    // so each child subtree is full and only the last group of a node is partial.
+    U32 groupSize = 1;
+    while ( groupSize * NodeWidth < count )
+        groupSize *= NodeWidth;
+
+    const U32 groups = (count + groupSize - 1) / groupSize;
+    U32 groupFirst[NodeWidth];
+    U32 groupCount[NodeWidth];
+    for ( U32 group = 0; group < groups; ++group )
+    {
+        groupFirst[group] = first + group * groupSize;
+        groupCount[group] = getMin( groupSize, count - group * groupSize );
+    }
+
+    // Fill the children.  The node is fetched afterwards as building children can move it.
+    for ( U32 lane = 0; lane < NodeWidth; ++lane )
+    {
+        b2AABB bounds;
+        S32 child;
+
+        if ( lane >= groups )
+        {
+            // Keep empty children from overlapping.
+            bounds.lowerBound.Set( b2_maxFloat, b2_maxFloat );
+            bounds.upperBound.Set( -b2_maxFloat, -b2_maxFloat );
+            child = 0;
+        }
+        else if ( groupCount[lane] == 1 )
+        {
+            // Add a leaf.
+            const BuildEntry& entry = mBuildEntries[groupFirst[lane]];
+            const S32 proxyId = entry.mProxyId;
+            bounds = entry.mAABB;
+            child = -(mLeafProxies.size() + 1);
+            mProxyLeaves[proxyId] = mLeafProxies.size();
+            mLeafProxies.push_back( proxyId );
+        }
+        else
+        {
+            // Add a node.
+            child = buildNode( groupFirst[lane], groupCount[lane], bounds );
+        }
+
+        // Bound the node by its children.
+        if ( lane == 0 )
+            nodeBounds = bounds;
+        else if ( lane < groups )
+            nodeBounds.Combine( bounds );
+
+        Node& node = mNodes[nodeIndex];
+        node.mMinX[lane] = bounds.lowerBound.x;
+        node.mMinY[lane] = bounds.lowerBound.y;
+        node.mMaxX[lane] = bounds.upperBound.x;
+        node.mMaxY[lane] = bounds.upperBound.y;
+        node.mChildren[lane] = child;
+    }
+
+    mNodes[nodeIndex].mChildCount = groups;
+
+    return nodeIndex;
+}
+
+//-----------------------------------------------------------------------------
+
+void WorldQuerySnapshot::sortEntries( void )
+{
+    // Find the extent of the centers.
+    const U32 entryCount = mBuildEntries.size();
+    b2Vec2 centerMin = mBuildEntries[0].mAABB.GetCenter();
+    b2Vec2 centerMax = centerMin;
+    for ( U32 n = 1; n < entryCount; ++n )
+    {
+        const b2Vec2 center = mBuildEntries[n].mAABB.GetCenter();
+        centerMin = b2Min( centerMin, center );
+        centerMax = b2Max( centerMax, center );
+    }
+
+    // Key each entry by the Morton code of its center so sorting keeps neighbours together.
+    const b2Vec2 extent = centerMax - centerMin;
+    const F32 scaleX = extent.x > 0.0f ? 65535.0f / extent.x : 0.0f;
+    const F32 scaleY = extent.y > 0.0f ? 65535.0f / extent.y : 0.0f;
+    for ( U32 n = 0; n < entryCount; ++n )
+    {
+        BuildEntry& entry = mBuildEntries[n];
+        const b2Vec2 center = entry.mAABB.GetCenter();
+        const U32 cellX = (U32)((center.x - centerMin.x) * scaleX);
+        const U32 cellY = (U32)((center.y - centerMin.y) * scaleY);
+        entry.mKey = spreadMortonBits( cellX ) | (spreadMortonBits( cellY ) << 1);
+    }
+
+    // Radix sort the keys a byte at a time.
+    mSortEntries.setSize( entryCount );
+    BuildEntry* pSource = mBuildEntries.address();
+    BuildEntry* pTarget = mSortEntries.address();
+    for ( U32 shift = 0; shift < 32; shift += 8 )
+    {
+        // Count the digits then turn the counts into offsets.
+        U32 offsets[256];
+        dMemset( offsets, 0, sizeof(offsets) );
+        for ( U32 n = 0; n < entryCount; ++n )
+            offsets[(pSource[n].mKey >> shift) & 0xff]++;
+
+        U32 offset = 0;
+        for ( U32 digit = 0; digit < 256; ++digit )
+        {
+            const U32 digitCount = offsets[digit];
+            offsets[digit] = offset;
+            offset += digitCount;
+        }
+
+        // Place the entries.
+        for ( U32 n = 0; n < entryCount; ++n )
+            pTarget[offsets[(pSource[n].mKey >> shift) & 0xff]++] = pSource[n];
+
+        BuildEntry* pSwap = pSource;
+        pSource = pTarget;
+        pTarget = pSwap;
+    }
+
+    // An even number of passes leaves the sorted entries back in the build entries.
+    AssertFatal( pSource == mBuildEntries.address(), "WorldQuerySnapshot::sortEntries() - Sorted entries are in the wrong buffer." );
+}
@@ -0,0 +1,127 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _WORLD_QUERY_SNAPSHOT_H_
+#define _WORLD_QUERY_SNAPSHOT_H_
+
+#ifndef _VECTOR_H_
+#include "collection/vector.h"
+#endif
+
+#ifndef _MMATHFN_H_
+#include "math/mMathFn.h"
+#endif
+
+#ifndef BOX2D_H
+#include "box2d/Box2D.h"
+#endif
+
+///-----------------------------------------------------------------------------
+
+/// A flattened, four-wide copy of the world query tree for the part of the scene that is not moving.
+/// Each node holds the bounds of its children as separate arrays so all four are tested against a query
+/// at once.  Builds sort the proxies along a Morton curve and pack them into full subtrees stored
+/// contiguously in depth-first order.  Proxies that are added or whose fat AABB moves after a build are
+/// evicted to an overflow list that is tested against the tree directly, so queries stay exact between
+/// builds.  Proxies that keep moving stay in the overflow list.
+class WorldQuerySnapshot
+{
+public:
+    /// Children per node.
+    enum { NodeWidth = 4 };
+
+    WorldQuerySnapshot( const b2DynamicTree* pTree );
+
+    /// Proxy tracking.
+    void            addProxy( const S32 proxyId );
+    void            removeProxy( const S32 proxyId );
+    void            moveProxy( const S32 proxyId );
+
+    /// Rebuild if enough proxies have been evicted or have settled.  Returns whether it rebuilt.
+    bool            update( void );
+
+    /// Whether queries should use the snapshot rather than the tree.
+    inline bool     getActive( void ) const { return mNodes.size() > 0 && (U32)mOverflowProxies.size() <= getRebuildThreshold(); }
+
+    /// Append the proxies whose fat AABB overlaps the AABB.  Returns the number appended.
+    U32             query( const b2AABB& aabb, Vector<S32>& proxies ) const;
+
+    inline U32      getNodeCount( void ) const { return mNodes.size(); }
+    inline U32      getLeafCount( void ) const { return mLeafProxies.size() - mEvictedLeafCount; }
+    inline U32      getOverflowCount( void ) const { return mOverflowProxies.size(); }
+
+private:
+    struct Node
+    {
+        F32         mMinX[NodeWidth];
+        F32         mMinY[NodeWidth];
+        F32         mMaxX[NodeWidth];
+        F32         mMaxY[NodeWidth];
+
+        /// A node index, or a leaf index encoded as -(leaf+1).
+        S32         mChildren[NodeWidth];
+        U32         mChildCount;
+    };
+
+    struct BuildEntry
+    {
+        b2AABB      mAABB;
+        U32         mKey;
+        S32         mProxyId;
+    };
+
+    /// Updates a proxy must stay still for before it is built into the nodes.
+    enum { SettleUpdates = 30 };
+
+    /// Evictions or settled proxies below which a rebuild isn't worth it.
+    enum { MinimumRebuildCount = 64 };
+
+    inline U32      getRebuildThreshold( void ) const { return getMax( (U32)MinimumRebuildCount, (U32)mLeafProxies.size() / 8 ); }
+    inline bool     getProxySettled( const S32 proxyId ) const { const U32 moveUpdate = mProxyMoveUpdates[proxyId]; return moveUpdate == 0 || mUpdateCount - moveUpdate > SettleUpdates; }
+
+    void            growProxies( const S32 proxyId );
+    void            addOverflow( const S32 proxyId );
+    void            removeOverflow( const S32 proxyId );
+    void            evictLeaf( const S32 proxyId );
+    void            rebuild( void );
+    S32             buildNode( const U32 first, const U32 count, b2AABB& nodeBounds );
+    void            sortEntries( void );
+
+private:
+    const b2DynamicTree*    mpTree;
+
+    Vector<Node>            mNodes;
+    Vector<S32>             mLeafProxies;
+    U32                     mEvictedLeafCount;
+    Vector<S32>             mOverflowProxies;
+
+    /// Per-proxy state.
+    Vector<S32>             mProxyLeaves;
+    Vector<S32>             mProxyOverflows;
+    Vector<U32>             mProxyMoveUpdates;
+
+    U32                     mUpdateCount;
+    Vector<BuildEntry>      mBuildEntries;
+    Vector<BuildEntry>      mSortEntries;
+};
+
+#endif // _WORLD_QUERY_SNAPSHOT_H_
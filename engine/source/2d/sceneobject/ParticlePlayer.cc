@@ -28,42 +28,32 @@
 
 //------------------------------------------------------------------------------
 
-ParticleSystem::ParticleNode* ParticlePlayer::EmitterNode::createParticle( void )
+void ParticlePlayer::EmitterNode::createParticles( const U32 particleCount )
 {
     // Sanity!
-    AssertFatal( mOwner != NULL, "ParticlePlayer::EmitterNode::createParticle() - Cannot create a particle with a NULL owner." );
-  
-    // Fetch a free node,
-    ParticleSystem::ParticleNode* pFreeParticleNode = ParticleSystem::Instance->createParticle();
+    AssertFatal( mOwner != NULL, "ParticlePlayer::EmitterNode::createParticles() - Cannot create particles with a NULL owner." );
 
-    // Insert node into emitter chain.
-    pFreeParticleNode->mNextNode        = mParticleNodeHead.mNextNode;
-    pFreeParticleNode->mPreviousNode    = &mParticleNodeHead;
-    mParticleNodeHead.mNextNode         = pFreeParticleNode;
-    pFreeParticleNode->mNextNode->mPreviousNode = pFreeParticleNode;
+    // Note the first new particle.
+    const U32 firstParticle = mParticles.getParticleCount();
 
-    // Configure the node.
-    mOwner->configureParticle( this, pFreeParticleNode );
+    // Create and configure the particles.
+    for ( U32 n = 0; n < particleCount; ++n )
+    {
+        mOwner->configureParticle( this, mParticles.createParticle() );
+    }
 
-    return pFreeParticleNode;
+    // Do a single integration of the new particles to get things going.
+    mOwner->integrateParticles( this, firstParticle, mParticles.getParticleCount(), 0.0f );
 }
 
 //------------------------------------------------------------------------------
 
-void ParticlePlayer::EmitterNode::freeParticle( ParticleSystem::ParticleNode* pParticleNode )
+U32 ParticlePlayer::EmitterNode::freeExpiredParticles( void )
 {
     // Sanity!
-    AssertFatal( mOwner != NULL, "ParticlePlayer::EmitterNode::freeParticle() - Cannot free a particle with a NULL owner." );
+    AssertFatal( mOwner != NULL, "ParticlePlayer::EmitterNode::freeExpiredParticles() - Cannot free particles with a NULL owner." );
 
-    // Deallocate the assets.
-    pParticleNode->mFrameProvider.deallocateAssets();
-
-    // Remove the node from the emitter chain.
-    pParticleNode->mPreviousNode->mNextNode = pParticleNode->mNextNode;
-    pParticleNode->mNextNode->mPreviousNode = pParticleNode->mPreviousNode;
-   
-    // Free the node.
-    ParticleSystem::Instance->freeParticle( pParticleNode );
+    return mParticles.freeExpiredParticles( mpAssetEmitter->getSingleParticle() );
 }
 
 //------------------------------------------------------------------------------
@@ -73,11 +63,8 @@ void ParticlePlayer::EmitterNode::freeAllParticles( void )
     // Sanity!
     AssertFatal( mOwner != NULL, "ParticlePlayer::EmitterNode::freeAllParticles() - Cannot free all particles with a NULL owner." );
 
-    // Free all the nodes,
-    while( mParticleNodeHead.mNextNode != &mParticleNodeHead )
-    {
-        freeParticle( mParticleNodeHead.mNextNode );
-    }
+    // Free all the particles.
+    mParticles.freeAllParticles();
 }
 
 //------------------------------------------------------------------------------
@@ -94,7 +81,9 @@ ParticlePlayer::ParticlePlayer() :
                     mCameraIdleDistance( 0.0f ),
                     mCameraIdle( false ),
                     mWaitingForParticles( false ),
-                    mWaitingForDelete( false )
+                    mWaitingForDelete( false ),
+                    mIntegrationJobCount( 0 ),
+                    mLifeModePending( false )
 {
     // Fetch the particle player scales.
     mEmissionRateScale = Con::getFloatVariable( PARTICLE_PLAYER_EMISSION_RATE_SCALE, 1.0f );
@@ -265,6 +254,10 @@ void ParticlePlayer::integrateObject( const F32 totalTime, const F32 elapsedTime
     // Call parent.
     Parent::integrateObject( totalTime, elapsedTime, pDebugStats );
 
+    // Reset the integration jobs.
+    mIntegrationJobCount = 0;
+    mLifeModePending = false;
+
     // Finish if no need to integrate.
     if (    !mPlaying ||
             mPaused ||
@@ -281,123 +274,205 @@ void ParticlePlayer::integrateObject( const F32 totalTime, const F32 elapsedTime
     if ( pParticleAsset == NULL )
         return;
 
-    // Reset active particle count.
-    U32 activeParticleCount = 0;
+    // Flag the life-mode as pending.
+    mLifeModePending = true;
 
-    // Is the camera idle?
-    if ( !mCameraIdle )
+    // Finish if the camera is idle.
+    if ( mCameraIdle )
+        return;
+
+    // Update the particle player age.
+    mAge += scaledTime;
+
+    // Iterate the emitters.
+    // NOTE:-   The emissions are calculated here so that any storage is grown on the main thread.
+    //          The particles themselves are integrated and emitted by the integration jobs.
+    for( typeEmitterVector::iterator emitterItr = mEmitters.begin(); emitterItr != mEmitters.end(); ++emitterItr )
     {
-        // No, so update the particle player age.
-        mAge += scaledTime;
+        // Fetch the emitter node.
+        EmitterNode* pEmitterNode = *emitterItr;
+
+        // Fetch the asset emitter.
+        ParticleAssetEmitter* pParticleAssetEmitter = pEmitterNode->getAssetEmitter();
+
+        // Fetch the particles.
+        ParticleSystem::ParticleStore& particles = pEmitterNode->getParticles();
+
+        // Reset the pending emission.
+        pEmitterNode->setPendingEmission( 0 );
 
-        // Iterate the emitters.
-        for( typeEmitterVector::iterator emitterItr = mEmitters.begin(); emitterItr != mEmitters.end(); ++emitterItr )
+        // Skip generating new particles if the emitter is paused.
+        if ( pEmitterNode->getPaused() )
+            continue;
+
+        // Are we in single-particle mode?
+        if ( pParticleAssetEmitter->getSingleParticle() )
         {
-            // Fetch the emitter node.
-            EmitterNode* pEmitterNode = *emitterItr;
+            // Yes, so ensure there's room for the single particle.
+            particles.ensureCapacity( particles.getParticleCount() + 1 );
+            continue;
+        }
 
-            // Fetch the asset emitter.
-            ParticleAssetEmitter* pParticleAssetEmitter = pEmitterNode->getAssetEmitter();
+        // Accumulate the last generation time as we need to handle very small time-integrations correctly.
+        //
+        // NOTE:    We need to do this if there's an emission target but the time-integration is so small
+        //          that rounding results in no emission.  Downside to good FPS!
+        pEmitterNode->setTimeSinceLastGeneration( pEmitterNode->getTimeSinceLastGeneration() + scaledTime );
 
-            // Fetch the first particle node.
-            ParticleSystem::ParticleNode* pParticleNode = pEmitterNode->getFirstParticle();
+        // Fetch the particle player age.
+        const F32 particlePlayerAge = mAge;
 
-            // Fetch the particle node head.
-            ParticleSystem::ParticleNode* pParticleNodeHead = pEmitterNode->getParticleNodeHead();
+        // Fetch the quantity base and variation fields.
+        const ParticleAssetField& quantityBaseField = pParticleAssetEmitter->getQuantityBaseField();
+        const ParticleAssetField& quantityVaritationField = pParticleAssetEmitter->getQuantityBaseField();
 
-            // Process All particle nodes.
-            while ( pParticleNode != pParticleNodeHead )
-            {
-                // Update the particle age.
-                pParticleNode->mParticleAge += scaledTime;
+        // Fetch the emissions.
+        const F32 baseEmission = quantityBaseField.getFieldValue( particlePlayerAge );
+        const F32 varEmission = quantityVaritationField.getFieldValue( particlePlayerAge ) * 0.5f;
 
-                // Has the particle expired?
-                // NOTE:-   If we're in single-particle mode then the particle lives as long as the particle player does.
-                if (    ( !pParticleAssetEmitter->getSingleParticle() && pParticleNode->mParticleAge > pParticleNode->mParticleLifetime ) ||
-                        ( mIsZero(pParticleNode->mParticleLifetime) ) )
-                {
-                    // Yes, so fetch next particle before we kill it.
-                    pParticleNode = pParticleNode->mNextNode;
+        // Fetch the emission scale.
+        const F32 effectEmission = pParticleAsset->getQuantityScaleField().getFieldValue( particlePlayerAge ) * getEmissionRateScale();
 
-                    // Kill the particle.
-                    // NOTE:-   Because we move to the next particle the particle to kill is now the previous!
-                    pEmitterNode->freeParticle( pParticleNode->mPreviousNode );
-                }
-                else
-                {
-                    // No, so integrate the particle.
-                    integrateParticle( pEmitterNode, pParticleNode, pParticleNode->mParticleAge / pParticleNode->mParticleLifetime, scaledTime );
+        // Calculate the local emission.
+        const F32 localEmission = mClampF(  (baseEmission + pEmitterNode->getRandom().randRangeF(-varEmission, varEmission)) * effectEmission,
+                                            quantityBaseField.getMinValue(),
+                                            quantityBaseField.getMaxValue() );
 
-                    // Move to the next particle node.
-                    pParticleNode = pParticleNode->mNextNode;
+        // Calculate the final time-independent emission count.
+        const U32 emissionCount = U32(mFloor( localEmission * pEmitterNode->getTimeSinceLastGeneration() ));
 
-                    // Only count particles when not in single-particle mode.
-                    activeParticleCount++;
-                }
-            };
+        // Do we have an emission?
+        if ( emissionCount > 0 )
+        {
+            // Yes, so remove this emission from accumulated time.
+            pEmitterNode->setTimeSinceLastGeneration( getMax(0.0f, pEmitterNode->getTimeSinceLastGeneration() - (emissionCount / localEmission) ) );
 
-            // Skip generating new particles if the emitter is paused.
-            if ( pEmitterNode->getPaused() )
-                continue;
+            // Suppress Precision Errors.
+            if ( mIsZero( pEmitterNode->getTimeSinceLastGeneration() ) )
+                pEmitterNode->setTimeSinceLastGeneration( 0.0f );
 
-            // Are we in single-particle mode?
-            if ( pParticleAssetEmitter->getSingleParticle() )
-            {
-                // Yes, so do we have a single particle yet?
-                if ( pParticleNodeHead->mNextNode == pParticleNodeHead )
-                {
-                    // No, so generate a single particle.
-                    pEmitterNode->createParticle();
-                }
-            }
-            else
-            {
-                // Accumulate the last generation time as we need to handle very small time-integrations correctly.
-                //
-                // NOTE:    We need to do this if there's an emission target but the time-integration is so small
-                //          that rounding results in no emission.  Downside to good FPS!
-                pEmitterNode->setTimeSinceLastGeneration( pEmitterNode->getTimeSinceLastGeneration() + scaledTime );
+            // Ensure there's room for the emission.
+            particles.ensureCapacity( particles.getParticleCount() + emissionCount );
 
-                // Fetch the particle player age.
-                const F32 particlePlayerAge = mAge;
+            // Set the pending emission.
+            pEmitterNode->setPendingEmission( emissionCount );
+        }
+    }
+
+    // Integrate each emitter as a separate job.
+    mIntegrationJobCount = (U32)mEmitters.size();
+}
 
-                // Fetch the quantity base and variation fields.
-                const ParticleAssetField& quantityBaseField = pParticleAssetEmitter->getQuantityBaseField();
-                const ParticleAssetField& quantityVaritationField = pParticleAssetEmitter->getQuantityBaseField();
+//------------------------------------------------------------------------------
+
+void ParticlePlayer::integrateJob( const U32 jobIndex, const F32 totalTime, const F32 elapsedTime )
+{
+    // NOTE:-   This can run on a worker thread so it neither profiles nor warns.
+    //          The jobs are profiled by the scene that dispatches them and warnings are reported by "postIntegrate()".
 
-                // Fetch the emissions.
-                const F32 baseEmission = quantityBaseField.getFieldValue( particlePlayerAge );
-                const F32 varEmission = quantityVaritationField.getFieldValue( particlePlayerAge ) * 0.5f;
+    // Calculate scaled time.
+    const F32 scaledTime = elapsedTime * mTimeScale;
 
-                // Fetch the emission scale.
-                const F32 effectEmission = pParticleAsset->getQuantityScaleField().getFieldValue( particlePlayerAge ) * getEmissionRateScale();
+    // Fetch the emitter node.
+    EmitterNode* pEmitterNode = mEmitters[jobIndex];
 
-                // Calculate the local emission.
-                const F32 localEmission = mClampF(  (baseEmission + CoreMath::mGetRandomF(-varEmission, varEmission)) * effectEmission,
-                                                    quantityBaseField.getMinValue(),
-                                                    quantityBaseField.getMaxValue() );
+    // Fetch the particles.
+    ParticleSystem::ParticleStore& particles = pEmitterNode->getParticles();
 
-                // Calculate the final time-independent emission count.
-                const U32 emissionCount = U32(mFloor( localEmission * pEmitterNode->getTimeSinceLastGeneration() ));
+    // Update the particle ages.
+    F32* pParticleAge = particles.mParticleAge;
+    const U32 agedParticleCount = particles.getParticleCount();
+    for ( U32 particleIndex = 0; particleIndex < agedParticleCount; ++particleIndex )
+        pParticleAge[particleIndex] += scaledTime;
 
-                // Do we have an emission?
-                if ( emissionCount > 0 )
-                {
-                    // Yes, so remove this emission from accumulated time.
-                    pEmitterNode->setTimeSinceLastGeneration( getMax(0.0f, pEmitterNode->getTimeSinceLastGeneration() - (emissionCount / localEmission) ) );
+    // Kill any expired particles.
+    pEmitterNode->freeExpiredParticles();
 
-                    // Suppress Precision Errors.
-                    if ( mIsZero( pEmitterNode->getTimeSinceLastGeneration() ) )
-                        pEmitterNode->setTimeSinceLastGeneration( 0.0f );
+    // Integrate the remaining particles.
+    integrateParticles( pEmitterNode, 0, particles.getParticleCount(), scaledTime );
 
-                    // Generate the required emission.
-                    for ( U32 n = 0; n < emissionCount; n++ )
-                        pEmitterNode->createParticle();
-                }
-            }
+    // Skip generating new particles if the emitter is paused.
+    if ( pEmitterNode->getPaused() )
+        return;
+
+    // Are we in single-particle mode?
+    if ( pEmitterNode->getAssetEmitter()->getSingleParticle() )
+    {
+        // Yes, so do we have a single particle yet?
+        if ( !pEmitterNode->getActiveParticles() )
+        {
+            // No, so generate a single particle.
+            pEmitterNode->createParticles( 1 );
         }
+
+        return;
     }
 
+    // Generate the pending emission.
+    const U32 pendingEmission = pEmitterNode->getPendingEmission();
+    if ( pendingEmission > 0 )
+    {
+        pEmitterNode->createParticles( pendingEmission );
+        pEmitterNode->setPendingEmission( 0 );
+    }
+}
+
+//------------------------------------------------------------------------------
+
+void ParticlePlayer::postIntegrate( const F32 totalTime, const F32 elapsedTime, DebugStats* pDebugStats )
+{
+    // Report any particles the integration jobs could not give a frame.
+    for( typeEmitterVector::iterator emitterItr = mEmitters.begin(); emitterItr != mEmitters.end(); ++emitterItr )
+    {
+        EmitterNode* pEmitterNode = *emitterItr;
+
+        const U32 invalidFrameCount = pEmitterNode->getInvalidFrameCount();
+        if ( invalidFrameCount == 0 )
+            continue;
+
+        pEmitterNode->setInvalidFrameCount( 0 );
+
+        ParticleAssetEmitter* pParticleAssetEmitter = pEmitterNode->getAssetEmitter();
+        if ( pParticleAssetEmitter->isStaticFrameProvider() )
+        {
+            Con::warnf( "ParticlePlayer::postIntegrate() - %d particle(s) could not use frame #%d of ImageAsset '%s' on emitter '%s'.",
+                invalidFrameCount, pParticleAssetEmitter->getImageFrame(), pParticleAssetEmitter->getImage(), pParticleAssetEmitter->getEmitterName() );
+        }
+        else
+        {
+            Con::warnf( "ParticlePlayer::postIntegrate() - %d particle(s) could not play AnimationAsset '%s' on emitter '%s' - Animation has no validated frames!",
+                invalidFrameCount, pParticleAssetEmitter->getAnimation(), pParticleAssetEmitter->getEmitterName() );
+        }
+    }
+
+    // Is the life-mode pending?
+    if ( mLifeModePending )
+    {
+        // Yes, so update it.
+        mLifeModePending = false;
+        updateLifeMode();
+    }
+
+    // Call parent.
+    Parent::postIntegrate( totalTime, elapsedTime, pDebugStats );
+}
+
+//------------------------------------------------------------------------------
+
+void ParticlePlayer::updateLifeMode( void )
+{
+    // Fetch particle asset.
+    ParticleAsset* pParticleAsset = mParticleAsset;
+
+    // Finish if no particle asset assigned.
+    if ( pParticleAsset == NULL )
+        return;
+
+    // Count the active particles.
+    U32 activeParticleCount = 0;
+    for( typeEmitterVector::iterator emitterItr = mEmitters.begin(); emitterItr != mEmitters.end(); ++emitterItr )
+        activeParticleCount += (*emitterItr)->getParticleCount();
+
     // Fetch the particle life-mode.
     const ParticleAsset::LifeMode lifeMode = pParticleAsset->getLifeMode();
 
@@ -475,46 +550,38 @@ void ParticlePlayer::interpolateObject( const F32 timeDelta )
         // Fetch the emitter node.
         EmitterNode* pEmitterNode = *emitterItr;
 
-        // Fetch First Particle Node.
-        ParticleSystem::ParticleNode* pParticleNode = pEmitterNode->getFirstParticle();
+        // Fetch the particles.
+        ParticleSystem::ParticleStore& particles = pEmitterNode->getParticles();
 
-        // Fetch the particle node head.
-        ParticleSystem::ParticleNode* pParticleNodeHead = pEmitterNode->getParticleNodeHead();
+        // Fetch the particle count.
+        const U32 particleCount = particles.getParticleCount();
 
-        // Fetch the asset emitter.
-        ParticleAssetEmitter* pParticleAssetEmitter = pEmitterNode->getAssetEmitter();
-
-        // Fetch the local AABB..
-        const Vector2& localAABB0 = pParticleAssetEmitter->getLocalPivotAABB0();
-        const Vector2& localAABB1 = pParticleAssetEmitter->getLocalPivotAABB1();
-        const Vector2& localAABB2 = pParticleAssetEmitter->getLocalPivotAABB2();
-        const Vector2& localAABB3 = pParticleAssetEmitter->getLocalPivotAABB3();
+        // Skip if there are no particles.
+        if ( particleCount == 0 )
+            continue;
 
-        // Process All particle nodes.
-        while ( pParticleNode != pParticleNodeHead )
+        // Fetch the particle components.
+        const F32* pPreTickPositionX = particles.mPreTickPositionX;
+        const F32* pPreTickPositionY = particles.mPreTickPositionY;
+        const F32* pPostTickPositionX = particles.mPositionX;
+        const F32* pPostTickPositionY = particles.mPositionY;
+
+        // Fetch the render tick positions.
+        mRenderTickPositionX.setSize( particleCount );
+        mRenderTickPositionY.setSize( particleCount );
+        F32* pRenderTickPositionX = mRenderTickPositionX.address();
+        F32* pRenderTickPositionY = mRenderTickPositionY.address();
+
+        // Interpolate the positions.
+        const F32 postTimeDelta = 1.0f - timeDelta;
+        for ( U32 particleIndex = 0; particleIndex < particleCount; ++particleIndex )
         {
-            // Interpolate the position.
-            pParticleNode->mRenderTickPosition = (timeDelta * pParticleNode->mPreTickPosition) + ((1.0f-timeDelta) * pParticleNode->mPostTickPosition);
-
-            // Set the transform.
-            pParticleNode->mTransform.p = pParticleNode->mRenderTickPosition;
-
-            // Fetch the render size.
-            const Vector2& renderSize = pParticleNode->mRenderSize;
-
-            // Calculate the scaled AABB.
-            Vector2 scaledAABB[4];
-            scaledAABB[0] = localAABB0 * renderSize;
-            scaledAABB[1] = localAABB1 * renderSize;
-            scaledAABB[2] = localAABB2 * renderSize;
-            scaledAABB[3] = localAABB3 * renderSize;
-
-            // Calculate the world OOBB..
-            CoreMath::mCalculateOOBB( scaledAABB, pParticleNode->mTransform, pParticleNode->mRenderOOBB );
-
-            // Move to the next particle.
-            pParticleNode = pParticleNode->mNextNode;
+            pRenderTickPositionX[particleIndex] = (timeDelta * pPreTickPositionX[particleIndex]) + (postTimeDelta * pPostTickPositionX[particleIndex]);
+            pRenderTickPositionY[particleIndex] = (timeDelta * pPreTickPositionY[particleIndex]) + (postTimeDelta * pPostTickPositionY[particleIndex]);
         }
+
+        // Calculate the world OOBBs.
+        calculateParticleOOBBs( pEmitterNode, 0, particleCount, pRenderTickPositionX, pRenderTickPositionY );
     }
 }
 
@@ -619,17 +686,30 @@ void ParticlePlayer::sceneRender( const SceneRenderState* pSceneRenderState, con
         // Fetch the oldest-in-front flag.
         const bool oldestInFront = pParticleAssetEmitter->getOldestInFront();
 
-        // Fetch the starting particle (using appropriate particle order).
-        ParticleSystem::ParticleNode* pParticleNode = oldestInFront ? pEmitterNode->getFirstParticle() : pEmitterNode->getLastParticle();
+        // Fetch the particles.
+        const ParticleSystem::ParticleStore& particles = pEmitterNode->getParticles();
+
+        // Fetch the particle components.
+        ImageFrameProviderCore* const* pFrameProviders = particles.mFrameProviders;
+        const Vector2* pRenderOOBB = particles.mRenderOOBB;
+        const F32* pRed = particles.mRed;
+        const F32* pGreen = particles.mGreen;
+        const F32* pBlue = particles.mBlue;
+        const F32* pAlpha = particles.mAlpha;
+
+        // Fetch the particle count.
+        const S32 particleCount = (S32)particles.getParticleCount();
 
-        // Fetch the particle node head.
-        ParticleSystem::ParticleNode* pParticleNodeHead = pEmitterNode->getParticleNodeHead();
+        // Calculate the particle order.
+        // NOTE:-   Particles are stored oldest first so the oldest are in front when we render the newest first.
+        const S32 firstParticle = oldestInFront ? particleCount-1 : 0;
+        const S32 particleStep = oldestInFront ? -1 : 1;
 
-        // Process all particle nodes.
-        while ( pParticleNode != pParticleNodeHead )
+        // Process all particles.
+        for ( S32 particleIndex = firstParticle, n = 0; n < particleCount; particleIndex += particleStep, ++n )
         {
             // Fetch the frame provider.
-            const ImageFrameProviderCore& frameProvider = pParticleNode->mFrameProvider;
+            const ImageFrameProviderCore& frameProvider = *pFrameProviders[particleIndex];
 
             // Fetch the frame area.
             const ImageAsset::FrameArea::TexelArea& texelFrameArea = frameProvider.getProviderImageFrameArea().mTexelArea;
@@ -638,7 +718,7 @@ void ParticlePlayer::sceneRender( const SceneRenderState* pSceneRenderState, con
             TextureHandle& frameTexture = frameProvider.getProviderTexture();
 
             // Fetch the particle render OOBB.
-            Vector2* renderOOBB = pParticleNode->mRenderOOBB;
+            const Vector2* renderOOBB = pRenderOOBB + particleIndex*4;
 
             // Fetch lower/upper texture coordinates.
             const Vector2& texLower = texelFrameArea.mTexelLower;
@@ -655,11 +735,8 @@ void ParticlePlayer::sceneRender( const SceneRenderState* pSceneRenderState, con
                 Vector2( texUpper.x, texLower.y ),
                 Vector2( texLower.x, texLower.y ),
                 frameTexture,
-                pParticleNode->mColor );
-
-            // Move to next Particle ( using appropriate sort-order ).
-            pParticleNode = oldestInFront ? pParticleNode->mNextNode : pParticleNode->mPreviousNode;
-        };
+                ColorF( pRed[particleIndex], pGreen[particleIndex], pBlue[particleIndex], pAlpha[particleIndex] ) );
+        }
 
         // Flush.
         pBatchRenderer->flush( getScene()->getDebugStats().batchIsolatedFlush );
@@ -796,6 +873,10 @@ bool ParticlePlayer::play( const bool resetParticles )
 
         // Reset the time since last generation.
         pEmitterNode->setTimeSinceLastGeneration( 0.0f );
+
+        // Reseed the emitter random stream from the global generator.
+        // NOTE:-   This keeps each emitter deterministic no matter which thread integrates it.
+        pEmitterNode->getRandom().setSeed( CoreMath::mGetRandomI() );
     }
 
     // Reset Waiting for Particles.
@@ -876,7 +957,7 @@ void ParticlePlayer::stop( const bool waitForParticles, const bool killEffect )
 
 //------------------------------------------------------------------------------
 
-void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSystem::ParticleNode* pParticleNode )
+void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, const U32 particleIndex )
 {
     // Fetch the particle player age.
     const F32 particlePlayerAge = mAge;
@@ -884,15 +965,18 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
     // Fetch the particle player position.
     const Vector2& particlePlayerPosition = getPosition();
 
-    // Default to not suppressing movement.
-    pParticleNode->mSuppressMovement = false;
-
     // Fetch particle asset.
     ParticleAsset* pParticleAsset = mParticleAsset;
 
     // Fetch the asset emitter.
     ParticleAssetEmitter* pParticleAssetEmitter = pEmitterNode->getAssetEmitter();
 
+    // Fetch the particles.
+    ParticleSystem::ParticleStore& particles = pEmitterNode->getParticles();
+
+    // Fetch the emitter random stream.
+    RandomGeneratorBase& random = pEmitterNode->getRandom();
+
 
     // **********************************************************************************************************************
     // Calculate Particle Position.
@@ -906,17 +990,20 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
     const Vector2& emitterSize = pParticleAssetEmitter->getEmitterSize() * getSizeScale();
     const F32 emitterAngle = mDegToRad(pParticleAssetEmitter->getEmitterAngle());
 
+    // Particle position.
+    Vector2 position( 0.0f, 0.0f );
+
     // Are we using Single Particle?
     if ( pParticleAssetEmitter->getSingleParticle() )
     {
         // Determine whether to use world-space or emitter-space.
         if ( attachPositionToEmitter )
         {
-            pParticleNode->mPosition = emitterOffset;
+            position = emitterOffset;
         }
         else
         {
-            pParticleNode->mPosition = particlePlayerPosition + emitterOffset;
+            position = particlePlayerPosition + emitterOffset;
         }
     }
     else
@@ -931,12 +1018,12 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
                 if ( attachPositionToEmitter )
                 {
                     // Yes, so transform the particle into emitter-space only.
-                    pParticleNode->mPosition = emitterOffset;
+                    position = emitterOffset;
                 }
                 else
                 {
                     // No, so transform the particle into world-space here.
-                    pParticleNode->mPosition = emitterOffset + particlePlayerPosition;
+                    position = emitterOffset + particlePlayerPosition;
                 }
 
             } break;
@@ -948,17 +1035,17 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
                 const F32 halfWidth = emitterSize.x * 0.5f;
 
                 // Calculate emitter position.
-                Vector2 emissionPosition( CoreMath::mGetRandomF( -halfWidth, halfWidth ), 0.0f );
+                Vector2 emissionPosition( random.randRangeF( -halfWidth, halfWidth ), 0.0f );
 
                 // Transform particle position in emitter-space.
-                pParticleNode->mPosition = b2Mul( b2Rot(emitterAngle), emissionPosition ) + emitterOffset;
+                position = b2Mul( b2Rot(emitterAngle), emissionPosition ) + emitterOffset;
 
                 // Are we attaching the position to the emitter?
                 if ( !attachPositionToEmitter )
                 {
                     // No, so transform the particle into world-space here.
                     b2Transform xform( particlePlayerPosition, b2Rot( getAngle()) );
-                    pParticleNode->mPosition = b2Mul( xform, pParticleNode->mPosition );
+                    position = b2Mul( xform, position );
                 }
 
             } break;
@@ -971,17 +1058,17 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
                 const F32 halfHeight = emitterSize.y * 0.5f;
 
                 // Calculate emitter position.
-                Vector2 emissionPosition( CoreMath::mGetRandomF( -halfWidth, halfWidth ), CoreMath::mGetRandomF( -halfHeight, halfHeight ) );
+                Vector2 emissionPosition( random.randRangeF( -halfWidth, halfWidth ), random.randRangeF( -halfHeight, halfHeight ) );
 
                 // Transform particle position in emitter-space.
-                pParticleNode->mPosition = b2Mul( b2Rot(emitterAngle), emissionPosition ) + emitterOffset;
+                position = b2Mul( b2Rot(emitterAngle), emissionPosition ) + emitterOffset;
 
                 // Are we attaching the position to the emitter?
                 if ( !attachPositionToEmitter )
                 {
                     // No, so transform the particle into world-space here.
                     b2Transform xform( particlePlayerPosition, b2Rot( getAngle()) );
-                    pParticleNode->mPosition = b2Mul( xform, pParticleNode->mPosition );
+                    position = b2Mul( xform, position );
                 }
 
             } break;
@@ -990,10 +1077,10 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
             case ParticleAssetEmitter::DISK_EMITTER:
             {
                 // Calculate the random angle.
-                const F32 angle = CoreMath::mGetRandomF( 0.0f, b2_pi2 );
+                const F32 angle = random.randRangeF( 0.0f, b2_pi2 );
 #if 1
                 // Calculate the uniform distribution scale.
-                const F32 distributionScale = mSqrt( CoreMath::mGetRandomF(0.0f, 1.0f) );
+                const F32 distributionScale = mSqrt( random.randRangeF(0.0f, 1.0f) );
 
                 // Calculate the radii.
                 const F32 radiusX = emitterSize.x * 0.5f * distributionScale;
@@ -1007,14 +1094,14 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
                 Vector2 emissionPosition( radiusX * mCos(angle), radiusY * mSin(angle) );
 
                 // Transform particle position in emitter-space.
-                pParticleNode->mPosition = b2Mul( b2Rot(emitterAngle), emissionPosition ) + emitterOffset;
+                position = b2Mul( b2Rot(emitterAngle), emissionPosition ) + emitterOffset;
 
                 // Are we attaching the position to the emitter?
                 if ( !attachPositionToEmitter )
                 {
                     // No, so transform the particle into world-space here.
                     b2Transform xform( particlePlayerPosition, b2Rot( getAngle()) );
-                    pParticleNode->mPosition = b2Mul( xform, pParticleNode->mPosition );
+                    position = b2Mul( xform, position );
                 }
 
             } break;
@@ -1023,20 +1110,20 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
             case ParticleAssetEmitter::ELLIPSE_EMITTER:
             {
                 // Calculate the random angle.
-                const F32 angle = CoreMath::mGetRandomF( 0.0f, b2_pi2 );
+                const F32 angle = random.randRangeF( 0.0f, b2_pi2 );
 
                 // Calculate emitter position using a uniform distribution.
                 Vector2 emissionPosition( emitterSize.x * 0.5f * mCos(angle), emitterSize.y * 0.5f * mSin(angle) );
 
                 // Transform particle position in emitter-space.
-                pParticleNode->mPosition = b2Mul( b2Rot(emitterAngle), emissionPosition ) + emitterOffset;
+                position = b2Mul( b2Rot(emitterAngle), emissionPosition ) + emitterOffset;
 
                 // Are we attaching the position to the emitter?
                 if ( !attachPositionToEmitter )
                 {
                     // No, so transform the particle into world-space here.
                     b2Transform xform( particlePlayerPosition, b2Rot( getAngle()) );
-                    pParticleNode->mPosition = b2Mul( xform, pParticleNode->mPosition );
+                    position = b2Mul( xform, position );
                 }
 
             } break;
@@ -1045,17 +1132,17 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
             case ParticleAssetEmitter::TORUS_EMITTER:
             {
                 // Calculate the random angle.
-                const F32 angle = CoreMath::mGetRandomF( 0.0f, b2_pi2 );
+                const F32 angle = random.randRangeF( 0.0f, b2_pi2 );
 
                 // Calculate the inner and outer radii.
                 const F32 outerRadii = emitterSize.getMajorAxis() * 0.5f;
                 const F32 innerRadii = emitterSize.getMinorAxis() * 0.5f;
 #if 1
                 // Calculate the radius as a uniform distribution.
-                const F32 radius = innerRadii + ( mSqrt( CoreMath::mGetRandomF(0.0f, 1.0f) ) * (outerRadii-innerRadii) );
+                const F32 radius = innerRadii + ( mSqrt( random.randRangeF(0.0f, 1.0f) ) * (outerRadii-innerRadii) );
 #else
                 // Calculate the radius as a non-uniform distribution.
-                const F32 radius = CoreMath::mGetRandomF( innerRadii, outerRadii );
+                const F32 radius = random.randRangeF( innerRadii, outerRadii );
 #endif
                 // Calculate emitter position using a uniform distribution.
                 Vector2 emissionPosition( radius * mCos(angle), radius * mSin(angle) );
@@ -1064,12 +1151,12 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
                 if ( attachPositionToEmitter )
                 {
                     // Yes, so transform the particle into emitter-space only.
-                    pParticleNode->mPosition = emissionPosition + emitterOffset;
+                    position = emissionPosition + emitterOffset;
                 }
                 else
                 {
                     // No, so transform the particle into world-space here.
-                    pParticleNode->mPosition = emissionPosition + emitterOffset + particlePlayerPosition;
+                    position = emissionPosition + emitterOffset + particlePlayerPosition;
                 }
 
             } break;
@@ -1083,39 +1170,40 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
     // Calculate Particle Lifetime.
     // **********************************************************************************************************************
 
-    pParticleNode->mParticleAge = 0.0f;
-    pParticleNode->mParticleLifetime = ParticleAssetField::calculateFieldBVE(   pParticleAssetEmitter->getParticleLifeBaseField(),
-                                                                                pParticleAssetEmitter->getParticleLifeVariationField(),
-                                                                                pParticleAsset->getParticleLifeScaleField(),
-                                                                                particlePlayerAge );
+    particles.mParticleAge[particleIndex] = 0.0f;
+    particles.mParticleLifetime[particleIndex] = ParticleAssetField::calculateFieldBVE( pParticleAssetEmitter->getParticleLifeBaseField(),
+                                                                                        pParticleAssetEmitter->getParticleLifeVariationField(),
+                                                                                        pParticleAsset->getParticleLifeScaleField(),
+                                                                                        particlePlayerAge, random );
 
 
     // **********************************************************************************************************************
     // Calculate Particle Size-X.
     // **********************************************************************************************************************
 
-    pParticleNode->mSize.x = ParticleAssetField::calculateFieldBVE( pParticleAssetEmitter->getSizeXBaseField(),
-                                                                    pParticleAssetEmitter->getSizeXVariationField(),
-                                                                    pParticleAsset->getSizeXScaleField(),
-                                                                    particlePlayerAge ) * getSizeScale();
+    particles.mSizeX[particleIndex] = ParticleAssetField::calculateFieldBVE( pParticleAssetEmitter->getSizeXBaseField(),
+                                                                             pParticleAssetEmitter->getSizeXVariationField(),
+                                                                             pParticleAsset->getSizeXScaleField(),
+                                                                             particlePlayerAge, random ) * getSizeScale();
 
     // Is the particle using a fixed aspect?
     if ( pParticleAssetEmitter->getFixedAspect() )
     {
         // Yes, so simply copy Size-X.
-        pParticleNode->mSize.y = pParticleNode->mSize.x;
+        particles.mSizeY[particleIndex] = particles.mSizeX[particleIndex];
     }
     else
     {
         // No, so calculate the particle Size-Y.
-        pParticleNode->mSize.y = ParticleAssetField::calculateFieldBVE( pParticleAssetEmitter->getSizeYBaseField(),
-                                                                        pParticleAssetEmitter->getSizeYVariationField(),
-                                                                        pParticleAsset->getSizeYScaleField(),
-                                                                        particlePlayerAge ) * getSizeScale();
+        particles.mSizeY[particleIndex] = ParticleAssetField::calculateFieldBVE( pParticleAssetEmitter->getSizeYBaseField(),
+                                                                                 pParticleAssetEmitter->getSizeYVariationField(),
+                                                                                 pParticleAsset->getSizeYScaleField(),
+                                                                                 particlePlayerAge, random ) * getSizeScale();
     }
 
     // Reset the render size.
-    pParticleNode->mRenderSize.Set(-1.0f, -1.0f);
+    particles.mRenderSizeX[particleIndex] = -1.0f;
+    particles.mRenderSizeY[particleIndex] = -1.0f;
 
 
     // **********************************************************************************************************************
@@ -1130,32 +1218,32 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
     // Ignore if we're using a single-particle.
     if ( !pParticleAssetEmitter->getSingleParticle() )
     {
-        pParticleNode->mSpeed = ParticleAssetField::calculateFieldBVE(  pParticleAssetEmitter->getSpeedBaseField(),
-                                                                        pParticleAssetEmitter->getSpeedVariationField(),
-                                                                        pParticleAsset->getSpeedScaleField(),
-                                                                        particlePlayerAge ) * getForceScale();
+        particles.mSpeed[particleIndex] = ParticleAssetField::calculateFieldBVE( pParticleAssetEmitter->getSpeedBaseField(),
+                                                                                 pParticleAssetEmitter->getSpeedVariationField(),
+                                                                                 pParticleAsset->getSpeedScaleField(),
+                                                                                 particlePlayerAge, random ) * getForceScale();
 
-        pParticleNode->mRandomMotion = ParticleAssetField::calculateFieldBVE(   pParticleAssetEmitter->getRandomMotionBaseField(),
-                                                                                pParticleAssetEmitter->getRandomMotionVariationField(),
-                                                                                pParticleAsset->getRandomMotionScaleField(),
-                                                                                particlePlayerAge ) * getForceScale();
+        particles.mRandomMotion[particleIndex] = ParticleAssetField::calculateFieldBVE( pParticleAssetEmitter->getRandomMotionBaseField(),
+                                                                                        pParticleAssetEmitter->getRandomMotionVariationField(),
+                                                                                        pParticleAsset->getRandomMotionScaleField(),
+                                                                                        particlePlayerAge, random ) * getForceScale();
 
 
         //  Calculate the emission force.
         emissionForce = ParticleAssetField::calculateFieldBV(   pParticleAssetEmitter->getEmissionForceForceBaseField(),
                                                                 pParticleAssetEmitter->getEmissionForceVariationField(),
-                                                                particlePlayerAge) * getForceScale();
+                                                                particlePlayerAge, random) * getForceScale();
 
         // Calculate Emission Angle.
         emissionAngle = ParticleAssetField::calculateFieldBV(   pParticleAssetEmitter->getEmissionAngleBaseField(),
                                                                 pParticleAssetEmitter->getEmissionAngleVariationField(),
-                                                                particlePlayerAge );
+                                                                particlePlayerAge, random );
 
         // Calculate Emission Arc.
         // NOTE:-   We're actually interested in half the emission arc!
         emissionArc = ParticleAssetField::calculateFieldBV( pParticleAssetEmitter->getEmissionArcBaseField(),
                                                             pParticleAssetEmitter->getEmissionArcVariationField(),
-                                                            particlePlayerAge ) * 0.5f;
+                                                            particlePlayerAge, random ) * 0.5f;
 
         // Is the emission rotation linked?
         if ( pParticleAssetEmitter->getLinkEmissionRotation() )
@@ -1165,11 +1253,12 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
         }
 
         // Calculate the final emission angle choosing random Arc.
-        emissionAngle = mFmod( CoreMath::mGetRandomF( emissionAngle-emissionArc, emissionAngle+emissionArc ), 360.0f );
+        emissionAngle = mFmod( random.randRangeF( emissionAngle-emissionArc, emissionAngle+emissionArc ), 360.0f );
 
         // Calculate the particle velocity.
         const F32 emissionAngleRadians = mDegToRad( emissionAngle );
-        pParticleNode->mVelocity.Set( emissionForce * mCos( emissionAngleRadians ), emissionForce * mSin( emissionAngleRadians ) );
+        particles.mVelocityX[particleIndex] = emissionForce * mCos( emissionAngleRadians );
+        particles.mVelocityY[particleIndex] = emissionForce * mSin( emissionAngleRadians );
     }
 
 
@@ -1177,20 +1266,20 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
     // Calculate Spin.
     // **********************************************************************************************************************
 
-    pParticleNode->mSpin = ParticleAssetField::calculateFieldBVE(   pParticleAssetEmitter->getSpinBaseField(),
-                                                                    pParticleAssetEmitter->getSpinVariationField(),
-                                                                    pParticleAsset->getSpinScaleField(),
-                                                                    particlePlayerAge );
+    particles.mSpin[particleIndex] = ParticleAssetField::calculateFieldBVE( pParticleAssetEmitter->getSpinBaseField(),
+                                                                            pParticleAssetEmitter->getSpinVariationField(),
+                                                                            pParticleAsset->getSpinScaleField(),
+                                                                            particlePlayerAge, random );
 
 
     // **********************************************************************************************************************
     // Calculate Fixed-Force.
     // **********************************************************************************************************************
 
-    pParticleNode->mFixedForce = ParticleAssetField::calculateFieldBVE( pParticleAssetEmitter->getFixedForceBaseField(),
-                                                                        pParticleAssetEmitter->getFixedForceVariationField(),
-                                                                        pParticleAsset->getFixedForceScaleField(),
-                                                                        particlePlayerAge ) * getForceScale();
+    particles.mFixedForce[particleIndex] = ParticleAssetField::calculateFieldBVE( pParticleAssetEmitter->getFixedForceBaseField(),
+                                                                                  pParticleAssetEmitter->getFixedForceVariationField(),
+                                                                                  pParticleAsset->getFixedForceScaleField(),
+                                                                                  particlePlayerAge, random ) * getForceScale();
 
 
     // **********************************************************************************************************************
@@ -1204,7 +1293,7 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
         case ParticleAssetEmitter::ALIGNED_ORIENTATION:
         {
             // Use the emission angle with fixed offset.
-            pParticleNode->mOrientationAngle = mFmod( emissionAngle - pParticleAssetEmitter->getAlignedAngleOffset(), 360.0f );
+            particles.mOrientationAngle[particleIndex] = mFmod( emissionAngle - pParticleAssetEmitter->getAlignedAngleOffset(), 360.0f );
 
         } break;
 
@@ -1212,7 +1301,7 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
         case ParticleAssetEmitter::FIXED_ORIENTATION:
         {
             // Use a fixed angle.
-            pParticleNode->mOrientationAngle = mFmod( pParticleAssetEmitter->getFixedAngleOffset(), 360.0f );
+            particles.mOrientationAngle[particleIndex] = mFmod( pParticleAssetEmitter->getFixedAngleOffset(), 360.0f );
 
         } break;
 
@@ -1221,7 +1310,7 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
         {
             // Used a random angle/arc.
             const F32 randomArc = pParticleAssetEmitter->getRandomArc() * 0.5f;
-            pParticleNode->mOrientationAngle = mFmod( CoreMath::mGetRandomF( pParticleAssetEmitter->getRandomAngleOffset() - randomArc, pParticleAssetEmitter->getRandomAngleOffset() + randomArc ), 360.0f );
+            particles.mOrientationAngle[particleIndex] = mFmod( random.randRangeF( pParticleAssetEmitter->getRandomAngleOffset() - randomArc, pParticleAssetEmitter->getRandomAngleOffset() + randomArc ), 360.0f );
 
         } break;
         
@@ -1241,10 +1330,10 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
     const ParticleAssetField& alphaChannelScale = pParticleAsset->getAlphaChannelScaleField();
 
     // Calculate the color.
-    pParticleNode->mColor.set(  mClampF( redChannel.getFieldValue( 0.0f ), redChannel.getMinValue(), redChannel.getMaxValue() ),
-                                mClampF( greenChannel.getFieldValue( 0.0f ),greenChannel.getMinValue(), greenChannel.getMaxValue() ),
-                                mClampF( blueChannel.getFieldValue( 0.0f ), blueChannel.getMinValue(),blueChannel.getMaxValue() ),
-                                mClampF( alphaChannel.getFieldValue( 0.0f ) * alphaChannelScale.getFieldValue( 0.0f ), alphaChannel.getMinValue(), alphaChannel.getMaxValue() ) );
+    particles.mRed[particleIndex] = mClampF( redChannel.getFieldValue( 0.0f ), redChannel.getMinValue(), redChannel.getMaxValue() );
+    particles.mGreen[particleIndex] = mClampF( greenChannel.getFieldValue( 0.0f ),greenChannel.getMinValue(), greenChannel.getMaxValue() );
+    particles.mBlue[particleIndex] = mClampF( blueChannel.getFieldValue( 0.0f ), blueChannel.getMinValue(),blueChannel.getMaxValue() );
+    particles.mAlpha[particleIndex] = mClampF( alphaChannel.getFieldValue( 0.0f ) * alphaChannelScale.getFieldValue( 0.0f ), alphaChannel.getMinValue(), alphaChannel.getMaxValue() );
 
 
     // **********************************************************************************************************************
@@ -1252,28 +1341,30 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
     // **********************************************************************************************************************
 
     // Fetch the image frame provider.
-    ImageFrameProviderCore& frameProvider = pParticleNode->mFrameProvider;
+    ImageFrameProviderCore& frameProvider = *particles.mFrameProviders[particleIndex];
 
     // Allocate assets to the particle.
     frameProvider.allocateAssets( &(pParticleAssetEmitter->getImageAsset()), &(pParticleAssetEmitter->getAnimationAsset()) );
 
+    // NOTE:-   This can run on a worker thread so invalid frames are counted rather than warned about.
+
     // Is the emitter in static mode?
     if ( pParticleAssetEmitter->isStaticFrameProvider() )
     {
-        // Yes, so is random image frame active?
-        if ( pParticleAssetEmitter->getRandomImageFrame() )
-        {
-            // Yes, so fetch the frame count for the image asset.
-            const U32 frameCount = pParticleAssetEmitter->getImageAsset()->getFrameCount();
+        // Yes, so fetch the image asset.
+        const AssetPtr<ImageAsset>& imageAsset = pParticleAssetEmitter->getImageAsset();
 
-            // Choose a random frame.
-            frameProvider.setImageFrame( (U32)CoreMath::mGetRandomI( 0, frameCount-1 ) );
-        }
+        // Fetch the frame count for the image asset.
+        const U32 frameCount = imageAsset.isNull() ? 0 : imageAsset->getFrameCount();
+
+        // Choose a random frame or use the emitter image frame.
+        const U32 frame = pParticleAssetEmitter->getRandomImageFrame() && frameCount > 0 ? (U32)random.randRangeI( 0, frameCount-1 ) : pParticleAssetEmitter->getImageFrame();
+
+        // Set the frame if it's valid.
+        if ( frame < frameCount )
+            frameProvider.setImageFrame( frame );
         else
-        {
-            // No, so set the emitter image frame.
-            frameProvider.setImageFrame( pParticleAssetEmitter->getImageFrame() );
-        }
+            pEmitterNode->addInvalidFrame();
     }
     else
     {
@@ -1281,210 +1372,275 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
         const AssetPtr<AnimationAsset>& animationAsset = pParticleAssetEmitter->getAnimationAsset();
 
         // Play it.
-        frameProvider.playAnimation( animationAsset );
+        if ( !frameProvider.playAnimation( animationAsset, random ) )
+            pEmitterNode->addInvalidFrame();
     }
 
 
     // **********************************************************************************************************************
-    // Reset Tick Position.
+    // Set Position and Reset Tick Position.
     // **********************************************************************************************************************
-    pParticleNode->mPreTickPosition = pParticleNode->mPostTickPosition = pParticleNode->mRenderTickPosition = pParticleNode->mPosition;
-
-
-    // **********************************************************************************************************************
-    // Do a Single Particle Integration to get things going.
-    // **********************************************************************************************************************
-    integrateParticle( pEmitterNode, pParticleNode, 0.0f, 0.0f );
+    particles.mPositionX[particleIndex] = particles.mPreTickPositionX[particleIndex] = position.x;
+    particles.mPositionY[particleIndex] = particles.mPreTickPositionY[particleIndex] = position.y;
 }
 
 //------------------------------------------------------------------------------
 
-void ParticlePlayer::integrateParticle( EmitterNode* pEmitterNode, ParticleSystem::ParticleNode* pParticleNode, F32 particleAge, F32 elapsedTime )
+void ParticlePlayer::integrateParticles( EmitterNode* pEmitterNode, const U32 firstParticle, const U32 lastParticle, const F32 elapsedTime )
 {
+    // Finish if there are no particles to integrate.
+    if ( firstParticle >= lastParticle )
+        return;
+
     // Fetch particle asset.
     ParticleAsset* pParticleAsset = mParticleAsset;
 
     // Fetch the asset emitter.
     ParticleAssetEmitter* pParticleAssetEmitter = pEmitterNode->getAssetEmitter();
 
+    // Fetch the particles.
+    ParticleSystem::ParticleStore& particles = pEmitterNode->getParticles();
+
 
     // **********************************************************************************************************************
     // Copy Old Tick Position.
     // **********************************************************************************************************************
-    pParticleNode->mRenderTickPosition = pParticleNode->mPreTickPosition = pParticleNode->mPostTickPosition;
+    dMemcpy( particles.mPreTickPositionX + firstParticle, particles.mPositionX + firstParticle, (lastParticle-firstParticle) * sizeof(F32) );
+    dMemcpy( particles.mPreTickPositionY + firstParticle, particles.mPositionY + firstParticle, (lastParticle-firstParticle) * sizeof(F32) );
 
 
     // **********************************************************************************************************************
-    // Scale Size.
+    // Scale the Life Properties.
     // **********************************************************************************************************************
 
+    // Fetch the life fields.
+    const ParticleAssetField& sizeXLifeField = pParticleAssetEmitter->getSizeXLifeField();
+    const ParticleAssetField& sizeYLifeField = pParticleAssetEmitter->getSizeYLifeField();
+    const ParticleAssetField& speedLifeField = pParticleAssetEmitter->getSpeedLifeField();
+    const ParticleAssetField& fixedForceLifeField = pParticleAssetEmitter->getFixedForceLifeField();
+    const ParticleAssetField& randomMotionLifeField = pParticleAssetEmitter->getRandomMotionLifeField();
+    const ParticleAssetField& spinLifeField = pParticleAssetEmitter->getSpinLifeField();
+
+    // Fetch the base fields (for limits).
+    const ParticleAssetField& sizeXBaseField = pParticleAssetEmitter->getSizeXBaseField();
+    const ParticleAssetField& sizeYBaseField = pParticleAssetEmitter->getSizeYBaseField();
+    const ParticleAssetField& speedBaseField = pParticleAssetEmitter->getSpeedBaseField();
+    const ParticleAssetField& fixedForceBaseField = pParticleAssetEmitter->getFixedForceBaseField();
+    const ParticleAssetField& randomMotionBaseField = pParticleAssetEmitter->getRandomMotionBaseField();
+
+    // Fetch the channels.
+    const ParticleAssetField& redChannel = pParticleAssetEmitter->getRedChannelLifeField();
+    const ParticleAssetField& greenChannel = pParticleAssetEmitter->getGreenChannelLifeField();
+    const ParticleAssetField& blueChannel = pParticleAssetEmitter->getBlueChannelLifeField();
+    const ParticleAssetField& alphaChannel = pParticleAssetEmitter->getAlphaChannelLifeField();
+    const F32 alphaChannelScale = pParticleAsset->getAlphaChannelScaleField().getFieldValue( 0.0f );
+
+    // Fetch the emitter options.
+    const bool fixedAspect = pParticleAssetEmitter->getFixedAspect();
+    const bool keepAligned = pParticleAssetEmitter->getKeepAligned() && pParticleAssetEmitter->getOrientationType() == ParticleAssetEmitter::ALIGNED_ORIENTATION;
+
+    // Calculate the normalized particle ages.
+    const U32 particleCount = lastParticle - firstParticle;
+    F32* pParticleLifeAge = particles.mParticleLifeAge;
+    for ( U32 particleIndex = firstParticle; particleIndex < lastParticle; ++particleIndex )
+    {
+        const F32 particleLifetime = particles.mParticleLifetime[particleIndex];
+        pParticleLifeAge[particleIndex-firstParticle] = mIsZero( particleLifetime ) ? 0.0f : particles.mParticleAge[particleIndex] / particleLifetime;
+    }
+
     // Scale Size-X.
-    pParticleNode->mRenderSize.x = mClampF( pParticleNode->mSize.x * pParticleAssetEmitter->getSizeXLifeField().getFieldValue( particleAge ),
-                                            pParticleAssetEmitter->getSizeXBaseField().getMinValue(),
-                                            pParticleAssetEmitter->getSizeXBaseField().getMaxValue());
+    sizeXLifeField.sampleLookupTable( pParticleLifeAge, particles.mSizeX + firstParticle, 1.0f, sizeXBaseField.getMinValue(), sizeXBaseField.getMaxValue(), particles.mRenderSizeX + firstParticle, particleCount );
 
     // Is the particle using a fixed aspect?
-    if ( pParticleAssetEmitter->getFixedAspect() )
+    if ( fixedAspect )
     {
         // Yes, so simply copy Size-X.
-        pParticleNode->mRenderSize.y = pParticleNode->mRenderSize.x;
+        dMemcpy( particles.mRenderSizeY + firstParticle, particles.mRenderSizeX + firstParticle, particleCount * sizeof(F32) );
     }
     else
     {
         // No, so Scale Size-Y.
-        pParticleNode->mRenderSize.y = mClampF( pParticleNode->mSize.y * pParticleAssetEmitter->getSizeYLifeField().getFieldValue( particleAge ),
-                                                pParticleAssetEmitter->getSizeYBaseField().getMinValue(),
-                                                pParticleAssetEmitter->getSizeYBaseField().getMaxValue() );
+        sizeYLifeField.sampleLookupTable( pParticleLifeAge, particles.mSizeY + firstParticle, 1.0f, sizeYBaseField.getMinValue(), sizeYBaseField.getMaxValue(), particles.mRenderSizeY + firstParticle, particleCount );
     }
 
+    // Scale Speed, Fixed-Force and Random-Motion.
+    speedLifeField.sampleLookupTable( pParticleLifeAge, particles.mSpeed + firstParticle, 1.0f, speedBaseField.getMinValue(), speedBaseField.getMaxValue(), particles.mRenderSpeed + firstParticle, particleCount );
+    fixedForceLifeField.sampleLookupTable( pParticleLifeAge, particles.mFixedForce + firstParticle, 1.0f, fixedForceBaseField.getMinValue(), fixedForceBaseField.getMaxValue(), particles.mRenderFixedForce + firstParticle, particleCount );
+    randomMotionLifeField.sampleLookupTable( pParticleLifeAge, particles.mRandomMotion + firstParticle, 1.0f, randomMotionBaseField.getMinValue(), randomMotionBaseField.getMaxValue(), particles.mRenderRandomMotion + firstParticle, particleCount );
 
-    // **********************************************************************************************************************
-    // Scale Speed.
-    // **********************************************************************************************************************
-    pParticleNode->mRenderSpeed = mClampF(  pParticleNode->mSpeed * pParticleAssetEmitter->getSpeedLifeField().getFieldValue( particleAge ),
-                                            pParticleAssetEmitter->getSpeedBaseField().getMinValue(),
-                                            pParticleAssetEmitter->getSpeedBaseField().getMaxValue() );
-
-
-    // **********************************************************************************************************************
-    // Scale Fixed-Force.
-    // **********************************************************************************************************************
-    pParticleNode->mRenderFixedForce = mClampF( pParticleNode->mFixedForce * pParticleAssetEmitter->getFixedForceLifeField().getFieldValue( particleAge ),
-                                                pParticleAssetEmitter->getFixedForceBaseField().getMinValue(),
-                                                pParticleAssetEmitter->getFixedForceBaseField().getMaxValue() );
-
-
-    // **********************************************************************************************************************
-    // Scale Random-Motion.
-    // **********************************************************************************************************************
-    pParticleNode->mRenderRandomMotion = mClampF(   pParticleNode->mRandomMotion * pParticleAssetEmitter->getRandomMotionLifeField().getFieldValue( particleAge ),
-                                                    pParticleAssetEmitter->getRandomMotionBaseField().getMinValue(),
-                                                    pParticleAssetEmitter->getRandomMotionBaseField().getMaxValue() );
-
-
-    // **********************************************************************************************************************
-    // Calculate RGBA Components.
-    // **********************************************************************************************************************
-
-    // Fetch the channels.
-    const ParticleAssetField& redChannel = pParticleAssetEmitter->getRedChannelLifeField();
-    const ParticleAssetField& greenChannel = pParticleAssetEmitter->getGreenChannelLifeField();
-    const ParticleAssetField& blueChannel = pParticleAssetEmitter->getBlueChannelLifeField();
-    const ParticleAssetField& alphaChannel = pParticleAssetEmitter->getAlphaChannelLifeField();
-    const ParticleAssetField& alphaChannelScale = pParticleAsset->getAlphaChannelScaleField();
+    // Scale Spin (unless we're aligning to motion).
+    if ( keepAligned )
+        dMemset( particles.mRenderSpin + firstParticle, 0, particleCount * sizeof(F32) );
+    else
+        spinLifeField.sampleLookupTable( pParticleLifeAge, particles.mSpin + firstParticle, 1.0f, -F32_MAX, F32_MAX, particles.mRenderSpin + firstParticle, particleCount );
 
     // Calculate the color.
-    pParticleNode->mColor.set(  mClampF( redChannel.getFieldValue( particleAge ), redChannel.getMinValue(), redChannel.getMaxValue() ),
-                                mClampF( greenChannel.getFieldValue( particleAge ),greenChannel.getMinValue(), greenChannel.getMaxValue() ),
-                                mClampF( blueChannel.getFieldValue( particleAge ), blueChannel.getMinValue(),blueChannel.getMaxValue() ),
-                                mClampF( alphaChannel.getFieldValue( particleAge ) * alphaChannelScale.getFieldValue( 0.0f ), alphaChannel.getMinValue(), alphaChannel.getMaxValue() ) );
+    redChannel.sampleLookupTable( pParticleLifeAge, NULL, 1.0f, redChannel.getMinValue(), redChannel.getMaxValue(), particles.mRed + firstParticle, particleCount );
+    greenChannel.sampleLookupTable( pParticleLifeAge, NULL, 1.0f, greenChannel.getMinValue(), greenChannel.getMaxValue(), particles.mGreen + firstParticle, particleCount );
+    blueChannel.sampleLookupTable( pParticleLifeAge, NULL, 1.0f, blueChannel.getMinValue(), blueChannel.getMaxValue(), particles.mBlue + firstParticle, particleCount );
+    alphaChannel.sampleLookupTable( pParticleLifeAge, NULL, alphaChannelScale, alphaChannel.getMinValue(), alphaChannel.getMaxValue(), particles.mAlpha + firstParticle, particleCount );
 
 
     // **********************************************************************************************************************
-    // Integrate Particle.
+    // Update Animation.
     // **********************************************************************************************************************
 
-
     // Is the emitter in static mode?
     if ( !pParticleAssetEmitter->isStaticFrameProvider() )
     {
         // No, so update animation.
-        pParticleNode->mFrameProvider.updateAnimation( elapsedTime );
+        for ( U32 particleIndex = firstParticle; particleIndex < lastParticle; ++particleIndex )
+            particles.mFrameProviders[particleIndex]->stepAnimation( elapsedTime );
     }
 
 
     // **********************************************************************************************************************
-    // Calculate New Velocity...
+    // Calculate New Velocity and Position...
     // **********************************************************************************************************************
 
     // Calculate the velocity if not a single particle.
-    if ( !pParticleAssetEmitter->getSingleParticle() )
+    if ( !pParticleAssetEmitter->getSingleParticle() && mNotZero( elapsedTime ) )
     {
-        // Calculate random motion (if we've got any).
-        if ( mNotZero( pParticleNode->mRenderRandomMotion ) )
+        F32* pVelocityX = particles.mVelocityX;
+        F32* pVelocityY = particles.mVelocityY;
+        F32* pPositionX = particles.mPositionX;
+        F32* pPositionY = particles.mPositionY;
+        const F32* pRenderSpeed = particles.mRenderSpeed;
+        const F32* pRenderFixedForce = particles.mRenderFixedForce;
+        const F32* pRenderRandomMotion = particles.mRenderRandomMotion;
+        RandomGeneratorBase& random = pEmitterNode->getRandom();
+
+        // Add time-integrated random motion into velocity (if we've got any).
+        for ( U32 particleIndex = firstParticle; particleIndex < lastParticle; ++particleIndex )
         {
-            // Fetch random motion.
-            const F32 randomMotion = pParticleNode->mRenderRandomMotion * 0.5f;
-
-            // Add time-integrated random motion into velocity.
-            pParticleNode->mVelocity += Vector2( CoreMath::mGetRandomF(-randomMotion, randomMotion) * elapsedTime, CoreMath::mGetRandomF(-randomMotion, randomMotion) * elapsedTime );
+            if ( mNotZero( pRenderRandomMotion[particleIndex] ) )
+            {
+                const F32 randomMotion = pRenderRandomMotion[particleIndex] * 0.5f;
+                pVelocityX[particleIndex] += random.randRangeF(-randomMotion, randomMotion) * elapsedTime;
+                pVelocityY[particleIndex] += random.randRangeF(-randomMotion, randomMotion) * elapsedTime;
+            }
         }
 
-        // Do we have any fixed force?
-        if ( mNotZero( pParticleNode->mRenderFixedForce ) )
+        // Time-integrate the fixed force into the velocity.
+        const Vector2 fixedForceImpulse = pParticleAssetEmitter->getFixedForceDirection() * getForceScale() * elapsedTime;
+        const F32 fixedForceImpulseX = fixedForceImpulse.x;
+        const F32 fixedForceImpulseY = fixedForceImpulse.y;
+        for ( U32 particleIndex = firstParticle; particleIndex < lastParticle; ++particleIndex )
         {
-            // Yes, so time-integrate a fixed force to the velocity.
-            pParticleNode->mVelocity += (pParticleAssetEmitter->getFixedForceDirection() * (pParticleNode->mRenderFixedForce * getForceScale()) * elapsedTime);
+            pVelocityX[particleIndex] += fixedForceImpulseX * pRenderFixedForce[particleIndex];
+            pVelocityY[particleIndex] += fixedForceImpulseY * pRenderFixedForce[particleIndex];
         }
 
-        // Are we suppressing movement?
-        if ( !pParticleNode->mSuppressMovement )
+        // Adjust the particle positions.
+        for ( U32 particleIndex = firstParticle; particleIndex < lastParticle; ++particleIndex )
         {
-            // No, so adjust particle position.
-            pParticleNode->mPosition += (pParticleNode->mVelocity * pParticleNode->mRenderSpeed * elapsedTime);
+            const F32 displacement = pRenderSpeed[particleIndex] * elapsedTime;
+            pPositionX[particleIndex] += pVelocityX[particleIndex] * displacement;
+            pPositionY[particleIndex] += pVelocityY[particleIndex] * displacement;
         }
     }
 
 
     // **********************************************************************************************************************
-    // Are we Aligning to motion?
+    // Calculate Orientation.
     // **********************************************************************************************************************
-    if ( pParticleAssetEmitter->getKeepAligned() && pParticleAssetEmitter->getOrientationType() == ParticleAssetEmitter::ALIGNED_ORIENTATION )
+
+    F32* pOrientationAngle = particles.mOrientationAngle;
+
+    // Are we aligning to motion?
+    if ( keepAligned )
     {
-        // Yes, so calculate last movement direction.
-        F32 movementAngle = mRadToDeg( mAtan( pParticleNode->mVelocity.x, -pParticleNode->mVelocity.y ) );
+        // Yes, so fetch the aligned angle offset.
+        const F32 alignedAngleOffset = pParticleAssetEmitter->getAlignedAngleOffset();
 
-        // Adjust for negative ArcTan quadrants.
-        if ( movementAngle < 0.0f )
-            movementAngle += 360.0f;
+        for ( U32 particleIndex = firstParticle; particleIndex < lastParticle; ++particleIndex )
+        {
+            // Calculate last movement direction.
+            F32 movementAngle = mRadToDeg( mAtan( particles.mVelocityX[particleIndex], -particles.mVelocityY[particleIndex] ) );
 
-        // Set new Orientation Angle.
-        pParticleNode->mOrientationAngle = -movementAngle - pParticleAssetEmitter->getAlignedAngleOffset();
+            // Adjust for negative ArcTan quadrants.
+            if ( movementAngle < 0.0f )
+                movementAngle += 360.0f;
 
+            // Set new Orientation Angle.
+            pOrientationAngle[particleIndex] = -movementAngle - alignedAngleOffset;
+        }
     }
     else
     {
-        // No, so calculate the render spin.
-        pParticleNode->mRenderSpin = pParticleNode->mSpin * pParticleAssetEmitter->getSpinLifeField().getFieldValue( particleAge );
-
-        // Have we got some Spin?
-        if ( mNotZero(pParticleNode->mRenderSpin) )
+        // No, so add any spin into the orientation.
+        const F32* pRenderSpin = particles.mRenderSpin;
+        for ( U32 particleIndex = firstParticle; particleIndex < lastParticle; ++particleIndex )
         {
-            // Yes, so add into Orientation.
-            pParticleNode->mOrientationAngle += pParticleNode->mRenderSpin * elapsedTime;
-
-            // Clamp the orientation angle.
-            pParticleNode->mOrientationAngle = mFmod( pParticleNode->mOrientationAngle, 360.0f );
+            // Have we got some Spin?
+            if ( mNotZero(pRenderSpin[particleIndex]) )
+            {
+                // Yes, so add into Orientation and clamp it.
+                pOrientationAngle[particleIndex] = mFmod( pOrientationAngle[particleIndex] + pRenderSpin[particleIndex] * elapsedTime, 360.0f );
+            }
         }
     }
 
-    // Calculate the transform.
-    pParticleNode->mTransform.Set( pParticleNode->mPosition, mDegToRad(pParticleNode->mOrientationAngle) );
+    // Calculate the rotations.
+    for ( U32 particleIndex = firstParticle; particleIndex < lastParticle; ++particleIndex )
+    {
+        const F32 angle = mDegToRad( pOrientationAngle[particleIndex] );
+        particles.mRotationCos[particleIndex] = mCos( angle );
+        particles.mRotationSin[particleIndex] = mSin( angle );
+    }
 
-    // Fetch the local AABB..
-    const Vector2& localAABB0 = pParticleAssetEmitter->getLocalPivotAABB0();
-    const Vector2& localAABB1 = pParticleAssetEmitter->getLocalPivotAABB1();
-    const Vector2& localAABB2 = pParticleAssetEmitter->getLocalPivotAABB2();
-    const Vector2& localAABB3 = pParticleAssetEmitter->getLocalPivotAABB3();
 
-    // Fetch the render size.
-    const Vector2& renderSize = pParticleNode->mRenderSize;
+    // **********************************************************************************************************************
+    // Calculate the World OOBB.
+    // **********************************************************************************************************************
+    calculateParticleOOBBs( pEmitterNode, firstParticle, lastParticle, particles.mPositionX, particles.mPositionY );
+}
 
-    // Calculate the scaled AABB.
-    Vector2 scaledAABB[4];
-    scaledAABB[0] = localAABB0 * renderSize;
-    scaledAABB[1] = localAABB1 * renderSize;
-    scaledAABB[2] = localAABB2 * renderSize;
-    scaledAABB[3] = localAABB3 * renderSize;
+//------------------------------------------------------------------------------
 
-    // Calculate the world OOBB..
-    CoreMath::mCalculateOOBB( scaledAABB, pParticleNode->mTransform, pParticleNode->mRenderOOBB );
+void ParticlePlayer::calculateParticleOOBBs( EmitterNode* pEmitterNode, const U32 firstParticle, const U32 lastParticle, const F32* pPositionX, const F32* pPositionY )
+{
+    // Fetch the asset emitter.
+    ParticleAssetEmitter* pParticleAssetEmitter = pEmitterNode->getAssetEmitter();
 
+    // Fetch the particles.
+    ParticleSystem::ParticleStore& particles = pEmitterNode->getParticles();
 
-    // **********************************************************************************************************************
-    // Set Post Tick Position.
-    // **********************************************************************************************************************
-    pParticleNode->mPostTickPosition = pParticleNode->mPosition;
+    // Fetch the local AABB..
+    const Vector2 localAABB[4] =
+    {
+        pParticleAssetEmitter->getLocalPivotAABB0(),
+        pParticleAssetEmitter->getLocalPivotAABB1(),
+        pParticleAssetEmitter->getLocalPivotAABB2(),
+        pParticleAssetEmitter->getLocalPivotAABB3()
+    };
+
+    // Fetch the particle components.
+    const F32* pRenderSizeX = particles.mRenderSizeX;
+    const F32* pRenderSizeY = particles.mRenderSizeY;
+    const F32* pRotationCos = particles.mRotationCos;
+    const F32* pRotationSin = particles.mRotationSin;
+    Vector2* pRenderOOBB = particles.mRenderOOBB;
+
+    for ( U32 particleIndex = firstParticle; particleIndex < lastParticle; ++particleIndex )
+    {
+        const F32 renderSizeX = pRenderSizeX[particleIndex];
+        const F32 renderSizeY = pRenderSizeY[particleIndex];
+        const F32 rotationCos = pRotationCos[particleIndex];
+        const F32 rotationSin = pRotationSin[particleIndex];
+        const F32 positionX = pPositionX[particleIndex];
+        const F32 positionY = pPositionY[particleIndex];
+        Vector2* pParticleOOBB = pRenderOOBB + particleIndex*4;
+
+        // Transform the scaled AABB into the world OOBB.
+        for ( U32 vertexIndex = 0; vertexIndex < 4; ++vertexIndex )
+        {
+            const F32 scaledX = localAABB[vertexIndex].x * renderSizeX;
+            const F32 scaledY = localAABB[vertexIndex].y * renderSizeY;
+            pParticleOOBB[vertexIndex].x = (rotationCos * scaledX - rotationSin * scaledY) + positionX;
+            pParticleOOBB[vertexIndex].y = (rotationSin * scaledX + rotationCos * scaledY) + positionY;
+        }
+    }
 }
 
 //-----------------------------------------------------------------------------
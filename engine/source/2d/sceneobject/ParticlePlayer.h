@@ -51,13 +51,17 @@ private:
     private:
         ParticlePlayer*                 mOwner;
         ParticleAssetEmitter*           mpAssetEmitter;
-        ParticleSystem::ParticleNode    mParticleNodeHead;
+        ParticleSystem::ParticleStore   mParticles;
+        RandomLCG                       mRandom;
         F32                             mTimeSinceLastGeneration;
+        U32                             mPendingEmission;
+        U32                             mInvalidFrameCount;
         bool                            mPaused;
         bool                            mVisible;
 
     public:
-        EmitterNode( ParticlePlayer* pParticlePlayer, ParticleAssetEmitter* pParticleAssetEmitter )
+        EmitterNode( ParticlePlayer* pParticlePlayer, ParticleAssetEmitter* pParticleAssetEmitter ) :
+            mRandom( CoreMath::mGetRandomI() )
         {
             // Sanity!
             AssertFatal( pParticlePlayer != NULL, "EmitterNode() - Cannot have a NULL owner." );
@@ -78,8 +82,11 @@ private:
             // Reset time since last generation.
             mTimeSinceLastGeneration = 0.0f;
 
-            // Reset the node head.
-            mParticleNodeHead.mNextNode = mParticleNodeHead.mPreviousNode = &mParticleNodeHead;
+            // Reset pending emission.
+            mPendingEmission = 0;
+
+            // Reset invalid frame count.
+            mInvalidFrameCount = 0;
         }
 
         ~EmitterNode()
@@ -90,24 +97,35 @@ private:
         inline ParticlePlayer* getOwner( void ) const { return mOwner; }
         inline ParticleAssetEmitter* getAssetEmitter( void ) const { return mpAssetEmitter; }
 
-        inline bool getActiveParticles( void ) const { return mParticleNodeHead.mNextNode != &mParticleNodeHead; }
+        inline bool getActiveParticles( void ) const { return mParticles.getParticleCount() > 0; }
+        inline U32 getParticleCount( void ) const { return mParticles.getParticleCount(); }
+
+        inline ParticleSystem::ParticleStore& getParticles( void ) { return mParticles; }
+        inline const ParticleSystem::ParticleStore& getParticles( void ) const { return mParticles; }
 
-        inline ParticleSystem::ParticleNode* getFirstParticle( void ) const { return mParticleNodeHead.mNextNode; }
-        inline ParticleSystem::ParticleNode* getLastParticle( void ) const { return mParticleNodeHead.mPreviousNode; }
-        inline ParticleSystem::ParticleNode* getParticleNodeHead( void ) { return &mParticleNodeHead; }
+        inline RandomGeneratorBase& getRandom( void ) { return mRandom; }
 
         inline void setTimeSinceLastGeneration( const F32 timeSinceLastGeneration ) { mTimeSinceLastGeneration = timeSinceLastGeneration; }
         inline F32 getTimeSinceLastGeneration( void ) const { return mTimeSinceLastGeneration; }
 
+        inline void setPendingEmission( const U32 pendingEmission ) { mPendingEmission = pendingEmission; }
+        inline U32 getPendingEmission( void ) const { return mPendingEmission; }
+
+        /// Particles that could not be given their image frame or animation.
+        /// NOTE:-  These are counted by the integration job and reported on the main thread.
+        inline void addInvalidFrame( void ) { mInvalidFrameCount++; }
+        inline void setInvalidFrameCount( const U32 invalidFrameCount ) { mInvalidFrameCount = invalidFrameCount; }
+        inline U32 getInvalidFrameCount( void ) const { return mInvalidFrameCount; }
+
         inline void setPaused( const bool paused ) { mPaused = paused; }
         inline bool getPaused( void ) const { return mPaused; }
 
         inline void setVisible( const bool visible ) { mVisible = visible; }
         inline bool getVisible( void ) const { return mVisible; }
 
-        ParticleSystem::ParticleNode* createParticle( void );
-        void freeParticle( ParticleSystem::ParticleNode* pParticleNode );
-        void freeAllParticles( void );        
+        void createParticles( const U32 particleCount );
+        U32 freeExpiredParticles( void );
+        void freeAllParticles( void );
     };
 
     typedef Vector<EmitterNode*> typeEmitterVector;
@@ -131,6 +149,12 @@ private:
     bool                        mWaitingForParticles;
     bool                        mWaitingForDelete;
 
+    U32                         mIntegrationJobCount;
+    bool                        mLifeModePending;
+
+    Vector<F32>                 mRenderTickPositionX;
+    Vector<F32>                 mRenderTickPositionY;
+
 public:
     ParticlePlayer();
     virtual ~ParticlePlayer();
@@ -141,7 +165,12 @@ public:
 
     virtual void preIntegrate( const F32 totalTime, const F32 elapsedTime, DebugStats* pDebugStats );
     void integrateObject( const F32 totalTime, const F32 elapsedTime, DebugStats* pDebugStats );
+    virtual void postIntegrate( const F32 totalTime, const F32 elapsedTime, DebugStats* pDebugStats );
     void interpolateObject( const F32 timeDelta );
+    virtual bool getTickRequired( void ) const { return true; }
+
+    virtual U32 getIntegrationJobCount( void ) const { return mIntegrationJobCount; }
+    virtual void integrateJob( const U32 jobIndex, const F32 totalTime, const F32 elapsedTime );
 
     virtual bool validRender( void ) const { return mParticleAsset.notNull() && mParticleAsset->isAssetValid(); }
     virtual bool shouldRender( void ) const { return true; }
@@ -192,8 +221,9 @@ protected:
     virtual void onAssetRefreshed( AssetPtrBase* pAssetPtrBase );
 
     /// Particle Creation/Integration.
-    void configureParticle( EmitterNode* pEmitterNode, ParticleSystem::ParticleNode* pParticleNode );
-    void integrateParticle( EmitterNode* pEmitterNode, ParticleSystem::ParticleNode* pParticleNode, const F32 particleAge, const F32 elapsedTime );
+    void configureParticle( EmitterNode* pEmitterNode, const U32 particleIndex );
+    void integrateParticles( EmitterNode* pEmitterNode, const U32 firstParticle, const U32 lastParticle, const F32 elapsedTime );
+    void calculateParticleOOBBs( EmitterNode* pEmitterNode, const U32 firstParticle, const U32 lastParticle, const F32* pPositionX, const F32* pPositionY );
 
     /// Persistence.
     virtual void onTamlAddParent( SimObject* pParentObject );
@@ -209,6 +239,7 @@ protected:
 private:
     void initializeParticleAsset( void );
     void destroyParticleAsset( void );
+    void updateLifeMode( void );
 };
 
 #endif // _PARTICLE_PLAYER_H_
\ No newline at end of file
@@ -128,10 +128,11 @@ SceneObject::SceneObject() :
     mRenderPosition( 0.0f, 0.0f ),
     mRenderAngle( 0.0f ),
     mSpatialDirty( true ),
+    mActiveIndex( -1 ),
 
     /// Body.
     mpBody(NULL),
-    mWorldQueryKey(0),
+    mRenderOnly(false),
 
     /// Collision control.
     mCollisionLayerMask(MASK_ALL),
@@ -280,6 +281,7 @@ void SceneObject::initPersistFields()
     addProtectedField("Awake", TypeBool, NULL, &setAwake, &getAwake, &writeAwake, "" );
     addProtectedField("Bullet", TypeBool, NULL, &setBullet, &getBullet, &writeBullet, "" );
     addProtectedField("SleepingAllowed", TypeBool, NULL, &setSleepingAllowed, &getSleepingAllowed, &writeSleepingAllowed, "" );
+    addProtectedField("RenderOnly", TypeBool, Offset(mRenderOnly, SceneObject), &setRenderOnly, &defaultProtectedGetFn, &writeRenderOnly, "" );
 
     /// Collision control.
     addProtectedField("CollisionGroups", TypeS32, Offset(mCollisionGroupMask, SceneObject), &setCollisionGroups, &defaultProtectedGetFn, &writeCollisionGroups, "");
@@ -300,7 +302,7 @@ void SceneObject::initPersistFields()
     addProtectedField("GravityScale", TypeF32, NULL, &setGravityScale, &getGravityScale, &writeGravityScale, "");
 
     /// Render visibility.
-    addField("Visible", TypeBool, Offset(mVisible, SceneObject), &writeVisible, "");
+    addProtectedField("Visible", TypeBool, Offset(mVisible, SceneObject), &setVisible, &defaultProtectedGetFn, &writeVisible, "");
 
     /// Render blending.
     addField("BlendMode", TypeBool, Offset(mBlendMode, SceneObject), &writeBlendMode, "");
@@ -319,9 +321,9 @@ void SceneObject::initPersistFields()
     addField("PickingAllowed", TypeBool, Offset(mPickingAllowed, SceneObject), &writePickingAllowed, "");
 
     // Script callbacks.
-    addField("UpdateCallback", TypeBool, Offset(mUpdateCallback, SceneObject), &writeUpdateCallback, "");
+    addProtectedField("UpdateCallback", TypeBool, Offset(mUpdateCallback, SceneObject), &setUpdateCallback, &defaultProtectedGetFn, &writeUpdateCallback, "");
     addField("CollisionCallback", TypeBool, Offset(mCollisionCallback, SceneObject), &writeCollisionCallback, "");
-    addField("SleepingCallback", TypeBool, Offset(mSleepingCallback, SceneObject), &writeSleepingCallback, "");
+    addProtectedField("SleepingCallback", TypeBool, Offset(mSleepingCallback, SceneObject), &setSleepingCallback, &defaultProtectedGetFn, &writeSleepingCallback, "");
 
     /// Scene.
     addProtectedField("scene", TypeSimObjectPtr, Offset(mpScene, SceneObject), &setScene, &defaultProtectedGetFn, &writeScene, "");
@@ -383,11 +385,13 @@ void SceneObject::OnRegisterScene( Scene* pScene )
     // Set scene.
     mpScene = pScene;
 
-    // Create the physics body.
-    mpBody = pScene->getWorld()->CreateBody( &mBodyDefinition );
+    // Collision shapes added whilst out of a scene need a body after all.
+    if ( mRenderOnly && mCollisionFixtureDefs.size() > 0 )
+        mRenderOnly = false;
 
-    // Set active status.
-    if ( !isEnabled() ) mpBody->SetActive( false );
+    // Create the physics body unless render-only.
+    if ( !mRenderOnly )
+        createPhysicsBody();
 
     // Create fixtures.
     for( typeCollisionFixtureDefVector::iterator itr = mCollisionFixtureDefs.begin(); itr != mCollisionFixtureDefs.end(); itr++ )
@@ -396,10 +400,7 @@ void SceneObject::OnRegisterScene( Scene* pScene )
         b2FixtureDef* pFixtureDef = (*itr);
 
         // Create fixture.
-        b2Fixture* pFixture = mpBody->CreateFixture( pFixtureDef );
-
-        // Push fixture.
-        mCollisionFixtures.push_back( pFixture );
+        createCollisionFixture( pFixtureDef );
 
         // Destroy fixture shape.
         delete pFixtureDef->shape;
@@ -412,7 +413,7 @@ void SceneObject::OnRegisterScene( Scene* pScene )
     mCollisionFixtureDefs.clear();
 
     // Calculate current AABB.
-    CoreMath::mCalculateAABB( getLocalSizedOOBB(), mpBody->GetTransform(), &mCurrentAABB );
+    CoreMath::mCalculateAABB( getLocalSizedOOBB(), getTransform(), &mCurrentAABB );
 
     // Create world proxy Id.
     mWorldProxyId = pScene->getWorldQuery()->add( this );
@@ -430,7 +431,6 @@ void SceneObject::OnUnregisterScene( Scene* pScene )
 {
     // Sanity!
     AssertFatal( mpScene == pScene, "Cannot unregister from a scene that is not registered." );
-    AssertFatal( mpBody != NULL, "Cannot unregister physics body as it does not exist." );
 
     // Notify components.
     notifyComponentsRemoveFromScene();
@@ -458,6 +458,48 @@ void SceneObject::OnUnregisterScene( Scene* pScene )
     // The actual fixtures will get destroyed when the body is destroyed so no need to destroy them here.
     mCollisionFixtures.clear();
 
+    // Destroy current contacts.
+    delete mpCurrentContacts;
+    mpCurrentContacts = NULL;
+
+    // Destroy the physics body.
+    if ( mpBody != NULL )
+        destroyPhysicsBody();
+
+    // Destroy world proxy Id.
+    if ( mWorldProxyId != -1 )
+    {
+
+        mpScene->getWorldQuery()->remove( this );
+        mWorldProxyId = -1;
+    }
+
+    // Reset scene.
+    mpScene = NULL;
+}
+
+//-----------------------------------------------------------------------------
+
+void SceneObject::createPhysicsBody( void )
+{
+    // Sanity!
+    AssertFatal( mpScene != NULL, "Cannot create a physics body when not in a scene." );
+    AssertFatal( mpBody == NULL, "Cannot create a physics body if one already exists." );
+
+    // Create the physics body.
+    mpBody = mpScene->getWorld()->CreateBody( &mBodyDefinition );
+
+    // Set active status.
+    if ( !isEnabled() ) mpBody->SetActive( false );
+}
+
+//-----------------------------------------------------------------------------
+
+void SceneObject::destroyPhysicsBody( void )
+{
+    // Sanity!
+    AssertFatal( mpBody != NULL, "Cannot destroy physics body as it does not exist." );
+
     // Transfer physics body configuration back to definition.
     mBodyDefinition.type            = getBodyType();
     mBodyDefinition.position        = getPosition();
@@ -473,27 +515,55 @@ void SceneObject::OnUnregisterScene( Scene* pScene )
     mBodyDefinition.bullet          = getBullet();
     mBodyDefinition.active          = getActive();
 
-    // Destroy current contacts.
-    delete mpCurrentContacts;
-    mpCurrentContacts = NULL;
-
     // Destroy the physics body.
     mpScene->getWorld()->DestroyBody( mpBody );
     mpBody = NULL;
+}
 
-    // Destroy world proxy Id.
-    if ( mWorldProxyId != -1 )
+//-----------------------------------------------------------------------------
+
+void SceneObject::setRenderOnly( const bool renderOnly )
+{
+    // Finish if no change.
+    if ( renderOnly == mRenderOnly )
+        return;
+
+    if ( !renderOnly )
     {
+        mRenderOnly = false;
 
-        mpScene->getWorldQuery()->remove( this );
-        mWorldProxyId = -1;
+        // Promote to a full physics body if in a scene.
+        if ( mpScene != NULL && mpBody == NULL )
+            createPhysicsBody();
+
+        return;
     }
 
-    // Reset scene.
-    mpScene = NULL;
-}
+    // Render-only objects cannot collide.
+    if ( getCollisionShapeCount() > 0 )
+    {
+        Con::warnf( "SceneObject::setRenderOnly() - Cannot make an object with collision shapes render-only." );
+        return;
+    }
 
-//-----------------------------------------------------------------------------
+    // Render-only objects cannot be jointed.
+    if ( mpBody != NULL && mpBody->GetJointList() != NULL )
+    {
+        Con::warnf( "SceneObject::setRenderOnly() - Cannot make an object with joints render-only." );
+        return;
+    }
+
+    // Render-only objects never move under physics.
+    setBodyType( b2_staticBody );
+    setLinearVelocity( b2Vec2_zero );
+    setAngularVelocity( 0.0f );
+
+    mRenderOnly = true;
+
+    // Drop the physics body if in a scene.
+    if ( mpBody != NULL )
+        destroyPhysicsBody();
+}
 
 void SceneObject::resetTickSpatials( const bool resize )
 {
@@ -536,6 +606,9 @@ void SceneObject::resetTickSpatials( const bool resize )
 
     // Flag spatial changed.
     mSpatialDirty = true;
+
+    // Make sure we're ticked.
+    setTickActive();
 }
 
 //-----------------------------------------------------------------------------
@@ -658,6 +731,26 @@ void SceneObject::postIntegrate(const F32 totalTime, const F32 elapsedTime, Debu
 
 //-----------------------------------------------------------------------------
 
+bool SceneObject::getTickRequired( void ) const
+{
+    // Ticks are required whilst the spatials are changing.
+    if ( mSpatialDirty )
+        return true;
+
+    // Ticks are required whilst the body can move.
+    if ( mpBody != NULL && mpBody->IsAwake() && mpBody->GetType() != b2_staticBody )
+        return true;
+
+    // Ticks are required until a change in awake state has been reported.
+    if ( mSleepingCallback && getAwake() != mLastAwakeState )
+        return true;
+
+    // Ticks are required for anything else updated every tick.
+    return mLifetimeActive || mUpdateCallback || mpAttachedGui != NULL || mpAttachedCamera != NULL || hasComponents();
+}
+
+//-----------------------------------------------------------------------------
+
 void SceneObject::interpolateObject( const F32 timeDelta )
 {
     // Debug Profiling.
@@ -787,7 +880,8 @@ void SceneObject::sceneRenderOverlay( const SceneRenderState* sceneRenderState )
     // Collision Shapes.
     if ( debugMask & Scene::SCENE_DEBUG_COLLISION_SHAPES )
     {
-        pScene->mDebugDraw.DrawCollisionShapes( getRenderTransform(), getBody() );
+        if ( mpBody )
+            pScene->mDebugDraw.DrawCollisionShapes( getRenderTransform(), mpBody );
     }
 
     // Position and local center of mass.
@@ -823,13 +917,25 @@ void SceneObject::unpackUpdate(NetConnection * conn, BitStream *stream)
 
 void SceneObject::setEnabled( const bool enabled )
 {
+    // Fetch the current enabled state.
+    const bool wasEnabled = isEnabled();
+
     // Call parent.
     Parent::setEnabled( enabled );
 
     // If we have a scene, modify active.
     if ( mpScene )
     {
-        mpBody->SetActive( enabled );
+        if ( mpBody )
+            mpBody->SetActive( enabled );
+
+        // Update the scene's enabled count.
+        if ( enabled != wasEnabled )
+            mpScene->updateEnabledObjectCount( enabled );
+
+        // Make sure we're ticked.
+        if ( enabled )
+            setTickActive();
     }
 }
 
@@ -848,6 +954,9 @@ void SceneObject::setLifetime( const F32 lifetime )
     {
         // Yes, so set to incoming lifetime.
         mLifetime = lifetime;
+
+        // Make sure we're ticked.
+        setTickActive();
     }
     else
     {
@@ -1180,17 +1289,20 @@ void SceneObject::setPosition( const Vector2& position )
     // Debug Profiling.
     PROFILE_SCOPE(SceneObject_SetPosition);
 
-    if ( mpScene )
+    if ( mpBody )
     {
         mpBody->SetTransform( position, mpBody->GetAngle() );
-
-        // Reset tick spatials.
-        resetTickSpatials();
     }
     else
     {
         mBodyDefinition.position = position;
     }
+
+    if ( mpScene )
+    {
+        // Reset tick spatials.
+        resetTickSpatials();
+    }
 }
 
 //-----------------------------------------------------------------------------
@@ -1200,24 +1312,27 @@ void SceneObject::setAngle( const F32 radians )
     // Debug Profiling.
     PROFILE_SCOPE(SceneObject_SetAngle);
 
-    if ( mpScene )
+    if ( mpBody )
     {
         mpBody->SetTransform( mpBody->GetPosition(), radians );
-
-        // Reset tick spatials.
-        resetTickSpatials();
     }
     else
     {
         mBodyDefinition.angle = radians;
     }
+
+    if ( mpScene )
+    {
+        // Reset tick spatials.
+        resetTickSpatials();
+    }
 }
 
 //-----------------------------------------------------------------------------
 
 Vector2 SceneObject::getLocalPoint( const Vector2 &worldPoint )
 {
-    if ( mpScene )
+    if ( mpBody )
     {
         return mpBody->GetLocalPoint( worldPoint );
     }
@@ -1232,7 +1347,7 @@ Vector2 SceneObject::getLocalPoint( const Vector2 &worldPoint )
 
 Vector2 SceneObject::getWorldPoint( const Vector2 &localPoint )
 {
-    if ( mpScene )
+    if ( mpBody )
     {
         return mpBody->GetWorldPoint( localPoint );
     }
@@ -1247,7 +1362,7 @@ Vector2 SceneObject::getWorldPoint( const Vector2 &localPoint )
 
 Vector2 SceneObject::getLocalVector( const Vector2& worldVector )
 {
-    if ( mpScene )
+    if ( mpBody )
     {
         return mpBody->GetLocalVector( worldVector );
     }
@@ -1262,7 +1377,7 @@ Vector2 SceneObject::getLocalVector( const Vector2& worldVector )
 
 Vector2 SceneObject::getWorldVector( const Vector2& localVector )
 {
-    if ( mpScene )
+    if ( mpBody )
     {
         return mpBody->GetWorldVector( localVector );
     }
@@ -1320,7 +1435,11 @@ void SceneObject::setBodyType( const b2BodyType type )
     // Sanity!
     AssertFatal( type == b2_staticBody || type == b2_kinematicBody || type == b2_dynamicBody, "Invalid body type." );
 
-    if ( mpScene )
+    // Render-only objects need a body to move.
+    if ( type != b2_staticBody )
+        setRenderOnly( false );
+
+    if ( mpBody )
     {
         mpBody->SetType( type );
         return;
@@ -1336,8 +1455,8 @@ void SceneObject::setBodyType( const b2BodyType type )
 
 void SceneObject::applyForce( const Vector2& worldForce, const bool wake )
 {
-    // Ignore if not in scene.
-    if ( !mpScene )
+    // Ignore if there's no body.
+    if ( mpBody == NULL )
         return;
 
     applyForce( worldForce, getPosition() + getLocalCenter(), wake );
@@ -1347,8 +1466,8 @@ void SceneObject::applyForce( const Vector2& worldForce, const bool wake )
 
 void SceneObject::applyForce( const Vector2& worldForce, const Vector2& worldPoint, const bool wake )
 {
-    // Ignore if not in scene.
-    if ( !mpScene )
+    // Ignore if there's no body.
+    if ( mpBody == NULL )
         return;
 
     getBody()->ApplyForce( worldForce, worldPoint, wake );
@@ -1358,8 +1477,8 @@ void SceneObject::applyForce( const Vector2& worldForce, const Vector2& worldPoi
 
 void SceneObject::applyTorque( const F32 torque, const bool wake )
 {
-    // Ignore if not in scene.
-    if ( !mpScene )
+    // Ignore if there's no body.
+    if ( mpBody == NULL )
         return;
 
     getBody()->ApplyTorque( torque, wake );
@@ -1369,8 +1488,8 @@ void SceneObject::applyTorque( const F32 torque, const bool wake )
 
 void SceneObject::applyLinearImpulse( const Vector2& worldImpulse, const bool wake )
 {
-    // Ignore if not in scene.
-    if ( !mpScene )
+    // Ignore if there's no body.
+    if ( mpBody == NULL )
         return;
 
     applyLinearImpulse( worldImpulse, getPosition() + getLocalCenter(), wake );
@@ -1380,8 +1499,8 @@ void SceneObject::applyLinearImpulse( const Vector2& worldImpulse, const bool wa
 
 void SceneObject::applyLinearImpulse( const Vector2& worldImpulse, const Vector2& worldPoint, const bool wake )
 {
-    // Ignore if not in scene.
-    if ( !mpScene )
+    // Ignore if there's no body.
+    if ( mpBody == NULL )
         return;
 
     getBody()->ApplyLinearImpulse( worldImpulse, worldPoint, wake );
@@ -1391,8 +1510,8 @@ void SceneObject::applyLinearImpulse( const Vector2& worldImpulse, const Vector2
 
 void SceneObject::applyAngularImpulse( const F32 impulse, const bool wake )
 {
-    // Ignore if not in scene.
-    if ( !mpScene )
+    // Ignore if there's no body.
+    if ( mpBody == NULL )
         return;
 
     getBody()->ApplyAngularImpulse( impulse, wake );
@@ -1427,7 +1546,7 @@ void SceneObject::setDefaultDensity( const F32 density, const bool updateShapes
     if ( !updateShapes )
         return;
 
-    if ( mpScene )
+    if ( mpBody )
     {
         // Update live fixtures.
         for( U32 index = 0; index < (U32)mCollisionFixtures.size(); ++index )
@@ -1728,14 +1847,12 @@ b2Shape::Type SceneObject::getCollisionShapeType( U32 shapeIndex ) const
 
 S32 SceneObject::getCollisionShapeIndex( const b2Fixture* pFixture ) const
 {
-    // Iterate collision shapes.
-    S32 collisionShapeIndex = 0;
-    for( typeCollisionFixtureVector::const_iterator collisionShapeItr = mCollisionFixtures.begin(); collisionShapeItr != mCollisionFixtures.end(); ++collisionShapeItr, ++collisionShapeIndex )
-    {
-        // Return index if this is the collision shape we are searching for.
-        if ( pFixture == *collisionShapeItr )
-            return collisionShapeIndex;
-    }
+    // Fetch the shape index held in the fixture user data.
+    const U32 collisionShapeIndex = (U32)(size_t)pFixture->GetUserData();
+
+    // Return index if this is the collision shape we are searching for.
+    if ( collisionShapeIndex < (U32)mCollisionFixtures.size() && mCollisionFixtures[collisionShapeIndex] == pFixture )
+        return (S32)collisionShapeIndex;
 
     // Not found.
     return -1;
@@ -1743,6 +1860,30 @@ S32 SceneObject::getCollisionShapeIndex( const b2Fixture* pFixture ) const
 
 //-----------------------------------------------------------------------------
 
+b2Fixture* SceneObject::createCollisionFixture( const b2FixtureDef* pFixtureDef )
+{
+    // Promote render-only objects to a full body.
+    if ( mpBody == NULL )
+        setRenderOnly( false );
+
+    // Sanity!
+    AssertFatal( mpBody != NULL, "SceneObject::createCollisionFixture() - Cannot create a fixture without a body." );
+
+    // Create the fixture.
+    b2Fixture* pFixture = mpBody->CreateFixture( pFixtureDef );
+
+    // Store the shape index in the fixture user data.
+    // NOTE:-   This allows contacts to find the shape index without a search.
+    pFixture->SetUserData( (void*)(size_t)mCollisionFixtures.size() );
+
+    // Push fixture.
+    mCollisionFixtures.push_back( pFixture );
+
+    return pFixture;
+}
+
+//-----------------------------------------------------------------------------
+
 void SceneObject::setCollisionShapeDefinition( const U32 shapeIndex, const b2FixtureDef& fixtureDef )
 {
     // We only set specific features of a fixture definition here.
@@ -2042,6 +2183,11 @@ void SceneObject::deleteCollisionShape( const U32 shapeIndex )
     {
         mpBody->DestroyFixture( mCollisionFixtures[ shapeIndex ] );
         mCollisionFixtures.erase_fast( shapeIndex );
+
+        // Update the shape index of any fixture moved into the deleted slot.
+        if ( shapeIndex < (U32)mCollisionFixtures.size() )
+            mCollisionFixtures[shapeIndex]->SetUserData( (void*)(size_t)shapeIndex );
+
         return;
     }
 
@@ -2090,7 +2236,7 @@ S32 SceneObject::createCircleCollisionShape( const F32 radius, const b2Vec2& loc
     if ( mpScene )
     {
         // Create and push fixture.
-        mCollisionFixtures.push_back( mpBody->CreateFixture( pFixtureDef ) );
+        createCollisionFixture( pFixtureDef );
 
         // Destroy shape and fixture.
         delete pShape;
@@ -2148,7 +2294,7 @@ S32 SceneObject::createPolygonCollisionShape( const U32 pointCount, const b2Vec2
     if ( mpScene )
     {
         // Create and push fixture.
-        mCollisionFixtures.push_back( mpBody->CreateFixture( pFixtureDef ) );
+        createCollisionFixture( pFixtureDef );
 
         // Destroy shape and fixture.
         delete pShape;
@@ -2191,7 +2337,7 @@ S32 SceneObject::createPolygonBoxCollisionShape( const F32 width, const F32 heig
     if ( mpScene )
     {
         // Create and push fixture.
-        mCollisionFixtures.push_back( mpBody->CreateFixture( pFixtureDef ) );
+        createCollisionFixture( pFixtureDef );
 
         // Destroy shape and fixture.
         delete pShape;
@@ -2234,7 +2380,7 @@ S32 SceneObject::createPolygonBoxCollisionShape( const F32 width, const F32 heig
     if ( mpScene )
     {
         // Create and push fixture.
-        mCollisionFixtures.push_back( mpBody->CreateFixture( pFixtureDef ) );
+        createCollisionFixture( pFixtureDef );
 
         // Destroy shape and fixture.
         delete pShape;
@@ -2277,7 +2423,7 @@ S32 SceneObject::createPolygonBoxCollisionShape( const F32 width, const F32 heig
     if ( mpScene )
     {
         // Create and push fixture.
-        mCollisionFixtures.push_back( mpBody->CreateFixture( pFixtureDef ) );
+        createCollisionFixture( pFixtureDef );
 
         // Destroy shape and fixture.
         delete pShape;
@@ -2338,7 +2484,7 @@ S32 SceneObject::createChainCollisionShape( const U32 pointCount, const b2Vec2*
     if ( mpScene )
     {
         // Create and push fixture.
-        mCollisionFixtures.push_back( mpBody->CreateFixture( pFixtureDef ) );
+        createCollisionFixture( pFixtureDef );
 
         // Destroy shape and fixture.
         delete pShape;
@@ -2385,7 +2531,7 @@ S32 SceneObject::createChainCollisionShape(  const U32 pointCount, const b2Vec2*
     if ( mpScene )
     {
         // Create and push fixture.
-        mCollisionFixtures.push_back( mpBody->CreateFixture( pFixtureDef ) );
+        createCollisionFixture( pFixtureDef );
 
         // Destroy shape and fixture.
         delete pShape;
@@ -2479,7 +2625,7 @@ S32 SceneObject::createEdgeCollisionShape( const b2Vec2& localPositionStart, con
     if ( mpScene )
     {
         // Create and push fixture.
-        mCollisionFixtures.push_back( mpBody->CreateFixture( pFixtureDef ) );
+        createCollisionFixture( pFixtureDef );
 
         // Destroy shape and fixture.
         delete pShape;
@@ -2516,7 +2662,7 @@ S32 SceneObject::createEdgeCollisionShape(   const b2Vec2& localPositionStart, c
     if ( mpScene )
     {
         // Create and push fixture.
-        mCollisionFixtures.push_back( mpBody->CreateFixture( pFixtureDef ) );
+        createCollisionFixture( pFixtureDef );
 
         // Destroy shape and fixture.
         delete pShape;
@@ -2677,6 +2823,9 @@ void SceneObject::attachGui( GuiControl* pGuiControl, SceneWindow* pSceneWindow,
     // Set Size Gui Flag.
     mAttachedGuiSizeControl = sizeControl;
 
+    // Make sure we're ticked.
+    setTickActive();
+
     // Register Gui Control/Window References.
     mpAttachedGui->registerReference( (SimObject**)&mpAttachedGui );
     mpAttachedGuiSceneWindow->registerReference( (SimObject**)&mpAttachedGuiSceneWindow );
@@ -2832,6 +2981,7 @@ void SceneObject::copyTo( SimObject* obj )
     pSceneObject->setAwake( getAwake() );
     pSceneObject->setBullet( getBullet() );
     pSceneObject->setSleepingAllowed( getSleepingAllowed() );
+    pSceneObject->setRenderOnly( getRenderOnly() );
 
     /// Collision control.
     pSceneObject->setCollisionGroupMask( getCollisionGroupMask() );
@@ -3224,6 +3374,20 @@ void SceneObject::processDestroyNotifications( void )
 
 //-----------------------------------------------------------------------------
 
+bool SceneObject::addComponent( SimComponent* pComponent )
+{
+    // Call parent.
+    if ( !Parent::addComponent( pComponent ) )
+        return false;
+
+    // Components are updated every tick so make sure we're ticked.
+    setTickActive();
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
 void SceneObject::notifyComponentsAddToScene( void )
 {
     // Debug Profiling.
@@ -152,10 +152,15 @@ protected:
     F32                     mRenderAngle;
     bool                    mSpatialDirty;
 
+    /// Index in the scene's active set or -1 if resting.
+    S32                     mActiveIndex;
+
     /// Body.
     b2Body*                 mpBody;
     b2BodyDef               mBodyDefinition;
-    U32                     mWorldQueryKey;
+
+    /// Render-only objects have no body whilst in a scene and keep their transform in the body definition.
+    bool                    mRenderOnly;
 
     /// Collision control.
     U32                     mCollisionLayerMask;
@@ -228,6 +233,10 @@ protected:
     virtual void            OnRegisterScene( Scene* pScene );
     virtual void            OnUnregisterScene( Scene* pScene );
 
+    /// Physics body.
+    void                    createPhysicsBody( void );
+    void                    destroyPhysicsBody( void );
+
     /// Ticking.
     void                    resetTickSpatials( const bool resize = false );
     inline bool             getSpatialDirty( void ) const { return mSpatialDirty; }
@@ -256,6 +265,20 @@ public:
     virtual void            interpolateObject( const F32 timeDelta );
     inline bool             getIsEditorTickAllowed( void ) const { return mEditorTickAllowed; }
 
+    /// Active set.
+    /// Only objects in the scene's active set are ticked.  Objects join it when anything that needs a tick changes
+    /// and leave it once "getTickRequired()" reports they have come to rest.
+    virtual bool            getTickRequired( void ) const;
+    inline bool             getTickActive( void ) const                 { return mActiveIndex != -1; }
+    inline void             setTickActive( void )                       { if ( mActiveIndex == -1 && mpScene ) mpScene->addActiveSceneObject( this ); }
+
+    /// Integration jobs.
+    /// Objects may request jobs during "integrateObject()" which are then run in parallel before "postIntegrate()".
+    /// Jobs may run on worker threads so must only touch state owned by that job.
+    /// Jobs must not profile or warn; collect any warnings in the job state and report them from "postIntegrate()".
+    virtual U32             getIntegrationJobCount( void ) const { return 0; }
+    virtual void            integrateJob( const U32 jobIndex, const F32 totalTime, const F32 elapsedTime ) {}
+
     /// Render batching.
     inline void             setBatchIsolated( const bool batchIsolated ) { mBatchIsolated = batchIsolated; }
     virtual bool            getBatchIsolated( void ) { return mBatchIsolated; }
@@ -318,19 +341,19 @@ public:
 
     /// Position / Angle.
     virtual void            setPosition( const Vector2& position );
-    inline Vector2          getPosition(void) const                     { if ( mpScene ) return mpBody->GetPosition(); else return mBodyDefinition.position; }
+    inline Vector2          getPosition(void) const                     { if ( mpBody ) return mpBody->GetPosition(); else return mBodyDefinition.position; }
     inline Vector2          getRenderPosition(void) const               { return mRenderPosition; }
     inline F32              getRenderAngle(void) const                  { return mRenderAngle; }
     inline const b2Vec2*    getRenderOOBB(void) const                   { return mRenderOOBB; }
     inline const b2Vec2*    getLocalSizedOOBB( void ) const             { return mLocalSizeOOBB; }
     virtual void            setAngle( const F32 radians );
-    inline F32              getAngle(void) const                        { if ( mpScene ) return mpBody->GetAngle(); else return mBodyDefinition.angle; }
-    virtual void            setFixedAngle( const bool fixed )           { if ( mpScene ) mpBody->SetFixedRotation( fixed ); else mBodyDefinition.fixedRotation = fixed; }
-    inline bool             getFixedAngle(void) const                   { if ( mpScene ) return mpBody->IsFixedRotation(); else return mBodyDefinition.fixedRotation; }
-    b2Transform             getTransform( void ) const                  { if ( mpScene ) return mpBody->GetTransform(); else return b2Transform( mBodyDefinition.position, b2Rot(mBodyDefinition.angle) ); }
+    inline F32              getAngle(void) const                        { if ( mpBody ) return mpBody->GetAngle(); else return mBodyDefinition.angle; }
+    virtual void            setFixedAngle( const bool fixed )           { if ( mpBody ) mpBody->SetFixedRotation( fixed ); else mBodyDefinition.fixedRotation = fixed; }
+    inline bool             getFixedAngle(void) const                   { if ( mpBody ) return mpBody->IsFixedRotation(); else return mBodyDefinition.fixedRotation; }
+    b2Transform             getTransform( void ) const                  { if ( mpBody ) return mpBody->GetTransform(); else return b2Transform( mBodyDefinition.position, b2Rot(mBodyDefinition.angle) ); }
     b2Transform             getRenderTransform( void ) const            { return b2Transform( getRenderPosition(), b2Rot( getRenderAngle()) ); }
-    inline Vector2          getLocalCenter(void) const                  { if ( mpScene ) return mpBody->GetLocalCenter(); else return b2Vec2_zero; }
-    inline Vector2          getWorldCenter(void) const                  { if ( mpScene ) return mpBody->GetWorldCenter(); else return mBodyDefinition.position; }
+    inline Vector2          getLocalCenter(void) const                  { if ( mpBody ) return mpBody->GetLocalCenter(); else return b2Vec2_zero; }
+    inline Vector2          getWorldCenter(void) const                  { if ( mpBody ) return mpBody->GetWorldCenter(); else return mBodyDefinition.position; }
     Vector2                 getLocalPoint( const Vector2& worldPoint );
     Vector2                 getWorldPoint( const Vector2& localPoint );
     Vector2                 getLocalVector( const Vector2& worldVector );
@@ -341,18 +364,21 @@ public:
     /// Body.
     virtual ePhysicsProxyType getPhysicsProxyType( void ) const         { return PhysicsProxy::PHYSIC_PROXY_SCENEOBJECT; }
     inline b2Body*          getBody( void ) const                       { return mpBody; }
+    inline b2Body*          getPhysicsBody( void )                      { if ( mpBody == NULL && mpScene != NULL ) setRenderOnly( false ); return mpBody; }
+    void                    setRenderOnly( const bool renderOnly );
+    inline bool             getRenderOnly( void ) const                 { return mRenderOnly; }
     void                    setBodyType( const b2BodyType type );
-    inline b2BodyType       getBodyType(void) const                     { if ( mpScene ) return mpBody->GetType(); else return mBodyDefinition.type; }
-    inline void             setActive( const bool active )              { if ( mpScene ) mpBody->SetActive( active ); else mBodyDefinition.active = active; }
-    inline bool             getActive(void) const                       { if ( mpScene ) return mpBody->IsActive(); else return mBodyDefinition.active; }
-    inline void             setAwake( const bool awake )                { if ( mpScene ) mpBody->SetAwake( awake ); else mBodyDefinition.awake = awake; }
-    inline bool             getAwake(void) const                        { if ( mpScene ) return mpBody->IsAwake(); else return mBodyDefinition.awake; }
-    inline void             setBullet( const bool bullet )              { if ( mpScene ) mpBody->SetBullet( bullet ); else mBodyDefinition.bullet = bullet; }
-    inline bool             getBullet(void) const                       { if ( mpScene ) return mpBody->IsBullet(); else return mBodyDefinition.bullet; }
-    inline void             setSleepingAllowed( const bool allowed )    { if ( mpScene ) mpBody->SetSleepingAllowed( allowed ); else mBodyDefinition.allowSleep = allowed; }
-    inline bool             getSleepingAllowed(void) const              { if ( mpScene ) return mpBody->IsSleepingAllowed(); else return mBodyDefinition.allowSleep; }
-    inline F32              getMass( void ) const                       { if ( mpScene ) return mpBody->GetMass(); else return 0.0f; }
-    inline F32              getInertia( void ) const                    { if ( mpScene ) return mpBody->GetInertia(); else return 0.0f; }
+    inline b2BodyType       getBodyType(void) const                     { if ( mpBody ) return mpBody->GetType(); else return mBodyDefinition.type; }
+    inline void             setActive( const bool active )              { if ( mpBody ) mpBody->SetActive( active ); else mBodyDefinition.active = active; }
+    inline bool             getActive(void) const                       { if ( mpBody ) return mpBody->IsActive(); else return mBodyDefinition.active; }
+    inline void             setAwake( const bool awake )                { if ( mpBody ) mpBody->SetAwake( awake ); else mBodyDefinition.awake = awake; }
+    inline bool             getAwake(void) const                        { if ( mpBody ) return mpBody->IsAwake(); else return mBodyDefinition.awake; }
+    inline void             setBullet( const bool bullet )              { if ( mpBody ) mpBody->SetBullet( bullet ); else mBodyDefinition.bullet = bullet; }
+    inline bool             getBullet(void) const                       { if ( mpBody ) return mpBody->IsBullet(); else return mBodyDefinition.bullet; }
+    inline void             setSleepingAllowed( const bool allowed )    { if ( mpBody ) mpBody->SetSleepingAllowed( allowed ); else mBodyDefinition.allowSleep = allowed; }
+    inline bool             getSleepingAllowed(void) const              { if ( mpBody ) return mpBody->IsSleepingAllowed(); else return mBodyDefinition.allowSleep; }
+    inline F32              getMass( void ) const                       { if ( mpBody ) return mpBody->GetMass(); else return 0.0f; }
+    inline F32              getInertia( void ) const                    { if ( mpBody ) return mpBody->GetInertia(); else return 0.0f; }
 
     /// Collision control.
     void                    setCollisionAgainst( const SceneObject* pSceneObject, const bool clearMasks );
@@ -376,16 +402,16 @@ public:
     virtual void            onEndCollision( const TickContact& tickContact );
 
     /// Velocities.
-    inline void             setLinearVelocity( const Vector2& velocity ) { if ( mpScene ) mpBody->SetLinearVelocity( velocity ); else mBodyDefinition.linearVelocity = velocity; }
-    inline Vector2          getLinearVelocity(void) const               { if ( mpScene ) return mpBody->GetLinearVelocity(); else return mBodyDefinition.linearVelocity; }
-    inline Vector2          getLinearVelocityFromWorldPoint( const Vector2& worldPoint ) { if ( mpScene ) return mpBody->GetLinearVelocityFromWorldPoint( worldPoint ); else return mBodyDefinition.linearVelocity; }
-    inline Vector2          getLinearVelocityFromLocalPoint( const Vector2& localPoint ) { if ( mpScene ) return mpBody->GetLinearVelocityFromLocalPoint( localPoint ); else return mBodyDefinition.linearVelocity; }
-    inline void             setAngularVelocity( const F32 velocity )    { if ( mpScene ) mpBody->SetAngularVelocity( velocity ); else mBodyDefinition.angularVelocity = velocity; }
-    inline F32              getAngularVelocity(void) const              { if ( mpScene ) return mpBody->GetAngularVelocity(); else return mBodyDefinition.angularVelocity; }
-    inline void             setLinearDamping( const F32 damping )       { if ( mpScene ) mpBody->SetLinearDamping( damping ); else mBodyDefinition.linearDamping = damping; }
-    inline F32              getLinearDamping(void) const                { if ( mpScene ) return mpBody->GetLinearDamping(); else return mBodyDefinition.linearDamping; }
-    inline void             setAngularDamping( const F32 damping )      { if ( mpScene ) mpBody->SetAngularDamping( damping ); else mBodyDefinition.angularDamping = damping; }
-    inline F32              getAngularDamping(void) const               { if ( mpScene ) return mpBody->GetAngularDamping(); else return mBodyDefinition.angularDamping; }
+    inline void             setLinearVelocity( const Vector2& velocity ) { if ( mpBody ) mpBody->SetLinearVelocity( velocity ); else mBodyDefinition.linearVelocity = velocity; }
+    inline Vector2          getLinearVelocity(void) const               { if ( mpBody ) return mpBody->GetLinearVelocity(); else return mBodyDefinition.linearVelocity; }
+    inline Vector2          getLinearVelocityFromWorldPoint( const Vector2& worldPoint ) { if ( mpBody ) return mpBody->GetLinearVelocityFromWorldPoint( worldPoint ); else return mBodyDefinition.linearVelocity; }
+    inline Vector2          getLinearVelocityFromLocalPoint( const Vector2& localPoint ) { if ( mpBody ) return mpBody->GetLinearVelocityFromLocalPoint( localPoint ); else return mBodyDefinition.linearVelocity; }
+    inline void             setAngularVelocity( const F32 velocity )    { if ( mpBody ) mpBody->SetAngularVelocity( velocity ); else mBodyDefinition.angularVelocity = velocity; }
+    inline F32              getAngularVelocity(void) const              { if ( mpBody ) return mpBody->GetAngularVelocity(); else return mBodyDefinition.angularVelocity; }
+    inline void             setLinearDamping( const F32 damping )       { if ( mpBody ) mpBody->SetLinearDamping( damping ); else mBodyDefinition.linearDamping = damping; }
+    inline F32              getLinearDamping(void) const                { if ( mpBody ) return mpBody->GetLinearDamping(); else return mBodyDefinition.linearDamping; }
+    inline void             setAngularDamping( const F32 damping )      { if ( mpBody ) mpBody->SetAngularDamping( damping ); else mBodyDefinition.angularDamping = damping; }
+    inline F32              getAngularDamping(void) const               { if ( mpBody ) return mpBody->GetAngularDamping(); else return mBodyDefinition.angularDamping; }
 
     /// Move/Rotate to.
     bool                    moveTo( const Vector2& targetWorldPoint, const F32 speed, const bool autoStop = true, const bool warpToTarget = true );
@@ -404,8 +430,8 @@ public:
     void                    applyAngularImpulse( const F32 impulse, const bool wake = true );
 
     /// Gravity scaling.
-    inline void             setGravityScale( const F32 scale )          { if ( mpScene ) mpBody->SetGravityScale( scale ); else mBodyDefinition.gravityScale = scale; }
-    inline F32              getGravityScale(void) const                 { if ( mpScene ) return mpBody->GetGravityScale(); else return mBodyDefinition.gravityScale; }
+    inline void             setGravityScale( const F32 scale )          { if ( mpBody ) mpBody->SetGravityScale( scale ); else mBodyDefinition.gravityScale = scale; }
+    inline F32              getGravityScale(void) const                 { if ( mpBody ) return mpBody->GetGravityScale(); else return mBodyDefinition.gravityScale; }
 
     /// General collision shape access.
     void                    deleteCollisionShape( const U32 shapeIndex );
@@ -475,7 +501,7 @@ public:
     Vector2                 getEdgeCollisionShapeAdjacentEnd( const U32 shapeIndex ) const;
 
     /// Render visibility.
-    inline void             setVisible( const bool status )             { mVisible = status; }
+    inline void             setVisible( const bool status )             { if ( mpScene && status != mVisible ) mpScene->updateVisibleObjectCount( status ); mVisible = status; }
     inline bool             getVisible(void) const                      { return mVisible; }
 
     /// Render blending.
@@ -506,11 +532,11 @@ public:
     virtual void            onInputEvent( StringTableEntry name, const GuiEvent& event, const Vector2& worldMousePoint );
 
     // Script callbacks.
-    inline void             setUpdateCallback( bool status )            { mUpdateCallback = status; }
+    inline void             setUpdateCallback( bool status )            { mUpdateCallback = status; if ( status ) setTickActive(); }
     inline bool             getUpdateCallback( void ) const             { return mUpdateCallback; }
     inline void             setCollisionCallback( const bool status )   { mCollisionCallback = status; }
     inline bool             getCollisionCallback(void) const            { return mCollisionCallback; }
-    inline void             setSleepingCallback( bool status )          { mSleepingCallback = status; }
+    inline void             setSleepingCallback( bool status )          { mSleepingCallback = status; if ( status ) setTickActive(); }
     inline bool             getSleepingCallback( void ) const           { return mSleepingCallback; }
 
     /// Debug mode.
@@ -519,7 +545,7 @@ public:
     inline U32              getDebugMask( void ) const                  { return mDebugMask; }
 
     /// Camera mounting.
-    inline void             addCameraMountReference( SceneWindow* pAttachedCamera ) { mpAttachedCamera = pAttachedCamera; }
+    inline void             addCameraMountReference( SceneWindow* pAttachedCamera ) { mpAttachedCamera = pAttachedCamera; setTickActive(); }
     inline void             removeCameraMountReference( void )          { mpAttachedCamera = NULL; }
     inline void             dismountCamera( void )                      { if ( mpAttachedCamera ) mpAttachedCamera->dismountMe( this ); }
 
@@ -549,6 +575,7 @@ public:
     void                    processDestroyNotifications( void );
 
     /// Component notifications.
+    virtual bool            addComponent( SimComponent* pComponent );
     void                    notifyComponentsAddToScene( void );
     void                    notifyComponentsRemoveFromScene( void );
     void                    notifyComponentsUpdate( void );
@@ -556,8 +583,6 @@ public:
     /// Miscellaneous.
     inline const char*      scriptThis(void) const                      { return Con::getIntArg(getId()); }
     inline bool             getIsAlwaysInScope(void) const              { return mAlwaysInScope; }
-    inline void             setWorldQueryKey( const U32 key )           { mWorldQueryKey = key; }
-    inline U32              getWorldQueryKey( void ) const              { return mWorldQueryKey; }
     static U32              getGlobalSceneObjectCount( void );
     inline U32              getSerialId( void ) const                   { return mSerialId; }
 
@@ -581,6 +606,7 @@ protected:
     S32                     copyPolygonCollisionShapeTo( SceneObject* pSceneObject, const b2FixtureDef& fixtureDef ) const;
     S32                     copyChainCollisionShapeTo( SceneObject* pSceneObject, const b2FixtureDef& fixtureDef ) const;
     S32                     copyEdgeCollisionShapeTo( SceneObject* pSceneObject, const b2FixtureDef& fixtureDef ) const;
+    b2Fixture*              createCollisionFixture( const b2FixtureDef* pFixtureDef );
 
 protected:
     /// Lifetime.
@@ -650,6 +676,8 @@ protected:
     static bool             setSleepingAllowed(void* obj, const char* data) { static_cast<SceneObject*>(obj)->setSleepingAllowed(dAtob(data)); return false; }
     static const char*      getSleepingAllowed(void* obj, const char* data) { return Con::getBoolArg( static_cast<SceneObject*>(obj)->getSleepingAllowed() ); }
     static bool             writeSleepingAllowed( void* obj, StringTableEntry pFieldName ) { return static_cast<SceneObject*>(obj)->getSleepingAllowed() == false; }
+    static bool             setRenderOnly(void* obj, const char* data)      { static_cast<SceneObject*>(obj)->setRenderOnly(dAtob(data)); return false; }
+    static bool             writeRenderOnly( void* obj, StringTableEntry pFieldName ) { return static_cast<SceneObject*>(obj)->getRenderOnly() == true; }
 
     /// Collision control.
     static bool             setDefaultDensity(void* obj, const char* data)  { static_cast<SceneObject*>(obj)->setDefaultDensity(dAtof(data)); return false; }
@@ -686,6 +714,7 @@ protected:
     static bool             writeGravityScale( void* obj, StringTableEntry pFieldName ) { return mNotEqual(static_cast<SceneObject*>(obj)->getGravityScale(), 1.0f); }
 
     /// Render visibility.
+    static bool             setVisible(void* obj, const char* data)     { static_cast<SceneObject*>(obj)->setVisible(dAtob(data)); return false; }
     static bool             writeVisible( void* obj, StringTableEntry pFieldName ) { return static_cast<SceneObject*>(obj)->getVisible() == false; }
 
     /// Render blending.
@@ -706,6 +735,8 @@ protected:
     static bool             writePickingAllowed( void* obj, StringTableEntry pFieldName ) { return static_cast<SceneObject*>(obj)->getPickingAllowed() == false; }    
 
     /// Script callbacks.
+    static bool             setUpdateCallback(void* obj, const char* data) { static_cast<SceneObject*>(obj)->setUpdateCallback(dAtob(data)); return false; }
+    static bool             setSleepingCallback(void* obj, const char* data) { static_cast<SceneObject*>(obj)->setSleepingCallback(dAtob(data)); return false; }
     static bool             writeUpdateCallback( void* obj, StringTableEntry pFieldName ) { return static_cast<SceneObject*>(obj)->getUpdateCallback() == true; }
     static bool             writeCollisionCallback( void* obj, StringTableEntry pFieldName ) { return static_cast<SceneObject*>(obj)->getCollisionCallback() == true; }
     static bool             writeSleepingCallback( void* obj, StringTableEntry pFieldName ) { return static_cast<SceneObject*>(obj)->getSleepingCallback() == true; }
@@ -888,6 +888,25 @@ ConsoleMethod(SceneObject, getSleepingAllowed, bool, 2, 2,   "() Gets whether th
 
 //-----------------------------------------------------------------------------
 
+ConsoleMethod(SceneObject, setRenderOnly, void, 2, 3,       "([bool status?]) - Sets whether the object is render-only or not.\n"
+                                                                "A render-only object has no physics body and so cannot collide, move under physics or be jointed.\n"
+                                                                "The object cannot become render-only if it has collision shapes or joints.\n"
+                                                                "@param status - Whether the object is render-only or not (defaults to true).\n"
+                                                                "@return No return Value.")
+{
+    object->setRenderOnly( argc > 2 ? dAtob(argv[2]) : true );
+}
+
+//-----------------------------------------------------------------------------
+
+ConsoleMethod(SceneObject, getRenderOnly, bool, 2, 2,       "() Gets whether the object is render-only or not.\n"
+                                                                "@return (bool status) Whether the object is render-only or not.")
+{
+    return object->getRenderOnly();
+}
+
+//-----------------------------------------------------------------------------
+
 ConsoleMethod(SceneObject, getMass, F32, 2, 2,               "() Gets the total mass of the body.\n"
                                                                 "@return (float mass) The total mass of the body.  If object is not in a scene then mass is always zero.")
 {
@@ -0,0 +1,614 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _TILE_LAYER_H_
+#include "2d/sceneobject/TileLayer.h"
+#endif
+
+#ifndef _SCENE_RENDER_QUEUE_H_
+#include "2d/scene/SceneRenderQueue.h"
+#endif
+
+// Script bindings.
+#include "TileLayer_ScriptBinding.h"
+
+//------------------------------------------------------------------------------
+
+IMPLEMENT_CONOBJECT(TileLayer);
+
+//------------------------------------------------------------------------------
+
+TileLayer::TileLayer() :
+    mGridWidth(0),
+    mGridHeight(0),
+    mCellSize(Vector2::getOne()),
+    mGridOffset(Vector2::getZero()),
+    mIsometric(false),
+    mTileCount(1),
+    mCellPadding(1)
+{
+    // Tile id zero is always empty.
+    mTileTilesets.push_back( 0 );
+
+    // Tile layers have no collision of their own.
+    setBodyType( b2_staticBody );
+
+    updateLocalExtents();
+}
+
+//------------------------------------------------------------------------------
+
+TileLayer::~TileLayer()
+{
+}
+
+//------------------------------------------------------------------------------
+
+void TileLayer::initPersistFields()
+{
+    // Call parent.
+    Parent::initPersistFields();
+
+    addProtectedField("GridWidth", TypeS32, Offset(mGridWidth, TileLayer), &setGridWidth, &defaultProtectedGetFn, &defaultProtectedWriteFn, "The number of cells across the grid.");
+    addProtectedField("GridHeight", TypeS32, Offset(mGridHeight, TileLayer), &setGridHeight, &defaultProtectedGetFn, &defaultProtectedWriteFn, "The number of cells down the grid.");
+    addProtectedField("CellSize", TypeVector2, Offset(mCellSize, TileLayer), &setCellSize, &defaultProtectedGetFn, &writeCellSize, "The size of each cell.");
+    addProtectedField("GridOffset", TypeVector2, Offset(mGridOffset, TileLayer), &setGridOffset, &defaultProtectedGetFn, &writeGridOffset, "The local offset of the grid origin.");
+    addProtectedField("Isometric", TypeBool, Offset(mIsometric, TileLayer), &setIsometric, &defaultProtectedGetFn, &writeIsometric, "Whether the cells are placed isometrically or not.");
+}
+
+//------------------------------------------------------------------------------
+
+void TileLayer::copyTo(SimObject* object)
+{
+    // Call to parent.
+    Parent::copyTo(object);
+
+    // Cast to tile layer.
+    TileLayer* pTileLayer = static_cast<TileLayer*>(object);
+
+    // Sanity!
+    AssertFatal(pTileLayer != NULL, "TileLayer::copyTo() - Object is not the correct type.");
+
+    // Copy the grid.
+    pTileLayer->mGridWidth = mGridWidth;
+    pTileLayer->mGridHeight = mGridHeight;
+    pTileLayer->mCellSize = mCellSize;
+    pTileLayer->mGridOffset = mGridOffset;
+    pTileLayer->mIsometric = mIsometric;
+    pTileLayer->mTiles = mTiles;
+    pTileLayer->mTileFlags = mTileFlags;
+    pTileLayer->mTilesets = mTilesets;
+    pTileLayer->mTileTilesets = mTileTilesets;
+    pTileLayer->mTileCount = mTileCount;
+    pTileLayer->mCellPadding = mCellPadding;
+    pTileLayer->updateLocalExtents();
+}
+
+//------------------------------------------------------------------------------
+
+void TileLayer::setGridSize( const U32 width, const U32 height )
+{
+    mGridWidth = width;
+    mGridHeight = height;
+
+    // Resize and clear the tiles.
+    const U32 cellCount = mGridWidth * mGridHeight;
+    mTiles.setSize( cellCount );
+    if ( cellCount > 0 )
+        dMemset( mTiles.address(), 0, cellCount * sizeof(U16) );
+
+    // Flip flags are only allocated when a flipped tile is set.
+    mTileFlags.clear();
+
+    updateLocalExtents();
+}
+
+//------------------------------------------------------------------------------
+
+void TileLayer::setCellSize( const Vector2& cellSize )
+{
+    // Sanity!
+    if ( cellSize.x <= 0.0f || cellSize.y <= 0.0f )
+    {
+        Con::warnf("TileLayer::setCellSize() - Invalid cell size of '%g,%g'.", cellSize.x, cellSize.y );
+        return;
+    }
+
+    mCellSize = cellSize;
+
+    updateLocalExtents();
+}
+
+//------------------------------------------------------------------------------
+
+void TileLayer::setGridOffset( const Vector2& gridOffset )
+{
+    mGridOffset = gridOffset;
+
+    updateLocalExtents();
+}
+
+//------------------------------------------------------------------------------
+
+void TileLayer::setIsometric( const bool isometric )
+{
+    mIsometric = isometric;
+
+    updateLocalExtents();
+}
+
+//------------------------------------------------------------------------------
+
+S32 TileLayer::addTileset( const char* pImageAssetId, const Vector2& tileSize, const Vector2& tileOffset )
+{
+    // Sanity!
+    AssertFatal( pImageAssetId != NULL, "TileLayer::addTileset() - Cannot use a NULL image asset Id." );
+
+    // Finish if too many tilesets.
+    if ( mTilesets.size() >= (S32)MaxTilesets )
+    {
+        Con::warnf("TileLayer::addTileset() - Cannot add more than %d tilesets.", MaxTilesets );
+        return -1;
+    }
+
+    // Fetch the image asset.
+    AssetPtr<ImageAsset> imageAsset( pImageAssetId );
+
+    // Finish if the image asset is not valid.
+    if ( imageAsset.isNull() )
+    {
+        Con::warnf("TileLayer::addTileset() - Could not find image asset '%s'.", pImageAssetId );
+        return -1;
+    }
+
+    const U32 frameCount = imageAsset->getFrameCount();
+
+    // Finish if the tile ids would not fit.
+    if ( mTileCount + frameCount > (U32)U16_MAX + 1 )
+    {
+        Con::warnf("TileLayer::addTileset() - Image asset '%s' has too many frames to add.", pImageAssetId );
+        return -1;
+    }
+
+    // Add the tileset.
+    Tileset tileset;
+    tileset.mImageAsset = imageAsset;
+    tileset.mFirstTile = mTileCount;
+    tileset.mFrameCount = frameCount;
+    tileset.mTileSize = tileSize;
+    tileset.mTileOffset = tileOffset;
+    mTilesets.push_back( tileset );
+
+    // Map its tile ids back to it.
+    const U8 tilesetIndex = (U8)(mTilesets.size()-1);
+    mTileTilesets.setSize( mTileCount + frameCount );
+    dMemset( mTileTilesets.address() + mTileCount, tilesetIndex, frameCount );
+    mTileCount += frameCount;
+
+    // Pad the visible range by the largest overhang.
+    const Vector2 cellStep = mIsometric ? getIsometricStep( mCellSize ) : mCellSize;
+    const F32 overhang = getMax( (mFabs(tileOffset.x) + tileSize.x * 0.5f) / cellStep.x, (mFabs(tileOffset.y) + tileSize.y * 0.5f) / cellStep.y );
+    mCellPadding = getMax( mCellPadding, (S32)mCeil(overhang) );
+
+    updateLocalExtents();
+
+    return tilesetIndex;
+}
+
+//------------------------------------------------------------------------------
+
+void TileLayer::clearTilesets( void )
+{
+    // The tile ids are meaningless without their tilesets.
+    clearTiles();
+
+    mTilesets.clear();
+    mTileTilesets.setSize( 1 );
+    mTileTilesets[0] = 0;
+    mTileCount = 1;
+    mCellPadding = 1;
+
+    updateLocalExtents();
+}
+
+//------------------------------------------------------------------------------
+
+bool TileLayer::setTile( const U32 x, const U32 y, const U32 tilesetIndex, const U32 frame, const bool flipX, const bool flipY )
+{
+    // Finish if invalid cell.
+    if ( !isCellValid(x, y) )
+    {
+        Con::warnf("TileLayer::setTile() - Invalid cell of '%d,%d'.", x, y );
+        return false;
+    }
+
+    // Finish if invalid tileset.
+    if ( tilesetIndex >= (U32)mTilesets.size() )
+    {
+        Con::warnf("TileLayer::setTile() - Invalid tileset index of '%d'.", tilesetIndex );
+        return false;
+    }
+
+    const Tileset& tileset = mTilesets[tilesetIndex];
+
+    // Finish if invalid frame.
+    if ( frame >= tileset.mFrameCount )
+    {
+        Con::warnf("TileLayer::setTile() - Invalid frame of '%d'.", frame );
+        return false;
+    }
+
+    const U32 cellIndex = y * mGridWidth + x;
+    mTiles[cellIndex] = (U16)(tileset.mFirstTile + frame);
+
+    // Set the flip flags, allocating them if this is the first flipped tile.
+    const U8 flags = (flipX ? TILE_FLIP_X : 0) | (flipY ? TILE_FLIP_Y : 0);
+    if ( flags != 0 && mTileFlags.size() == 0 )
+    {
+        mTileFlags.setSize( mTiles.size() );
+        dMemset( mTileFlags.address(), 0, mTileFlags.size() );
+    }
+    if ( mTileFlags.size() > 0 )
+        mTileFlags[cellIndex] = flags;
+
+    return true;
+}
+
+//------------------------------------------------------------------------------
+
+void TileLayer::clearTile( const U32 x, const U32 y )
+{
+    // Finish if invalid cell.
+    if ( !isCellValid(x, y) )
+        return;
+
+    const U32 cellIndex = y * mGridWidth + x;
+    mTiles[cellIndex] = EmptyTile;
+
+    if ( mTileFlags.size() > 0 )
+        mTileFlags[cellIndex] = 0;
+}
+
+//------------------------------------------------------------------------------
+
+void TileLayer::clearTiles( void )
+{
+    if ( mTiles.size() > 0 )
+        dMemset( mTiles.address(), 0, mTiles.size() * sizeof(U16) );
+
+    mTileFlags.clear();
+}
+
+//------------------------------------------------------------------------------
+
+S32 TileLayer::getTileTileset( const U32 x, const U32 y ) const
+{
+    const U16 tile = getTile( x, y );
+
+    return tile == EmptyTile ? -1 : mTileTilesets[tile];
+}
+
+//------------------------------------------------------------------------------
+
+S32 TileLayer::getTileFrame( const U32 x, const U32 y ) const
+{
+    const U16 tile = getTile( x, y );
+
+    return tile == EmptyTile ? -1 : tile - mTilesets[mTileTilesets[tile]].mFirstTile;
+}
+
+//------------------------------------------------------------------------------
+
+Vector2 TileLayer::getCellLocalPosition( const U32 x, const U32 y ) const
+{
+    // Rows are numbered from the top of the grid.
+    const F32 row = (F32)(mGridHeight - y);
+
+    if ( mIsometric )
+    {
+        const Vector2 cellStep = getIsometricStep( mCellSize );
+        const F32 originY = mGridHeight * cellStep.y - cellStep.y;
+
+        return Vector2( mGridOffset.x + (x - row) * cellStep.x, mGridOffset.y + originY - (x + row) * cellStep.y );
+    }
+
+    return Vector2( mGridOffset.x + x * mCellSize.x, mGridOffset.y + row * mCellSize.y );
+}
+
+//------------------------------------------------------------------------------
+
+bool TileLayer::getCellRange( const b2AABB& localAABB, S32& minX, S32& minY, S32& maxX, S32& maxY ) const
+{
+    // Finish if no cells.
+    if ( mGridWidth == 0 || mGridHeight == 0 )
+        return false;
+
+    const Vector2 corners[4] =
+    {
+        Vector2( localAABB.lowerBound.x, localAABB.lowerBound.y ),
+        Vector2( localAABB.upperBound.x, localAABB.lowerBound.y ),
+        Vector2( localAABB.upperBound.x, localAABB.upperBound.y ),
+        Vector2( localAABB.lowerBound.x, localAABB.upperBound.y )
+    };
+
+    F32 cellMinX = F32_MAX;
+    F32 cellMinY = F32_MAX;
+    F32 cellMaxX = -F32_MAX;
+    F32 cellMaxY = -F32_MAX;
+
+    for ( U32 n = 0; n < 4; ++n )
+    {
+        // Invert the cell placement.
+        const Vector2 local = corners[n] - mGridOffset;
+
+        F32 cellX;
+        F32 cellY;
+
+        if ( mIsometric )
+        {
+            const Vector2 cellStep = getIsometricStep( mCellSize );
+            const F32 originY = mGridHeight * cellStep.y - cellStep.y;
+            const F32 difference = local.x / cellStep.x;
+            const F32 sum = (originY - local.y) / cellStep.y;
+            cellX = (sum + difference) * 0.5f;
+            cellY = mGridHeight - (sum - difference) * 0.5f;
+        }
+        else
+        {
+            cellX = local.x / mCellSize.x;
+            cellY = mGridHeight - local.y / mCellSize.y;
+        }
+
+        cellMinX = getMin( cellMinX, cellX );
+        cellMinY = getMin( cellMinY, cellY );
+        cellMaxX = getMax( cellMaxX, cellX );
+        cellMaxY = getMax( cellMaxY, cellY );
+    }
+
+    // Pad by the largest tile overhang.
+    minX = getMax( (S32)mFloor(cellMinX) - mCellPadding, 0 );
+    minY = getMax( (S32)mFloor(cellMinY) - mCellPadding, 0 );
+    maxX = getMin( (S32)mCeil(cellMaxX) + mCellPadding, (S32)mGridWidth - 1 );
+    maxY = getMin( (S32)mCeil(cellMaxY) + mCellPadding, (S32)mGridHeight - 1 );
+
+    return minX <= maxX && minY <= maxY;
+}
+
+//------------------------------------------------------------------------------
+
+void TileLayer::scenePrepareRender( const SceneRenderState* pSceneRenderState, SceneRenderQueue* pSceneRenderQueue )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(TileLayer_PrepareRender);
+
+    // Fetch the visible cell range.
+    S32 minX, minY, maxX, maxY;
+    if ( !getCellRange( calculateLocalAABB( pSceneRenderState->mRenderAABB ), minX, minY, maxX, maxY ) )
+        return;
+
+    // Finish if there are no tiles in view.
+    bool tileVisible = false;
+    for ( S32 y = minY; y <= maxY && !tileVisible; ++y )
+    {
+        const U16* pTile = mTiles.address() + y * mGridWidth + minX;
+
+        for ( S32 x = minX; x <= maxX; ++x, ++pTile )
+        {
+            if ( *pTile != EmptyTile )
+            {
+                tileVisible = true;
+                break;
+            }
+        }
+    }
+
+    if ( !tileVisible )
+        return;
+
+    // Create a single render request so the tiles are submitted in order whatever their tileset.
+    Scene::createDefaultRenderRequest( pSceneRenderQueue, this );
+}
+
+//------------------------------------------------------------------------------
+
+void TileLayer::sceneRender( const SceneRenderState* pSceneRenderState, const SceneRenderRequest* pSceneRenderRequest, BatchRender* pBatchRenderer )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(TileLayer_Render);
+
+    // Fetch the visible cell range.
+    S32 minX, minY, maxX, maxY;
+    if ( !getCellRange( calculateLocalAABB( pSceneRenderState->mRenderAABB ), minX, minY, maxX, maxY ) )
+        return;
+
+    const b2Transform renderTransform = getRenderTransform();
+
+    // Calculate the render state of each tileset.
+    mTilesetRenders.setSize( mTilesets.size() );
+    for ( S32 tilesetIndex = 0; tilesetIndex < mTilesets.size(); ++tilesetIndex )
+    {
+        Tileset& tileset = mTilesets[tilesetIndex];
+        TilesetRender& tilesetRender = mTilesetRenders[tilesetIndex];
+
+        // Tilesets that cannot render have their tiles skipped.
+        tilesetRender.mpImageAsset = tileset.mImageAsset.isNull() || !tileset.mImageAsset->isAssetValid() ? NULL : (ImageAsset*)tileset.mImageAsset;
+        tilesetRender.mTileOffset = b2Mul( renderTransform.q, tileset.mTileOffset );
+        tilesetRender.mHalfAxisX = b2Mul( renderTransform.q, b2Vec2( tileset.mTileSize.x * 0.5f, 0.0f ) );
+        tilesetRender.mHalfAxisY = b2Mul( renderTransform.q, b2Vec2( 0.0f, tileset.mTileSize.y * 0.5f ) );
+    }
+
+    // Calculate the world steps between cells.
+    Vector2 stepX;
+    Vector2 stepY;
+    if ( mIsometric )
+    {
+        const Vector2 cellStep = getIsometricStep( mCellSize );
+        stepX = b2Mul( renderTransform.q, b2Vec2( cellStep.x, -cellStep.y ) );
+        stepY = b2Mul( renderTransform.q, b2Vec2( cellStep.x, cellStep.y ) );
+    }
+    else
+    {
+        stepX = b2Mul( renderTransform.q, b2Vec2( mCellSize.x, 0.0f ) );
+        stepY = b2Mul( renderTransform.q, b2Vec2( 0.0f, -mCellSize.y ) );
+    }
+
+    // Calculate the world position of the first visible cell.
+    const Vector2 firstPosition = b2Mul( renderTransform, getCellLocalPosition( minX, minY ) );
+
+    if ( mIsometric )
+    {
+        // Isometric cells further down the screen are in front so walk the diagonals of equal depth from the back.
+        for ( S32 depth = minX - maxY; depth <= maxX - minY; ++depth )
+        {
+            const S32 startX = getMax( minX, minY + depth );
+            const S32 endX = getMin( maxX, maxY + depth );
+
+            for ( S32 x = startX; x <= endX; ++x )
+            {
+                const S32 y = x - depth;
+                submitTile( y * mGridWidth + x, firstPosition + (F32)(x - minX) * stepX + (F32)(y - minY) * stepY, pBatchRenderer );
+            }
+        }
+    }
+    else
+    {
+        // Orthogonal rows are walked from the top.
+        Vector2 rowPosition = firstPosition;
+        for ( S32 y = minY; y <= maxY; ++y, rowPosition += stepY )
+        {
+            const U32 rowIndex = y * mGridWidth;
+            Vector2 cellPosition = rowPosition;
+
+            for ( S32 x = minX; x <= maxX; ++x, cellPosition += stepX )
+            {
+                submitTile( rowIndex + x, cellPosition, pBatchRenderer );
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+
+void TileLayer::submitTile( const U32 cellIndex, const Vector2& cellPosition, BatchRender* pBatchRenderer )
+{
+    const U16 tile = mTiles[cellIndex];
+
+    // Skip if empty.
+    if ( tile == EmptyTile )
+        return;
+
+    const U8 tilesetIndex = mTileTilesets[tile];
+    const TilesetRender& tilesetRender = mTilesetRenders[tilesetIndex];
+
+    // Skip if the tileset cannot render.
+    if ( tilesetRender.mpImageAsset == NULL )
+        return;
+
+    // Fetch texel area.
+    ImageAsset::FrameArea::TexelArea texelArea = tilesetRender.mpImageAsset->getImageFrameArea( tile - mTilesets[tilesetIndex].mFirstTile ).mTexelArea;
+
+    // Flip texture coordinates appropriately.
+    if ( mTileFlags.size() > 0 )
+    {
+        const U8 flags = mTileFlags[cellIndex];
+        texelArea.setFlip( (flags & TILE_FLIP_X) != 0, (flags & TILE_FLIP_Y) != 0 );
+    }
+
+    const Vector2& texLower = texelArea.mTexelLower;
+    const Vector2& texUpper = texelArea.mTexelUpper;
+    const Vector2 position = cellPosition + tilesetRender.mTileOffset;
+    const Vector2& halfAxisX = tilesetRender.mHalfAxisX;
+    const Vector2& halfAxisY = tilesetRender.mHalfAxisY;
+
+    // Submit batched quad.
+    pBatchRenderer->SubmitQuad(
+        position - halfAxisX - halfAxisY,
+        position + halfAxisX - halfAxisY,
+        position + halfAxisX + halfAxisY,
+        position - halfAxisX + halfAxisY,
+        Vector2( texLower.x, texUpper.y ),
+        Vector2( texUpper.x, texUpper.y ),
+        Vector2( texUpper.x, texLower.y ),
+        Vector2( texLower.x, texLower.y ),
+        tilesetRender.mpImageAsset->getImageTexture() );
+}
+
+//------------------------------------------------------------------------------
+
+void TileLayer::updateLocalExtents( void )
+{
+    // Default to a unit size when there are no cells.
+    if ( mGridWidth == 0 || mGridHeight == 0 )
+    {
+        setSize( Vector2::getOne() );
+        return;
+    }
+
+    // The cell placement is linear so the corner cells bound the grid.
+    b2AABB localAABB;
+    localAABB.lowerBound = getCellLocalPosition( 0, 0 );
+    localAABB.upperBound = localAABB.lowerBound;
+
+    const Vector2 corners[3] =
+    {
+        getCellLocalPosition( mGridWidth-1, 0 ),
+        getCellLocalPosition( 0, mGridHeight-1 ),
+        getCellLocalPosition( mGridWidth-1, mGridHeight-1 )
+    };
+
+    for ( U32 n = 0; n < 3; ++n )
+    {
+        localAABB.lowerBound = b2Min( localAABB.lowerBound, corners[n] );
+        localAABB.upperBound = b2Max( localAABB.upperBound, corners[n] );
+    }
+
+    // Expand by the largest tile.
+    Vector2 tileExtent( mCellSize.x * 0.5f, mCellSize.y * 0.5f );
+    for ( typeTilesetVector::iterator tilesetItr = mTilesets.begin(); tilesetItr != mTilesets.end(); ++tilesetItr )
+    {
+        tileExtent.x = getMax( tileExtent.x, mFabs(tilesetItr->mTileOffset.x) + tilesetItr->mTileSize.x * 0.5f );
+        tileExtent.y = getMax( tileExtent.y, mFabs(tilesetItr->mTileOffset.y) + tilesetItr->mTileSize.y * 0.5f );
+    }
+    localAABB.lowerBound -= tileExtent;
+    localAABB.upperBound += tileExtent;
+
+    // The size is centered on the position so use the largest extent either side.
+    setSize( Vector2(
+        getMax( mFabs(localAABB.lowerBound.x), mFabs(localAABB.upperBound.x) ) * 2.0f,
+        getMax( mFabs(localAABB.lowerBound.y), mFabs(localAABB.upperBound.y) ) * 2.0f ) );
+}
+
+//------------------------------------------------------------------------------
+
+b2AABB TileLayer::calculateLocalAABB( const b2AABB& renderAABB )
+{
+    // Calculate local OOBB.
+    b2Vec2 localOOBB[4];
+    CoreMath::mAABBtoOOBB( renderAABB, localOOBB );
+    CoreMath::mCalculateInverseOOBB( localOOBB, getRenderTransform(), localOOBB );
+
+    // Calculate local AABB.
+    b2AABB localAABB;
+    CoreMath::mOOBBtoAABB( localOOBB, localAABB );
+
+    return localAABB;
+}
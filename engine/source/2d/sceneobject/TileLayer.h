@@ -0,0 +1,176 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _TILE_LAYER_H_
+#define _TILE_LAYER_H_
+
+#ifndef _SCENE_OBJECT_H_
+#include "2d/sceneobject/SceneObject.h"
+#endif
+
+#ifndef _IMAGE_ASSET_H_
+#include "2d/assets/ImageAsset.h"
+#endif
+
+#ifndef _ASSET_PTR_H_
+#include "assets/assetPtr.h"
+#endif
+
+//------------------------------------------------------------------------------
+
+/// A dense grid of tiles rendered directly into the batch renderer.
+///
+/// Each cell is a single packed tile id (zero is empty) rather than a sprite so a
+/// layer costs two bytes per cell.  The visible cell range is calculated from the
+/// render area arithmetically and the tiles in it are submitted back to front so
+/// overlapping tiles from different tilesets are drawn in the correct order.
+///
+/// Rows are numbered from the top of the grid.  Orthogonal cells are placed on a
+/// regular grid whereas isometric cells are placed on a diamond where each step along
+/// a column or row moves half the cell width across and half the cell height down
+/// (matching the TMX isometric layout whatever the aspect of the cells).
+class TileLayer : public SceneObject
+{
+    typedef SceneObject Parent;
+
+public:
+    /// Empty tile id.
+    static const U16 EmptyTile = 0;
+
+    /// Maximum number of tilesets a layer can reference.
+    static const U32 MaxTilesets = 255;
+
+    /// Tile flip flags.
+    enum TileFlip
+    {
+        TILE_FLIP_X = BIT(0),
+        TILE_FLIP_Y = BIT(1),
+    };
+
+    struct Tileset
+    {
+        AssetPtr<ImageAsset>    mImageAsset;
+        U32                     mFirstTile;
+        U32                     mFrameCount;
+        Vector2                 mTileSize;
+        Vector2                 mTileOffset;
+    };
+
+private:
+    typedef Vector<Tileset> typeTilesetVector;
+
+    /// Tileset state used whilst rendering.
+    struct TilesetRender
+    {
+        ImageAsset*             mpImageAsset;
+        Vector2                 mTileOffset;
+        Vector2                 mHalfAxisX;
+        Vector2                 mHalfAxisY;
+    };
+
+    /// Grid.
+    U32                 mGridWidth;
+    U32                 mGridHeight;
+    Vector2             mCellSize;
+    Vector2             mGridOffset;
+    bool                mIsometric;
+
+    /// Packed tile ids (row-major) and optional flip flags.
+    Vector<U16>         mTiles;
+    Vector<U8>          mTileFlags;
+
+    /// Tilesets and a tile id to tileset lookup.
+    typeTilesetVector   mTilesets;
+    Vector<U8>          mTileTilesets;
+    U32                 mTileCount;
+
+    /// Largest tile overhang (in cells) used to pad the visible range.
+    S32                 mCellPadding;
+
+    /// Render state for each tileset.
+    Vector<TilesetRender> mTilesetRenders;
+
+public:
+    TileLayer();
+    virtual ~TileLayer();
+
+    static void initPersistFields();
+    virtual void copyTo(SimObject* object);
+
+    /// Grid.
+    void setGridSize( const U32 width, const U32 height );
+    inline U32 getGridWidth( void ) const                   { return mGridWidth; }
+    inline U32 getGridHeight( void ) const                  { return mGridHeight; }
+    void setCellSize( const Vector2& cellSize );
+    inline const Vector2& getCellSize( void ) const         { return mCellSize; }
+    void setGridOffset( const Vector2& gridOffset );
+    inline const Vector2& getGridOffset( void ) const       { return mGridOffset; }
+    void setIsometric( const bool isometric );
+    inline bool getIsometric( void ) const                  { return mIsometric; }
+
+    /// Tilesets.
+    S32 addTileset( const char* pImageAssetId, const Vector2& tileSize, const Vector2& tileOffset );
+    inline U32 getTilesetCount( void ) const                { return (U32)mTilesets.size(); }
+    inline const Tileset& getTileset( const U32 tilesetIndex ) const { return mTilesets[tilesetIndex]; }
+    void clearTilesets( void );
+
+    /// Tiles.
+    bool setTile( const U32 x, const U32 y, const U32 tilesetIndex, const U32 frame, const bool flipX = false, const bool flipY = false );
+    void clearTile( const U32 x, const U32 y );
+    void clearTiles( void );
+    inline U16 getTile( const U32 x, const U32 y ) const    { return isCellValid(x, y) ? mTiles[y * mGridWidth + x] : EmptyTile; }
+    S32 getTileTileset( const U32 x, const U32 y ) const;
+    S32 getTileFrame( const U32 x, const U32 y ) const;
+    inline bool isCellValid( const U32 x, const U32 y ) const { return x < mGridWidth && y < mGridHeight; }
+
+    /// Cell placement.
+    static inline Vector2 getIsometricStep( const Vector2& cellSize ) { return Vector2( cellSize.x * 0.5f, cellSize.y * 0.5f ); }
+    Vector2 getCellLocalPosition( const U32 x, const U32 y ) const;
+    bool getCellRange( const b2AABB& localAABB, S32& minX, S32& minY, S32& maxX, S32& maxY ) const;
+
+    /// Render.
+    virtual bool canPrepareRender( void ) const             { return true; }
+    virtual bool validRender( void ) const                  { return mTilesets.size() > 0; }
+    virtual bool shouldRender( void ) const                 { return true; }
+    virtual void scenePrepareRender( const SceneRenderState* pSceneRenderState, SceneRenderQueue* pSceneRenderQueue );
+    virtual void sceneRender( const SceneRenderState* pSceneRenderState, const SceneRenderRequest* pSceneRenderRequest, BatchRender* pBatchRenderer );
+
+    /// Declare Console Object.
+    DECLARE_CONOBJECT( TileLayer );
+
+private:
+    void updateLocalExtents( void );
+    b2AABB calculateLocalAABB( const b2AABB& renderAABB );
+    void submitTile( const U32 cellIndex, const Vector2& cellPosition, BatchRender* pBatchRenderer );
+
+protected:
+    static bool setGridWidth(void* obj, const char* data)           { TileLayer* pTileLayer = static_cast<TileLayer*>(obj); pTileLayer->setGridSize( dAtoi(data), pTileLayer->getGridHeight() ); return false; }
+    static bool setGridHeight(void* obj, const char* data)          { TileLayer* pTileLayer = static_cast<TileLayer*>(obj); pTileLayer->setGridSize( pTileLayer->getGridWidth(), dAtoi(data) ); return false; }
+    static bool setCellSize(void* obj, const char* data)            { static_cast<TileLayer*>(obj)->setCellSize( Vector2(data) ); return false; }
+    static bool writeCellSize( void* obj, StringTableEntry pFieldName ) { return static_cast<TileLayer*>(obj)->getCellSize().notEqual( Vector2::getOne() ); }
+    static bool setGridOffset(void* obj, const char* data)          { static_cast<TileLayer*>(obj)->setGridOffset( Vector2(data) ); return false; }
+    static bool writeGridOffset( void* obj, StringTableEntry pFieldName ) { return static_cast<TileLayer*>(obj)->getGridOffset().notZero(); }
+    static bool setIsometric(void* obj, const char* data)           { static_cast<TileLayer*>(obj)->setIsometric( dAtob(data) ); return false; }
+    static bool writeIsometric( void* obj, StringTableEntry pFieldName ) { return static_cast<TileLayer*>(obj)->getIsometric(); }
+};
+
+#endif // _TILE_LAYER_H_
@@ -0,0 +1,128 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+ConsoleMethod(TileLayer, setGridSize, void, 4, 4,   "(int width, int height) - Sets the grid size, clearing all tiles.\n"
+                                                    "@param width The number of cells across the grid.\n"
+                                                    "@param height The number of cells down the grid.\n"
+                                                    "@return No return value." )
+{
+    object->setGridSize( dAtoi(argv[2]), dAtoi(argv[3]) );
+}
+
+//-----------------------------------------------------------------------------
+
+ConsoleMethod(TileLayer, getGridSize, const char*, 2, 2,    "() - Gets the grid size.\n"
+                                                            "@return (int width/int height) The grid size." )
+{
+    // Create Returnable Buffer.
+    char* pBuffer = Con::getReturnBuffer(32);
+
+    // Format Buffer.
+    dSprintf(pBuffer, 32, "%d %d", object->getGridWidth(), object->getGridHeight());
+
+    // Return Buffer.
+    return pBuffer;
+}
+
+//-----------------------------------------------------------------------------
+
+ConsoleMethod(TileLayer, addTileset, S32, 3, 7, "(imageAssetId, [tileWidth, tileHeight], [offsetX, offsetY]) - Adds a tileset.\n"
+                                                "@param imageAssetId The image whose frames are the tiles.\n"
+                                                "@param tileWidth/tileHeight The size of each tile.  Defaults to the cell size.\n"
+                                                "@param offsetX/offsetY The offset of each tile from its cell.  Defaults to no offset.\n"
+                                                "@return The tileset index or -1 on failure." )
+{
+    // Fetch tile size.
+    Vector2 tileSize = object->getCellSize();
+    if ( argc >= 5 )
+        tileSize.Set( dAtof(argv[3]), dAtof(argv[4]) );
+
+    // Fetch tile offset.
+    Vector2 tileOffset = Vector2::getZero();
+    if ( argc >= 7 )
+        tileOffset.Set( dAtof(argv[5]), dAtof(argv[6]) );
+
+    return object->addTileset( argv[2], tileSize, tileOffset );
+}
+
+//-----------------------------------------------------------------------------
+
+ConsoleMethod(TileLayer, getTilesetCount, S32, 2, 2,    "() - Gets the number of tilesets.\n"
+                                                        "@return The number of tilesets." )
+{
+    return object->getTilesetCount();
+}
+
+//-----------------------------------------------------------------------------
+
+ConsoleMethod(TileLayer, clearTilesets, void, 2, 2, "() - Removes all tilesets and tiles.\n"
+                                                    "@return No return value." )
+{
+    object->clearTilesets();
+}
+
+//-----------------------------------------------------------------------------
+
+ConsoleMethod(TileLayer, setTile, bool, 6, 8,   "(int x, int y, int tilesetIndex, int frame, [bool flipX], [bool flipY]) - Sets the tile at the specified cell.\n"
+                                                "@param x/y The cell.\n"
+                                                "@param tilesetIndex The tileset to use.\n"
+                                                "@param frame The tileset image frame to use.\n"
+                                                "@param flipX/flipY Whether to flip the tile or not.\n"
+                                                "@return Whether the tile was set or not." )
+{
+    const bool flipX = argc >= 7 ? dAtob(argv[6]) : false;
+    const bool flipY = argc >= 8 ? dAtob(argv[7]) : false;
+
+    return object->setTile( dAtoi(argv[2]), dAtoi(argv[3]), dAtoi(argv[4]), dAtoi(argv[5]), flipX, flipY );
+}
+
+//-----------------------------------------------------------------------------
+
+ConsoleMethod(TileLayer, clearTile, void, 4, 4, "(int x, int y) - Clears the tile at the specified cell.\n"
+                                                "@return No return value." )
+{
+    object->clearTile( dAtoi(argv[2]), dAtoi(argv[3]) );
+}
+
+//-----------------------------------------------------------------------------
+
+ConsoleMethod(TileLayer, clearTiles, void, 2, 2,    "() - Clears all the tiles.\n"
+                                                    "@return No return value." )
+{
+    object->clearTiles();
+}
+
+//-----------------------------------------------------------------------------
+
+ConsoleMethod(TileLayer, getTileTileset, S32, 4, 4, "(int x, int y) - Gets the tileset of the tile at the specified cell.\n"
+                                                    "@return The tileset index or -1 if the cell is empty." )
+{
+    return object->getTileTileset( dAtoi(argv[2]), dAtoi(argv[3]) );
+}
+
+//-----------------------------------------------------------------------------
+
+ConsoleMethod(TileLayer, getTileFrame, S32, 4, 4,   "(int x, int y) - Gets the frame of the tile at the specified cell.\n"
+                                                    "@return The frame or -1 if the cell is empty." )
+{
+    return object->getTileFrame( dAtoi(argv[2]), dAtoi(argv[3]) );
+}
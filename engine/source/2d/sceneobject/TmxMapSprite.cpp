@@ -1,6 +1,7 @@
 #include "TmxMapSprite.h"
 
 #include "assets/assetManager.h"
+#include "platform/threads/threadPool.h"
 #include <string>
 
 //script bindings
@@ -13,8 +14,14 @@ IMPLEMENT_CONOBJECT(TmxMapSprite);
 //------------------------------------------------------------------------------
 
 TmxMapSprite::TmxMapSprite() : mMapPixelToMeterFactor(0.03f),
-	mLastTileAsset(StringTable->EmptyString),
-	mLastTileImage(StringTable->EmptyString)
+	mChunkSize(0),
+	mChunkMargin(1),
+	mChunkBudget(4),
+	mBakeCollision(false),
+	mCollisionProperty(StringTable->EmptyString),
+	mChunksX(0),
+	mChunksY(0),
+	mMapDirty(false)
 {
 	mAutoSizing = true;
 	setBodyType(b2_staticBody);
@@ -34,6 +41,11 @@ void TmxMapSprite::initPersistFields()
 
 	addProtectedField("Map", TypeTmxMapAssetPtr, Offset(mMapAsset, TmxMapSprite), &setMap, &getMap, &writeMap, "");
 	addProtectedField("MapToMeterFactor", TypeF32, Offset(mMapPixelToMeterFactor, TmxMapSprite), &setMapToMeterFactor, &getMapToMeterFactor, &writeMapToMeterFactor, "");
+	addProtectedField("ChunkSize", TypeS32, Offset(mChunkSize, TmxMapSprite), &setChunkSize, &defaultProtectedGetFn, &writeChunkSize, "Tiles per chunk side when streaming tile layers around the camera. Zero (the default) builds every layer up front.");
+	addProtectedField("ChunkMargin", TypeS32, Offset(mChunkMargin, TmxMapSprite), &setChunkMargin, &defaultProtectedGetFn, &writeChunkMargin, "Number of chunks around the visible area that are kept built.");
+	addProtectedField("ChunkBudget", TypeS32, Offset(mChunkBudget, TmxMapSprite), &setChunkBudget, &defaultProtectedGetFn, &writeChunkBudget, "Maximum number of prefetch builds and evictions per tick.");
+	addProtectedField("BakeCollision", TypeBool, Offset(mBakeCollision, TmxMapSprite), &setBakeCollision, &defaultProtectedGetFn, &writeBakeCollision, "Whether rectangle and polyline collision objects are welded into chain shapes or not.");
+	addProtectedField("CollisionProperty", TypeString, Offset(mCollisionProperty, TmxMapSprite), &setCollisionProperty, &defaultProtectedGetFn, &writeCollisionProperty, "Tile property that, when true, gives a tile (welded) collision. Empty (the default) gives tiles no collision.");
 }
 
 bool TmxMapSprite::onAdd()
@@ -51,6 +63,13 @@ void TmxMapSprite::OnRegisterScene(Scene* pScene)
 {
 	Parent::OnRegisterScene(pScene);
 
+	//fields set before the sprite joined a scene are applied in a single build, which adds everything it creates to the scene.
+	if (mMapDirty)
+	{
+		BuildMap();
+		return;
+	}
+
 	auto layerIdx = mLayers.begin();
 	for(layerIdx; layerIdx != mLayers.end(); ++layerIdx)
 	{
@@ -58,11 +77,28 @@ void TmxMapSprite::OnRegisterScene(Scene* pScene)
 		pScene->addToScene(*layerIdx);
 	}
 
+	auto tileLayerIdx = mTileLayers.begin();
+	for (tileLayerIdx; tileLayerIdx != mTileLayers.end(); ++tileLayerIdx)
+	{
+		pScene->addToScene(*tileLayerIdx);
+	}
+
 	auto objectsIdx = mObjects.begin();
 	for (objectsIdx; objectsIdx != mObjects.end(); ++objectsIdx){
 		pScene->addToScene(*objectsIdx);
 	}
 
+	auto chunkLayerIdx = mChunkLayers.begin();
+	for (chunkLayerIdx; chunkLayerIdx != mChunkLayers.end(); ++chunkLayerIdx)
+	{
+		auto chunkIdx = chunkLayerIdx->mChunks.begin();
+		for (chunkIdx; chunkIdx != chunkLayerIdx->mChunks.end(); ++chunkIdx)
+		{
+			if (*chunkIdx != NULL)
+				pScene->addToScene(*chunkIdx);
+		}
+	}
+
 }
 
 void TmxMapSprite::OnUnregisterScene( Scene* pScene )
@@ -74,10 +110,26 @@ void TmxMapSprite::OnUnregisterScene( Scene* pScene )
 	{
 		pScene->removeFromScene(*layerIdx);
 	}
+	auto tileLayerIdx = mTileLayers.begin();
+	for (tileLayerIdx; tileLayerIdx != mTileLayers.end(); ++tileLayerIdx)
+	{
+		pScene->removeFromScene(*tileLayerIdx);
+	}
 	auto objectsIdx = mObjects.begin();
 	for (objectsIdx; objectsIdx != mObjects.end(); ++objectsIdx){
 		pScene->removeFromScene(*objectsIdx);
 	}
+
+	auto chunkLayerIdx = mChunkLayers.begin();
+	for (chunkLayerIdx; chunkLayerIdx != mChunkLayers.end(); ++chunkLayerIdx)
+	{
+		auto chunkIdx = chunkLayerIdx->mChunks.begin();
+		for (chunkIdx; chunkIdx != chunkLayerIdx->mChunks.end(); ++chunkIdx)
+		{
+			if (*chunkIdx != NULL)
+				pScene->removeFromScene(*chunkIdx);
+		}
+	}
 }
 
 void TmxMapSprite::setPosition( const Vector2& position )
@@ -89,6 +141,32 @@ void TmxMapSprite::setPosition( const Vector2& position )
 		(*layerIdx)->setPosition(position);
 	}
 
+	auto tileLayerIdx = mTileLayers.begin();
+	for (tileLayerIdx; tileLayerIdx != mTileLayers.end(); ++tileLayerIdx)
+	{
+		(*tileLayerIdx)->setPosition(position);
+	}
+
+	auto chunkLayerIdx = mChunkLayers.begin();
+	for (chunkLayerIdx; chunkLayerIdx != mChunkLayers.end(); ++chunkLayerIdx)
+	{
+		auto chunkIdx = chunkLayerIdx->mChunks.begin();
+		for (chunkIdx; chunkIdx != chunkLayerIdx->mChunks.end(); ++chunkIdx)
+		{
+			if (*chunkIdx != NULL)
+				(*chunkIdx)->setPosition(position);
+		}
+	}
+
+}
+
+void TmxMapSprite::integrateObject( const F32 totalTime, const F32 elapsedTime, DebugStats* pDebugStats )
+{
+	// Call parent.
+	Parent::integrateObject( totalTime, elapsedTime, pDebugStats );
+
+	if (mChunkLayers.size() > 0)
+		UpdateChunks(pDebugStats);
 }
 
 void TmxMapSprite::ClearMap()
@@ -100,41 +178,78 @@ void TmxMapSprite::ClearMap()
 		delete sprite;
 	}
 	mLayers.clear();
+	auto tileLayerIdx = mTileLayers.begin();
+	for (tileLayerIdx; tileLayerIdx != mTileLayers.end(); ++tileLayerIdx)
+	{
+		TileLayer* tileLayer = *tileLayerIdx;
+		delete tileLayer;
+	}
+	mTileLayers.clear();
 	auto objectsIdx = mObjects.begin();
 	for (objectsIdx; objectsIdx != mObjects.end(); ++objectsIdx){
 		SceneObject* object = *objectsIdx;
 		delete object;
 	}
 	mObjects.clear();
+
+	auto chunkLayerIdx = mChunkLayers.begin();
+	for (chunkLayerIdx; chunkLayerIdx != mChunkLayers.end(); ++chunkLayerIdx)
+	{
+		auto chunkIdx = chunkLayerIdx->mChunks.begin();
+		for (chunkIdx; chunkIdx != chunkLayerIdx->mChunks.end(); ++chunkIdx)
+		{
+			TileLayer* tileLayer = *chunkIdx;
+			delete tileLayer;
+		}
+	}
+	mChunkLayers.clear();
+	mChunksX = 0;
+	mChunksY = 0;
+
+	ReleaseRetiredChunks();
 }
 
 
+void TmxMapSprite::MarkMapDirty()
+{
+	mMapDirty = true;
+
+	//a sprite already in a scene rebuilds straight away, otherwise the build waits until it is added to one.
+	if (getScene() != NULL)
+		BuildMap();
+}
+
 void TmxMapSprite::BuildMap()
 {
 	// Debug Profiling.
 	PROFILE_SCOPE(TmxMapSprite_BuildMap);
 
+	mMapDirty = false;
 
 	ClearMap();
+	if (mMapAsset.isNull())
+		return;
+
 	auto mapParser = mMapAsset->getParser();
+	if (mapParser == NULL)
+		return;
 
-	F32 tileWidth = static_cast<F32>(mapParser->GetTileWidth());
-	F32 tileHeight = static_cast<F32>(mapParser->GetTileHeight());
-	F32 halfTileHeight = static_cast<F32>(tileHeight * 0.5);
+	Tmx::MapOrientation orient = mapParser->GetOrientation();
 
-	F32 width = (mapParser->GetWidth() * tileWidth);
-	F32 height = (mapParser->GetHeight() * tileHeight);
+	int xTiles = mapParser->GetWidth();
+	int yTiles = mapParser->GetHeight();
 
-	F32 originY = height / 2 - halfTileHeight;
-	F32 originX = 0;
-
-	Vector2 tileSize(tileWidth, tileHeight);
-	Vector2 originSize(originX, originY);
+	if (mChunkSize > 0)
+	{
+		mChunksX = (xTiles + mChunkSize - 1) / mChunkSize;
+		mChunksY = (yTiles + mChunkSize - 1) / mChunkSize;
+	}
 
-	Tmx::MapOrientation orient = mapParser->GetOrientation();
+	Vector<TileLayerBuild> builds;
 
+	int layerIndex = 0;
 	auto layerItr = mapParser->GetLayers().begin();
-	for(layerItr; layerItr != mapParser->GetLayers().end(); ++layerItr)
+	for(layerItr; layerItr != mapParser->GetLayers().end(); ++layerItr, ++layerIndex)
 	{
 		Tmx::Layer* layer = *layerItr;
 
@@ -142,60 +257,40 @@ void TmxMapSprite::BuildMap()
 		int layerNumber = 0;
 		layerNumber = layer->GetProperties().GetNumericProperty(TMX_MAP_LAYER_ID_PROP);
 
+		//tile collision is always built for the whole layer, even when the tiles themselves are streamed.
+		if (mCollisionProperty != StringTable->EmptyString)
+			addTileCollision(layerIndex, layer, layerNumber);
 
-
-		auto compSprite = CreateLayer(layerNumber, orient == Tmx::TMX_MO_ISOMETRIC);
-
-		int xTiles = mapParser->GetWidth();
-		int yTiles = mapParser->GetHeight();
-		for(int x=0; x < xTiles; ++x)
+		if (mChunkSize > 0)
 		{
-			for (int y=0; y < yTiles; ++y)
-			{
-				auto tile = layer->GetTile(x, y);
-				if (tile.tilesetId == -1) continue; //no tile at this location
-
-				auto tset = mapParser->GetTileset(tile.tilesetId);
-
-				StringTableEntry assetName = GetTilesetAsset(tset);
-				if (assetName == StringTable->EmptyString) continue;
-
-
-				int localFrame = tile.id;
-				F32 spriteHeight = static_cast<F32>( tset->GetTileHeight() );
-				F32 spriteWidth = static_cast<F32>( tset->GetTileWidth() );
-
-				F32 heightOffset = (spriteHeight - tileHeight) / 2;
-				F32 widthOffset = (spriteWidth - tileWidth) / 2;
-
-
-				Vector2 pos = TileToCoord( 
-					Vector2
-						(
-							static_cast<const F32>(x),
-							static_cast<const F32>(yTiles-y)	
-						),
-					tileSize,
-					originSize,
-					orient == Tmx::TMX_MO_ISOMETRIC
-					);
-				pos.add(Vector2(widthOffset, heightOffset));
-				pos *= mMapPixelToMeterFactor;
-
-				auto bId = compSprite->addSprite( SpriteBatchItem::LogicalPosition( pos.scriptThis()) );
-				compSprite->selectSpriteId(bId);
-				compSprite->setSpriteImage(assetName, localFrame);
-				compSprite->setSpriteSize( Vector2( spriteWidth * mMapPixelToMeterFactor, spriteHeight * mMapPixelToMeterFactor ) );
-
-				compSprite->setSpriteFlipX(tile.flippedHorizontally);
-				compSprite->setSpriteFlipY(tile.flippedVertically);
-				
-
-			}
+			//chunks for this layer are built on demand as cameras approach them.
+			TileChunkLayer chunkLayer;
+			chunkLayer.mpLayer = layer;
+			chunkLayer.mSceneLayer = layerNumber;
+			mChunkLayers.push_back(chunkLayer);
+			mChunkLayers.last().mChunks.setSize(mChunksX * mChunksY);
+			dMemset(mChunkLayers.last().mChunks.address(), 0, mChunksX * mChunksY * sizeof(TileLayer*));
+			continue;
 		}
 
+		auto tileLayer = CreateTileLayer(layerNumber);
+		mTileLayers.push_back(tileLayer);
+
+		builds.increment();
+		TileLayerBuild& build = builds.last();
+		build.mpLayer = layer;
+		build.mpTileLayer = tileLayer;
+		build.mStartX = 0;
+		build.mStartY = 0;
+		build.mEndX = xTiles;
+		build.mEndY = yTiles;
+		build.mSkippedTiles = 0;
 	}
 
+	//every layer is filled in at once on the worker threads.
+	if (builds.size() > 0)
+		BuildTileLayers(builds);
+
 	auto groupIdx = mapParser->GetObjectGroups().begin();
 	for(groupIdx; groupIdx != mapParser->GetObjectGroups().end(); ++groupIdx)
 	{
@@ -206,6 +301,10 @@ void TmxMapSprite::BuildMap()
 		layerNumber = groupLayer->GetProperties().GetNumericProperty(TMX_MAP_LAYER_ID_PROP);
 		auto compSprite = CreateLayer(layerNumber, orient == Tmx::TMX_MO_ISOMETRIC);
 
+		//when baking, rectangles and polylines are collected and welded once the whole group has been read.
+		CollisionBaker baker;
+		CollisionBaker* pBaker = mBakeCollision ? &baker : NULL;
+
 		auto objectIdx = groupLayer->GetObjects().begin();
 		for(objectIdx; objectIdx != groupLayer->GetObjects().end(); ++objectIdx)
 		{
@@ -223,7 +322,7 @@ void TmxMapSprite::BuildMap()
 				//try to add some physics bodies...
 
 				if (object->GetPolyline() != nullptr){
-					addPhysicsPolyLine(object, compSprite);
+					addPhysicsPolyLine(object, compSprite, pBaker);
 				}
 				else if (object->GetPolygon() != nullptr){
 					addPhysicsPolygon(object, compSprite);
@@ -233,13 +332,523 @@ void TmxMapSprite::BuildMap()
 				}
 				else{
 					//must be a rectangle. 
-					addPhysicsRectangle(object, compSprite);
+					addPhysicsRectangle(object, compSprite, pBaker);
 				}
 			} 
 		}
+
+		if (pBaker != NULL)
+			baker.bake(compSprite);
+	}
+}
+
+void TmxMapSprite::addTileCollision(int layerIndex, const Tmx::Layer* layer, int layerNumber)
+{
+	// Debug Profiling.
+	PROFILE_SCOPE(TmxMapSprite_AddTileCollision);
+
+	auto mapParser = mMapAsset->getParser();
+
+	S32 propertyIndex = mMapAsset->getPropertyIndex(mCollisionProperty);
+	if (propertyIndex < 0)
+		return;
+
+	int width = layer->GetWidth();
+	int height = layer->GetHeight();
+	Vector<StringTableEntry> values;
+	values.setSize(width * height);
+	if (!mMapAsset->getTilePropertyRegion(layerIndex, propertyIndex, 0, 0, width, height, values.address()))
+		return;
+
+	F32 tileWidth = static_cast<F32>(mapParser->GetTileWidth());
+	F32 tileHeight = static_cast<F32>(mapParser->GetTileHeight());
+	int mapHeight = mapParser->GetHeight();
+	Vector2 tileSize(tileWidth, tileHeight);
+	Vector2 originSize(0, (mapHeight * tileHeight) / 2 - tileHeight * 0.5f);
+	Vector2 isoStep = TileLayer::getIsometricStep(tileSize);
+	bool isIso = mapParser->GetOrientation() == Tmx::TMX_MO_ISOMETRIC;
+	CompositeSprite* isoSprite = NULL;
+
+	//each run of solid tiles along a row goes in as one rectangle, the baker welds the rows together.
+	CollisionBaker baker;
+	for (int y = 0; y < height; ++y)
+	{
+		int x = 0;
+		while (x < width)
+		{
+			StringTableEntry value = values[y * width + x];
+			if (value == StringTable->EmptyString || !dAtob(value))
+			{
+				++x;
+				continue;
+			}
+
+			int runStart = x;
+			while (x < width)
+			{
+				value = values[y * width + x];
+				if (value == StringTable->EmptyString || !dAtob(value))
+					break;
+				++x;
+			}
+
+			//an isometric run is a parallelogram, which the baker cannot weld, so it goes in as a polygon.
+			if (isIso)
+			{
+				Vector2 firstTile((F32)runStart, (F32)(mapHeight - y));
+				Vector2 lastTile((F32)(x - 1), (F32)(mapHeight - y));
+				Vector2 first = TileToCoord(firstTile, tileSize, originSize, true);
+				Vector2 last = TileToCoord(lastTile, tileSize, originSize, true);
+
+				b2Vec2 points[4] =
+				{
+					mMapPixelToMeterFactor * (first - Vector2(isoStep.x, 0)),
+					mMapPixelToMeterFactor * (last - Vector2(0, isoStep.y)),
+					mMapPixelToMeterFactor * (last + Vector2(isoStep.x, 0)),
+					mMapPixelToMeterFactor * (first + Vector2(0, isoStep.y))
+				};
+
+				if (isoSprite == NULL)
+					isoSprite = CreateLayer(layerNumber, true);
+				isoSprite->createPolygonCollisionShape(4, points);
+				continue;
+			}
+
+			//tiles are centered on TileToCoord, matching where the tile layers put them.
+			b2Vec2 lower(runStart * tileWidth - tileWidth / 2, (mapHeight - y) * tileHeight - tileHeight / 2);
+			b2Vec2 upper(x * tileWidth - tileWidth / 2, lower.y + tileHeight);
+			baker.addRectangle(mMapPixelToMeterFactor * lower, mMapPixelToMeterFactor * upper);
+		}
+	}
+
+	if (baker.getRectangleCount() == 0)
+		return;
+
+	auto compSprite = CreateLayer(layerNumber, false);
+	baker.bake(compSprite);
+}
+
+TileLayer* TmxMapSprite::CreateTileLayer(int layerIndex)
+{
+	TileLayer* tileLayer = new TileLayer();
+
+	auto scene = this->getScene();
+	if (scene)
+		scene->addToScene(tileLayer);
+
+	tileLayer->setPosition(getPosition());
+	tileLayer->setSceneLayer(layerIndex);
+
+	return tileLayer;
+}
+
+void TmxMapSprite::addTiles(const Tmx::Layer* layer, TileLayer* tileLayer, int startX, int startY, int endX, int endY)
+{
+	//a single layer (such as a streamed chunk) goes through the same steps, just without the workers.
+	TileLayerBuild build;
+	build.mpLayer = layer;
+	build.mpTileLayer = tileLayer;
+	build.mStartX = startX;
+	build.mStartY = startY;
+	build.mEndX = endX;
+	build.mEndY = endY;
+	build.mSkippedTiles = 0;
+
+	SetupTileLayer(build);
+	FindLayerTilesets(&build, 0);
+	AddLayerTilesets(build);
+	FillTileLayer(&build, 0);
+
+	if (build.mSkippedTiles > 0)
+		Con::warnf("TmxMapSprite::addTiles() - Skipped %d tiles with frames outside of their tileset.", build.mSkippedTiles);
+}
+
+void TmxMapSprite::BuildTileLayers(Vector<TileLayerBuild>& builds)
+{
+	// Debug Profiling.
+	PROFILE_SCOPE(TmxMapSprite_BuildTileLayers);
+
+	//scanning and filling the tiles only touches each layer's own tile layer so runs on the workers,
+	//whereas the scene objects and the tileset assets they acquire are set up here on the main thread.
+	for (S32 i = 0; i < builds.size(); ++i)
+		SetupTileLayer(builds[i]);
+
+	RunLayerJobs(&TmxMapSprite::FindLayerTilesets, builds);
+
+	for (S32 i = 0; i < builds.size(); ++i)
+		AddLayerTilesets(builds[i]);
+
+	RunLayerJobs(&TmxMapSprite::FillTileLayer, builds);
+
+	for (S32 i = 0; i < builds.size(); ++i)
+	{
+		if (builds[i].mSkippedTiles > 0)
+			Con::warnf("TmxMapSprite::BuildTileLayers() - Skipped %d tiles with frames outside of their tileset.", builds[i].mSkippedTiles);
 	}
 }
 
+void TmxMapSprite::RunLayerJobs(void (*job)(void* context, U32 index), Vector<TileLayerBuild>& builds)
+{
+	ThreadPool* pThreadPool = ThreadPool::getGlobal();
+	if (pThreadPool == NULL)
+	{
+		for (S32 i = 0; i < builds.size(); ++i)
+			job(builds.address(), i);
+		return;
+	}
+
+	pThreadPool->parallelFor(job, builds.address(), builds.size());
+}
+
+void TmxMapSprite::SetupTileLayer(TileLayerBuild& build)
+{
+	auto mapParser = mMapAsset->getParser();
+
+	F32 tileWidth = static_cast<F32>(mapParser->GetTileWidth());
+	F32 tileHeight = static_cast<F32>(mapParser->GetTileHeight());
+	F32 halfTileHeight = static_cast<F32>(tileHeight * 0.5);
+
+	F32 height = (mapParser->GetHeight() * tileHeight);
+
+	F32 originY = height / 2 - halfTileHeight;
+	F32 originX = 0;
+
+	Vector2 tileSize(tileWidth, tileHeight);
+	Vector2 originSize(originX, originY);
+
+	bool isIso = mapParser->GetOrientation() == Tmx::TMX_MO_ISOMETRIC;
+
+	TileLayer* tileLayer = build.mpTileLayer;
+	tileLayer->setIsometric(isIso);
+	tileLayer->setCellSize(tileSize * mMapPixelToMeterFactor);
+	tileLayer->setGridSize(build.mEndX - build.mStartX, build.mEndY - build.mStartY);
+
+	//line the first cell up with where the map puts that tile, so a chunk sits exactly over its part of the map.
+	Vector2 firstTile = TileToCoord( 
+		Vector2
+			(
+				static_cast<const F32>(build.mStartX),
+				static_cast<const F32>(mapParser->GetHeight()-build.mStartY)	
+			),
+		tileSize,
+		originSize,
+		isIso
+		);
+	firstTile *= mMapPixelToMeterFactor;
+	tileLayer->setGridOffset(firstTile - tileLayer->getCellLocalPosition(0, 0));
+
+	build.mTilesets.setSize(mapParser->GetNumTilesets());
+	for (S32 i = 0; i < build.mTilesets.size(); ++i)
+		build.mTilesets[i] = -1;
+}
+
+void TmxMapSprite::FindLayerTilesets(void* context, U32 index)
+{
+	//runs on a worker thread.
+	TileLayerBuild& build = static_cast<TileLayerBuild*>(context)[index];
+
+	//mark the tmx tilesets this part of the layer uses.
+	for (int y = build.mStartY; y < build.mEndY; ++y)
+	{
+		for (int x = build.mStartX; x < build.mEndX; ++x)
+		{
+			auto& tile = build.mpLayer->GetTile(x, y);
+			if (tile.tilesetId >= 0 && tile.tilesetId < build.mTilesets.size())
+				build.mTilesets[tile.tilesetId] = 0;
+		}
+	}
+}
+
+void TmxMapSprite::AddLayerTilesets(TileLayerBuild& build)
+{
+	auto mapParser = mMapAsset->getParser();
+
+	F32 tileWidth = static_cast<F32>(mapParser->GetTileWidth());
+	F32 tileHeight = static_cast<F32>(mapParser->GetTileHeight());
+
+	//tmx tilesets are only added to the layer when one of their tiles is used.
+	for (S32 i = 0; i < build.mTilesets.size(); ++i)
+	{
+		if (build.mTilesets[i] < 0)
+			continue;
+
+		auto tset = mapParser->GetTileset(i);
+
+		StringTableEntry assetName = GetTilesetAsset(i);
+		if (assetName == StringTable->EmptyString)
+		{
+			build.mTilesets[i] = -1;
+			continue;
+		}
+
+		F32 spriteHeight = static_cast<F32>( tset->GetTileHeight() );
+		F32 spriteWidth = static_cast<F32>( tset->GetTileWidth() );
+
+		F32 heightOffset = (spriteHeight - tileHeight) / 2;
+		F32 widthOffset = (spriteWidth - tileWidth) / 2;
+
+		build.mTilesets[i] = build.mpTileLayer->addTileset(
+			assetName, 
+			Vector2( spriteWidth * mMapPixelToMeterFactor, spriteHeight * mMapPixelToMeterFactor ),
+			Vector2( widthOffset * mMapPixelToMeterFactor, heightOffset * mMapPixelToMeterFactor )
+			);
+	}
+}
+
+void TmxMapSprite::FillTileLayer(void* context, U32 index)
+{
+	//runs on a worker thread so must not warn. setTile is only given tiles it will accept.
+	TileLayerBuild& build = static_cast<TileLayerBuild*>(context)[index];
+	TileLayer* tileLayer = build.mpTileLayer;
+
+	for (int y = build.mStartY; y < build.mEndY; ++y)
+	{
+		for (int x = build.mStartX; x < build.mEndX; ++x)
+		{
+			auto& tile = build.mpLayer->GetTile(x, y);
+			if (tile.tilesetId < 0 || tile.tilesetId >= build.mTilesets.size()) continue; //no tile at this location
+
+			S32 tilesetIndex = build.mTilesets[tile.tilesetId];
+			if (tilesetIndex < 0) continue;
+
+			if (tile.id >= tileLayer->getTileset(tilesetIndex).mFrameCount)
+			{
+				build.mSkippedTiles++;
+				continue;
+			}
+
+			tileLayer->setTile(x - build.mStartX, y - build.mStartY, tilesetIndex, tile.id, tile.flippedHorizontally, tile.flippedVertically);
+		}
+	}
+}
+
+TileLayer* TmxMapSprite::BuildChunk(TileChunkLayer& chunkLayer, int chunkX, int chunkY)
+{
+	// Debug Profiling.
+	PROFILE_SCOPE(TmxMapSprite_BuildChunk);
+
+	auto mapParser = mMapAsset->getParser();
+
+	//chunks are regular tile layers that just happen to cover a sub-range of the tiles.
+	auto tileLayer = CreateTileLayer(chunkLayer.mSceneLayer);
+
+	int startX = chunkX * mChunkSize;
+	int startY = chunkY * mChunkSize;
+	int endX = getMin(startX + mChunkSize, mapParser->GetWidth());
+	int endY = getMin(startY + mChunkSize, mapParser->GetHeight());
+	addTiles(chunkLayer.mpLayer, tileLayer, startX, startY, endX, endY);
+
+	chunkLayer.mChunks[chunkY * mChunksX + chunkX] = tileLayer;
+	return tileLayer;
+}
+
+void TmxMapSprite::EvictChunk(TileChunkLayer& chunkLayer, int chunkIndex)
+{
+	TileLayer* tileLayer = chunkLayer.mChunks[chunkIndex];
+	chunkLayer.mChunks[chunkIndex] = NULL;
+
+	//the chunk may still be in this tick's list of ticked objects, so it is only pulled 
+	//out of the scene here and deleted on the next update.
+	auto scene = tileLayer->getScene();
+	if (scene)
+		scene->removeFromScene(tileLayer);
+
+	mRetiredChunks.push_back(tileLayer);
+}
+
+void TmxMapSprite::ReleaseRetiredChunks()
+{
+	auto chunkIdx = mRetiredChunks.begin();
+	for (chunkIdx; chunkIdx != mRetiredChunks.end(); ++chunkIdx)
+	{
+		TileLayer* tileLayer = *chunkIdx;
+		delete tileLayer;
+	}
+	mRetiredChunks.clear();
+}
+
+bool TmxMapSprite::getVisibleChunkRange(S32 margin, S32& minX, S32& minY, S32& maxX, S32& maxY)
+{
+	auto scene = getScene();
+	if (scene == NULL)
+		return false;
+
+	auto mapParser = mMapAsset->getParser();
+	F32 tileWidth = static_cast<F32>(mapParser->GetTileWidth());
+	F32 tileHeight = static_cast<F32>(mapParser->GetTileHeight());
+	Vector2 tileSize(tileWidth, tileHeight);
+	Vector2 originSize(0, (mapParser->GetHeight() * tileHeight) / 2 - tileHeight * 0.5f);
+	S32 xTiles = mapParser->GetWidth();
+	S32 yTiles = mapParser->GetHeight();
+	bool isIso = mapParser->GetOrientation() == Tmx::TMX_MO_ISOMETRIC;
+
+	F32 tileMinX = F32_MAX;
+	F32 tileMinY = F32_MAX;
+	F32 tileMaxX = -F32_MAX;
+	F32 tileMaxY = -F32_MAX;
+
+	SimSet& sceneWindows = scene->getAttachedSceneWindows();
+	for (SimSet::iterator itr = sceneWindows.begin(); itr != sceneWindows.end(); ++itr)
+	{
+		SceneWindow* pSceneWindow = dynamic_cast<SceneWindow*>(*itr);
+		if (pSceneWindow == NULL)
+			continue;
+
+		RectF cameraArea = pSceneWindow->getCameraRenderArea();
+
+		//a rotated camera can see anything within its circumscribed square.
+		if (mNotZero(pSceneWindow->getCameraAngle()))
+		{
+			F32 radius = cameraArea.extent.len() * 0.5f;
+			Point2F center = cameraArea.centre();
+			cameraArea = RectF(center - Point2F(radius, radius), Point2F(radius * 2.0f, radius * 2.0f));
+		}
+
+		Vector2 corners[4] =
+		{
+			Vector2(cameraArea.point.x, cameraArea.point.y),
+			Vector2(cameraArea.point.x + cameraArea.extent.x, cameraArea.point.y),
+			Vector2(cameraArea.point.x, cameraArea.point.y + cameraArea.extent.y),
+			Vector2(cameraArea.point.x + cameraArea.extent.x, cameraArea.point.y + cameraArea.extent.y)
+		};
+
+		for (U32 i = 0; i < 4; ++i)
+		{
+			//invert TileToCoord to find which tile each corner of the view falls on.
+			Vector2 local = getLocalPoint(corners[i]);
+			local /= mMapPixelToMeterFactor;
+
+			Vector2 tile = CoordToTilePosition(local, tileSize, originSize, isIso);
+			F32 tileX = tile.x;
+			F32 tileY = yTiles - tile.y;
+
+			tileMinX = getMin(tileMinX, tileX);
+			tileMinY = getMin(tileMinY, tileY);
+			tileMaxX = getMax(tileMaxX, tileX);
+			tileMaxY = getMax(tileMaxY, tileY);
+		}
+	}
+
+	if (tileMinX > tileMaxX)
+		return false;
+
+	//a tile (and oversized tileset art) can overlap its neighbour, so pad by one tile.
+	minX = (mClamp((S32)mFloor(tileMinX) - 1, 0, xTiles - 1) / mChunkSize) - margin;
+	minY = (mClamp((S32)mFloor(tileMinY) - 1, 0, yTiles - 1) / mChunkSize) - margin;
+	maxX = (mClamp((S32)mCeil(tileMaxX) + 1, 0, xTiles - 1) / mChunkSize) + margin;
+	maxY = (mClamp((S32)mCeil(tileMaxY) + 1, 0, yTiles - 1) / mChunkSize) + margin;
+
+	//nothing to do if the view is entirely off the map.
+	if (tileMaxX < 0 || tileMaxY < 0 || tileMinX > xTiles || tileMinY > yTiles)
+		return false;
+
+	minX = getMax(minX, 0);
+	minY = getMax(minY, 0);
+	maxX = getMin(maxX, mChunksX - 1);
+	maxY = getMin(maxY, mChunksY - 1);
+	return true;
+}
+
+void TmxMapSprite::UpdateChunks(DebugStats* pDebugStats)
+{
+	// Debug Profiling.
+	PROFILE_SCOPE(TmxMapSprite_UpdateChunks);
+
+	ReleaseRetiredChunks();
+
+	S32 visibleMinX = 0, visibleMinY = 0, visibleMaxX = -1, visibleMaxY = -1;
+	S32 keepMinX = 0, keepMinY = 0, keepMaxX = -1, keepMaxY = -1;
+	if (getVisibleChunkRange(0, visibleMinX, visibleMinY, visibleMaxX, visibleMaxY))
+		getVisibleChunkRange(mChunkMargin, keepMinX, keepMinY, keepMaxX, keepMaxY);
+
+	U32 chunksBuilt = 0;
+	U32 chunksEvicted = 0;
+	U32 chunksResident = 0;
+	S32 budget = mChunkBudget;
+
+	auto chunkLayerIdx = mChunkLayers.begin();
+	for (chunkLayerIdx; chunkLayerIdx != mChunkLayers.end(); ++chunkLayerIdx)
+	{
+		TileChunkLayer& chunkLayer = *chunkLayerIdx;
+
+		//chunks in view are always built so the camera never sees holes.
+		for (S32 y = visibleMinY; y <= visibleMaxY; ++y)
+		{
+			for (S32 x = visibleMinX; x <= visibleMaxX; ++x)
+			{
+				if (chunkLayer.mChunks[y * mChunksX + x] != NULL)
+					continue;
+
+				BuildChunk(chunkLayer, x, y);
+				chunksBuilt++;
+			}
+		}
+
+		//chunks in the margin are prefetched, and distant chunks evicted, within the budget.
+		for (S32 y = 0; y < mChunksY; ++y)
+		{
+			for (S32 x = 0; x < mChunksX; ++x)
+			{
+				const S32 chunkIndex = y * mChunksX + x;
+				const bool keep = x >= keepMinX && x <= keepMaxX && y >= keepMinY && y <= keepMaxY;
+
+				if (chunkLayer.mChunks[chunkIndex] == NULL)
+				{
+					if (keep && budget > 0)
+					{
+						BuildChunk(chunkLayer, x, y);
+						chunksBuilt++;
+						budget--;
+					}
+				}
+				else if (!keep && budget > 0)
+				{
+					EvictChunk(chunkLayer, chunkIndex);
+					chunksEvicted++;
+					budget--;
+				}
+
+				if (chunkLayer.mChunks[chunkIndex] != NULL)
+					chunksResident++;
+			}
+		}
+	}
+
+	if (pDebugStats != NULL)
+	{
+		pDebugStats->tileChunksBuilt += chunksBuilt;
+		pDebugStats->tileChunksEvicted += chunksEvicted;
+		pDebugStats->tileChunksResident += chunksResident;
+	}
+}
+
+S32 TmxMapSprite::getResidentChunkCount()
+{
+	S32 resident = 0;
+	auto chunkLayerIdx = mChunkLayers.begin();
+	for (chunkLayerIdx; chunkLayerIdx != mChunkLayers.end(); ++chunkLayerIdx)
+	{
+		auto chunkIdx = chunkLayerIdx->mChunks.begin();
+		for (chunkIdx; chunkIdx != chunkLayerIdx->mChunks.end(); ++chunkIdx)
+		{
+			if (*chunkIdx != NULL)
+				resident++;
+		}
+	}
+	return resident;
+}
+
+S32 TmxMapSprite::getCollisionShapeCount()
+{
+	S32 shapes = 0;
+	auto layerIdx = mLayers.begin();
+	for (layerIdx; layerIdx != mLayers.end(); ++layerIdx)
+	{
+		shapes += (*layerIdx)->getCollisionShapeCount();
+	}
+	return shapes;
+}
+
 void TmxMapSprite::addObjectAsSprite(const Tmx::Tileset* tileSet, Tmx::Object* object, Tmx::Map * mapParser, int gid, CompositeSprite* compSprite ){
 
 	F32 tileWidth = static_cast<F32>( mapParser->GetTileWidth() );
@@ -278,7 +887,7 @@ void TmxMapSprite::addObjectAsSprite(const Tmx::Tileset* tileSet, Tmx::Object* o
 	pos *= mMapPixelToMeterFactor;
 
 	S32 frameNumber = gid - tileSet->GetFirstGid();
-	StringTableEntry assetName = GetTilesetAsset(tileSet);
+	StringTableEntry assetName = GetTilesetAsset(mapParser->FindTilesetIndex(gid));
 
 	auto bId = compSprite->addSprite( SpriteBatchItem::LogicalPosition( pos.scriptThis()) );
 	compSprite->selectSpriteId(bId);
@@ -290,7 +899,7 @@ void TmxMapSprite::addObjectAsSprite(const Tmx::Tileset* tileSet, Tmx::Object* o
 
 }
 
-void TmxMapSprite::addPhysicsPolyLine(Tmx::Object* object, CompositeSprite* compSprite){
+void TmxMapSprite::addPhysicsPolyLine(Tmx::Object* object, CompositeSprite* compSprite, CollisionBaker* baker){
 
 	auto mapParser = mMapAsset->getParser();
 	F32 tileWidth = static_cast<F32>(mapParser->GetTileWidth());
@@ -301,6 +910,7 @@ void TmxMapSprite::addPhysicsPolyLine(Tmx::Object* object, CompositeSprite* comp
 
 	const Tmx::Polyline* line = object->GetPolyline();
 	int points = line->GetNumPoints();
+	Vector<b2Vec2> bakePoints;
 	for (int i = 0; i < points-1; i++){
 
 		Tmx::Point first = line->GetPoint(i);
@@ -318,10 +928,21 @@ void TmxMapSprite::addPhysicsPolyLine(Tmx::Object* object, CompositeSprite* comp
 		firstPoint += Vector2(-tileWidth/2,tileHeight/2);
 		secondPoint += Vector2(-tileWidth/2,tileHeight/2);
 
+		if (baker != NULL)
+		{
+			//the baker takes the whole line and joins it up with any others that share its ends.
+			if (i == 0)
+				bakePoints.push_back(firstPoint * mMapPixelToMeterFactor);
+			bakePoints.push_back(secondPoint * mMapPixelToMeterFactor);
+			continue;
+		}
+
 		compSprite->createEdgeCollisionShape(firstPoint * mMapPixelToMeterFactor, secondPoint * mMapPixelToMeterFactor, false, false, Vector2(), Vector2());
 
 	}
 
+	if (baker != NULL)
+		baker->addPolyline(bakePoints.size(), bakePoints.address());
 	
 
 }
@@ -394,7 +1015,7 @@ void TmxMapSprite::addPhysicsEllipse(Tmx::Object* object, CompositeSprite* compS
 
 }
 
-void TmxMapSprite::addPhysicsRectangle(Tmx::Object* object, CompositeSprite* compSprite){
+void TmxMapSprite::addPhysicsRectangle(Tmx::Object* object, CompositeSprite* compSprite, CollisionBaker* baker){
 	auto mapParser = mMapAsset->getParser();
 	F32 tileWidth = static_cast<F32>(mapParser->GetTileWidth());
 	F32 tileHeight = static_cast<F32>(mapParser->GetTileHeight());
@@ -415,6 +1036,14 @@ void TmxMapSprite::addPhysicsRectangle(Tmx::Object* object, CompositeSprite* com
 		nativePoint += b2Vec2(-tileWidth/2,tileHeight/2);
 		nativePoint += b2Vec2(object->GetWidth()/2.0f, -(object->GetHeight()/2.0f)); //adjust for tmx defining from bottom left point while t2d defines from center...
 		nativePoint *= mMapPixelToMeterFactor;
+
+		if (baker != NULL)
+		{
+			b2Vec2 halfSize(object->GetWidth() * 0.5f * mMapPixelToMeterFactor, object->GetHeight() * 0.5f * mMapPixelToMeterFactor);
+			baker->addRectangle(nativePoint - halfSize, nativePoint + halfSize);
+			return;
+		}
+
 		compSprite->createPolygonBoxCollisionShape(object->GetWidth()*mMapPixelToMeterFactor, object->GetHeight()*mMapPixelToMeterFactor, nativePoint);
 		
 
@@ -442,9 +1071,11 @@ Vector2 TmxMapSprite::TileToCoord(Vector2& pos, Vector2& tileSize, Vector2& offs
 {
 	if (isIso)
 	{
+		//the same step the tile layers use, so tiles, objects, chunks and collision all line up.
+		Vector2 step = TileLayer::getIsometricStep(tileSize);
 		Vector2 newPos(
-			static_cast<F32>( (pos.x - pos.y) * tileSize.y),
-			static_cast<F32>( offset.y - (pos.x + pos.y) * tileSize.y * 0.5 )
+			(pos.x - pos.y) * step.x,
+			offset.y - (pos.x + pos.y) * step.y
 			);
 
 		return newPos;
@@ -456,6 +1087,21 @@ Vector2 TmxMapSprite::TileToCoord(Vector2& pos, Vector2& tileSize, Vector2& offs
 	}
 }
 
+Vector2 TmxMapSprite::CoordToTilePosition(const Vector2& coord, const Vector2& tileSize, const Vector2& offset, bool isIso)
+{
+	if (isIso)
+	{
+		Vector2 step = TileLayer::getIsometricStep(tileSize);
+		F32 diff = coord.x / step.x;
+		F32 sum = (offset.y - coord.y) / step.y;
+		return Vector2((sum + diff) * 0.5f, (sum - diff) * 0.5f);
+	}
+	else
+	{
+		return Vector2(coord.x / tileSize.x, coord.y / tileSize.y);
+	}
+}
+
 CompositeSprite* TmxMapSprite::CreateLayer(int layerIndex, bool isIso)
 {
 	CompositeSprite* compSprite = new CompositeSprite();
@@ -476,95 +1122,26 @@ CompositeSprite* TmxMapSprite::CreateLayer(int layerIndex, bool isIso)
 	return compSprite;
 }
 
-const char* TmxMapSprite::getFileName(const char* path)
-{
-	auto pStr = dStrrchr(path, '\\');
-	if (pStr == NULL)
-		pStr = dStrrchr(path, '/');
-	if (pStr == NULL)
-		return NULL;
-
-	pStr = pStr+1;
-
-	auto pDot = dStrrchr(pStr, '.');
-	int file_len = pDot - pStr;
-	if (file_len >= 1024) return NULL;
-
-	char buffer[1024];
-	dStrncpy(buffer, pStr, file_len);
-	buffer[file_len] = 0;
-	return StringTable->insert(buffer);
-}
-
-StringTableEntry TmxMapSprite::GetTilesetAsset(const Tmx::Tileset* tileSet)
+StringTableEntry TmxMapSprite::GetTilesetAsset(int tilesetIndex)
 {
-	StringTableEntry assetName = StringTable->insert( tileSet->GetProperties().GetLiteralProperty(TMX_MAP_TILESET_ASSETNAME_PROP).c_str() );
-	if (assetName == StringTable->EmptyString)
-	{
-		//we fall back to using the image filename as an asset name query.
-		//if that comes back with any hits, we use the first one.
-		//If you don't want to name your asset the same as your art tile set name, 
-		//you need to set a custom "AssetName" property on the tile set to override this.
-
-		auto imageSource = tileSet->GetImage()->GetSource().c_str();
-		StringTableEntry imageName = getFileName(imageSource);
-
-		if (imageName == mLastTileImage)
-		{
-			//this is a quick memoize optimization to cut down on asset queries.
-			//if we are requesting the same assetName from what we already found, we just return that.
-			return mLastTileAsset;
-		}
-
-		mLastTileImage = imageName;
-
-		AssetQuery query;
-		S32 count = AssetDatabase.findAssetName(&query, imageName);
-		if (count > 0)
-		{
-			assetName = query.first();
-			mLastTileAsset = StringTable->insert( assetName );
-		}
-	}
-	
-	return assetName;
+	//the asset resolves every tileset once when the map is loaded (or reads them from its precompiled map).
+	return mMapAsset->getTilesetAsset(tilesetIndex);
 }
 
 const char* TmxMapSprite::getTileProperty(StringTableEntry lName, StringTableEntry pName, int x,int y){
-	//we'll need a parser and to iterate over the layers
-	auto mapParser = mMapAsset->getParser();
-	auto layerItr = mapParser->GetLayers().begin();
-	for(layerItr; layerItr != mapParser->GetLayers().end(); ++layerItr)
-	{
-		Tmx::Layer* layer = *layerItr;
-
-		//look for a layer with a name that matches lName
-		if (std::string(lName) != layer->GetName())
-			continue;
-		//we found one, get the tile properties at the xy of that layer
-		Tmx::MapTile tile = layer->GetTile(x,y);
-		const Tmx::Tileset *tset = mapParser->GetTileset(tile.tilesetId);
-		//make sure they're asking for valid x and y
-		if (tset == nullptr)
-			return "";
+	if (mMapAsset.isNull())
+		return StringTable->EmptyString;
 
-		const Tmx::PropertySet pset = tset->GetTile(tile.id)->GetProperties();
-		if (pset.HasProperty(pName)){
-
-			//we have the result, put it in the string table and return it
-			std::string presult = pset.GetLiteralProperty(pName);
-			StringTableEntry s = StringTable->insert(presult.c_str());
-
-			return s;
-		}
-		else
-			return "";
-	}
+	//the asset indexes layer names and tile property columns when it loads, so this neither searches nor allocates.
+	//no layer or property of that name, or no tile with it, comes back empty.
+	return mMapAsset->getTileProperty(mMapAsset->getLayerIndex(lName), mMapAsset->getPropertyIndex(pName), x, y);
+}
 
-	//no layer or property of that name. 
-	//return empty
-	return "";
+bool TmxMapSprite::getTilePropertyRegion(StringTableEntry lName, StringTableEntry pName, int x, int y, int width, int height, StringTableEntry* pValues){
+	if (mMapAsset.isNull())
+		return false;
 
+	return mMapAsset->getTilePropertyRegion(mMapAsset->getLayerIndex(lName), mMapAsset->getPropertyIndex(pName), x, y, width, height, pValues);
 }
 
 Vector2 TmxMapSprite::getTileSize(){
@@ -5,12 +5,19 @@
 #include "2d/sceneobject/CompositeSprite.h"
 #endif
 
+#ifndef _TILE_LAYER_H_
+#include "2d/sceneobject/TileLayer.h"
+#endif
+
+#ifndef _COLLISION_BAKER_H_
+#include "2d/core/CollisionBaker.h"
+#endif
+
 #ifndef _TMXMAP_ASSET_H_
 #include "2d/assets/TmxMapAsset.h"
 #endif
 
 
-#define TMX_MAP_TILESET_ASSETNAME_PROP "AssetName"
 #define TMX_MAP_LAYER_ID_PROP "LayerId"
 
 class TmxMapSprite : public SceneObject
@@ -29,6 +36,8 @@ public:
 	virtual void OnRegisterScene(Scene* scene);
 	virtual void OnUnregisterScene( Scene* pScene );
 	virtual void            setPosition( const Vector2& position );
+	virtual void            integrateObject( const F32 totalTime, const F32 elapsedTime, DebugStats* pDebugStats );
+	virtual bool            getTickRequired( void ) const { return true; }
 
 	/// Declare Console Object.
 	DECLARE_CONOBJECT( TmxMapSprite );
@@ -42,33 +51,94 @@ private: //config
 													//The default is to set every pixel equal to 0.03 meters (or about 33 pixels per meter)
 													//This should match up with the rest of your asset design resolution.
 
+	S32					  mChunkSize;				//Tiles per chunk side. Zero builds every tile layer as a single composite up front.
+	S32					  mChunkMargin;				//Chunks around the visible area that are kept built (prefetch and eviction hysteresis).
+	S32					  mChunkBudget;				//Maximum prefetch builds and evictions performed per tick.
+
+	bool				  mBakeCollision;			//Welds rectangle and polyline collision objects into chain shapes.
+	StringTableEntry	  mCollisionProperty;		//Tiles with this property set to true get (welded) collision. Empty for none.
+
 private:
 
+	/// A tile layer that is built lazily, one chunk at a time, as cameras approach it.
+	struct TileChunkLayer
+	{
+		const Tmx::Layer*		 mpLayer;
+		S32						 mSceneLayer;
+		Vector<TileLayer*>		 mChunks;	//mChunksX * mChunksY entries, NULL until built.
+	};
+
+	/// A tile layer being filled in, mostly on the worker threads.
+	struct TileLayerBuild
+	{
+		const Tmx::Layer*		 mpLayer;
+		TileLayer*				 mpTileLayer;
+		S32						 mStartX;
+		S32						 mStartY;
+		S32						 mEndX;
+		S32						 mEndY;
+		Vector<S32>				 mTilesets;		//tile layer tileset for each tmx tileset, -1 if unused or it has no asset.
+		U32						 mSkippedTiles;	//tiles whose frame is outside their tileset image.
+	};
+
 	Vector<CompositeSprite*> mLayers;
+	Vector<TileLayer*> mTileLayers;
 	Vector<SceneObject*> mObjects;
 
-	StringTableEntry  mLastTileAsset;
-	StringTableEntry  mLastTileImage;
+	Vector<TileChunkLayer>	 mChunkLayers;
+	Vector<TileLayer*>		 mRetiredChunks;	//evicted this tick, deleted once the scene has finished ticking them.
+	S32						 mChunksX;
+	S32						 mChunksY;
 
+	bool					 mMapDirty;			//the map needs building once the sprite is in a scene.
+
+	void MarkMapDirty();
 	void BuildMap();
 	void ClearMap();
 	CompositeSprite* CreateLayer(int layerIndex, bool isIso);
-	const char* getFileName(const char* path);
-	StringTableEntry GetTilesetAsset(const Tmx::Tileset* tileSet);
+	void addTileCollision(int layerIndex, const Tmx::Layer* layer, int layerNumber);
+	TileLayer* CreateTileLayer(int layerIndex);
+	void addTiles(const Tmx::Layer* layer, TileLayer* tileLayer, int startX, int startY, int endX, int endY);
+	void BuildTileLayers(Vector<TileLayerBuild>& builds);
+	void SetupTileLayer(TileLayerBuild& build);
+	void AddLayerTilesets(TileLayerBuild& build);
+	static void FindLayerTilesets(void* context, U32 index);
+	static void FillTileLayer(void* context, U32 index);
+	static void RunLayerJobs(void (*job)(void* context, U32 index), Vector<TileLayerBuild>& builds);
+	TileLayer* BuildChunk(TileChunkLayer& chunkLayer, int chunkX, int chunkY);
+	void EvictChunk(TileChunkLayer& chunkLayer, int chunkIndex);
+	void ReleaseRetiredChunks();
+	bool getVisibleChunkRange(S32 margin, S32& minX, S32& minY, S32& maxX, S32& maxY);
+	void UpdateChunks(DebugStats* pDebugStats);
+	StringTableEntry GetTilesetAsset(int tilesetIndex);
 	void addObjectAsSprite(const Tmx::Tileset* tileSet, Tmx::Object* object, Tmx::Map * mapParser, int gid, CompositeSprite* compSprite );
-	void addPhysicsPolyLine(Tmx::Object* object, CompositeSprite* compSprite);
+	void addPhysicsPolyLine(Tmx::Object* object, CompositeSprite* compSprite, CollisionBaker* baker);
 	void addPhysicsPolygon(Tmx::Object* object, CompositeSprite* compSprite);
 	void addPhysicsEllipse(Tmx::Object* object, CompositeSprite* compSprite);
-	void addPhysicsRectangle(Tmx::Object* object, CompositeSprite* compSprite);
+	void addPhysicsRectangle(Tmx::Object* object, CompositeSprite* compSprite, CollisionBaker* baker);
 
 public:
-	inline bool setMap( const char* pMapAssetId ){ if (pMapAssetId == NULL) return false; mMapAsset = pMapAssetId; BuildMap(); return false;}
+	inline bool setMap( const char* pMapAssetId ){ if (pMapAssetId == NULL) return false; mMapAsset = pMapAssetId; MarkMapDirty(); return false;}
 	inline StringTableEntry getMap( void ) const { return mMapAsset.getAssetId(); }
-	inline bool setMapToMeterFactor( F32 factor ) {mMapPixelToMeterFactor = factor; BuildMap(); return false;}
+	inline bool setMapToMeterFactor( F32 factor ) {mMapPixelToMeterFactor = factor; MarkMapDirty(); return false;}
 	inline F32 getMapToMeterFactor( void ) const {return mMapPixelToMeterFactor;}
+	inline bool setChunkSize( S32 chunkSize ) {mChunkSize = chunkSize < 0 ? 0 : chunkSize; MarkMapDirty(); return false;}
+	inline S32 getChunkSize( void ) const {return mChunkSize;}
+	inline void setChunkMargin( S32 margin ) {mChunkMargin = margin < 0 ? 0 : margin;}
+	inline S32 getChunkMargin( void ) const {return mChunkMargin;}
+	inline void setChunkBudget( S32 budget ) {mChunkBudget = budget < 1 ? 1 : budget;}
+	inline S32 getChunkBudget( void ) const {return mChunkBudget;}
+	inline bool setBakeCollision( bool bake ) {mBakeCollision = bake; MarkMapDirty(); return false;}
+	inline bool getBakeCollision( void ) const {return mBakeCollision;}
+	inline bool setCollisionProperty( const char* pPropertyName ) {mCollisionProperty = StringTable->insert(pPropertyName); MarkMapDirty(); return false;}
+	inline StringTableEntry getCollisionProperty( void ) const {return mCollisionProperty;}
+	S32 getResidentChunkCount();
+	S32 getCollisionShapeCount();
 	const char* getTileProperty(StringTableEntry lName, StringTableEntry pName, int x,int y);
+	bool getTilePropertyRegion(StringTableEntry lName, StringTableEntry pName, int x, int y, int width, int height, StringTableEntry* pValues);
 	Vector2 CoordToTile(Vector2& pos, Vector2& tileSize, bool isIso);
 	Vector2 TileToCoord(Vector2& pos, Vector2& tileSize, Vector2& offset, bool isIso);
+	Vector2 CoordToTilePosition(const Vector2& coord, const Vector2& tileSize, const Vector2& offset, bool isIso);
 	Vector2 getTileSize();
 	bool isIsoMap();
 
@@ -81,6 +151,18 @@ protected:
 	static StringTableEntry getMapToMeterFactor(void* obj, const char* data)	{return Con::getFloatArg( static_cast<TmxMapSprite*>(obj)->getMapToMeterFactor() );}
 	static bool writeMapToMeterFactor(void* obj, StringTableEntry pFieldName)	{return static_cast<TmxMapSprite*>(obj)->mMapPixelToMeterFactor != 0.1f;}
 
+	static bool setChunkSize(void* obj, const char* data)						{return static_cast<TmxMapSprite*>(obj)->setChunkSize( dAtoi(data) ); }
+	static bool writeChunkSize(void* obj, StringTableEntry pFieldName)			{return static_cast<TmxMapSprite*>(obj)->mChunkSize != 0;}
+	static bool setChunkMargin(void* obj, const char* data)						{static_cast<TmxMapSprite*>(obj)->setChunkMargin( dAtoi(data) ); return false; }
+	static bool writeChunkMargin(void* obj, StringTableEntry pFieldName)		{return static_cast<TmxMapSprite*>(obj)->mChunkMargin != 1;}
+	static bool setChunkBudget(void* obj, const char* data)						{static_cast<TmxMapSprite*>(obj)->setChunkBudget( dAtoi(data) ); return false; }
+	static bool writeChunkBudget(void* obj, StringTableEntry pFieldName)		{return static_cast<TmxMapSprite*>(obj)->mChunkBudget != 4;}
+
+	static bool setBakeCollision(void* obj, const char* data)					{return static_cast<TmxMapSprite*>(obj)->setBakeCollision( dAtob(data) ); }
+	static bool writeBakeCollision(void* obj, StringTableEntry pFieldName)		{return static_cast<TmxMapSprite*>(obj)->mBakeCollision;}
+	static bool setCollisionProperty(void* obj, const char* data)				{return static_cast<TmxMapSprite*>(obj)->setCollisionProperty( data ); }
+	static bool writeCollisionProperty(void* obj, StringTableEntry pFieldName)	{return static_cast<TmxMapSprite*>(obj)->mCollisionProperty != StringTable->EmptyString;}
+
 
 };
 
@@ -23,6 +23,44 @@ ConsoleMethod(TmxMapSprite, getTileProperty, const char*, 6, 6, "(layerName, pro
 	return object->getTileProperty(lName, pName, x, y);
 }
 
+ConsoleMethod(TmxMapSprite, getTilePropertyRegion, const char*, 8, 8, "(layerName, propertyName, x, y, width, height) Gets a property value for every tile in a region of the given layer.\n"
+	"@return The property values as tab separated fields, row by row. Tiles without the property have blank fields.")
+{
+	StringTableEntry lName = StringTable->insert(argv[2]);
+	StringTableEntry pName = StringTable->insert(argv[3]);
+	S32 x = dAtoi(argv[4]);
+	S32 y = dAtoi(argv[5]);
+	S32 width = dAtoi(argv[6]);
+	S32 height = dAtoi(argv[7]);
+
+	if (width <= 0 || height <= 0)
+		return StringTable->EmptyString;
+
+	Vector<StringTableEntry> values;
+	values.setSize(width * height);
+	if (!object->getTilePropertyRegion(lName, pName, x, y, width, height, values.address()))
+		return StringTable->EmptyString;
+
+	U32 bufferSize = 1;
+	for (S32 i = 0; i < values.size(); ++i)
+		bufferSize += dStrlen(values[i]) + 1;
+
+	char* pBuffer = Con::getReturnBuffer(bufferSize);
+	char* pCursor = pBuffer;
+	for (S32 i = 0; i < values.size(); ++i)
+	{
+		if (i > 0)
+			*pCursor++ = '\t';
+
+		const U32 length = dStrlen(values[i]);
+		dMemcpy(pCursor, values[i], length);
+		pCursor += length;
+	}
+	*pCursor = 0;
+
+	return pBuffer;
+}
+
 
 ConsoleMethod(TmxMapSprite, WorldCoordToTile, const char*, 3,3,"Convert a world cooridnate into a local tile coordinate\n"
 	"@Return a tile coordinate as string (x y)")
@@ -33,3 +71,17 @@ ConsoleMethod(TmxMapSprite, WorldCoordToTile, const char*, 3,3,"Convert a world
 	auto tilePoint = object->CoordToTile(localPoint, object->getTileSize(), object->isIsoMap());
 	return tilePoint.scriptThis();
 }
+
+
+ConsoleMethod(TmxMapSprite, getResidentChunkCount, S32, 2, 2, "() Gets the number of tile chunks currently built when streaming with a non-zero ChunkSize.\n"
+	"@return The number of resident tile chunks across all tile layers.")
+{
+	return object->getResidentChunkCount();
+}
+
+
+ConsoleMethod(TmxMapSprite, getCollisionShapeCount, S32, 2, 2, "() Gets the number of collision shapes created for the map's object groups and tile collision.\n"
+	"@return The number of collision shapes across all layers.")
+{
+	return object->getCollisionShapeCount();
+}
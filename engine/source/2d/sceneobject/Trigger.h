@@ -61,6 +61,7 @@ public:
     /// Integration.
     virtual void            preIntegrate( const F32 totalTime, const F32 elapsedTime, DebugStats *pDebugStats );
     virtual void            integrateObject( const F32 totalTime, const F32 elapsedTime, DebugStats* pDebugStats );
+    virtual bool            getTickRequired( void ) const { return true; }
 
     /// Rendering.
     virtual bool            shouldRender( void ) const { return false; }
@@ -101,6 +101,19 @@ public:
 	template <typename T>
 	void RayCast(T* callback, const b2RayCastInput& input) const;
 
+	/// Query up to b2_maxBatchQueries AABBs in a single walk of the tree. The callback's
+	/// QueryBatchCallback(proxyId, mask) is called once for each proxy overlapping any of
+	/// the AABBs, with bit i of the mask set if the proxy overlaps aabbs[i].
+	template <typename T>
+	void QueryBatch(T* callback, const b2AABB* aabbs, int32 count) const;
+
+	/// Ray-cast up to b2_maxBatchQueries rays in a single walk of the tree. The callback's
+	/// RayCastBatchCallback(proxyId, mask) is called once for each proxy hit by any of the
+	/// rays, with bit i of the mask set if inputs[i] hits the proxy's AABB. The rays are not
+	/// clipped by the callback.
+	template <typename T>
+	void RayCastBatch(T* callback, const b2RayCastInput* inputs, int32 count) const;
+
 	/// Validate this tree. For testing.
 	void Validate() const;
 
@@ -286,4 +299,161 @@ inline void b2DynamicTree::RayCast(T* callback, const b2RayCastInput& input) con
 	}
 }
 
+template <typename T>
+inline void b2DynamicTree::QueryBatch(T* callback, const b2AABB* aabbs, int32 count) const
+{
+	b2Assert(0 < count && count <= b2_maxBatchQueries);
+
+	// Each stack entry carries the queries that still overlap the node.
+	struct b2BatchEntry
+	{
+		int32 nodeId;
+		uint32 mask;
+	};
+
+	b2BatchEntry entry;
+	entry.nodeId = m_root;
+	entry.mask = count == 32 ? 0xFFFFFFFFu : (1u << count) - 1;
+
+	b2GrowableStack<b2BatchEntry, 256> stack;
+	stack.Push(entry);
+
+	while (stack.GetCount() > 0)
+	{
+		entry = stack.Pop();
+		if (entry.nodeId == b2_nullNode)
+		{
+			continue;
+		}
+
+		const b2TreeNode* node = m_nodes + entry.nodeId;
+
+		uint32 mask = 0;
+		for (int32 i = 0; i < count; ++i)
+		{
+			if ((entry.mask & (1u << i)) && b2TestOverlap(node->aabb, aabbs[i]))
+			{
+				mask |= 1u << i;
+			}
+		}
+
+		if (mask == 0)
+		{
+			continue;
+		}
+
+		if (node->IsLeaf())
+		{
+			bool proceed = callback->QueryBatchCallback(entry.nodeId, mask);
+			if (proceed == false)
+			{
+				return;
+			}
+		}
+		else
+		{
+			b2BatchEntry child;
+			child.mask = mask;
+			child.nodeId = node->child1;
+			stack.Push(child);
+			child.nodeId = node->child2;
+			stack.Push(child);
+		}
+	}
+}
+
+template <typename T>
+inline void b2DynamicTree::RayCastBatch(T* callback, const b2RayCastInput* inputs, int32 count) const
+{
+	b2Assert(0 < count && count <= b2_maxBatchQueries);
+
+	// Set up the separating axis and bounding box of each ray once.
+	b2Vec2 p1s[b2_maxBatchQueries];
+	b2Vec2 vs[b2_maxBatchQueries];
+	b2Vec2 abs_vs[b2_maxBatchQueries];
+	b2AABB segmentAABBs[b2_maxBatchQueries];
+	for (int32 i = 0; i < count; ++i)
+	{
+		const b2RayCastInput& input = inputs[i];
+		b2Vec2 r = input.p2 - input.p1;
+		b2Assert(r.LengthSquared() > 0.0f);
+		r.Normalize();
+
+		p1s[i] = input.p1;
+		vs[i] = b2Cross(1.0f, r);
+		abs_vs[i] = b2Abs(vs[i]);
+
+		b2Vec2 t = input.p1 + input.maxFraction * (input.p2 - input.p1);
+		segmentAABBs[i].lowerBound = b2Min(input.p1, t);
+		segmentAABBs[i].upperBound = b2Max(input.p1, t);
+	}
+
+	// Each stack entry carries the rays that still hit the node.
+	struct b2BatchEntry
+	{
+		int32 nodeId;
+		uint32 mask;
+	};
+
+	b2BatchEntry entry;
+	entry.nodeId = m_root;
+	entry.mask = count == 32 ? 0xFFFFFFFFu : (1u << count) - 1;
+
+	b2GrowableStack<b2BatchEntry, 256> stack;
+	stack.Push(entry);
+
+	while (stack.GetCount() > 0)
+	{
+		entry = stack.Pop();
+		if (entry.nodeId == b2_nullNode)
+		{
+			continue;
+		}
+
+		const b2TreeNode* node = m_nodes + entry.nodeId;
+		b2Vec2 c = node->aabb.GetCenter();
+		b2Vec2 h = node->aabb.GetExtents();
+
+		uint32 mask = 0;
+		for (int32 i = 0; i < count; ++i)
+		{
+			if ((entry.mask & (1u << i)) == 0 || b2TestOverlap(node->aabb, segmentAABBs[i]) == false)
+			{
+				continue;
+			}
+
+			// Separating axis for segment (Gino, p80).
+			// |dot(v, p1 - c)| > dot(|v|, h)
+			float32 separation = b2Abs(b2Dot(vs[i], p1s[i] - c)) - b2Dot(abs_vs[i], h);
+			if (separation <= 0.0f)
+			{
+				mask |= 1u << i;
+			}
+		}
+
+		if (mask == 0)
+		{
+			continue;
+		}
+
+		if (node->IsLeaf())
+		{
+			bool proceed = callback->RayCastBatchCallback(entry.nodeId, mask);
+			if (proceed == false)
+			{
+				return;
+			}
+		}
+		else
+		{
+			b2BatchEntry child;
+			child.mask = mask;
+			child.nodeId = node->child1;
+			stack.Push(child);
+			child.nodeId = node->child2;
+			stack.Push(child);
+		}
+	}
+}
+
 #endif
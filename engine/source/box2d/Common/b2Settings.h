@@ -62,6 +62,10 @@ typedef double float64;
 /// This is a dimensionless multiplier.
 #define b2_aabbMultiplier		2.0f
 
+/// The number of queries the dynamic tree can answer in one walk of the tree.
+/// This is the number of bits in the mask passed to the batch callbacks.
+#define b2_maxBatchQueries		32
+
 /// A small length used as a collision and constraint tolerance. Usually it is
 /// chosen to be numerically significant, but visually insignificant.
 #define b2_linearSlop			0.005f
@@ -84,6 +88,12 @@ typedef double float64;
 /// Maximum number of contacts to be handled to solve a TOI impact.
 #define b2_maxTOIContacts			32
 
+/// The number of contacts each task evaluates when a step collides contacts in parallel.
+#define b2_contactsPerTask			64
+
+/// The number of tasks per thread islands are split into when a step solves them in parallel.
+#define b2_solveTasksPerThread		4
+
 /// A velocity threshold for elastic collisions. Any collision with a relative linear
 /// velocity below this threshold will be treated as inelastic.
 #define b2_velocityThreshold		1.0f
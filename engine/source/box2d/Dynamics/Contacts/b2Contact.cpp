@@ -158,7 +158,33 @@ b2Contact::b2Contact(b2Fixture* fA, int32 indexA, b2Fixture* fB, int32 indexB)
 
 // Update the contact manifold and touching status.
 // Note: do not assume the fixture AABBs are overlapping or are valid.
-void b2Contact::Update(b2ContactListener* listener)
+void b2Contact::EvaluateAhead(b2ContactEvaluation* evaluation)
+{
+	b2Body* bodyA = m_fixtureA->GetBody();
+	b2Body* bodyB = m_fixtureB->GetBody();
+	const b2Transform& xfA = bodyA->GetTransform();
+	const b2Transform& xfB = bodyB->GetTransform();
+
+	evaluation->sensor = m_fixtureA->IsSensor() || m_fixtureB->IsSensor();
+	if (evaluation->sensor)
+	{
+		evaluation->manifold.pointCount = 0;
+		evaluation->touching = b2TestOverlap(m_fixtureA->GetShape(), m_indexA, m_fixtureB->GetShape(), m_indexB, xfA, xfB);
+	}
+	else
+	{
+		Evaluate(&evaluation->manifold, xfA, xfB);
+		evaluation->touching = evaluation->manifold.pointCount > 0;
+	}
+}
+
+void b2Contact::AssignIslandIndices()
+{
+	m_islandIndexA = m_fixtureA->GetBody()->m_islandIndex;
+	m_islandIndexB = m_fixtureB->GetBody()->m_islandIndex;
+}
+
+void b2Contact::Update(b2ContactListener* listener, const b2ContactEvaluation* evaluation)
 {
 	b2Manifold oldManifold = m_manifold;
 
@@ -172,6 +198,12 @@ void b2Contact::Update(b2ContactListener* listener)
 	bool sensorB = m_fixtureB->IsSensor();
 	bool sensor = sensorA || sensorB;
 
+	// A listener may have changed the sensor flag since the evaluation.
+	if (evaluation && evaluation->sensor != sensor)
+	{
+		evaluation = NULL;
+	}
+
 	b2Body* bodyA = m_fixtureA->GetBody();
 	b2Body* bodyB = m_fixtureB->GetBody();
 	const b2Transform& xfA = bodyA->GetTransform();
@@ -182,14 +214,21 @@ void b2Contact::Update(b2ContactListener* listener)
 	{
 		const b2Shape* shapeA = m_fixtureA->GetShape();
 		const b2Shape* shapeB = m_fixtureB->GetShape();
-		touching = b2TestOverlap(shapeA, m_indexA, shapeB, m_indexB, xfA, xfB);
+		touching = evaluation ? evaluation->touching : b2TestOverlap(shapeA, m_indexA, shapeB, m_indexB, xfA, xfB);
 
 		// Sensors don't generate manifolds.
 		m_manifold.pointCount = 0;
 	}
 	else
 	{
-		Evaluate(&m_manifold, xfA, xfB);
+		if (evaluation)
+		{
+			m_manifold = evaluation->manifold;
+		}
+		else
+		{
+			Evaluate(&m_manifold, xfA, xfB);
+		}
 		touching = m_manifold.pointCount > 0;
 
 		// Match old contact ids to new contact ids and copy the
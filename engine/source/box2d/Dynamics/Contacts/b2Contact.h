@@ -51,6 +51,15 @@ typedef b2Contact* b2ContactCreateFcn(	b2Fixture* fixtureA, int32 indexA,
 										b2BlockAllocator* allocator);
 typedef void b2ContactDestroyFcn(b2Contact* contact, b2BlockAllocator* allocator);
 
+/// The shapes of a contact evaluated ahead of the contact being updated, so that
+/// contacts can be evaluated on several threads.
+struct b2ContactEvaluation
+{
+	b2Manifold manifold;
+	bool touching;
+	bool sensor;
+};
+
 struct b2ContactRegister
 {
 	b2ContactCreateFcn* createFcn;
@@ -148,6 +157,7 @@ protected:
 	friend class b2ContactManager;
 	friend class b2World;
 	friend class b2ContactSolver;
+	friend class b2Island;
 	friend class b2Body;
 	friend class b2Fixture;
 
@@ -170,7 +180,10 @@ protected:
 		e_bulletHitFlag		= 0x0010,
 
 		// This contact has a valid TOI in m_toi
-		e_toiFlag			= 0x0020
+		e_toiFlag			= 0x0020,
+
+		// This contact was evaluated ahead of being updated
+		e_evaluatedFlag		= 0x0040
 	};
 
 	/// Flag this contact for filtering. Filtering will occur the next time step.
@@ -187,7 +200,17 @@ protected:
 	b2Contact(b2Fixture* fixtureA, int32 indexA, b2Fixture* fixtureB, int32 indexB);
 	virtual ~b2Contact() {}
 
-	void Update(b2ContactListener* listener);
+	/// Evaluate the shapes without changing the contact. Safe to call for
+	/// different contacts at the same time.
+	void EvaluateAhead(b2ContactEvaluation* evaluation);
+
+	/// Update the manifold and touching state and report changes to the listener.
+	/// If given, the evaluation is used instead of evaluating the shapes again.
+	void Update(b2ContactListener* listener, const b2ContactEvaluation* evaluation = NULL);
+
+	/// Record the island indices of the bodies. Static bodies can be in several
+	/// islands, so the solver uses these rather than the body indices.
+	void AssignIslandIndices();
 
 	static b2ContactRegister s_registers[b2Shape::e_typeCount][b2Shape::e_typeCount];
 	static bool s_initialized;
@@ -208,6 +231,9 @@ protected:
 	int32 m_indexA;
 	int32 m_indexB;
 
+	int32 m_islandIndexA;
+	int32 m_islandIndexB;
+
 	b2Manifold m_manifold;
 
 	int32 m_toiCount;
@@ -122,8 +122,6 @@ protected:
 	float32 m_length;
 
 	// Solver temp
-	int32 m_indexA;
-	int32 m_indexB;
 	b2Vec2 m_u;
 	b2Vec2 m_rA;
 	b2Vec2 m_rB;
@@ -102,8 +102,6 @@ protected:
 	float32 m_maxTorque;
 
 	// Solver temp
-	int32 m_indexA;
-	int32 m_indexB;
 	b2Vec2 m_rA;
 	b2Vec2 m_rB;
 	b2Vec2 m_localCenterA;
@@ -83,6 +83,7 @@ protected:
 	void InitVelocityConstraints(const b2SolverData& data);
 	void SolveVelocityConstraints(const b2SolverData& data);
 	bool SolvePositionConstraints(const b2SolverData& data);
+	void AssignIslandIndices();
 
 	b2Joint* m_joint1;
 	b2Joint* m_joint2;
@@ -113,7 +114,7 @@ protected:
 	float32 m_impulse;
 
 	// Solver temp
-	int32 m_indexA, m_indexB, m_indexC, m_indexD;
+	int32 m_indexC, m_indexD;
 	b2Vec2 m_lcA, m_lcB, m_lcC, m_lcD;
 	float32 m_mA, m_mB, m_mC, m_mD;
 	float32 m_iA, m_iB, m_iC, m_iD;
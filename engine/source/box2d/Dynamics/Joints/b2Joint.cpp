@@ -205,6 +205,12 @@ b2Joint::b2Joint(const b2JointDef* def)
 	m_edgeB.next = NULL;
 }
 
+void b2Joint::AssignIslandIndices()
+{
+	m_indexA = m_bodyA->m_islandIndex;
+	m_indexB = m_bodyB->m_islandIndex;
+}
+
 bool b2Joint::IsActive() const
 {
 	return m_bodyA->IsActive() && m_bodyB->IsActive();
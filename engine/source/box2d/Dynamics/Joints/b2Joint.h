@@ -167,6 +167,10 @@ protected:
 	// This returns true if the position errors are within tolerance.
 	virtual bool SolvePositionConstraints(const b2SolverData& data) = 0;
 
+	// Record the island indices of the bodies. Static bodies can be in several
+	// islands, so the solver uses these rather than the body indices.
+	virtual void AssignIslandIndices();
+
 	b2JointType m_type;
 	b2Joint* m_prev;
 	b2Joint* m_next;
@@ -177,6 +181,10 @@ protected:
 
 	int32 m_index;
 
+	// Solver temp
+	int32 m_indexA;
+	int32 m_indexB;
+
 	bool m_islandFlag;
 	bool m_collideConnected;
 
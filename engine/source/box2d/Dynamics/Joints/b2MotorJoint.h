@@ -111,8 +111,6 @@ protected:
 	float32 m_correctionFactor;
 
 	// Solver temp
-	int32 m_indexA;
-	int32 m_indexB;
 	b2Vec2 m_rA;
 	b2Vec2 m_rB;
 	b2Vec2 m_localCenterA;
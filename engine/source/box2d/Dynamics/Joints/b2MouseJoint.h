@@ -116,8 +116,6 @@ protected:
 	float32 m_gamma;
 
 	// Solver temp
-	int32 m_indexA;
-	int32 m_indexB;
 	b2Vec2 m_rB;
 	b2Vec2 m_localCenterB;
 	float32 m_invMassB;
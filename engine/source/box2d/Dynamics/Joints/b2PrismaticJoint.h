@@ -173,8 +173,6 @@ protected:
 	b2LimitState m_limitState;
 
 	// Solver temp
-	int32 m_indexA;
-	int32 m_indexB;
 	b2Vec2 m_localCenterA;
 	b2Vec2 m_localCenterB;
 	float32 m_invMassA;
@@ -159,8 +159,6 @@ protected:
 	bool m_enableMotor;
 
 	// Solver temp
-	int32 m_indexA;
-	int32 m_indexB;
 	b2Vec2 m_localCenterA;
 	b2Vec2 m_localCenterB;
 	float32 m_invMassA;
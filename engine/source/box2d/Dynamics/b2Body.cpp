@@ -453,6 +453,14 @@ void b2Body::SynchronizeFixtures()
 	}
 }
 
+void b2Body::NotifyWoken()
+{
+	if (m_world->m_wakeListener)
+	{
+		m_world->m_wakeListener->BodyWoken(this);
+	}
+}
+
 void b2Body::SetActive(bool flag)
 {
 	b2Assert(m_world->IsLocked() == false);
@@ -391,6 +391,7 @@ private:
 	friend class b2ContactSolver;
 	friend class b2Contact;
 	
+	friend class b2Joint;
 	friend class b2DistanceJoint;
 	friend class b2FrictionJoint;
 	friend class b2GearJoint;
@@ -421,6 +422,9 @@ private:
 	void SynchronizeFixtures();
 	void SynchronizeTransform();
 
+	// Tells the world's wake listener that this body has woken.
+	void NotifyWoken();
+
 	// This is used to prevent connected bodies from colliding.
 	// It may lie, depending on the collideConnected flag.
 	bool ShouldCollide(const b2Body* other) const;
@@ -638,6 +642,7 @@ inline void b2Body::SetAwake(bool flag)
 		{
 			m_flags |= e_awakeFlag;
 			m_sleepTime = 0.0f;
+			NotifyWoken();
 		}
 	}
 	else
@@ -32,6 +32,17 @@ b2ContactManager::b2ContactManager()
 	m_contactFilter = &b2_defaultFilter;
 	m_contactListener = &b2_defaultListener;
 	m_allocator = NULL;
+	m_taskExecutor = NULL;
+	m_evaluatedContacts = NULL;
+	m_evaluations = NULL;
+	m_evaluationCount = 0;
+	m_evaluationCapacity = 0;
+}
+
+b2ContactManager::~b2ContactManager()
+{
+	b2Free(m_evaluatedContacts);
+	b2Free(m_evaluations);
 }
 
 void b2ContactManager::Destroy(b2Contact* c)
@@ -102,12 +113,89 @@ void b2ContactManager::Destroy(b2Contact* c)
 // This is the top level collision call for the time step. Here
 // all the narrow phase collision is processed for the world
 // contact list.
+void b2ContactManager::EvaluateContacts()
+{
+	if (m_evaluationCapacity < m_contactCount)
+	{
+		b2Free(m_evaluatedContacts);
+		b2Free(m_evaluations);
+		m_evaluationCapacity = b2Max(m_contactCount, 2 * m_evaluationCapacity);
+		m_evaluatedContacts = (b2Contact**)b2Alloc(m_evaluationCapacity * sizeof(b2Contact*));
+		m_evaluations = (b2ContactEvaluation*)b2Alloc(m_evaluationCapacity * sizeof(b2ContactEvaluation));
+	}
+
+	// Pick the contacts that will be updated unless a listener or a body waking
+	// up changes things first.
+	int32 count = 0;
+	for (b2Contact* c = m_contactList; c; c = c->GetNext())
+	{
+		if (c->m_flags & b2Contact::e_filterFlag)
+		{
+			continue;
+		}
+
+		b2Fixture* fixtureA = c->GetFixtureA();
+		b2Fixture* fixtureB = c->GetFixtureB();
+		b2Body* bodyA = fixtureA->GetBody();
+		b2Body* bodyB = fixtureB->GetBody();
+
+		bool activeA = bodyA->IsAwake() && bodyA->m_type != b2_staticBody;
+		bool activeB = bodyB->IsAwake() && bodyB->m_type != b2_staticBody;
+		if (activeA == false && activeB == false)
+		{
+			continue;
+		}
+
+		int32 proxyIdA = fixtureA->m_proxies[c->GetChildIndexA()].proxyId;
+		int32 proxyIdB = fixtureB->m_proxies[c->GetChildIndexB()].proxyId;
+		if (m_broadPhase.TestOverlap(proxyIdA, proxyIdB) == false)
+		{
+			continue;
+		}
+
+		c->m_flags |= b2Contact::e_evaluatedFlag;
+		m_evaluatedContacts[count++] = c;
+	}
+
+	m_evaluationCount = count;
+	int32 taskCount = (count + b2_contactsPerTask - 1) / b2_contactsPerTask;
+	m_taskExecutor->ParallelFor(&b2ContactManager::EvaluateContactsTask, this, taskCount);
+}
+
+void b2ContactManager::EvaluateContactsTask(void* context, int32 index)
+{
+	b2ContactManager* manager = (b2ContactManager*)context;
+	int32 begin = index * b2_contactsPerTask;
+	int32 end = b2Min(begin + b2_contactsPerTask, manager->m_evaluationCount);
+	for (int32 i = begin; i < end; ++i)
+	{
+		manager->m_evaluatedContacts[i]->EvaluateAhead(manager->m_evaluations + i);
+	}
+}
+
 void b2ContactManager::Collide()
 {
+	// With a task executor, the narrow-phase runs on the task threads first. The
+	// loop below still updates the contacts in order on this thread, evaluating
+	// any that were not evaluated ahead, so the results are the same however
+	// many threads there are.
+	if (m_taskExecutor)
+	{
+		EvaluateContacts();
+	}
+	int32 evaluationIndex = 0;
+
 	// Update awake contacts.
 	b2Contact* c = m_contactList;
 	while (c)
 	{
+		const b2ContactEvaluation* evaluation = NULL;
+		if (c->m_flags & b2Contact::e_evaluatedFlag)
+		{
+			c->m_flags &= ~b2Contact::e_evaluatedFlag;
+			evaluation = m_evaluations + evaluationIndex++;
+		}
+
 		b2Fixture* fixtureA = c->GetFixtureA();
 		b2Fixture* fixtureB = c->GetFixtureB();
 		int32 indexA = c->GetChildIndexA();
@@ -164,7 +252,7 @@ void b2ContactManager::Collide()
 		}
 
 		// The contact persists.
-		c->Update(m_contactListener);
+		c->Update(m_contactListener, evaluation);
 		c = c->GetNext();
 	}
 }
@@ -25,12 +25,15 @@ class b2Contact;
 class b2ContactFilter;
 class b2ContactListener;
 class b2BlockAllocator;
+class b2TaskExecutor;
+struct b2ContactEvaluation;
 
 // Delegate of b2World.
 class b2ContactManager
 {
 public:
 	b2ContactManager();
+	~b2ContactManager();
 
 	// Broad-phase callback.
 	void AddPair(void* proxyUserDataA, void* proxyUserDataB);
@@ -40,6 +43,11 @@ public:
 	void Destroy(b2Contact* c);
 
 	void Collide();
+
+	// Evaluate the contacts Collide is likely to update on the task executor.
+	void EvaluateContacts();
+
+	static void EvaluateContactsTask(void* context, int32 index);
             
 	b2BroadPhase m_broadPhase;
 	b2Contact* m_contactList;
@@ -47,6 +55,13 @@ public:
 	b2ContactFilter* m_contactFilter;
 	b2ContactListener* m_contactListener;
 	b2BlockAllocator* m_allocator;
+	b2TaskExecutor* m_taskExecutor;
+
+	// Contacts evaluated ahead of Collide, in contact list order.
+	b2Contact** m_evaluatedContacts;
+	b2ContactEvaluation* m_evaluations;
+	int32 m_evaluationCount;
+	int32 m_evaluationCapacity;
 };
 
 #endif
@@ -28,6 +28,7 @@ class b2Joint;
 class b2StackAllocator;
 class b2ContactListener;
 struct b2ContactVelocityConstraint;
+struct b2ContactImpulse;
 struct b2Profile;
 
 /// This is an internal class.
@@ -69,11 +70,19 @@ public:
 		m_joints[m_jointCount++] = joint;
 	}
 
+	/// Record the island indices of the bodies each contact and joint connects.
+	/// Call this once every body has been added.
+	void AssignIslandIndices();
+
 	void Report(const b2ContactVelocityConstraint* constraints);
 
 	b2StackAllocator* m_allocator;
 	b2ContactListener* m_listener;
 
+	/// If set, the contact impulses are stored here instead of being reported
+	/// to the listener.
+	b2ContactImpulse* m_impulses;
+
 	b2Body** m_bodies;
 	b2Contact** m_contacts;
 	b2Joint** m_joints;
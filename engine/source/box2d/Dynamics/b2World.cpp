@@ -37,6 +37,7 @@
 b2World::b2World(const b2Vec2& gravity)
 {
 	m_destructionListener = NULL;
+	m_wakeListener = NULL;
 	m_debugDraw = NULL;
 
 	m_bodyList = NULL;
@@ -60,6 +61,10 @@ b2World::b2World(const b2Vec2& gravity)
 
 	m_contactManager.m_allocator = &m_blockAllocator;
 
+	m_taskExecutor = NULL;
+	m_taskAllocators = NULL;
+	m_taskAllocatorCount = 0;
+
 	memset(&m_profile, 0, sizeof(b2Profile));
 }
 
@@ -82,6 +87,12 @@ b2World::~b2World()
 
 		b = bNext;
 	}
+
+	for (int32 i = 0; i < m_taskAllocatorCount; ++i)
+	{
+		m_taskAllocators[i].~b2StackAllocator();
+	}
+	b2Free(m_taskAllocators);
 }
 
 void b2World::SetDestructionListener(b2DestructionListener* listener)
@@ -99,6 +110,17 @@ void b2World::SetContactListener(b2ContactListener* listener)
 	m_contactManager.m_contactListener = listener;
 }
 
+void b2World::SetTaskExecutor(b2TaskExecutor* executor)
+{
+	m_taskExecutor = executor;
+	m_contactManager.m_taskExecutor = executor;
+}
+
+void b2World::SetWakeListener(b2WakeListener* listener)
+{
+	m_wakeListener = listener;
+}
+
 void b2World::SetDebugDraw(b2Draw* debugDraw)
 {
 	m_debugDraw = debugDraw;
@@ -382,6 +404,103 @@ void b2World::SetAllowSleeping(bool flag)
 	}
 }
 
+// An island gathered to be solved on the task threads.
+struct b2IslandRange
+{
+	int32 bodyStart;
+	int32 bodyCount;
+	int32 contactStart;
+	int32 contactCount;
+	int32 jointStart;
+	int32 jointCount;
+};
+
+// The islands of a step solved on the task threads.
+struct b2IslandSolveContext
+{
+	b2World* world;
+	b2TimeStep step;
+
+	b2IslandRange* islands;
+	int32 islandCount;
+
+	// The first island of each task, followed by the island count.
+	int32* taskIslands;
+	b2Profile* profiles;
+
+	b2Body** bodies;
+	b2Contact** contacts;
+	b2Joint** joints;
+	b2ContactImpulse* impulses;
+	int32 bodyCount;
+	int32 contactCount;
+	int32 jointCount;
+};
+
+void b2World::ReserveTaskAllocators(int32 count)
+{
+	if (count <= m_taskAllocatorCount)
+	{
+		return;
+	}
+
+	for (int32 i = 0; i < m_taskAllocatorCount; ++i)
+	{
+		m_taskAllocators[i].~b2StackAllocator();
+	}
+	b2Free(m_taskAllocators);
+
+	m_taskAllocators = (b2StackAllocator*)b2Alloc(count * sizeof(b2StackAllocator));
+	for (int32 i = 0; i < count; ++i)
+	{
+		new (m_taskAllocators + i) b2StackAllocator;
+	}
+	m_taskAllocatorCount = count;
+}
+
+void b2World::SolveIslandsTask(void* context, int32 index)
+{
+	b2IslandSolveContext* solve = (b2IslandSolveContext*)context;
+	b2World* world = solve->world;
+	int32 firstIsland = solve->taskIslands[index];
+	int32 endIsland = solve->taskIslands[index + 1];
+
+	// Size the island for the largest one in this task.
+	int32 bodyCapacity = 0;
+	int32 contactCapacity = 0;
+	int32 jointCapacity = 0;
+	for (int32 i = firstIsland; i < endIsland; ++i)
+	{
+		bodyCapacity = b2Max(bodyCapacity, solve->islands[i].bodyCount);
+		contactCapacity = b2Max(contactCapacity, solve->islands[i].contactCount);
+		jointCapacity = b2Max(jointCapacity, solve->islands[i].jointCount);
+	}
+
+	b2Island island(bodyCapacity, contactCapacity, jointCapacity, world->m_taskAllocators + index, NULL);
+	b2Profile* taskProfile = solve->profiles + index;
+
+	for (int32 i = firstIsland; i < endIsland; ++i)
+	{
+		const b2IslandRange& range = solve->islands[i];
+
+		// The bodies were indexed when the island was built. Adding them again would
+		// change the indices of static bodies other tasks may be reading.
+		memcpy(island.m_bodies, solve->bodies + range.bodyStart, range.bodyCount * sizeof(b2Body*));
+		memcpy(island.m_contacts, solve->contacts + range.contactStart, range.contactCount * sizeof(b2Contact*));
+		memcpy(island.m_joints, solve->joints + range.jointStart, range.jointCount * sizeof(b2Joint*));
+		island.m_bodyCount = range.bodyCount;
+		island.m_contactCount = range.contactCount;
+		island.m_jointCount = range.jointCount;
+		island.m_impulses = solve->impulses + range.contactStart;
+
+		b2Profile profile;
+		island.Solve(&profile, solve->step, world->m_gravity, world->m_allowSleep);
+		taskProfile->solveInit += profile.solveInit;
+		taskProfile->solveVelocity += profile.solveVelocity;
+		taskProfile->solvePosition += profile.solvePosition;
+	}
+}
+
 // Find islands, integrate and solve constraints, solve position constraints
 void b2World::Solve(const b2TimeStep& step)
 {
@@ -413,6 +532,25 @@ void b2World::Solve(const b2TimeStep& step)
 	// Build and simulate all awake islands.
 	int32 stackSize = m_bodyCount;
 	b2Body** stack = (b2Body**)m_stackAllocator.Allocate(stackSize * sizeof(b2Body*));
+
+	// With a task executor, the islands are gathered here and solved afterwards on
+	// the task threads. Static bodies can be in several islands, so contacts and
+	// joints record the island indices they use before the next island is built.
+	b2IslandSolveContext solve;
+	if (m_taskExecutor)
+	{
+		solve.world = this;
+		solve.step = step;
+		solve.islandCount = 0;
+		solve.bodyCount = 0;
+		solve.contactCount = 0;
+		solve.jointCount = 0;
+		solve.islands = (b2IslandRange*)m_stackAllocator.Allocate(m_bodyCount * sizeof(b2IslandRange));
+		solve.bodies = (b2Body**)m_stackAllocator.Allocate((m_bodyCount + m_contactManager.m_contactCount + m_jointCount) * sizeof(b2Body*));
+		solve.contacts = (b2Contact**)m_stackAllocator.Allocate(m_contactManager.m_contactCount * sizeof(b2Contact*));
+		solve.joints = (b2Joint**)m_stackAllocator.Allocate(m_jointCount * sizeof(b2Joint*));
+		solve.impulses = (b2ContactImpulse*)m_stackAllocator.Allocate(m_contactManager.m_contactCount * sizeof(b2ContactImpulse));
+	}
 	for (b2Body* seed = m_bodyList; seed; seed = seed->m_next)
 	{
 		if (seed->m_flags & b2Body::e_islandFlag)
@@ -527,11 +665,33 @@ void b2World::Solve(const b2TimeStep& step)
 			}
 		}
 
-		b2Profile profile;
-		island.Solve(&profile, step, m_gravity, m_allowSleep);
-		m_profile.solveInit += profile.solveInit;
-		m_profile.solveVelocity += profile.solveVelocity;
-		m_profile.solvePosition += profile.solvePosition;
+		island.AssignIslandIndices();
+
+		if (m_taskExecutor)
+		{
+			b2IslandRange* range = solve.islands + solve.islandCount++;
+			range->bodyStart = solve.bodyCount;
+			range->bodyCount = island.m_bodyCount;
+			range->contactStart = solve.contactCount;
+			range->contactCount = island.m_contactCount;
+			range->jointStart = solve.jointCount;
+			range->jointCount = island.m_jointCount;
+
+			memcpy(solve.bodies + solve.bodyCount, island.m_bodies, island.m_bodyCount * sizeof(b2Body*));
+			memcpy(solve.contacts + solve.contactCount, island.m_contacts, island.m_contactCount * sizeof(b2Contact*));
+			memcpy(solve.joints + solve.jointCount, island.m_joints, island.m_jointCount * sizeof(b2Joint*));
+			solve.bodyCount += island.m_bodyCount;
+			solve.contactCount += island.m_contactCount;
+			solve.jointCount += island.m_jointCount;
+		}
+		else
+		{
+			b2Profile profile;
+			island.Solve(&profile, step, m_gravity, m_allowSleep);
+			m_profile.solveInit += profile.solveInit;
+			m_profile.solveVelocity += profile.solveVelocity;
+			m_profile.solvePosition += profile.solvePosition;
+		}
 
 		// Post solve cleanup.
 		for (int32 i = 0; i < island.m_bodyCount; ++i)
@@ -545,6 +705,61 @@ void b2World::Solve(const b2TimeStep& step)
 		}
 	}
 
+	if (m_taskExecutor)
+	{
+		// Split the islands, in order, into tasks of about the same size.
+		int32 threadCount = b2Max(m_taskExecutor->GetThreadCount(), 1);
+		int32 maxTaskCount = b2Max(b2Min(solve.islandCount, threadCount * b2_solveTasksPerThread), 1);
+		solve.taskIslands = (int32*)m_stackAllocator.Allocate((maxTaskCount + 1) * sizeof(int32));
+		solve.profiles = (b2Profile*)m_stackAllocator.Allocate(maxTaskCount * sizeof(b2Profile));
+
+		float32 totalSize = float32(solve.bodyCount + solve.contactCount + solve.jointCount);
+		float32 size = 0.0f;
+		int32 taskCount = 0;
+		solve.taskIslands[0] = 0;
+		for (int32 i = 0; i < solve.islandCount; ++i)
+		{
+			const b2IslandRange& range = solve.islands[i];
+			size += float32(range.bodyCount + range.contactCount + range.jointCount);
+			if (size * maxTaskCount >= totalSize * (taskCount + 1) || i == solve.islandCount - 1)
+			{
+				solve.taskIslands[++taskCount] = i + 1;
+			}
+		}
+
+		if (taskCount > 0)
+		{
+			memset(solve.profiles, 0, taskCount * sizeof(b2Profile));
+			ReserveTaskAllocators(taskCount);
+			m_taskExecutor->ParallelFor(&b2World::SolveIslandsTask, &solve, taskCount);
+		}
+
+		for (int32 i = 0; i < taskCount; ++i)
+		{
+			m_profile.solveInit += solve.profiles[i].solveInit;
+			m_profile.solveVelocity += solve.profiles[i].solveVelocity;
+			m_profile.solvePosition += solve.profiles[i].solvePosition;
+		}
+
+		// Report the impulses in the order the islands were built.
+		b2ContactListener* listener = m_contactManager.m_contactListener;
+		if (listener)
+		{
+			for (int32 i = 0; i < solve.contactCount; ++i)
+			{
+				listener->PostSolve(solve.contacts[i], solve.impulses + i);
+			}
+		}
+
+		m_stackAllocator.Free(solve.profiles);
+		m_stackAllocator.Free(solve.taskIslands);
+		m_stackAllocator.Free(solve.impulses);
+		m_stackAllocator.Free(solve.joints);
+		m_stackAllocator.Free(solve.contacts);
+		m_stackAllocator.Free(solve.bodies);
+		m_stackAllocator.Free(solve.islands);
+	}
+
 	m_stackAllocator.Free(stack);
 
 	{
@@ -860,6 +1075,7 @@ void b2World::SolveTOI(const b2TimeStep& step)
 		subStep.positionIterations = 20;
 		subStep.velocityIterations = step.velocityIterations;
 		subStep.warmStarting = false;
+		island.AssignIslandIndices();
 		island.SolveTOI(subStep, bA->m_islandIndex, bB->m_islandIndex);
 
 		// Reset island flags and synchronize broad-phase proxies.
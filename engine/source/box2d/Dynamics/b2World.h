@@ -61,6 +61,19 @@ public:
 	/// remain in scope.
 	void SetContactListener(b2ContactListener* listener);
 
+	/// Register a task executor to collide contacts and solve islands on several
+	/// threads. The executor is owned by you and must remain in scope. Pass NULL
+	/// to step on the calling thread only.
+	/// Note: with an executor, PostSolve is called once every island is solved.
+	void SetTaskExecutor(b2TaskExecutor* executor);
+
+	/// Get the task executor, if any.
+	b2TaskExecutor* GetTaskExecutor() const { return m_taskExecutor; }
+
+	/// Register a listener to be told when sleeping bodies wake up. The listener
+	/// is owned by you and must remain in scope.
+	void SetWakeListener(b2WakeListener* listener);
+
 	/// Register a routine for debug drawing. The debug draw functions are called
 	/// inside with b2World::DrawDebugData method. The debug draw object is owned
 	/// by you and must remain in scope.
@@ -227,12 +240,20 @@ private:
 	void Solve(const b2TimeStep& step);
 	void SolveTOI(const b2TimeStep& step);
 
+	void ReserveTaskAllocators(int32 count);
+	static void SolveIslandsTask(void* context, int32 index);
+
 	void DrawJoint(b2Joint* joint);
 	void DrawShape(b2Fixture* shape, const b2Transform& xf, const b2Color& color);
 
 	b2BlockAllocator m_blockAllocator;
 	b2StackAllocator m_stackAllocator;
 
+	// Islands solved on the task threads use one stack allocator per task.
+	b2TaskExecutor* m_taskExecutor;
+	b2StackAllocator* m_taskAllocators;
+	int32 m_taskAllocatorCount;
+
 	int32 m_flags;
 
 	b2ContactManager m_contactManager;
@@ -247,6 +268,7 @@ private:
 	bool m_allowSleep;
 
 	b2DestructionListener* m_destructionListener;
+	b2WakeListener* m_wakeListener;
 	b2Draw* m_debugDraw;
 
 	// This is used to compute the time step ratio to
@@ -152,4 +152,34 @@ public:
 									const b2Vec2& normal, float32 fraction) = 0;
 };
 
+/// Runs the independent parts of a time step on several threads. Implement this
+/// with your job system and register it with b2World::SetTaskExecutor. The
+/// results of a step do not depend on the number of threads used.
+class b2TaskExecutor
+{
+public:
+	virtual ~b2TaskExecutor() {}
+
+	typedef void b2TaskFunction(void* context, int32 index);
+
+	/// Call task(context, index) for every index in [0, count), in any order and
+	/// on any threads, and return once all of them have finished.
+	virtual void ParallelFor(b2TaskFunction* task, void* context, int32 count) = 0;
+
+	/// Get the number of threads tasks can run on, including the calling thread.
+	virtual int32 GetThreadCount() const = 0;
+};
+
+/// Implement this class to be told when a sleeping body wakes up, whether it was
+/// woken by the world or by you. Register it with b2World::SetWakeListener.
+class b2WakeListener
+{
+public:
+	virtual ~b2WakeListener() {}
+
+	/// Called when a sleeping body is woken. This is always called on the thread
+	/// stepping the world, never from a task.
+	virtual void BodyWoken(b2Body* body) = 0;
+};
+
 #endif
@@ -1286,11 +1286,25 @@ TypeReq TTagExprNode::getPreferredType()
 
 //------------------------------------------------------------
 
+// Numeric arguments are pushed as numbers and only formatted if the callee
+// wants a string.  Literals already have their string in the string table.
+static TypeReq getArgumentType(ExprNode *arg)
+{
+   if(dynamic_cast<IntNode *>(arg) || dynamic_cast<FloatNode *>(arg))
+      return TypeReqString;
+
+   TypeReq type = arg->getPreferredType();
+   if(type == TypeReqUInt || type == TypeReqFloat)
+      return type;
+   return TypeReqString;
+}
+
 U32 FuncCallExprNode::precompile(TypeReq type)
 {
    // OP_PUSH_FRAME
    // arg OP_PUSH arg OP_PUSH arg OP_PUSH
    // eval all the args, then call the function.
+   // Numeric args use OP_PUSH_UINT or OP_PUSH_FLT instead of OP_PUSH.
 
    // OP_CALLFUNC
    // function
@@ -1303,7 +1317,7 @@ U32 FuncCallExprNode::precompile(TypeReq type)
    precompileIdent(funcName);
    precompileIdent(nameSpace);
    for(ExprNode *walk = args; walk; walk = (ExprNode *) walk->getNext())
-      size += walk->precompile(TypeReqString) + 1;
+      size += walk->precompile(getArgumentType(walk)) + 1;
    return size + 5;
 }
 
@@ -1312,8 +1326,14 @@ U32 FuncCallExprNode::compile(U32 *codeStream, U32 ip, TypeReq type)
    codeStream[ip++] = OP_PUSH_FRAME;
    for(ExprNode *walk = args; walk; walk = (ExprNode *) walk->getNext())
    {
-      ip = walk->compile(codeStream, ip, TypeReqString);
-      codeStream[ip++] = OP_PUSH;
+      TypeReq argType = getArgumentType(walk);
+      ip = walk->compile(codeStream, ip, argType);
+      if(argType == TypeReqUInt)
+         codeStream[ip++] = OP_PUSH_UINT;
+      else if(argType == TypeReqFloat)
+         codeStream[ip++] = OP_PUSH_FLT;
+      else
+         codeStream[ip++] = OP_PUSH;
    }
    if(callType == MethodCall || callType == ParentCall)
       codeStream[ip++] = OP_CALLFUNC;
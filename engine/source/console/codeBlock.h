@@ -25,8 +25,10 @@
 
 #include "console/compiler.h"
 #include "console/consoleParser.h"
+#include "console/consoleNamespace.h"
 
 class Stream;
+class ConsoleValue;
 
 
 /// Core TorqueScript code management class.
@@ -82,6 +84,18 @@ public:
    CodeBlock *nextFile;
    StringTableEntry mRoot;
 
+   /// The lookup cache for a function or method call in the code.
+   struct CallSite
+   {
+      Namespace *mNamespace;              ///< The namespace of a function call.  Method and parent calls use the namespace being called.
+      Namespace::EntryCache mEntryCache;
+
+      CallSite() : mNamespace(NULL) {}
+   };
+
+   /// Call sites indexed by their OP_CALLFUNC_CACHED instructions.
+   Vector<CallSite> callSites;
+
 
    void addToCodeList();
    void removeFromCodeList();
@@ -143,9 +157,11 @@ public:
    /// -1 a new frame is created. If the index is out of range the
    /// top stack frame is used.
    /// @param packageName The code package name or null.
+   /// @param argValues The function parameters as tagged values, used
+   /// instead of argv when argv is null.
    const char *exec(U32 offset, const char *fnName, Namespace *ns, U32 argc, 
       const char **argv, bool noCalls, StringTableEntry packageName, 
-      S32 setFrame = -1);
+      S32 setFrame = -1, ConsoleValue *argValues = NULL);
 };
 
 #endif
@@ -39,6 +39,7 @@
 #include "string/stringStack.h"
 #include "messaging/message.h"
 #include "memory/frameAllocator.h"
+#include "debug/scriptProfiler.h"
 
 #include "debug/telnetDebugger.h"
 
@@ -447,7 +448,30 @@ static void setFieldComponent( SimObject* object, StringTableEntry field, const
     }
 }
 
-const char *CodeBlock::exec(U32 ip, const char *functionName, Namespace *thisNamespace, U32 argc, const char **argv, bool noCalls, StringTableEntry packageName, S32 setFrame)
+// Store a tagged argument in the current variable.  Variables hold floats
+// at single precision, so a float that would lose digits keeps its string form.
+static void setArgumentVariable(ConsoleValue &value)
+{
+   switch(value.getType())
+   {
+      case ConsoleValue::TypeInt:
+         gEvalState.setIntVariable(value.getIntValue());
+         break;
+
+      case ConsoleValue::TypeFloat:
+         if((F64)(F32)value.getFloatValue() == value.getFloatValue())
+            gEvalState.setFloatVariable(value.getFloatValue());
+         else
+            gEvalState.setStringVariable(value.getStringValue());
+         break;
+
+      default:
+         gEvalState.setStringVariable(value.getStringValue());
+         break;
+   }
+}
+
+const char *CodeBlock::exec(U32 ip, const char *functionName, Namespace *thisNamespace, U32 argc, const char **argv, bool noCalls, StringTableEntry packageName, S32 setFrame, ConsoleValue *argValues)
 {
 #ifdef TORQUE_DEBUG
    U32 stackStart = STR.mStartStackSize;
@@ -462,7 +486,8 @@ const char *CodeBlock::exec(U32 ip, const char *functionName, Namespace *thisNam
    STR.clearFunctionOffset();
    StringTableEntry thisFunctionName = NULL;
    bool popFrame = false;
-   if(argv)
+   U32 profilerToken = 0;
+   if(argv || argValues)
    {
       // assume this points into a function decl:
       U32 fnArgc = code[ip + 5];
@@ -490,7 +515,7 @@ const char *CodeBlock::exec(U32 ip, const char *functionName, Namespace *thisNam
          }
          for(i = 0; i < argc; i++)
          {
-            dStrcat(traceBuffer, argv[i+1]);
+            dStrcat(traceBuffer, argv ? argv[i+1] : argValues[i+1].getStringValue());
             if(i != argc - 1)
                dStrcat(traceBuffer, ", ");
          }
@@ -499,11 +524,15 @@ const char *CodeBlock::exec(U32 ip, const char *functionName, Namespace *thisNam
       }
       gEvalState.pushFrame(thisFunctionName, thisNamespace);
       popFrame = true;
+      profilerToken = gScriptProfiler.enterFunction(this, ip, thisNamespace ? thisNamespace->mName : NULL, thisFunctionName);
       for(i = 0; i < argc; i++)
       {
          StringTableEntry var = U32toSTE(code[ip + i + 6]);
          gEvalState.setCurVarNameCreate(var);
-         gEvalState.setStringVariable(argv[i+1]);
+         if(argv)
+            gEvalState.setStringVariable(argv[i+1]);
+         else
+            setArgumentVariable(argValues[i+1]);
       }
       ip = ip + fnArgc + 6;
       curFloatTable = functionFloats;
@@ -562,6 +591,7 @@ const char *CodeBlock::exec(U32 ip, const char *functionName, Namespace *thisNam
 
    U32 callArgc;
    const char **callArgv;
+   ConsoleValue *callValues;
 
    static char curFieldArray[256];
    static char prevFieldArray[256];
@@ -579,9 +609,15 @@ const char *CodeBlock::exec(U32 ip, const char *functionName, Namespace *thisNam
    // OP_LOADFIELD_*) to store temporary values for the fields.
    static S32 VAL_BUFFER_SIZE = 1024;
    FrameTemp<char> valBuffer( VAL_BUFFER_SIZE );
+
+   // Checked once so the loop only pays for line sampling while it is on.
+   const bool sampleLines = gScriptProfiler.isSamplingLines();
    
    for(;;)
    {
+      if(sampleLines && gScriptProfiler.tickLineSample())
+         gScriptProfiler.sampleLine(this, ip);
+
       U32 instruction = code[ip++];
 breakContinue:
       switch(instruction)
@@ -1414,29 +1450,20 @@ breakContinue:
             break;
 
          case OP_CALLFUNC_RESOLVE:
-            // This deals with a function that is potentially living in a namespace.
-            fnNamespace = U32toSTE(code[ip+1]);
-            fnName      = U32toSTE(code[ip]);
-
-            // Try to look it up.
-            ns = Namespace::find(fnNamespace);
-            nsEntry = ns->lookup(fnName);
-            if(!nsEntry)
-            {
-               ip+= 3;
-               Con::warnf(ConsoleLogEntry::General,
-                  "%s: Unable to find function %s%s%s",
-                  getFileLine(ip-4), fnNamespace ? fnNamespace : "",
-                  fnNamespace ? "::" : "", fnName);
-               STR.popFrame();
-               break;
-            }
-            // Now, rewrite our code a bit (ie, avoid future lookups) and fall
-            // through to OP_CALLFUNC
-            code[ip+1] = *((U32 *) &nsEntry);
-            code[ip-1] = OP_CALLFUNC;
-
          case OP_CALLFUNC:
+         {
+            // This is the first call made from this site, so give it a lookup cache.
+            // Function calls resolve their namespace here as it never changes.  Then
+            // rewrite our code a bit (ie, avoid future lookups) and fall through to
+            // OP_CALLFUNC_CACHED.
+            CallSite callSite;
+            callSite.mNamespace = instruction == OP_CALLFUNC_RESOLVE ? Namespace::find(U32toSTE(code[ip+1])) : NULL;
+            code[ip+1] = callSites.size();
+            code[ip-1] = OP_CALLFUNC_CACHED;
+            callSites.push_back(callSite);
+         }
+
+         case OP_CALLFUNC_CACHED:
          {
             // This routingId is set when we query the object as to whether
             // it handles this method.  It is set to an enum from the table
@@ -1446,6 +1473,28 @@ breakContinue:
 
             fnName = U32toSTE(code[ip]);
 
+            // Calls can add call sites to this block so they are always reached by index.
+            const U32 callSiteIndex = code[ip+1];
+            U32 callType = code[ip+2];
+
+            if(callType == FuncCallExprNode::FunctionCall)
+            {
+               // Try to look it up.
+               CallSite &callSite = callSites[callSiteIndex];
+               nsEntry = callSite.mEntryCache.lookup(callSite.mNamespace, fnName);
+               if(!nsEntry)
+               {
+                  fnNamespace = callSite.mNamespace->mName;
+                  ip+= 3;
+                  Con::warnf(ConsoleLogEntry::General,
+                     "%s: Unable to find function %s%s%s",
+                     getFileLine(ip-4), fnNamespace ? fnNamespace : "",
+                     fnNamespace ? "::" : "", fnName);
+                  STR.popFrame();
+                  break;
+               }
+            }
+
             //if this is called from inside a function, append the ip and codeptr
             if (!gEvalState.stack.empty())
             {
@@ -1453,24 +1502,24 @@ breakContinue:
                gEvalState.stack.last()->ip = ip - 1;
             }
 
-            U32 callType = code[ip+2];
-
             ip += 3;
-            STR.getArgcArgv(fnName, &callArgc, &callArgv);
+
+            // Script functions and typed console functions take the arguments as
+            // they are; string arguments are only built for everything else.
+            STR.getArgValues(fnName, &callArgc, &callValues);
 
             if(callType == FuncCallExprNode::FunctionCall) 
             {
-               nsEntry = *((Namespace::Entry **) &code[ip-2]);
                ns = NULL;
             }
             else if(callType == FuncCallExprNode::MethodCall)
             {
                saveObject = gEvalState.thisObject;
-               gEvalState.thisObject = Sim::findObject(callArgv[1]);
+               gEvalState.thisObject = Sim::findObject(callValues[1].getStringValue());
                if(!gEvalState.thisObject)
                {
                   gEvalState.thisObject = 0;
-                  Con::warnf(ConsoleLogEntry::General,"%s: Unable to find object: '%s' attempting to call function '%s'", getFileLine(ip-4), callArgv[1], fnName);
+                  Con::warnf(ConsoleLogEntry::General,"%s: Unable to find object: '%s' attempting to call function '%s'", getFileLine(ip-4), callValues[1].getStringValue(), fnName);
                   
                   STR.popFrame(); // [neo, 5/7/2007 - #2974]
 
@@ -1482,30 +1531,19 @@ breakContinue:
                {
                   DynamicConsoleMethodComponent *pComponent = dynamic_cast<DynamicConsoleMethodComponent*>( gEvalState.thisObject );
                   if( pComponent )
+                  {
+                     STR.getArgcArgv(fnName, &callArgc, &callArgv);
                      pComponent->callMethodArgList( callArgc, callArgv, false );
+                  }
                }
                
                ns = gEvalState.thisObject->getNamespace();
-               if(ns)
-                  nsEntry = ns->lookup(fnName);
-               else
-                  nsEntry = NULL;
+               nsEntry = callSites[callSiteIndex].mEntryCache.lookup(ns, fnName);
             }
             else // it's a ParentCall
             {
-               if(thisNamespace)
-               {
-                  ns = thisNamespace->mParent;
-                  if(ns)
-                     nsEntry = ns->lookup(fnName);
-                  else
-                     nsEntry = NULL;
-               }
-               else
-               {
-                  ns = NULL;
-                  nsEntry = NULL;
-               }
+               ns = thisNamespace ? thisNamespace->mParent : NULL;
+               nsEntry = callSites[callSiteIndex].mEntryCache.lookup(ns, fnName);
             }
 
             S32 nsType = -1;
@@ -1543,7 +1581,7 @@ breakContinue:
             {
                const char *ret = "";
                if(nsEntry->mFunctionOffset)
-                  ret = nsEntry->mCode->exec(nsEntry->mFunctionOffset, fnName, nsEntry->mNamespace, callArgc, callArgv, false, nsEntry->mPackage);
+                  ret = nsEntry->mCode->exec(nsEntry->mFunctionOffset, fnName, nsEntry->mNamespace, callArgc, NULL, false, nsEntry->mPackage, -1, callValues);
                
                STR.popFrame();
                STR.setStringValue(ret);
@@ -1559,6 +1597,9 @@ breakContinue:
                }
                else
                {
+                  if(nsEntry->mType != Namespace::Entry::ValueCallbackType)
+                     STR.getArgcArgv(fnName, &callArgc, &callArgv);
+
                   switch(nsEntry->mType)
                   {
                      case Namespace::Entry::StringCallbackType:
@@ -1645,6 +1686,38 @@ breakContinue:
                            STR.setIntValue(result);
                         break;
                      }
+                     case Namespace::Entry::ValueCallbackType:
+                     {
+                        ConsoleValue result = nsEntry->cb.mValueCallbackFunc(gEvalState.thisObject, callArgc, callValues);
+                        STR.popFrame();
+                        if(code[ip] == OP_STR_TO_UINT)
+                        {
+                           ip++;
+                           intStack[++UINT] = result.getIntValue();
+                           break;
+                        }
+                        else if(code[ip] == OP_STR_TO_FLT)
+                        {
+                           ip++;
+                           floatStack[++FLT] = result.getFloatValue();
+                           break;
+                        }
+                        else if(code[ip] == OP_STR_TO_NONE)
+                           ip++;
+                        else if(result.getType() == ConsoleValue::TypeInt)
+                           STR.setIntValue(result.getIntValue());
+                        else if(result.getType() == ConsoleValue::TypeFloat)
+                           STR.setFloatValue(result.getFloatValue());
+                        else
+                        {
+                           const char *ret = result.getStringValue();
+                           if(ret != STR.getStringValue())
+                              STR.setStringValue(ret);
+                           else
+                              STR.setLen(dStrlen(ret));
+                        }
+                        break;
+                     }
                   }
                }
             }
@@ -1683,6 +1756,16 @@ breakContinue:
             STR.push();
             break;
 
+         case OP_PUSH_UINT:
+            STR.pushInt((S32)intStack[UINT]);
+            UINT--;
+            break;
+
+         case OP_PUSH_FLT:
+            STR.pushFloat(floatStack[FLT]);
+            FLT--;
+            break;
+
          case OP_PUSH_FRAME:
             STR.pushFrame();
             break;
@@ -1724,7 +1807,10 @@ execFinished:
    if ( popFrame )
       gEvalState.popFrame();
 
-   if(argv)
+   if ( profilerToken )
+      gScriptProfiler.exitFunction(profilerToken);
+
+   if(argv || argValues)
    {
       if(gEvalState.traceOn)
       {
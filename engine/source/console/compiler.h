@@ -137,10 +137,16 @@ namespace Compiler
       OP_COMPARE_STR,
 
       OP_PUSH,
+      OP_PUSH_UINT,      ///< Push a call argument from the int stack without formatting it.
+      OP_PUSH_FLT,       ///< Push a call argument from the float stack without formatting it.
       OP_PUSH_FRAME,
 
       OP_BREAK,
 
+      /// A call site that has been given a lookup cache.  The interpreter rewrites
+      /// OP_CALLFUNC_RESOLVE and OP_CALLFUNC to this so it never appears in DSOs.
+      OP_CALLFUNC_CACHED,
+
       OP_INVALID
    };
 
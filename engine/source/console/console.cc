@@ -95,7 +95,7 @@ void ConsoleConstructor::init(const char *cName, const char *fName, const char *
    funcName = fName;
    usage = usg;
    className = cName;
-   sc = 0; fc = 0; vc = 0; bc = 0; ic = 0;
+   sc = 0; fc = 0; vc = 0; bc = 0; ic = 0; valc = 0;
    group = false;
    next = first;
    ns = false;
@@ -116,6 +116,8 @@ void ConsoleConstructor::setup()
          Con::addCommand(walk->className, walk->funcName, walk->vc, walk->usage, walk->mina, walk->maxa);
       else if(walk->bc)
          Con::addCommand(walk->className, walk->funcName, walk->bc, walk->usage, walk->mina, walk->maxa);
+      else if(walk->valc)
+         Con::addCommand(walk->className, walk->funcName, walk->valc, walk->usage, walk->mina, walk->maxa);
       else if(walk->group)
          Con::markCommandGroup(walk->className, walk->funcName, walk->usage);
       else if(walk->overload)
@@ -161,6 +163,12 @@ ConsoleConstructor::ConsoleConstructor(const char *className, const char *funcNa
    bc = bfunc;
 }
 
+ConsoleConstructor::ConsoleConstructor(const char *className, const char *funcName, ValueCallback valfunc, const char *usage, S32 minArgs, S32 maxArgs)
+{
+   init(className, funcName, usage, minArgs, maxArgs);
+   valc = valfunc;
+}
+
 ConsoleConstructor::ConsoleConstructor(const char* className, const char* groupName, const char* aUsage)
 {
    init(className, groupName, usage, -1, -2);
@@ -905,6 +913,12 @@ void addCommand(const char *nsName, const char *name,BoolCallback cb, const char
    ns->addCommand(StringTable->insert(name), cb, usage, minArgs, maxArgs);
 }
 
+void addCommand(const char *nsName, const char *name,ValueCallback cb, const char *usage, S32 minArgs, S32 maxArgs)
+{
+   Namespace *ns = lookupNamespace(nsName);
+   ns->addCommand(StringTable->insert(name), cb, usage, minArgs, maxArgs);
+}
+
 void markCommandGroup(const char * nsName, const char *name, const char* usage)
 {
    Namespace *ns = lookupNamespace(nsName);
@@ -952,6 +966,11 @@ void addCommand(const char *name,BoolCallback cb,const char *usage, S32 minArgs,
    Namespace::global()->addCommand(StringTable->insert(name), cb, usage, minArgs, maxArgs);
 }
 
+void addCommand(const char *name,ValueCallback cb,const char *usage, S32 minArgs, S32 maxArgs)
+{
+   Namespace::global()->addCommand(StringTable->insert(name), cb, usage, minArgs, maxArgs);
+}
+
 const char *evaluate(const char* string, bool echo, const char *fileName)
 {
    if (echo)
@@ -1029,7 +1048,6 @@ const char *execute(S32 argc, const char *argv[])
 //------------------------------------------------------------------------------
 const char *execute(SimObject *object, S32 argc, const char *argv[],bool thisCallOnly)
 {
-   static char idBuf[16];
    if(argc < 2)
       return "";
 
@@ -1057,32 +1075,53 @@ const char *execute(SimObject *object, S32 argc, const char *argv[],bool thisCal
          return "";
       }
 
-      // Twiddle %this argument
-      const char *oldArg1 = argv[1];
-      dSprintf(idBuf, sizeof(idBuf), "%d", object->getId());
-      argv[1] = idBuf;
+      return execute(object, ent, argc, argv);
+   }
+   warnf(ConsoleLogEntry::Script, "Con::execute - %d has no namespace: %s", object->getId(), argv[0]);
+   return "";
+}
 
-      object->pushScriptCallbackGuard();
+const char *execute(SimObject *object, Namespace::Entry *entry, S32 argc, const char *argv[])
+{
+   AssertFatal(isMainThread(), "Con::execute - Pre-resolved calls must be made from the main thread.");
+   AssertFatal(argc >= 2, "Con::execute - Method calls need at least the method name and an object parameter.");
 
-      SimObject *save = gEvalState.thisObject;
-      gEvalState.thisObject = object;
-      const char *ret = ent->execute(argc, argv, &gEvalState);
-      gEvalState.thisObject = save;
+   // Twiddle %this argument
+   const char *oldArg1 = argv[1];
+   argv[1] = object->getIdString();
 
-      object->popScriptCallbackGuard();
+   object->pushScriptCallbackGuard();
 
-      // Twiddle it back
-      argv[1] = oldArg1;
+   SimObject *save = gEvalState.thisObject;
+   gEvalState.thisObject = object;
+   const char *ret = entry->execute(argc, argv, &gEvalState);
+   gEvalState.thisObject = save;
 
-      // Reset the function offset so the stack
-      // doesn't continue to grow unnecessarily
-      STR.clearFunctionOffset();
+   object->popScriptCallbackGuard();
 
-      return ret;
-   }
-   warnf(ConsoleLogEntry::Script, "Con::execute - %d has no namespace: %s", object->getId(), argv[0]);
-   return "";
+   // Twiddle it back
+   argv[1] = oldArg1;
+
+   // Reset the function offset so the stack
+   // doesn't continue to grow unnecessarily
+   STR.clearFunctionOffset();
+
+   return ret;
+}
+
+const char *execute(Namespace::Entry *entry, S32 argc, const char *argv[])
+{
+   AssertFatal(isMainThread(), "Con::execute - Pre-resolved calls must be made from the main thread.");
+
+   const char *ret = entry->execute(argc, argv, &gEvalState);
+
+   // Reset the function offset so the stack
+   // doesn't continue to grow unnecessarily
+   STR.clearFunctionOffset();
+
+   return ret;
 }
+
 const char *executef(SimObject *object, S32 argc, ...)
 {
    const char *argv[128];
@@ -29,6 +29,9 @@
 #ifndef _BITSET_H_
 #include "collection/bitSet.h"
 #endif
+#ifndef _CONSOLE_VALUE_H_
+#include "console/consoleValue.h"
+#endif
 #include <stdarg.h>
 
 class SimObject;
@@ -135,6 +138,8 @@ typedef const char *StringTableEntry;
 /// function exposed to the scripting language. StringCallback,
 /// IntCallback, FloatCallback, VoidCallback, and BoolCallback all
 /// represent exposed script functions returning different types.
+/// ValueCallback takes and returns tagged ConsoleValues, so script can
+/// pass it numbers without formatting them as strings.
 ///
 /// ConsumerCallback is used with the function Con::addConsumer; functions
 /// registered with Con::addConsumer are called whenever something is outputted
@@ -152,6 +157,7 @@ typedef S32             (*IntCallback)(SimObject *obj, S32 argc, const char *arg
 typedef F32           (*FloatCallback)(SimObject *obj, S32 argc, const char *argv[]);
 typedef void           (*VoidCallback)(SimObject *obj, S32 argc, const char *argv[]); // We have it return a value so things don't break..
 typedef bool           (*BoolCallback)(SimObject *obj, S32 argc, const char *argv[]);
+typedef ConsoleValue  (*ValueCallback)(SimObject *obj, S32 argc, ConsoleValue argv[]);
 
 typedef void (*ConsumerCallback)(ConsoleLogEntry::Level level, const char *consoleLine);
 /// @}
@@ -196,7 +202,7 @@ namespace Con
       //  02/16/07 - THB - 40->41 newmsg operator
       //  02/16/07 - PAUP - 41->42 DSOs are read with a pointer before every string(ASTnodes changed). Namespace and HashTable revamped
       //  05/17/10 - Luma - 42-43 Adding proper sceneObject physics flags, fixes in general
-      DSOVersion = 43,
+      DSOVersion = 44,
       MaxLineLength = 512,  ///< Maximum length of a line of console input.
       MaxDataTypes = 256    ///< Maximum number of registered data types.
    };
@@ -432,6 +438,7 @@ namespace Con
    void addCommand(const char *name, FloatCallback  cb,  const char *usage, S32 minArgs, S32 maxArgs); ///< @copydoc addCommand(const char *, StringCallback, const char *, S32, S32)
    void addCommand(const char *name, VoidCallback   cb,   const char *usage, S32 minArgs, S32 maxArgs); ///< @copydoc addCommand(const char *, StringCallback, const char *, S32, S32)
    void addCommand(const char *name, BoolCallback   cb,   const char *usage, S32 minArgs, S32 maxArgs); ///< @copydoc addCommand(const char *, StringCallback, const char *, S32, S32)
+   void addCommand(const char *name, ValueCallback  cb,  const char *usage, S32 minArgs, S32 maxArgs); ///< @copydoc addCommand(const char *, StringCallback, const char *, S32, S32)
    /// @}
 
    /// @name Namespace Function Registration
@@ -451,6 +458,7 @@ namespace Con
    void addCommand(const char *nameSpace, const char *name,FloatCallback cb,  const char *usage, S32 minArgs, S32 maxArgs); ///< @copydoc addCommand(const char*, const char *, StringCallback, const char *, S32, S32)
    void addCommand(const char *nameSpace, const char *name,VoidCallback cb,   const char *usage, S32 minArgs, S32 maxArgs); ///< @copydoc addCommand(const char*, const char *, StringCallback, const char *, S32, S32)
    void addCommand(const char *nameSpace, const char *name,BoolCallback cb,   const char *usage, S32 minArgs, S32 maxArgs); ///< @copydoc addCommand(const char*, const char *, StringCallback, const char *, S32, S32)
+   void addCommand(const char *nameSpace, const char *name,ValueCallback cb,  const char *usage, S32 minArgs, S32 maxArgs); ///< @copydoc addCommand(const char*, const char *, StringCallback, const char *, S32, S32)
    /// @}
 
    /// @name Special Purpose Registration
@@ -655,6 +663,7 @@ public:
    FloatCallback fc;    ///< A function/method that returns a float.
    VoidCallback vc;     ///< A function/method that returns nothing.
    BoolCallback bc;     ///< A function/method that returns a bool.
+   ValueCallback valc;  ///< A function/method that takes and returns tagged values.
    bool group;          ///< Indicates that this is a group marker.
    bool overload;       ///< Indicates that this is an overload marker.
    bool ns;             ///< Indicates that this is a namespace marker.
@@ -742,6 +751,7 @@ public:
    ConsoleConstructor(const char *className, const char *funcName, FloatCallback  ffunc, const char* usage,  S32 minArgs, S32 maxArgs);
    ConsoleConstructor(const char *className, const char *funcName, VoidCallback   vfunc, const char* usage,  S32 minArgs, S32 maxArgs);
    ConsoleConstructor(const char *className, const char *funcName, BoolCallback   bfunc, const char* usage,  S32 minArgs, S32 maxArgs);
+   ConsoleConstructor(const char *className, const char *funcName, ValueCallback  valfunc, const char* usage,  S32 minArgs, S32 maxArgs);
    /// @}
 
    /// @name Magic Console Constructors
@@ -793,6 +803,12 @@ public:
 #  define ConsoleFunctionGroupEnd(groupName) \
       static ConsoleConstructor gConsoleFunctionGroup##groupName##__GroupEnd(NULL,#groupName,NULL);
 
+// Console function taking and returning tagged values (see ConsoleValue).
+#  define ConsoleValueFunction(name,minArgs,maxArgs,usage1)                                \
+      static ConsoleValue c##name(SimObject *, S32, ConsoleValue *argv);                  \
+      static ConsoleConstructor g##name##obj(NULL,#name,c##name,usage1,minArgs,maxArgs);  \
+      static ConsoleValue c##name(SimObject *, S32 argc, ConsoleValue *argv)
+
 // Console method macros
 #  define ConsoleNamespace(className, usage) \
       static ConsoleConstructor className##__Namespace(#className, usage);
@@ -809,6 +825,15 @@ public:
       static ConsoleConstructor className##name##obj(#className,#name,c##className##name##caster,usage1,minArgs,maxArgs); \
       static inline returnType c##className##name(className *object, S32 argc, const char **argv)
 
+#  define ConsoleValueMethod(className,name,minArgs,maxArgs,usage1)                                     \
+      static inline ConsoleValue c##className##name(className *, S32, ConsoleValue *argv);              \
+      static ConsoleValue c##className##name##caster(SimObject *object, S32 argc, ConsoleValue *argv) { \
+         AssertFatal( dynamic_cast<className*>( object ), "Object passed to " #name " is not a " #className "!" ); \
+         return c##className##name(static_cast<className*>(object),argc,argv);                          \
+      };                                                                                                \
+      static ConsoleConstructor className##name##obj(#className,#name,c##className##name##caster,usage1,minArgs,maxArgs); \
+      static inline ConsoleValue c##className##name(className *object, S32 argc, ConsoleValue *argv)
+
 #  define ConsoleStaticMethod(className,name,returnType,minArgs,maxArgs,usage1)                       \
       static inline returnType c##className##name(S32, const char **);                                \
       static returnType c##className##name##caster(SimObject *object, S32 argc, const char **argv) {  \
@@ -836,6 +861,11 @@ public:
       static ConsoleConstructor g##name##obj(NULL,#name,c##name,"",minArgs,maxArgs);\
       static returnType c##name(SimObject *, S32 argc, const char **argv)
 
+#  define ConsoleValueFunction(name,minArgs,maxArgs,usage1)                         \
+      static ConsoleValue c##name(SimObject *, S32, ConsoleValue *);               \
+      static ConsoleConstructor g##name##obj(NULL,#name,c##name,"",minArgs,maxArgs);\
+      static ConsoleValue c##name(SimObject *, S32 argc, ConsoleValue *argv)
+
 #  define ConsoleMethod(className,name,returnType,minArgs,maxArgs,usage1)                             \
       static inline returnType c##className##name(className *, S32, const char **argv);               \
       static returnType c##className##name##caster(SimObject *object, S32 argc, const char **argv) {  \
@@ -845,6 +875,15 @@ public:
          className##name##obj(#className,#name,c##className##name##caster,"",minArgs,maxArgs);        \
       static inline returnType c##className##name(className *object, S32 argc, const char **argv)
 
+#  define ConsoleValueMethod(className,name,minArgs,maxArgs,usage1)                                     \
+      static inline ConsoleValue c##className##name(className *, S32, ConsoleValue *argv);              \
+      static ConsoleValue c##className##name##caster(SimObject *object, S32 argc, ConsoleValue *argv) { \
+         return c##className##name(static_cast<className*>(object),argc,argv);                          \
+      };                                                                                                \
+      static ConsoleConstructor                                                                         \
+         className##name##obj(#className,#name,c##className##name##caster,"",minArgs,maxArgs);          \
+      static inline ConsoleValue c##className##name(className *object, S32 argc, ConsoleValue *argv)
+
 #  define ConsoleStaticMethod(className,name,returnType,minArgs,maxArgs,usage1)                       \
       static inline returnType c##className##name(S32, const char **);                                \
       static returnType c##className##name##caster(SimObject *object, S32 argc, const char **argv) {  \
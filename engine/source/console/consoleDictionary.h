@@ -95,7 +95,7 @@ public:
         {
             if(type <= TypeInternalString)
             {
-                fval = (F32)val;
+                fval = (F32)(S32)val;
                 ival = val;
                 if(sval != typeValueEmpty)
                 {
@@ -85,7 +85,7 @@ const char *typeNames[] =
       "float",
       "void",
       "bool",
-      "",
+      "value",
       "",
       "unknown_overload"
 };
@@ -27,4 +27,33 @@
 #include "consoleDictionary.h"
 #include "consoleExprEvalState.h"
 
+class SimObject;
+
+namespace Con
+{
+   /// @name Pre-resolved Calls
+   ///
+   /// These skip the name interning and namespace lookup done by execute() on every
+   /// call.  The entry would usually come from a Namespace::EntryCache kept by the
+   /// caller so it follows package activation:
+   /// @code
+   /// static Namespace::EntryCache onHitCache;
+   /// Namespace::Entry *entry = onHitCache.lookup(object->getNamespace(), onHitName);
+   /// if(entry)
+   ///    Con::execute(object, entry, 3, argv);
+   /// @endcode
+   /// They must be called from the main thread.
+   /// @{
+
+   /// Call a function that has already been looked up.
+   /// @param argv   The function name followed by its arguments.
+   const char *execute(Namespace::Entry *entry, S32 argc, const char *argv[]);
+
+   /// Call a method of an object that has already been looked up in the object's namespace.
+   /// @param argv   The method name, an empty parameter (gets filled with object ID) and the arguments.
+   const char *execute(SimObject *object, Namespace::Entry *entry, S32 argc, const char *argv[]);
+
+   /// @}
+};
+
 #endif // _CONSOLEINTERNAL_H_
@@ -33,6 +33,7 @@
 #include "console/consoleInternal.h"
 #include "io/fileStream.h"
 #include "console/compiler.h"
+#include "string/stringStack.h"
 
 U32 Namespace::mCacheSequence = 0;
 DataChunker Namespace::mCacheAllocator;
@@ -420,6 +421,19 @@ void Namespace::addCommand(StringTableEntry name,BoolCallback cb, const char *us
    ent->cb.mBoolCallbackFunc = cb;
 }
 
+void Namespace::addCommand(StringTableEntry name,ValueCallback cb, const char *usage, S32 minArgs, S32 maxArgs)
+{
+   Entry *ent = createLocalEntry(name);
+   trashCache();
+
+   ent->mUsage = usage;
+   ent->mMinArgs = minArgs;
+   ent->mMaxArgs = maxArgs;
+
+   ent->mType = Entry::ValueCallbackType;
+   ent->cb.mValueCallbackFunc = cb;
+}
+
 void Namespace::addOverload(const char * name, const char *altUsage)
 {
    static U32 uid=0;
@@ -503,6 +517,17 @@ const char *Namespace::Entry::execute(S32 argc, const char **argv, ExprEvalState
          dSprintf(returnBuffer, sizeof(returnBuffer), "%d",
             (U32)cb.mBoolCallbackFunc(state->thisObject, argc, argv));
          return returnBuffer;
+      case ValueCallbackType:
+      {
+         ConsoleValue values[StringStack::MaxArgs];
+         argc = getMin(argc, (S32)StringStack::MaxArgs);
+         for(S32 i = 0; i < argc; i++)
+            values[i].setStringValue(argv[i]);
+
+         ConsoleValue result = cb.mValueCallbackFunc(state->thisObject, argc, values);
+         result.setStringBuffer(returnBuffer);
+         return result.getStringValue();
+      }
    }
 
    return "";
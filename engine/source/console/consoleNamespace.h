@@ -74,7 +74,8 @@ public:
             IntCallbackType,
             FloatCallbackType,
             VoidCallbackType,
-            BoolCallbackType
+            BoolCallbackType,
+            ValueCallbackType
         };
 
         Namespace *mNamespace;
@@ -94,6 +95,7 @@ public:
             VoidCallback mVoidCallbackFunc;
             FloatCallback mFloatCallbackFunc;
             BoolCallback mBoolCallbackFunc;
+            ValueCallback mValueCallbackFunc;
             const char* mGroupName;
         } cb;
         Entry();
@@ -102,6 +104,31 @@ public:
         const char *execute(S32 argc, const char **argv, ExprEvalState *state);
 
     };
+
+    /// Remembers what a name last resolved to in a namespace.
+    ///
+    /// The entry is reused until a different namespace is asked for or any namespace
+    /// changes (functions are added, classes are linked or packages are activated),
+    /// which is tracked by mCacheSequence.  Failed lookups are cached too.
+    struct EntryCache
+    {
+        Namespace *mNamespace;
+        Entry *mEntry;
+        U32 mSequence;
+
+        EntryCache() : mNamespace(NULL), mEntry(NULL), mSequence(0) {}
+
+        inline Entry *lookup(Namespace *ns, StringTableEntry name)
+        {
+            if(ns != mNamespace || mSequence != mCacheSequence)
+            {
+                mNamespace = ns;
+                mEntry = ns ? ns->lookup(name) : NULL;
+                mSequence = mCacheSequence;
+            }
+            return mEntry;
+        }
+    };
     Entry *mEntryList;
 
     Entry **mHashTable;
@@ -117,6 +144,7 @@ public:
     void addCommand(StringTableEntry name,FloatCallback, const char *usage, S32 minArgs, S32 maxArgs);
     void addCommand(StringTableEntry name,VoidCallback, const char *usage, S32 minArgs, S32 maxArgs);
     void addCommand(StringTableEntry name,BoolCallback, const char *usage, S32 minArgs, S32 maxArgs);
+    void addCommand(StringTableEntry name,ValueCallback, const char *usage, S32 minArgs, S32 maxArgs);
 
     void addOverload(const char *name, const char* altUsage);
 
@@ -0,0 +1,147 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _CONSOLE_VALUE_H_
+#define _CONSOLE_VALUE_H_
+
+#ifndef _PLATFORM_H_
+#include "platform/platform.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+/// A tagged script value.
+///
+/// The interpreter passes arguments of script-to-script calls, and of console
+/// functions declared with ConsoleValueFunction/ConsoleValueMethod, as tagged
+/// values so numbers computed by script do not have to be formatted as strings
+/// and parsed back again by the callee.  The string form of a numeric value is
+/// only produced when something asks for it.
+class ConsoleValue
+{
+public:
+    enum Type
+    {
+        TypeString,
+        TypeInt,
+        TypeFloat
+    };
+
+    ConsoleValue() : mType(TypeString), mString(""), mBuffer(NULL) { mFloat = 0; }
+
+    static ConsoleValue fromString(const char *value)
+    {
+        ConsoleValue result;
+        result.setStringValue(value);
+        return result;
+    }
+    static ConsoleValue fromInt(S32 value)
+    {
+        ConsoleValue result;
+        result.setIntValue(value);
+        return result;
+    }
+    static ConsoleValue fromFloat(F64 value)
+    {
+        ConsoleValue result;
+        result.setFloatValue(value);
+        return result;
+    }
+
+    Type getType() const { return mType; }
+    bool isNumeric() const { return mType != TypeString; }
+
+    void setStringValue(const char *value)
+    {
+        mType = TypeString;
+        mString = value ? value : "";
+    }
+    void setIntValue(S32 value)
+    {
+        mType = TypeInt;
+        mInt = value;
+        mString = NULL;
+    }
+    void setFloatValue(F64 value)
+    {
+        mType = TypeFloat;
+        mFloat = value;
+        mString = NULL;
+    }
+
+    /// Use the given storage, which must hold at least StringBufferSize bytes,
+    /// when formatting a numeric value instead of the console return buffer.
+    void setStringBuffer(char *buffer) { mBuffer = buffer; }
+
+    S32 getIntValue() const
+    {
+        if(mType == TypeInt)
+            return mInt;
+        if(mType == TypeFloat)
+            return (S32)mFloat;
+        return dAtoi(mString);
+    }
+    F64 getFloatValue() const
+    {
+        if(mType == TypeFloat)
+            return mFloat;
+        if(mType == TypeInt)
+            return mInt;
+        return dAtof(mString);
+    }
+    bool getBoolValue() const
+    {
+        if(mType == TypeInt)
+            return mInt != 0;
+        if(mType == TypeFloat)
+            return mFloat != 0;
+        return dAtob(mString);
+    }
+
+    /// Get the string form of this value, formatting numbers the same way the
+    /// interpreter does ("%d" and "%.9g").
+    ///
+    /// @note Without a string buffer numbers are formatted into the console
+    ///       return buffer, so the result must be used before the next call.
+    const char *getStringValue()
+    {
+        if(!mString)
+            formatString();
+        return mString;
+    }
+
+    enum { StringBufferSize = 32 };
+
+private:
+    void formatString();
+
+    Type mType;
+    union
+    {
+        S32 mInt;
+        F64 mFloat;
+    };
+    const char *mString;
+    char *mBuffer;
+};
+
+#endif
@@ -34,9 +34,8 @@
 ProfilerRootData *ProfilerRootData::sRootList = NULL;
 Profiler *gProfiler = NULL;
 
-#ifdef TORQUE_MULTITHREAD
+// Profiling is only gathered on the main thread; jobs run on worker threads are ignored.
 U32 gMainThread = 0;
-#endif
 
 #if defined(TORQUE_SUPPORTS_VC_INLINE_X86_ASM)
 // platform specific get hires times...
@@ -190,9 +189,7 @@ Profiler::Profiler()
    mDumpToFile      = false;
    mDumpFileName[0] = '\0';
 
-#ifdef TORQUE_MULTITHREAD
    gMainThread = ThreadManager::getCurrentThreadId();
-#endif
 }
 
 Profiler::~Profiler()
@@ -274,11 +271,13 @@ void Profiler::validate()
 
 void Profiler::hashPush(ProfilerRootData *root)
 {
-#ifdef TORQUE_MULTITHREAD
+   // The timeline records every thread.
+   if(ProfilerTimeline::isRecording())
+      ProfilerTimeline::begin(root->mName);
+
    // Ignore non-main-thread profiler activity.
    if(! ThreadManager::isCurrentThread(gMainThread) )
       return;
-#endif
 
    mStackDepth++;
    AssertFatal(mStackDepth <= (S32)mMaxStackDepth,
@@ -370,11 +369,12 @@ void Profiler::dumpToFile(const char* fileName)
 
 void Profiler::hashPop()
 {
-#ifdef TORQUE_MULTITHREAD
+   if(ProfilerTimeline::isRecording())
+      ProfilerTimeline::end();
+
    // Ignore non-main-thread profiler activity.
    if(! ThreadManager::isCurrentThread(gMainThread) )
       return;
-#endif
 
    mStackDepth--;
    AssertFatal(mStackDepth >= 0, "Stack underflow in profiler.  You may have mismatched PROFILE_START and PROFILE_ENDs");
@@ -27,6 +27,10 @@
 
 #ifdef TORQUE_ENABLE_PROFILER
 
+#ifndef _PROFILER_TIMELINE_H_
+#include "debug/profilerTimeline.h"
+#endif
+
 struct ProfilerData;
 struct ProfilerRootData;
 /// The Profiler is used to see how long a specific chunk of code takes to execute.
@@ -171,6 +175,9 @@ public:
    static ProfilerRootData pdata##name##obj (#name); \
    ScopedProfiler scopedProfiler##name##obj(&pdata##name##obj);
 
+#undef PROFILE_FRAME
+#define PROFILE_FRAME() if(ProfilerTimeline::isRecording()) ProfilerTimeline::markFrame()
+
 #endif
 
 #endif
@@ -0,0 +1,521 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#include "platform/platform.h"
+#include "debug/profilerTimeline.h"
+
+#ifdef TORQUE_ENABLE_PROFILER
+
+#include "console/console.h"
+#include "collection/vector.h"
+#include "collection/hashTable.h"
+#include "io/fileStream.h"
+#include "platform/threads/thread.h"
+#include "math/mMathFn.h"
+
+// The profiler's main thread.
+extern U32 gMainThread;
+
+// The profiler's high resolution timer.
+extern void startHighResolutionTimer(U32 time[2]);
+
+//-----------------------------------------------------------------------------
+
+/// A ring of events written only by the thread that owns it.
+struct ProfilerTimeline::ThreadBuffer
+{
+   std::atomic<bool> mClaimed;
+   std::atomic<bool> mReady;
+   U32 mThreadId;
+   Event *mEvents;
+
+   /// The number of events ever written.  Only the owning thread changes it.
+   std::atomic<U32> mWriteCount;
+
+   /// Events written before this count have been cleared.
+   std::atomic<U32> mFirstValid;
+};
+
+std::atomic<bool> ProfilerTimeline::smRecording(false);
+ProfilerTimeline::ThreadBuffer ProfilerTimeline::smThreadBuffers[ProfilerTimeline::MaxThreads];
+
+// Percentiles are reported for the most markers in dumpSummary().
+static const U32 MaxSummaryMarkers = 40;
+
+// When recording last started, used to convert timer ticks to milliseconds.
+static U64 gRecordingStartTicks = 0;
+static U32 gRecordingStartMilliseconds = 0;
+
+static U64 getTimelineTime()
+{
+   U32 time[2] = { 0, 0 };
+   startHighResolutionTimer(time);
+   return ((U64)time[1] << 32) | time[0];
+}
+
+// Measures the timer against the platform clock over the time since recording started.
+static F64 getTicksPerMillisecond()
+{
+   const U32 elapsedMilliseconds = Platform::getRealMilliseconds() - gRecordingStartMilliseconds;
+   const U64 elapsedTicks = getTimelineTime() - gRecordingStartTicks;
+   if(elapsedMilliseconds == 0 || elapsedTicks == 0)
+      return 1.0;
+
+   return (F64)elapsedTicks / (F64)elapsedMilliseconds;
+}
+
+//-----------------------------------------------------------------------------
+
+ProfilerTimeline::ThreadBuffer *ProfilerTimeline::getThreadBuffer()
+{
+   const U32 threadId = ThreadManager::getCurrentThreadId();
+
+   // Buffers are claimed in order, so the first unclaimed one ends the search.
+   for(U32 i = 0; i < MaxThreads; i++)
+   {
+      ThreadBuffer &buffer = smThreadBuffers[i];
+      if(!buffer.mClaimed.load(std::memory_order_acquire))
+         break;
+      if(buffer.mReady.load(std::memory_order_acquire) && ThreadManager::compare(buffer.mThreadId, threadId))
+         return &buffer;
+   }
+
+   // This thread hasn't recorded anything yet.
+   for(U32 i = 0; i < MaxThreads; i++)
+   {
+      ThreadBuffer &buffer = smThreadBuffers[i];
+      bool claimed = false;
+      if(buffer.mClaimed.compare_exchange_strong(claimed, true, std::memory_order_acq_rel))
+      {
+         buffer.mThreadId = threadId;
+         buffer.mEvents = new Event[EventCapacity];
+         buffer.mWriteCount.store(0, std::memory_order_relaxed);
+         buffer.mFirstValid.store(0, std::memory_order_relaxed);
+         buffer.mReady.store(true, std::memory_order_release);
+         return &buffer;
+      }
+   }
+
+   return NULL;
+}
+
+//-----------------------------------------------------------------------------
+
+void ProfilerTimeline::record(U32 type, const char *name)
+{
+   ThreadBuffer *buffer = getThreadBuffer();
+   if(!buffer)
+      return;
+
+   const U32 count = buffer->mWriteCount.load(std::memory_order_relaxed);
+   Event &event = buffer->mEvents[count & (EventCapacity - 1)];
+   event.mTime = getTimelineTime();
+   event.mName = name;
+   event.mType = type;
+
+   // Publish the event to readers.
+   buffer->mWriteCount.store(count + 1, std::memory_order_release);
+}
+
+//-----------------------------------------------------------------------------
+
+void ProfilerTimeline::setRecording(bool recording)
+{
+   if(recording && !isRecording())
+   {
+      clear();
+      gRecordingStartTicks = getTimelineTime();
+      gRecordingStartMilliseconds = Platform::getRealMilliseconds();
+   }
+
+   smRecording.store(recording, std::memory_order_relaxed);
+}
+
+//-----------------------------------------------------------------------------
+
+void ProfilerTimeline::clear()
+{
+   for(U32 i = 0; i < MaxThreads; i++)
+   {
+      ThreadBuffer &buffer = smThreadBuffers[i];
+      if(buffer.mReady.load(std::memory_order_acquire))
+         buffer.mFirstValid.store(buffer.mWriteCount.load(std::memory_order_acquire), std::memory_order_relaxed);
+   }
+}
+
+//-----------------------------------------------------------------------------
+
+// A marker's begin and end on one thread.
+struct TimelineSpan
+{
+   const char *mName;
+   U64 mStart;
+   U64 mEnd;
+
+   /// Whether the marker is inside another invocation of itself.
+   bool mRecursive;
+};
+
+// Copies the events in a buffer, leaving out any the writer overwrote during the copy.
+static void copyEvents(const ProfilerTimeline::Event *ring, std::atomic<U32> &writeCount, U32 firstValid, Vector<ProfilerTimeline::Event> &events)
+{
+   const U32 capacity = ProfilerTimeline::EventCapacity;
+   const U32 end = writeCount.load(std::memory_order_acquire);
+   U32 start = firstValid;
+   if(end - start > capacity)
+      start = end - capacity;
+
+   events.setSize(end - start);
+   for(U32 i = start; i != end; i++)
+      events[i - start] = ring[i & (capacity - 1)];
+
+   std::atomic_thread_fence(std::memory_order_acquire);
+   const U32 lapped = writeCount.load(std::memory_order_relaxed) - start;
+   if(lapped > capacity)
+   {
+      const U32 overwritten = getMin(lapped - capacity, (U32)events.size());
+      for(U32 i = overwritten; i < (U32)events.size(); i++)
+         events[i - overwritten] = events[i];
+      events.setSize(events.size() - overwritten);
+   }
+}
+
+// Matches the begin and end events of a thread.  Markers still running, or that
+// began before the oldest event kept, are left out.
+static void buildSpans(const Vector<ProfilerTimeline::Event> &events, Vector<TimelineSpan> &spans, Vector<U64> &frames)
+{
+   Vector<const ProfilerTimeline::Event*> stack;
+   for(U32 i = 0; i < (U32)events.size(); i++)
+   {
+      const ProfilerTimeline::Event &event = events[i];
+      if(event.mType == ProfilerTimeline::BeginEvent)
+      {
+         stack.push_back(&event);
+      }
+      else if(event.mType == ProfilerTimeline::EndEvent)
+      {
+         if(stack.empty())
+            continue;
+
+         const ProfilerTimeline::Event *begin = stack.last();
+         stack.pop_back();
+
+         TimelineSpan span;
+         span.mName = begin->mName;
+         span.mStart = begin->mTime;
+         span.mEnd = event.mTime;
+         span.mRecursive = false;
+         for(U32 j = 0; j < (U32)stack.size() && !span.mRecursive; j++)
+            span.mRecursive = stack[j]->mName == begin->mName;
+         spans.push_back(span);
+      }
+      else
+      {
+         frames.push_back(event.mTime);
+      }
+   }
+}
+
+//-----------------------------------------------------------------------------
+
+/// The events recorded by one thread, turned into spans.
+struct ProfilerTimeline::ThreadSpans
+{
+   U32 mSlot;
+   bool mMainThread;
+   Vector<TimelineSpan> mSpans;
+   Vector<U64> mFrames;
+};
+
+U32 ProfilerTimeline::gatherThreads(ThreadSpans **threads)
+{
+   U32 count = 0;
+   Vector<Event> events;
+   for(U32 i = 0; i < MaxThreads; i++)
+   {
+      ThreadBuffer &buffer = smThreadBuffers[i];
+      if(!buffer.mReady.load(std::memory_order_acquire))
+         continue;
+
+      copyEvents(buffer.mEvents, buffer.mWriteCount, buffer.mFirstValid.load(std::memory_order_relaxed), events);
+      if(events.empty())
+         continue;
+
+      ThreadSpans *thread = new ThreadSpans;
+      thread->mSlot = i;
+      thread->mMainThread = ThreadManager::compare(buffer.mThreadId, gMainThread);
+      buildSpans(events, thread->mSpans, thread->mFrames);
+      threads[count++] = thread;
+   }
+
+   return count;
+}
+
+//-----------------------------------------------------------------------------
+
+static void writeTraceEvent(Stream &stream, bool &first, const char *event)
+{
+   if(!first)
+      stream.writeStringBuffer(",\n");
+   stream.writeStringBuffer(event);
+   first = false;
+}
+
+bool ProfilerTimeline::exportChromeTrace(const char *fileName)
+{
+   FileStream stream;
+   if(!stream.open(fileName, FileStream::Write))
+   {
+      Con::errorf("ProfilerTimeline::exportChromeTrace() - Could not open '%s' for writing.", fileName);
+      return false;
+   }
+
+   ThreadSpans *threads[MaxThreads];
+   const U32 threadCount = gatherThreads(threads);
+
+   // Trace times are in microseconds since the earliest event.  Spans are in
+   // the order they ended, so every start has to be looked at.
+   U64 origin = 0;
+   bool haveOrigin = false;
+   for(U32 i = 0; i < threadCount; i++)
+   {
+      const ThreadSpans &thread = *threads[i];
+      for(U32 j = 0; j < (U32)thread.mSpans.size(); j++)
+      {
+         if(!haveOrigin || thread.mSpans[j].mStart < origin)
+            origin = thread.mSpans[j].mStart;
+         haveOrigin = true;
+      }
+
+      if(thread.mFrames.size())
+      {
+         if(!haveOrigin || thread.mFrames.first() < origin)
+            origin = thread.mFrames.first();
+         haveOrigin = true;
+      }
+   }
+
+   const F64 ticksToMicroseconds = 1000.0 / getTicksPerMillisecond();
+
+   char event[512];
+   char threadName[32];
+   bool first = true;
+   stream.writeStringBuffer("{\"traceEvents\":[\n");
+
+   for(U32 i = 0; i < threadCount; i++)
+   {
+      const ThreadSpans &thread = *threads[i];
+      const S32 tid = thread.mSlot + 1;
+
+      if(thread.mMainThread)
+         dStrcpy(threadName, "Main");
+      else
+         dSprintf(threadName, sizeof(threadName), "Worker %d", tid);
+
+      dSprintf(event, sizeof(event), "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"%s\"}}", tid, threadName);
+      writeTraceEvent(stream, first, event);
+
+      for(U32 j = 0; j < (U32)thread.mSpans.size(); j++)
+      {
+         const TimelineSpan &span = thread.mSpans[j];
+         dSprintf(event, sizeof(event), "{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f}",
+            span.mName, tid, (span.mStart - origin) * ticksToMicroseconds, (span.mEnd - span.mStart) * ticksToMicroseconds);
+         writeTraceEvent(stream, first, event);
+      }
+
+      for(U32 j = 0; j < (U32)thread.mFrames.size(); j++)
+      {
+         dSprintf(event, sizeof(event), "{\"name\":\"Frame\",\"ph\":\"i\",\"s\":\"g\",\"pid\":1,\"tid\":%d,\"ts\":%.3f}",
+            tid, (thread.mFrames[j] - origin) * ticksToMicroseconds);
+         writeTraceEvent(stream, first, event);
+      }
+
+      delete threads[i];
+   }
+
+   stream.writeStringBuffer("\n]}\n");
+   return true;
+}
+
+//-----------------------------------------------------------------------------
+
+struct TimelineMarkerSummary
+{
+   const char *mName;
+   U32 mFrames;
+   F64 mMedian;
+   F64 mPercentile99;
+   F64 mWorst;
+};
+
+static S32 QSORT_CALLBACK compareTimes(const void *a, const void *b)
+{
+   const F64 timeA = *(const F64*)a;
+   const F64 timeB = *(const F64*)b;
+   return timeA < timeB ? -1 : (timeA > timeB ? 1 : 0);
+}
+
+static S32 QSORT_CALLBACK compareSummaries(const void *a, const void *b)
+{
+   const F64 timeA = ((const TimelineMarkerSummary*)a)->mPercentile99;
+   const F64 timeB = ((const TimelineMarkerSummary*)b)->mPercentile99;
+   return timeA > timeB ? -1 : (timeA < timeB ? 1 : 0);
+}
+
+// Nearest-rank percentile of sorted times.
+static F64 getPercentile(const Vector<F64> &times, F32 percentile)
+{
+   const S32 rank = (S32)mCeil(percentile * times.size()) - 1;
+   return times[mClamp(rank, 0, times.size() - 1)];
+}
+
+static void summariseTimes(const char *name, Vector<F64> &times, TimelineMarkerSummary &summary)
+{
+   dQsort(times.address(), times.size(), sizeof(F64), compareTimes);
+
+   summary.mName = name;
+   summary.mFrames = times.size();
+   summary.mMedian = getPercentile(times, 0.5f);
+   summary.mPercentile99 = getPercentile(times, 0.99f);
+   summary.mWorst = times.last();
+}
+
+// The frame that started at or most recently before a time.
+static U32 findFrame(const Vector<U64> &frames, U64 time)
+{
+   U32 low = 0;
+   U32 high = frames.size() - 1;
+   while(low + 1 < high)
+   {
+      const U32 middle = (low + high) / 2;
+      if(frames[middle] <= time)
+         low = middle;
+      else
+         high = middle;
+   }
+   return low;
+}
+
+void ProfilerTimeline::dumpSummary()
+{
+   ThreadSpans *threads[MaxThreads];
+   const U32 threadCount = gatherThreads(threads);
+
+   const Vector<U64> *frames = NULL;
+   for(U32 i = 0; i < threadCount; i++)
+   {
+      if(threads[i]->mMainThread)
+         frames = &threads[i]->mFrames;
+   }
+
+   if(!frames || frames->size() < 2)
+   {
+      Con::printf("ProfilerTimeline: No complete frames have been recorded.");
+      for(U32 i = 0; i < threadCount; i++)
+         delete threads[i];
+      return;
+   }
+
+   const U32 frameCount = frames->size() - 1;
+   const F64 ticksToMilliseconds = 1.0 / getTicksPerMillisecond();
+
+   // Milliseconds spent in each marker during each frame, on any thread.  Markers
+   // count towards the frame they started in and time spent inside a recursive
+   // call of the same marker is only counted once.
+   HashMap<const char*, U32> markerIndices;
+   Vector<const char*> markerNames;
+   Vector<F64> markerTimes;
+
+   for(U32 i = 0; i < threadCount; i++)
+   {
+      const Vector<TimelineSpan> &spans = threads[i]->mSpans;
+      for(U32 j = 0; j < (U32)spans.size(); j++)
+      {
+         const TimelineSpan &span = spans[j];
+         if(span.mRecursive || span.mStart < frames->first() || span.mStart >= frames->last())
+            continue;
+
+         U32 marker;
+         HashMap<const char*, U32>::iterator itr = markerIndices.find(span.mName);
+         if(itr == markerIndices.end())
+         {
+            marker = markerNames.size();
+            markerIndices.insert(span.mName, marker);
+            markerNames.push_back(span.mName);
+            markerTimes.setSize(markerTimes.size() + frameCount);
+            dMemset(markerTimes.address() + marker * frameCount, 0, frameCount * sizeof(F64));
+         }
+         else
+         {
+            marker = itr->value;
+         }
+
+         markerTimes[marker * frameCount + findFrame(*frames, span.mStart)] += (span.mEnd - span.mStart) * ticksToMilliseconds;
+      }
+   }
+
+   Vector<F64> times;
+   Vector<TimelineMarkerSummary> summaries;
+
+   for(U32 frame = 0; frame < frameCount; frame++)
+      times.push_back(((*frames)[frame + 1] - (*frames)[frame]) * ticksToMilliseconds);
+
+   TimelineMarkerSummary frameSummary;
+   summariseTimes("Frame", times, frameSummary);
+
+   for(U32 marker = 0; marker < (U32)markerNames.size(); marker++)
+   {
+      // Only frames the marker ran in are counted.
+      times.clear();
+      for(U32 frame = 0; frame < frameCount; frame++)
+      {
+         const F64 time = markerTimes[marker * frameCount + frame];
+         if(time > 0.0)
+            times.push_back(time);
+      }
+
+      if(times.empty())
+         continue;
+
+      summaries.increment();
+      summariseTimes(markerNames[marker], times, summaries.last());
+   }
+
+   dQsort(summaries.address(), summaries.size(), sizeof(TimelineMarkerSummary), compareSummaries);
+
+   Con::printf("Profiler timeline over %d frames, markers ordered by 99th percentile:", frameCount);
+   Con::printf("%-40s %10s %10s %10s %8s", "Marker", "p50 ms", "p99 ms", "Max ms", "Frames");
+   Con::printf("%-40s %10.3f %10.3f %10.3f %8d", frameSummary.mName, frameSummary.mMedian, frameSummary.mPercentile99, frameSummary.mWorst, frameSummary.mFrames);
+
+   for(U32 i = 0; i < (U32)summaries.size() && i < MaxSummaryMarkers; i++)
+   {
+      const TimelineMarkerSummary &summary = summaries[i];
+      Con::printf("%-40s %10.3f %10.3f %10.3f %8d", summary.mName, summary.mMedian, summary.mPercentile99, summary.mWorst, summary.mFrames);
+   }
+
+   for(U32 i = 0; i < threadCount; i++)
+      delete threads[i];
+}
+
+#include "profilerTimeline_ScriptBinding.h"
+
+#endif // TORQUE_ENABLE_PROFILER
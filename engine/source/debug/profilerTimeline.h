@@ -0,0 +1,115 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _PROFILER_TIMELINE_H_
+#define _PROFILER_TIMELINE_H_
+
+#include "torqueConfig.h"
+
+#ifdef TORQUE_ENABLE_PROFILER
+
+#ifndef _PLATFORM_H_
+#include "platform/platform.h"
+#endif
+
+#include <atomic>
+
+//-----------------------------------------------------------------------------
+
+/// Records when profiler markers begin and end on every thread.
+///
+/// The Profiler aggregates the main thread into a call tree, which hides when
+/// things happened and ignores worker threads.  While recording, the timeline
+/// also keeps every PROFILE_START/PROFILE_END and every PROFILE_FRAME() from any
+/// thread, with a timestamp, so a hitch can be looked at after the fact.
+///
+/// Each thread writes to its own ring buffer without locking and only the most
+/// recent events are kept.  The buffers can be exported as a Chrome trace (load
+/// it with chrome://tracing or Perfetto) or summarised as the median, 99th
+/// percentile and worst time spent in each marker per frame.
+///
+/// Examples of script use:
+/// @code
+/// profilerTimelineEnable(bool enable);          // starts or stops recording
+/// profilerTimelineExport(string filename);      // writes the recorded events as a Chrome trace
+/// profilerTimelineSummary();                    // dumps per-frame marker percentiles to the console
+/// @endcode
+class ProfilerTimeline
+{
+public:
+   enum EventType
+   {
+      BeginEvent,
+      EndEvent,
+      FrameEvent
+   };
+
+   enum
+   {
+      MaxThreads = 32,              ///< Threads past this many are not recorded.
+      EventCapacity = 1 << 16       ///< Events kept per thread.  Must be a power of two.
+   };
+
+   struct Event
+   {
+      U64 mTime;                    ///< Ticks of the profiler's high resolution timer, shared by all threads.
+      const char *mName;            ///< The marker name, or NULL for end and frame events.
+      U32 mType;
+   };
+
+   static inline bool isRecording() { return smRecording.load(std::memory_order_relaxed); }
+   static void setRecording(bool recording);
+
+   /// Records a marker starting on the calling thread.
+   static void begin(const char *name) { record(BeginEvent, name); }
+   /// Records the innermost marker on the calling thread ending.
+   static void end() { record(EndEvent, NULL); }
+   /// Records the start of a frame.  Called from the main loop.
+   static void markFrame() { record(FrameEvent, NULL); }
+
+   /// Discards all recorded events.
+   static void clear();
+
+   /// Writes the recorded events in the Chrome trace event format.
+   static bool exportChromeTrace(const char *fileName);
+
+   /// Prints the median, 99th percentile and worst time per frame of every marker.
+   static void dumpSummary();
+
+private:
+   struct ThreadBuffer;
+   struct ThreadSpans;
+
+   static void record(U32 type, const char *name);
+   static ThreadBuffer *getThreadBuffer();
+
+   /// Copies the events of every thread that recorded any and matches their
+   /// begins and ends.  The caller deletes the results.
+   static U32 gatherThreads(ThreadSpans **threads);
+
+   static std::atomic<bool> smRecording;
+   static ThreadBuffer smThreadBuffers[MaxThreads];
+};
+
+#endif // TORQUE_ENABLE_PROFILER
+
+#endif // _PROFILER_TIMELINE_H_
@@ -0,0 +1,48 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+ConsoleFunctionGroupBegin( ProfilerTimeline, "Profiler timeline functionality.");
+
+ConsoleFunction( profilerTimelineEnable, void, 2, 2,   "(bool enable) - Starts or stops recording profiler markers and frames on every thread.\n"
+                                                        "Starting discards any events recorded before.\n"
+                                                        "@param enable Whether to record or not.\n"
+                                                        "@return No return value." )
+{
+   ProfilerTimeline::setRecording( dAtob(argv[1]) );
+}
+
+ConsoleFunction( profilerTimelineExport, bool, 2, 2,   "(filename) - Writes the recorded events as a Chrome trace, which chrome://tracing or Perfetto can load.\n"
+                                                        "@param filename The file to write.\n"
+                                                        "@return Whether the file was written or not." )
+{
+   char fileName[1024];
+   Con::expandPath( fileName, sizeof(fileName), argv[1] );
+   return ProfilerTimeline::exportChromeTrace( fileName );
+}
+
+ConsoleFunction( profilerTimelineSummary, void, 1, 1,  "() - Dumps the median, 99th percentile and worst time per frame of each recorded marker to the console.\n"
+                                                        "@return No return value." )
+{
+   ProfilerTimeline::dumpSummary();
+}
+
+ConsoleFunctionGroupEnd( ProfilerTimeline );
@@ -0,0 +1,365 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#include "debug/scriptProfiler.h"
+#include "console/console.h"
+#include "console/codeBlock.h"
+#include "io/fileStream.h"
+
+//-----------------------------------------------------------------------------
+
+ScriptProfiler gScriptProfiler;
+
+// The most lines listed by dumpToConsole().
+static const U32 MaxDumpedLines = 20;
+
+static U64 getProfilerTime()
+{
+   return (U64)(Platform::getHighResolutionMilliseconds() * 1000000.0);
+}
+
+static F64 toMilliseconds(U64 time)
+{
+   return (F64)time / 1000000.0;
+}
+
+//-----------------------------------------------------------------------------
+
+ScriptProfiler::ScriptProfiler() :
+   mEnabled(false),
+   mGeneration(1),
+   mLineSampleInterval(0),
+   mLineSampleCountdown(0),
+   mTotalLineSamples(0)
+{
+}
+
+//-----------------------------------------------------------------------------
+
+void ScriptProfiler::start(U32 lineSampleInterval)
+{
+   mEnabled = true;
+   mLineSampleInterval = lineSampleInterval;
+   mLineSampleCountdown = lineSampleInterval;
+}
+
+//-----------------------------------------------------------------------------
+
+void ScriptProfiler::stop()
+{
+   mEnabled = false;
+}
+
+//-----------------------------------------------------------------------------
+
+void ScriptProfiler::reset()
+{
+   for(U32 i = 0; i < (U32)mFunctions.size(); i++)
+      delete mFunctions[i];
+
+   mFunctions.clear();
+   mFunctionMap.clear();
+   mNodes.clear();
+   mFrames.clear();
+   mTotalLineSamples = 0;
+   mLineSampleCountdown = mLineSampleInterval;
+
+   // Functions that are still running from before the reset are no longer tracked.
+   mGeneration++;
+}
+
+//-----------------------------------------------------------------------------
+
+U32 ScriptProfiler::findFunction(CodeBlock* code, U32 functionIp, StringTableEntry nameSpace, StringTableEntry functionName)
+{
+   // A function is identified by where its code is.  Check the name as the memory
+   // may have been reused by a code block loaded since.
+   const U32* key = code->code + functionIp;
+   HashMap<const U32*, U32>::iterator itr = mFunctionMap.find(key);
+   if(itr != mFunctionMap.end())
+   {
+      const FunctionStats* stats = mFunctions[itr->value];
+      if(stats->mName == functionName && stats->mNamespace == nameSpace && stats->mFile == code->name)
+         return itr->value;
+      mFunctionMap.erase(itr);
+   }
+
+   FunctionStats* stats = new FunctionStats;
+   stats->mNamespace = nameSpace;
+   stats->mName = functionName;
+   stats->mFile = code->name;
+   stats->mCallCount = 0;
+   stats->mActiveCount = 0;
+   stats->mInclusiveTime = 0;
+   stats->mExclusiveTime = 0;
+   stats->mLineSampleCount = 0;
+
+   const U32 index = mFunctions.size();
+   mFunctions.push_back(stats);
+   mFunctionMap.insert(key, index);
+   return index;
+}
+
+//-----------------------------------------------------------------------------
+
+U32 ScriptProfiler::findChildNode(S32 parent, U32 function)
+{
+   // Root nodes are chained from the first node.
+   S32 child = parent < 0 ? (mNodes.size() ? 0 : -1) : mNodes[parent].mFirstChild;
+   S32 lastChild = -1;
+   for(; child >= 0; child = mNodes[child].mNextSibling)
+   {
+      if(mNodes[child].mFunction == function)
+         return child;
+      lastChild = child;
+   }
+
+   StackNode node;
+   node.mFunction = function;
+   node.mParent = parent;
+   node.mFirstChild = -1;
+   node.mNextSibling = -1;
+   node.mExclusiveTime = 0;
+
+   const U32 index = mNodes.size();
+   mNodes.push_back(node);
+
+   if(lastChild >= 0)
+      mNodes[lastChild].mNextSibling = index;
+   else if(parent >= 0)
+      mNodes[parent].mFirstChild = index;
+
+   return index;
+}
+
+//-----------------------------------------------------------------------------
+
+U32 ScriptProfiler::enterFunction(CodeBlock* code, U32 functionIp, StringTableEntry nameSpace, StringTableEntry functionName)
+{
+   if(!mEnabled)
+      return 0;
+
+   Frame frame;
+   frame.mFunction = findFunction(code, functionIp, nameSpace, functionName);
+   frame.mNode = findChildNode(mFrames.size() ? (S32)mFrames.last().mNode : -1, frame.mFunction);
+   frame.mChildTime = 0;
+
+   FunctionStats* stats = mFunctions[frame.mFunction];
+   stats->mCallCount++;
+   stats->mActiveCount++;
+
+   mFrames.push_back(frame);
+
+   // Start the clock last so the bookkeeping isn't charged to the function.
+   mFrames.last().mStartTime = getProfilerTime();
+   return mGeneration;
+}
+
+//-----------------------------------------------------------------------------
+
+void ScriptProfiler::exitFunction(U32 token)
+{
+   const U64 endTime = getProfilerTime();
+
+   if(token != mGeneration || mFrames.empty())
+      return;
+
+   const Frame& frame = mFrames.last();
+   const U64 inclusiveTime = endTime - frame.mStartTime;
+   const U64 exclusiveTime = inclusiveTime > frame.mChildTime ? inclusiveTime - frame.mChildTime : 0;
+
+   FunctionStats* stats = mFunctions[frame.mFunction];
+   stats->mExclusiveTime += exclusiveTime;
+   if(--stats->mActiveCount == 0)
+      stats->mInclusiveTime += inclusiveTime;
+
+   mNodes[frame.mNode].mExclusiveTime += exclusiveTime;
+
+   mFrames.pop_back();
+   if(mFrames.size())
+      mFrames.last().mChildTime += inclusiveTime;
+}
+
+//-----------------------------------------------------------------------------
+
+void ScriptProfiler::sampleLine(CodeBlock* code, U32 ip)
+{
+   // Code run outside of a function (such as an exec'd file) has no frame to charge.
+   if(mFrames.empty())
+      return;
+
+   U32 line, instruction;
+   code->findBreakLine(ip, line, instruction);
+
+   FunctionStats* stats = mFunctions[mFrames.last().mFunction];
+   stats->mLineSampleCount++;
+   mTotalLineSamples++;
+
+   for(U32 i = 0; i < (U32)stats->mLineSamples.size(); i++)
+   {
+      LineSample& sample = stats->mLineSamples[i];
+      if(sample.mLine == line && sample.mFile == code->name)
+      {
+         sample.mCount++;
+         return;
+      }
+   }
+
+   LineSample sample;
+   sample.mFile = code->name;
+   sample.mLine = line;
+   sample.mCount = 1;
+   stats->mLineSamples.push_back(sample);
+}
+
+//-----------------------------------------------------------------------------
+
+void ScriptProfiler::formatFunctionName(const FunctionStats& stats, char* buffer, U32 bufferSize) const
+{
+   if(stats.mNamespace)
+      dSprintf(buffer, bufferSize, "%s::%s", stats.mNamespace, stats.mName);
+   else
+      dSprintf(buffer, bufferSize, "%s", stats.mName);
+}
+
+//-----------------------------------------------------------------------------
+
+S32 QSORT_CALLBACK ScriptProfiler::compareExclusiveTime(const void* a, const void* b)
+{
+   const U64 timeA = (*(const FunctionStats**)a)->mExclusiveTime;
+   const U64 timeB = (*(const FunctionStats**)b)->mExclusiveTime;
+   return timeA < timeB ? 1 : (timeA > timeB ? -1 : 0);
+}
+
+S32 QSORT_CALLBACK ScriptProfiler::compareLineCount(const void* a, const void* b)
+{
+   return (S32)((const LineEntry*)b)->mSample->mCount - (S32)((const LineEntry*)a)->mSample->mCount;
+}
+
+void ScriptProfiler::dumpToConsole()
+{
+   Vector<FunctionStats*> functions(mFunctions);
+   dQsort(functions.address(), functions.size(), sizeof(FunctionStats*), compareExclusiveTime);
+
+   U64 totalTime = 0;
+   for(U32 i = 0; i < (U32)functions.size(); i++)
+      totalTime += functions[i]->mExclusiveTime;
+
+   char name[256];
+   Con::printf("Script profile - %d functions, %.3f ms in script:", functions.size(), toMilliseconds(totalTime));
+   Con::printf("  Incl ms   Excl ms  Excl %%    Calls  Function");
+   for(U32 i = 0; i < (U32)functions.size(); i++)
+   {
+      const FunctionStats* stats = functions[i];
+      formatFunctionName(*stats, name, sizeof(name));
+      Con::printf("%9.3f %9.3f %7.2f %8d  %s (%s)",
+         toMilliseconds(stats->mInclusiveTime),
+         toMilliseconds(stats->mExclusiveTime),
+         totalTime ? 100.0 * stats->mExclusiveTime / totalTime : 0.0,
+         stats->mCallCount,
+         name,
+         stats->mFile ? stats->mFile : "<input>");
+   }
+
+   if(!mTotalLineSamples)
+      return;
+
+   // List the hottest lines.
+   Vector<LineEntry> lines;
+   for(U32 i = 0; i < (U32)functions.size(); i++)
+   {
+      const FunctionStats* stats = functions[i];
+      for(U32 j = 0; j < (U32)stats->mLineSamples.size(); j++)
+      {
+         LineEntry entry;
+         entry.mSample = &stats->mLineSamples[j];
+         entry.mFunction = stats;
+         lines.push_back(entry);
+      }
+   }
+   dQsort(lines.address(), lines.size(), sizeof(LineEntry), compareLineCount);
+
+   Con::printf("Script line samples - %d samples:", mTotalLineSamples);
+   Con::printf("  Samples       %%  Line");
+   for(U32 i = 0; i < (U32)lines.size() && i < MaxDumpedLines; i++)
+   {
+      const LineSample* sample = lines[i].mSample;
+      formatFunctionName(*lines[i].mFunction, name, sizeof(name));
+      Con::printf("%9d %7.2f  %s (%d) in %s",
+         sample->mCount,
+         100.0 * sample->mCount / mTotalLineSamples,
+         sample->mFile ? sample->mFile : "<input>",
+         sample->mLine,
+         name);
+   }
+}
+
+//-----------------------------------------------------------------------------
+
+void ScriptProfiler::writeStacks(Stream& stream, S32 node, char* buffer, U32 bufferLength, U32 bufferSize)
+{
+   for(; node >= 0; node = mNodes[node].mNextSibling)
+   {
+      const StackNode& stackNode = mNodes[node];
+
+      // Append this frame to the stack, leaving out frames too deep to fit.
+      U32 length = bufferLength;
+      if(length)
+         buffer[length++] = ';';
+      formatFunctionName(*mFunctions[stackNode.mFunction], buffer + length, bufferSize - length);
+      length += dStrlen(buffer + length);
+      if(length >= bufferSize - 1)
+         continue;
+
+      // Flame graph tools expect integer weights.
+      const U64 microseconds = stackNode.mExclusiveTime / 1000;
+      if(microseconds)
+      {
+         char weight[32];
+         dSprintf(weight, sizeof(weight), " %u\n", (U32)microseconds);
+         stream.write(length, buffer);
+         stream.write(dStrlen(weight), weight);
+      }
+
+      writeStacks(stream, stackNode.mFirstChild, buffer, length, bufferSize);
+   }
+}
+
+bool ScriptProfiler::dumpCollapsedStacks(const char* fileName)
+{
+   FileStream stream;
+   if(!stream.open(fileName, FileStream::Write))
+   {
+      Con::errorf("ScriptProfiler::dumpCollapsedStacks() - Unable to open '%s' for writing.", fileName);
+      return false;
+   }
+
+   char buffer[4096];
+   buffer[0] = 0;
+   writeStacks(stream, mNodes.size() ? 0 : -1, buffer, 0, sizeof(buffer));
+   stream.close();
+   return true;
+}
+
+//-----------------------------------------------------------------------------
+
+#include "debug/scriptProfiler_ScriptBinding.h"
@@ -0,0 +1,178 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _SCRIPT_PROFILER_H_
+#define _SCRIPT_PROFILER_H_
+
+#ifndef _PLATFORM_H_
+#include "platform/platform.h"
+#endif
+
+#ifndef _VECTOR_H_
+#include "collection/vector.h"
+#endif
+
+#ifndef _HASHTABLE_H
+#include "collection/hashTable.h"
+#endif
+
+#ifndef _STRINGTABLE_H_
+#include "string/stringTable.h"
+#endif
+
+class CodeBlock;
+class Stream;
+
+//-----------------------------------------------------------------------------
+
+/// Measures where time is spent in TorqueScript.
+///
+/// The C++ profiler sees the interpreter as a single block, so CodeBlock::exec
+/// reports every script function call here.  For each function the profiler
+/// keeps the number of calls, the inclusive time (including the functions it
+/// calls) and the exclusive time (its own code only).  It also keeps a call tree
+/// which can be written in the collapsed stack format used by flame graph tools:
+/// one line per call stack, frames separated by ';', followed by the exclusive
+/// time in microseconds spent with that stack.
+///
+/// Optionally the interpreter also takes a line sample every so many
+/// instructions, attributing it to the running function and to the line found
+/// with CodeBlock::findBreakLine.
+///
+/// Examples of script use:
+/// @code
+/// scriptProfilerStart([lineSampleInterval]);  // starts profiling, optionally sampling lines
+/// scriptProfilerStop();                       // stops profiling, keeping the data
+/// scriptProfilerReset();                      // clears the data gathered so far
+/// scriptProfilerDump();                       // dumps the data to the console
+/// scriptProfilerDumpToFile(string filename);  // writes the collapsed stacks to a file
+/// @endcode
+class ScriptProfiler
+{
+public:
+   ScriptProfiler();
+
+   /// Starts gathering data, sampling lines every lineSampleInterval instructions.
+   /// An interval of zero disables line sampling.
+   void start(U32 lineSampleInterval);
+
+   /// Stops gathering data.  Functions already running are still timed until they return.
+   void stop();
+
+   /// Clears all the data gathered so far.
+   void reset();
+
+   inline bool isEnabled() const { return mEnabled; }
+   inline bool isSamplingLines() const { return mEnabled && mLineSampleInterval != 0; }
+
+   /// Called by the interpreter when a script function starts executing.
+   /// @return A token to pass to exitFunction() or zero if the call is not being profiled.
+   U32 enterFunction(CodeBlock* code, U32 functionIp, StringTableEntry nameSpace, StringTableEntry functionName);
+
+   /// Called by the interpreter when a script function returns.
+   void exitFunction(U32 token);
+
+   /// Counts down to the next line sample.  Called by the interpreter for every instruction.
+   inline bool tickLineSample()
+   {
+      if(--mLineSampleCountdown)
+         return false;
+      mLineSampleCountdown = mLineSampleInterval;
+      return true;
+   }
+
+   /// Records a line sample for the instruction at ip in the running function.
+   void sampleLine(CodeBlock* code, U32 ip);
+
+   /// Prints the per function statistics and the hottest lines to the console.
+   void dumpToConsole();
+
+   /// Writes the call tree in collapsed stack format.
+   bool dumpCollapsedStacks(const char* fileName);
+
+private:
+   struct LineSample
+   {
+      StringTableEntry mFile;
+      U32 mLine;
+      U32 mCount;
+   };
+
+   struct FunctionStats
+   {
+      StringTableEntry mNamespace;
+      StringTableEntry mName;
+      StringTableEntry mFile;
+      U32 mCallCount;
+      U32 mActiveCount;   ///< Calls currently running, so recursion doesn't count twice.
+      U64 mInclusiveTime;
+      U64 mExclusiveTime;
+      U32 mLineSampleCount;
+      Vector<LineSample> mLineSamples;
+   };
+
+   struct StackNode
+   {
+      U32 mFunction;
+      S32 mParent;
+      S32 mFirstChild;
+      S32 mNextSibling;
+      U64 mExclusiveTime;
+   };
+
+   struct Frame
+   {
+      U32 mFunction;
+      U32 mNode;
+      U64 mStartTime;
+      U64 mChildTime;
+   };
+
+   struct LineEntry
+   {
+      const LineSample* mSample;
+      const FunctionStats* mFunction;
+   };
+
+   static S32 QSORT_CALLBACK compareExclusiveTime(const void* a, const void* b);
+   static S32 QSORT_CALLBACK compareLineCount(const void* a, const void* b);
+
+   U32 findFunction(CodeBlock* code, U32 functionIp, StringTableEntry nameSpace, StringTableEntry functionName);
+   U32 findChildNode(S32 parent, U32 function);
+   void formatFunctionName(const FunctionStats& stats, char* buffer, U32 bufferSize) const;
+   void writeStacks(Stream& stream, S32 node, char* buffer, U32 bufferLength, U32 bufferSize);
+
+   bool mEnabled;
+   U32 mGeneration;
+   U32 mLineSampleInterval;
+   U32 mLineSampleCountdown;
+   U32 mTotalLineSamples;
+
+   Vector<FunctionStats*> mFunctions;
+   HashMap<const U32*, U32> mFunctionMap;
+   Vector<StackNode> mNodes;
+   Vector<Frame> mFrames;
+};
+
+extern ScriptProfiler gScriptProfiler;
+
+#endif // _SCRIPT_PROFILER_H_
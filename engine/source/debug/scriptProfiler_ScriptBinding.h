@@ -0,0 +1,61 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+ConsoleFunctionGroupBegin( ScriptProfiler, "Script profiler functionality.");
+
+ConsoleFunction( scriptProfilerStart, void, 1, 2,  "([lineSampleInterval]) - Starts profiling script functions.\n"
+                                                    "@param lineSampleInterval Optionally samples the running line every so many script instructions.  Zero (the default) disables line sampling.\n"
+                                                    "@return No return value." )
+{
+   const S32 lineSampleInterval = argc >= 2 ? dAtoi(argv[1]) : 0;
+   gScriptProfiler.start( lineSampleInterval > 0 ? lineSampleInterval : 0 );
+}
+
+ConsoleFunction( scriptProfilerStop, void, 1, 1,   "() - Stops profiling script functions, keeping the data gathered so far.\n"
+                                                    "@return No return value." )
+{
+   gScriptProfiler.stop();
+}
+
+ConsoleFunction( scriptProfilerReset, void, 1, 1,  "() - Clears all the script profiling data gathered so far.\n"
+                                                    "@return No return value." )
+{
+   gScriptProfiler.reset();
+}
+
+ConsoleFunction( scriptProfilerDump, void, 1, 1,   "() - Dumps the time spent in each script function, and the most sampled lines, to the console.\n"
+                                                    "@return No return value." )
+{
+   gScriptProfiler.dumpToConsole();
+}
+
+ConsoleFunction( scriptProfilerDumpToFile, bool, 2, 2, "(filename) - Writes the script call stacks to a file in the collapsed stack format read by flame graph tools.\n"
+                                                        "Each line is a call stack followed by the microseconds spent in its last function.\n"
+                                                        "@param filename The file to write.\n"
+                                                        "@return Whether the file was written or not." )
+{
+   char fileName[1024];
+   Con::expandPath( fileName, sizeof(fileName), argv[1] );
+   return gScriptProfiler.dumpCollapsedStacks( fileName );
+}
+
+ConsoleFunctionGroupEnd( ScriptProfiler );
@@ -58,6 +58,7 @@
 #include "platform/nativeDialogs/msgBox.h"
 #include "platform/nativeDialogs/fileDialog.h"
 #include "memory/safeDelete.h"
+#include "platform/threads/threadPool.h"
 
 #include <stdio.h>
 
@@ -159,6 +160,9 @@ bool initializeLibraries()
     Processor::init();
     Math::init();
 
+    // Start the worker threads used for parallel loading.
+    ThreadPool::create();
+
     Platform::init();    // platform specific initialization
 
     // Initialize the particle system.
@@ -182,6 +186,8 @@ void shutdownLibraries()
     TelnetDebugger::destroy();
     TelnetConsole::destroy();
 
+    ThreadPool::destroy();
+
     Sim::shutdown();
     Platform::shutdown();
 
@@ -434,6 +440,7 @@ void DefaultGame::mainLoop( void )
 #ifdef TORQUE_OS_IOS_PROFILE
     iPhoneProfilerStart("MAIN_LOOP");
 #endif	
+         PROFILE_FRAME();
          PROFILE_START(MainLoop);
 #ifdef TORQUE_ALLOW_JOURNALING
          PROFILE_START(JournalMain);
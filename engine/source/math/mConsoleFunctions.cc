@@ -67,12 +67,12 @@ ConsoleFunction( mSolveQuartic, const char *, 6, 6, "(float a, float b, float c,
    return retBuffer;
 }
 
-ConsoleFunction( mFloor, S32, 2, 2, "( val ) Use the mFloor function to calculate the next lowest integer value from val.\n"
+ConsoleValueFunction( mFloor, 2, 2, "( val ) Use the mFloor function to calculate the next lowest integer value from val.\n"
                                                                 "@param val A floating-point value.\n"
                                                                 "@return Returns an integer representing the next lowest integer from val.\n"
                                                                 "@sa mCeil")
 {
-   return (S32)mFloor(dAtof(argv[1]));
+   return ConsoleValue::fromInt((S32)mFloor((F32)argv[1].getFloatValue()));
 }
 ConsoleFunction( mRound, F32, 2, 2, "(float v) Rounds a number. 0.5 is rounded up.\n"
                 "@param val A floating-point value\n"
@@ -82,12 +82,12 @@ ConsoleFunction( mRound, F32, 2, 2, "(float v) Rounds a number. 0.5 is rounded u
    return mRound( dAtof(argv[1]) );
 }
 
-ConsoleFunction( mCeil, S32, 2, 2, "( val ) Use the mCeil function to calculate the next highest integer value from val.\n"
+ConsoleValueFunction( mCeil, 2, 2, "( val ) Use the mCeil function to calculate the next highest integer value from val.\n"
                                                                 "@param val A floating-point value.\n"
                                                                 "@return Returns an integer representing the next highest integer from val.\n"
                                                                 "@sa mFloor")
 {
-   return (S32)mCeil(dAtof(argv[1]));
+   return ConsoleValue::fromInt((S32)mCeil((F32)argv[1].getFloatValue()));
 }
 
 
@@ -108,26 +108,26 @@ ConsoleFunction( mFloatLength, const char *, 3, 3, "( val , numDecimals ) Use th
 }
 
 //------------------------------------------------------------------------------
-ConsoleFunction( mAbs, F32, 2, 2, "( val ) Use the mAbs function to get the magnitude of val.\n"
+ConsoleValueFunction( mAbs, 2, 2, "( val ) Use the mAbs function to get the magnitude of val.\n"
                                                                 "@param val An integer or a floating-point value.\n"
                                                                 "@return Returns the magnitude of val")
 {
-   return(mFabs(dAtof(argv[1])));
+   return ConsoleValue::fromFloat(mFabs((F32)argv[1].getFloatValue()));
 }
 
-ConsoleFunction( mSqrt, F32, 2, 2, "( val ) Use the mSqrt function to calculated the square root of val.\n"
+ConsoleValueFunction( mSqrt, 2, 2, "( val ) Use the mSqrt function to calculated the square root of val.\n"
                                                                 "@param val A numeric value.\n"
                                                                 "@return Returns the the squareroot of val")
 {
-   return(mSqrt(dAtof(argv[1])));
+   return ConsoleValue::fromFloat(mSqrt((F32)argv[1].getFloatValue()));
 }
 
-ConsoleFunction( mPow, F32, 3, 3, "( val , power ) Use the mPow function to calculated val raised to the power of power.\n"
+ConsoleValueFunction( mPow, 3, 3, "( val , power ) Use the mPow function to calculated val raised to the power of power.\n"
                                                                 "@param val A numeric (integer or floating-point) value to be raised to a power.\n"
                                                                 "@param power A numeric (integer or floating-point) power to raise val to.\n"
                                                                 "@return Returns val^power")
 {
-   return(mPow(dAtof(argv[1]), dAtof(argv[2])));
+   return ConsoleValue::fromFloat(mPow((F32)argv[1].getFloatValue(), (F32)argv[2].getFloatValue()));
 }
 
 ConsoleFunction( mLog, F32, 2, 2, "( val ) Use the mLog function to calculate the natural logarithm of val.\n"
@@ -137,28 +137,28 @@ ConsoleFunction( mLog, F32, 2, 2, "( val ) Use the mLog function to calculate th
    return(mLog(dAtof(argv[1])));
 }
 
-ConsoleFunction( mSin, F32, 2, 2, "( val ) Use the mSin function to get the sine of the radian angle val.\n"
+ConsoleValueFunction( mSin, 2, 2, "( val ) Use the mSin function to get the sine of the radian angle val.\n"
                                                                 "@param val A value between -3.14159 and 3.14159.\n"
                                                                 "@return Returns the sine of val. This value will be in the range [ -1.0 , 1.0 ].\n"
                                                                 "@sa mAsin")
 {
-   return(mSin(dAtof(argv[1])));
+   return ConsoleValue::fromFloat(mSin((F32)argv[1].getFloatValue()));
 }
 
-ConsoleFunction( mCos, F32, 2, 2, "( val ) Use the mCos function to get the cosine of the radian angle val.\n"
+ConsoleValueFunction( mCos, 2, 2, "( val ) Use the mCos function to get the cosine of the radian angle val.\n"
                                                                 "@param val A value between -3.14159 and 3.14159.\n"
                                                                 "@return Returns the cosine of val. This value will be in the range [ -1.0 , 1.0 ].\n"
                                                                 "@sa mAcos")
 {
-   return(mCos(dAtof(argv[1])));
+   return ConsoleValue::fromFloat(mCos((F32)argv[1].getFloatValue()));
 }
 
-ConsoleFunction( mTan, F32, 2, 2, "( val ) Use the mTan function to get the tangent of the radian angle val.\n"
+ConsoleValueFunction( mTan, 2, 2, "( val ) Use the mTan function to get the tangent of the radian angle val.\n"
                                                                 "@param val A value between -3.14159/2 and 3.14159/2.\n"
                                                                 "@return Returns the tangent of val. This value will be in the range [ -inf.0 , inf.0 ].\n"
                                                                 "@sa mAtan")
 {
-   return(mTan(dAtof(argv[1])));
+   return ConsoleValue::fromFloat(mTan((F32)argv[1].getFloatValue()));
 }
 
 ConsoleFunction( mAsin, F32, 2, 2, "( val ) Use the mAsin function to get the inverse sine of val in radians.\n"
@@ -177,13 +177,13 @@ ConsoleFunction( mAcos, F32, 2, 2, "( val ) Use the mAcos function to get the in
    return(mAcos(dAtof(argv[1])));
 }
 
-ConsoleFunction( mAtan, F32, 3, 3, "( val ) Use the mAtan function to get the inverse tangent of rise/run in radians.\n"
+ConsoleValueFunction( mAtan, 3, 3, "( val ) Use the mAtan function to get the inverse tangent of rise/run in radians.\n"
                                                                 "@param rise Vertical component of a line.\n"
                                                                 "@param run Horizontal component of a line.\n"
                                                                 "@return Returns the slope in radians (the arc-tangent) of a line with the given rise and run.\n"
                                                                 "@sa mTan")
 {
-   return(mAtan(dAtof(argv[1]), dAtof(argv[2])));
+   return ConsoleValue::fromFloat(mAtan((F32)argv[1].getFloatValue(), (F32)argv[2].getFloatValue()));
 }
 
 ConsoleFunction( mRadToDeg, F32, 2, 2, "( val ) Use the mRadToDeg function to convert radians to degrees.\n"
@@ -202,30 +202,30 @@ ConsoleFunction( mDegToRad, F32, 2, 2, "( val ) Use the mDegToRad function to co
    return(mDegToRad(dAtof(argv[1])));
 }
 
-ConsoleFunction( mClamp, F32, 4, 4, "(float number, float min, float max) Clamp a value between two other values.\n"
+ConsoleValueFunction( mClamp, 4, 4, "(float number, float min, float max) Clamp a value between two other values.\n"
                 "@param number A float value representing the number to clamp\n"
                 "@param min The lower bound\n"
                 "@param max The upper bound\n"
                 "@return A float value the is within the given range")
 {
-   F32 value = dAtof( argv[1] );
-   F32 min = dAtof( argv[2] );
-   F32 max = dAtof( argv[3] );
-   return mClampF( value, min, max );
+   F32 value = (F32)argv[1].getFloatValue();
+   F32 min = (F32)argv[2].getFloatValue();
+   F32 max = (F32)argv[3].getFloatValue();
+   return ConsoleValue::fromFloat( mClampF( value, min, max ) );
 }
 
 //-----------------------------------------------------------------------------
 
-ConsoleFunction( mGetMin, F32, 3, 3, "(a, b) - Returns the Minimum of two values.")
+ConsoleValueFunction( mGetMin, 3, 3, "(a, b) - Returns the Minimum of two values.")
 {
-   return getMin(dAtof(argv[1]), dAtof(argv[2]));
+   return ConsoleValue::fromFloat(getMin((F32)argv[1].getFloatValue(), (F32)argv[2].getFloatValue()));
 }
 
 //-----------------------------------------------------------------------------
 
-ConsoleFunction( mGetMax, F32, 3, 3, "(a, b) - Returns the Maximum of two values.")
+ConsoleValueFunction( mGetMax, 3, 3, "(a, b) - Returns the Maximum of two values.")
 {
-   return getMax(dAtof(argv[1]), dAtof(argv[2]));
+   return ConsoleValue::fromFloat(getMax((F32)argv[1].getFloatValue(), (F32)argv[2].getFloatValue()));
 }
 
 //-----------------------------------------------------------------------------
@@ -121,6 +121,15 @@ GL_GROUP_BEGIN(EXT_blend_minmax)
 GL_FUNCTION(void,       glBlendEquationEXT, (GLenum mode), return; )
 GL_GROUP_END()
 
+//ARB_vertex_buffer_object
+GL_GROUP_BEGIN(ARB_vertex_buffer_object)
+GL_FUNCTION(void,       glBindBufferARB, (GLenum target, GLuint buffer), return; )
+GL_FUNCTION(void,       glDeleteBuffersARB, (GLsizei n, const GLuint* buffers), return; )
+GL_FUNCTION(void,       glGenBuffersARB, (GLsizei n, GLuint* buffers), return; )
+GL_FUNCTION(void,       glBufferDataARB, (GLenum target, GLsizeiptrARB size, const void* data, GLenum usage), return; )
+GL_FUNCTION(void,       glBufferSubDataARB, (GLenum target, GLintptrARB offset, GLsizeiptrARB size, const void* data), return; )
+GL_GROUP_END()
+
 //NV_vertex_array_range
 #ifdef TORQUE_OS_WIN32
 GL_GROUP_BEGIN(NV_vertex_array_range)
@@ -167,6 +167,7 @@ struct Platform
     static U32 getTime( void );
     static U32 getVirtualMilliseconds( void );
     static U32 getRealMilliseconds( void );
+    static F64 getHighResolutionMilliseconds( void );
     static void advanceTime(U32 delta);
     static S32 getBackgroundSleepTime();
     static void getLocalTime(LocalTime &);
@@ -0,0 +1,183 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#include "platform/threads/threadPool.h"
+#include "platform/platformAssert.h"
+#include "math/mMathFn.h"
+
+#include <thread>
+
+ThreadPool *ThreadPool::smGlobal = NULL;
+
+//-----------------------------------------------------------------------------
+
+void ThreadPool::WorkerThread::run(void *arg /* = 0 */)
+{
+   for(;;)
+   {
+      mPool->mWorkSemaphore.acquire();
+      if(mPool->mShutdown)
+         return;
+
+      mPool->runJobs();
+   }
+}
+
+//-----------------------------------------------------------------------------
+
+ThreadPool::ThreadPool(U32 workerCount /* = 0 */)
+   : mWorkSemaphore(0),
+     mDoneSemaphore(0),
+     mShutdown(false),
+     mBatchActive(false),
+     mJob(NULL),
+     mContext(NULL),
+     mJobCount(0),
+     mNextJob(0),
+     mJobsDone(0),
+     mWaiting(false)
+{
+   // The calling thread works too, so leave it a processor.
+   if(workerCount == 0)
+   {
+      const U32 processorCount = std::thread::hardware_concurrency();
+      workerCount = processorCount > 1 ? processorCount - 1 : 0;
+   }
+
+   for(U32 i = 0; i < workerCount; ++i)
+   {
+      WorkerThread *worker = new WorkerThread(this);
+      mWorkers.push_back(worker);
+      worker->start();
+   }
+}
+
+ThreadPool::~ThreadPool()
+{
+   mShutdown = true;
+   for(S32 i = 0; i < mWorkers.size(); ++i)
+      mWorkSemaphore.release();
+
+   for(S32 i = 0; i < mWorkers.size(); ++i)
+   {
+      mWorkers[i]->join();
+      delete mWorkers[i];
+   }
+   mWorkers.clear();
+}
+
+//-----------------------------------------------------------------------------
+
+void ThreadPool::runJobs()
+{
+   for(;;)
+   {
+      mLock.lock();
+      if(mNextJob >= mJobCount)
+      {
+         mLock.unlock();
+         return;
+      }
+      const U32 index = mNextJob++;
+      JobFunction job = mJob;
+      void *context = mContext;
+      mLock.unlock();
+
+      job(context, index);
+
+      // Wake the caller if it is waiting on this, the last job.
+      mLock.lock();
+      if(++mJobsDone == mJobCount && mWaiting)
+         mDoneSemaphore.release();
+      mLock.unlock();
+   }
+}
+
+void ThreadPool::parallelFor(JobFunction job, void *context, U32 jobCount)
+{
+   AssertFatal(job != NULL, "ThreadPool::parallelFor - Cannot run a NULL job.");
+
+   // Small batches, and batches started while another is running, are run here and now.
+   bool serial = jobCount <= 1 || mWorkers.size() == 0;
+   if(!serial)
+   {
+      mLock.lock();
+      serial = mBatchActive;
+      mBatchActive = true;
+      mLock.unlock();
+   }
+
+   if(serial)
+   {
+      for(U32 i = 0; i < jobCount; ++i)
+         job(context, i);
+      return;
+   }
+
+   mLock.lock();
+   mJob = job;
+   mContext = context;
+   mJobCount = jobCount;
+   mNextJob = 0;
+   mJobsDone = 0;
+   mWaiting = false;
+   mLock.unlock();
+
+   const U32 wakeCount = getMin(jobCount - 1, (U32)mWorkers.size());
+   for(U32 i = 0; i < wakeCount; ++i)
+      mWorkSemaphore.release();
+
+   runJobs();
+
+   // Wait for jobs still running on the workers.
+   mLock.lock();
+   mWaiting = mJobsDone != mJobCount;
+   const bool wait = mWaiting;
+   mLock.unlock();
+
+   if(wait)
+      mDoneSemaphore.acquire();
+
+   // Workers woken too late to find a job see an empty batch.
+   mLock.lock();
+   mJob = NULL;
+   mContext = NULL;
+   mJobCount = 0;
+   mNextJob = 0;
+   mWaiting = false;
+   mBatchActive = false;
+   mLock.unlock();
+}
+
+//-----------------------------------------------------------------------------
+
+void ThreadPool::create()
+{
+   AssertFatal(smGlobal == NULL, "ThreadPool::create - The pool has already been created.");
+   smGlobal = new ThreadPool();
+}
+
+void ThreadPool::destroy()
+{
+   delete smGlobal;
+   smGlobal = NULL;
+}
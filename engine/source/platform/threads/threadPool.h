@@ -0,0 +1,95 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _PLATFORM_THREADS_THREADPOOL_H_
+#define _PLATFORM_THREADS_THREADPOOL_H_
+
+#include "platform/types.h"
+#include "collection/vector.h"
+#include "platform/threads/thread.h"
+#include "platform/threads/mutex.h"
+#include "platform/threads/semaphore.h"
+
+/// A fixed set of worker threads that run batches of independent jobs.
+///
+/// A batch is a job function and a context run once for every index in a range.
+/// The calling thread runs jobs alongside the workers and only returns once every
+/// job in the batch has finished, so the context can live on the caller's stack.
+///
+/// Jobs must not touch the console, the sim or anything else that is not thread
+/// safe.  One batch runs at a time; a batch started while another is running (for
+/// instance from inside a job) simply runs on the calling thread.
+class ThreadPool
+{
+public:
+   typedef void (*JobFunction)(void *context, U32 index);
+
+private:
+   class WorkerThread : public Thread
+   {
+      ThreadPool *mPool;
+
+   public:
+      WorkerThread(ThreadPool *pool) : Thread(0, 0, false), mPool(pool) {}
+      virtual void run(void *arg = 0);
+   };
+
+   static ThreadPool *smGlobal;
+
+   Vector<WorkerThread*> mWorkers;
+
+   /// Guards the batch below.
+   Mutex mLock;
+
+   Semaphore mWorkSemaphore;
+   Semaphore mDoneSemaphore;
+   bool mShutdown;
+
+   bool mBatchActive;
+   JobFunction mJob;
+   void *mContext;
+   U32 mJobCount;
+   U32 mNextJob;
+   U32 mJobsDone;
+   bool mWaiting;
+
+   void runJobs();
+
+public:
+   /// Create a pool.
+   /// @param workerCount The number of worker threads, zero to size the pool to the processor count.
+   ThreadPool(U32 workerCount = 0);
+   ~ThreadPool();
+
+   /// Run job(context, index) for every index in [0, jobCount) and wait for them all to finish.
+   void parallelFor(JobFunction job, void *context, U32 jobCount);
+
+   /// Returns the number of worker threads (not counting the calling thread).
+   U32 getWorkerCount() const { return mWorkers.size(); }
+
+   /// The shared engine pool.
+   static void create();
+   static void destroy();
+   static ThreadPool *getGlobal() { return smGlobal; }
+};
+
+#endif // _PLATFORM_THREADS_THREADPOOL_H_
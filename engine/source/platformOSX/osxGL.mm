@@ -225,6 +225,10 @@ void getGLCapabilities()
         if (dStrstr(pExtString, (const char*)"GL_EXT_vertex_buffer") != NULL)
             gGLState.suppVertexBuffer = true;
         
+        // ARB_vertex_buffer_object ========================================
+        if (dStrstr(pExtString, (const char*)"GL_ARB_vertex_buffer_object") != NULL)
+            gGLState.suppARBVertexBufferObject = true;
+        
         // Anisotropic filtering ========================================
         gGLState.suppTexAnisotropic    = (dStrstr(pExtString, (const char*)"GL_EXT_texture_filter_anisotropic") != NULL);
         if (gGLState.suppTexAnisotropic)
@@ -284,6 +288,9 @@ void getGLCapabilities()
     if (gGLState.suppVertexArrayRange)
         Con::printf("  NV_vertex_array_range");
     
+    if (gGLState.suppARBVertexBufferObject)
+        Con::printf("  ARB_vertex_buffer_object");
+    
     if (gGLState.suppTextureEnvCombine)
         Con::printf("  EXT_texture_env_combine");
     
@@ -334,6 +341,9 @@ void getGLCapabilities()
     if (!gGLState.suppVertexArrayRange)
         Con::warnf("  NV_vertex_array_range");
     
+    if (!gGLState.suppARBVertexBufferObject)
+        Con::warnf("  ARB_vertex_buffer_object");
+    
     if (!gGLState.suppTextureEnvCombine)
         Con::warnf("  EXT_texture_env_combine");
     
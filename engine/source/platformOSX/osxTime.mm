@@ -23,6 +23,7 @@
 #import "platformOSX/platformOSX.h"
 #import "platform/event.h"
 #import "game/gameInterface.h"
+#import <mach/mach_time.h>
 
 #pragma mark ---- TimeManager Class Methods ----
 
@@ -105,6 +106,27 @@ U32 Platform::getRealMilliseconds()
     return (U32)([NSDate timeIntervalSinceReferenceDate] * 1000);
 }
 
+//------------------------------------------------------------------------------
+// Gets the milliseconds per absolute time unit
+static F64 _OSXGetMillisecondsPerAbsoluteTime()
+{
+    mach_timebase_info_data_t timebaseInfo;
+    mach_timebase_info(&timebaseInfo);
+    return (F64)timebaseInfo.numer / (1000000.0 * timebaseInfo.denom);
+}
+
+// Set-up before any threads start.
+static const F64 sgMillisecondsPerAbsoluteTime = _OSXGetMillisecondsPerAbsoluteTime();
+static const U64 sgHighResolutionStartTime = mach_absolute_time();
+
+//------------------------------------------------------------------------------
+// Gets the time in milliseconds since the app started, with sub-millisecond
+// precision. Use this to measure short intervals.
+F64 Platform::getHighResolutionMilliseconds()
+{
+    return (F64)(mach_absolute_time() - sgHighResolutionStartTime) * sgMillisecondsPerAbsoluteTime;
+}
+
 //------------------------------------------------------------------------------
 // Gets the running time for this app in milliseconds
 U32 Platform::getVirtualMilliseconds()
@@ -100,6 +100,7 @@ struct GLState
 
    bool suppPalettedTexture;
    bool suppVertexBuffer;
+   bool suppARBVertexBufferObject;
    bool suppSwapInterval;
 
    GLint maxFSAASamples;
@@ -213,6 +214,11 @@ inline bool dglDoesSupportVertexBuffer()
    return false;
 }
 
+inline bool dglDoesSupportARBVertexBufferObject()
+{
+   return gGLState.suppARBVertexBufferObject;
+}
+
 inline GLfloat dglGetMaxAnisotropy()
 {
    return gGLState.maxAnisotropy;
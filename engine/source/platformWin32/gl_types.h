@@ -25,6 +25,8 @@
 #ifndef _WIN32_GL_TYPES_H_
 #define _WIN32_GL_TYPES_H_
 
+#include <stddef.h>
+
 // added by BJG:
 #define GL_RGB_SCALE 0x8573
 
@@ -73,6 +75,14 @@
 
 #define GL_CLAMP_TO_EDGE_EXT     0x812F
 
+#ifndef GL_ARB_vertex_buffer_object
+#define GL_ARRAY_BUFFER_ARB               0x8892
+#define GL_ELEMENT_ARRAY_BUFFER_ARB       0x8893
+#define GL_STREAM_DRAW_ARB                0x88E0
+#define GL_STATIC_DRAW_ARB                0x88E4
+#define GL_DYNAMIC_DRAW_ARB               0x88E8
+#endif
+
 #define GL_V12MTVFMT_EXT                     0x8702
 #define GL_V12MTNVFMT_EXT                     0x8703
 #define GL_V12FTVFMT_EXT                     0x8704
@@ -171,6 +181,8 @@ typedef float		GLfloat;	/* single precision float */
 typedef float		GLclampf;	/* single precision float in [0,1] */
 typedef double		GLdouble;	/* double precision float */
 typedef double		GLclampd;	/* double precision float in [0,1] */
+typedef ptrdiff_t	GLintptrARB;	/* pointer sized signed */
+typedef ptrdiff_t	GLsizeiptrARB;	/* pointer sized signed */
 
 
 
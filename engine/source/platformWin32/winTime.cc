@@ -61,6 +61,30 @@ U32 Platform::getRealMilliseconds()
    return GetTickCount();
 }
 
+//--------------------------------------
+static S64 getPerformanceCount()
+{
+   LARGE_INTEGER count;
+   QueryPerformanceCounter( &count );
+   return count.QuadPart;
+}
+
+static F64 getPerformanceMillisecondsPerCount()
+{
+   LARGE_INTEGER frequency;
+   QueryPerformanceFrequency( &frequency );
+   return 1000.0 / (F64)frequency.QuadPart;
+}
+
+// Set-up before any threads start.
+static const F64 sgPerformanceMillisecondsPerCount = getPerformanceMillisecondsPerCount();
+static const S64 sgPerformanceStartCount = getPerformanceCount();
+
+F64 Platform::getHighResolutionMilliseconds()
+{
+   return (F64)(getPerformanceCount() - sgPerformanceStartCount) * sgPerformanceMillisecondsPerCount;
+}
+
 U32 Platform::getVirtualMilliseconds()
 {
    return winState.currentTime;
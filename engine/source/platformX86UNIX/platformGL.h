@@ -78,6 +78,7 @@ struct GLState
    bool suppTexAnisotropic;
    bool suppPalettedTexture;
         bool suppVertexBuffer;
+   bool suppARBVertexBufferObject;
    bool suppSwapInterval;
    unsigned int triCount[4];
    unsigned int primCount[4];
@@ -185,6 +186,11 @@ inline bool dglDoesSupportVertexBuffer()
         return gGLState.suppVertexBuffer;
 }
 
+inline bool dglDoesSupportARBVertexBufferObject()
+{
+   return gGLState.suppARBVertexBufferObject;
+}
+
 inline GLfloat dglGetMaxAnisotropy()
 {
    return gGLState.maxAnisotropy;
@@ -67,6 +67,25 @@ U32 Platform::getRealMilliseconds()
    return x86UNIXGetTickCount();
 }
 
+//--------------------------------------
+static timeval getHighResolutionStartTime()
+{
+   timeval t;
+   gettimeofday(&t, NULL);
+   return t;
+}
+
+// Set-up before any threads start.
+static const timeval sgHighResolutionStartTime = getHighResolutionStartTime();
+
+F64 Platform::getHighResolutionMilliseconds()
+{
+   timeval t;
+   gettimeofday(&t, NULL);
+
+   return (F64)(t.tv_sec - sgHighResolutionStartTime.tv_sec) * 1000.0 + (F64)(t.tv_usec - sgHighResolutionStartTime.tv_usec) / 1000.0;
+}
+
 U32 Platform::getVirtualMilliseconds()
 {
    return x86UNIXState->currentTime;
@@ -49,6 +49,18 @@ void iPhoneGLMatrixMode( GLenum mode );
 #define glPopMatrix iPhoneGLPopMatrix
 #define glMatrixMode iPhoneGLMatrixMode
 
+// ARB_vertex_buffer_object is core in OpenGL ES 1.1 (without stream draw).
+#define glBindBufferARB glBindBuffer
+#define glDeleteBuffersARB glDeleteBuffers
+#define glGenBuffersARB glGenBuffers
+#define glBufferDataARB glBufferData
+#define glBufferSubDataARB glBufferSubData
+#define GL_ARRAY_BUFFER_ARB GL_ARRAY_BUFFER
+#define GL_ELEMENT_ARRAY_BUFFER_ARB GL_ELEMENT_ARRAY_BUFFER
+#define GL_STREAM_DRAW_ARB GL_DYNAMIC_DRAW
+#define GL_STATIC_DRAW_ARB GL_STATIC_DRAW
+#define GL_DYNAMIC_DRAW_ARB GL_DYNAMIC_DRAW
+
 class ColorI;
 
 // defines that need functional workarounds
@@ -94,6 +94,15 @@ U32 Platform::getRealMilliseconds()
    return ret;
 }   
 
+// Set-up before any threads start.
+static const uint64_t sgHighResolutionStartTime = mach_absolute_time();
+
+/// Gets the time in milliseconds since the app started, with sub-millisecond precision.
+F64 Platform::getHighResolutionMilliseconds()
+{
+   return (F64)(mach_absolute_time() - sgHighResolutionStartTime) * absolute_to_millis;
+}
+
 U32 Platform::getVirtualMilliseconds()
 {
    return platState.currentTime;   
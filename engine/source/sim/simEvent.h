@@ -53,14 +53,15 @@ typedef U32 SimTime;
 class SimEvent
 {
   public:
-   SimEvent *nextEvent;     ///< Linked list details - pointer to next item in the list.
+   U32 queueIndex;          ///< Position of the event in the event queue heap.
+   SimEvent *nextPosted;    ///< Next event posted from another thread and not yet in the heap.
    SimTime startTime;       ///< When the event was posted.
    SimTime time;            ///< When the event is scheduled to occur.
    U32 sequenceCount;       ///< Unique ID. These are assigned sequentially based on order
                             ///  of addition to the list.
    SimObject *destObject;   ///< Object on which this event will be applied.
 
-   SimEvent() { destObject = NULL; }
+   SimEvent() { destObject = NULL; nextPosted = NULL; }
    virtual ~SimEvent() {}   ///< Destructor
                             ///
                             /// A dummy virtual destructor is required
@@ -0,0 +1,242 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+
+#include "sim/simEventQueue.h"
+#include "console/console.h"
+#include "string/stringTable.h"
+
+//---------------------------------------------------------------------------
+
+SimEventQueue::SimEventQueue() :
+   mNextOrder(0),
+   mPostedEvents(NULL)
+{
+}
+
+SimEventQueue::~SimEventQueue()
+{
+   deleteAll();
+}
+
+//---------------------------------------------------------------------------
+
+void SimEventQueue::insert(SimEvent* event)
+{
+   AssertFatal(event != NULL, "SimEventQueue::insert: Cannot insert a NULL event.");
+
+   HashMap<U32, SimEvent*>::iterator itr = mEventMap.insert(event->sequenceCount, event);
+   AssertFatal(itr != mEventMap.end(), "SimEventQueue::insert: An event with this sequence count is already pending.");
+
+   HeapEntry entry;
+   entry.mTime = event->time;
+   entry.mOrder = mNextOrder++;
+   entry.mEvent = event;
+
+   mHeap.increment();
+   setEntry(mHeap.size() - 1, entry);
+   siftUp(mHeap.size() - 1);
+}
+
+//---------------------------------------------------------------------------
+
+void SimEventQueue::post(SimEvent* event)
+{
+   SimEvent* head = mPostedEvents.load(std::memory_order_relaxed);
+   do
+   {
+      event->nextPosted = head;
+   }
+   while (!mPostedEvents.compare_exchange_weak(head, event, std::memory_order_release, std::memory_order_relaxed));
+}
+
+void SimEventQueue::insertPosted(const SimTime currentTime)
+{
+   // Take the whole inbox at once then reverse it so the events are inserted in the order they were posted.
+   SimEvent* walk = mPostedEvents.exchange(NULL, std::memory_order_acquire);
+   SimEvent* ordered = NULL;
+   while (walk)
+   {
+      SimEvent* next = walk->nextPosted;
+      walk->nextPosted = ordered;
+      ordered = walk;
+      walk = next;
+   }
+
+   while (ordered)
+   {
+      SimEvent* event = ordered;
+      ordered = event->nextPosted;
+      event->nextPosted = NULL;
+
+      // The poster may have read the time just before it advanced.
+      if (event->time < currentTime)
+         event->time = currentTime;
+
+      insert(event);
+   }
+}
+
+//---------------------------------------------------------------------------
+
+SimEvent* SimEventQueue::find(U32 eventSequence)
+{
+   HashMap<U32, SimEvent*>::iterator itr = mEventMap.find(eventSequence);
+   return itr == mEventMap.end() ? NULL : itr->value;
+}
+
+//---------------------------------------------------------------------------
+
+void SimEventQueue::remove(SimEvent* event)
+{
+   AssertFatal(event->queueIndex < (U32)mHeap.size() && mHeap[event->queueIndex].mEvent == event,
+      "SimEventQueue::remove: Event is not in the queue.");
+
+   mEventMap.erase(event->sequenceCount);
+   removeAt(event->queueIndex);
+}
+
+//---------------------------------------------------------------------------
+
+SimEvent* SimEventQueue::pop(void)
+{
+   if (mHeap.size() == 0)
+      return NULL;
+
+   SimEvent* event = mHeap[0].mEvent;
+   mEventMap.erase(event->sequenceCount);
+   removeAt(0);
+   return event;
+}
+
+//---------------------------------------------------------------------------
+
+void SimEventQueue::deleteObjectEvents(SimObject* object)
+{
+   // Compact the surviving events then restore the heap in one pass.
+   Vector<SimEvent*> deletedEvents;
+   U32 keepCount = 0;
+   for (U32 index = 0; index < (U32)mHeap.size(); ++index)
+   {
+      const HeapEntry& entry = mHeap[index];
+      if (entry.mEvent->destObject == object)
+      {
+         mEventMap.erase(entry.mEvent->sequenceCount);
+         deletedEvents.push_back(entry.mEvent);
+      }
+      else
+      {
+         setEntry(keepCount++, entry);
+      }
+   }
+
+   if (deletedEvents.size() == 0)
+      return;
+
+   mHeap.setSize(keepCount);
+   for (S32 index = (S32)(keepCount / 2) - 1; index >= 0; --index)
+      siftDown(index);
+
+   for (S32 index = 0; index < deletedEvents.size(); ++index)
+      delete deletedEvents[index];
+}
+
+//---------------------------------------------------------------------------
+
+void SimEventQueue::deleteAll(void)
+{
+   SimEvent* walk = mPostedEvents.exchange(NULL, std::memory_order_acquire);
+   while (walk)
+   {
+      SimEvent* next = walk->nextPosted;
+      delete walk;
+      walk = next;
+   }
+
+   for (S32 index = 0; index < mHeap.size(); ++index)
+      delete mHeap[index].mEvent;
+
+   mHeap.clear();
+   mEventMap.clear();
+}
+
+//---------------------------------------------------------------------------
+
+void SimEventQueue::siftUp(U32 index)
+{
+   const HeapEntry entry = mHeap[index];
+   while (index > 0)
+   {
+      const U32 parent = (index - 1) / 2;
+      if (!isEarlier(entry, mHeap[parent]))
+         break;
+
+      setEntry(index, mHeap[parent]);
+      index = parent;
+   }
+   setEntry(index, entry);
+}
+
+void SimEventQueue::siftDown(U32 index)
+{
+   const U32 count = mHeap.size();
+   const HeapEntry entry = mHeap[index];
+   for (;;)
+   {
+      U32 child = index * 2 + 1;
+      if (child >= count)
+         break;
+
+      if (child + 1 < count && isEarlier(mHeap[child + 1], mHeap[child]))
+         ++child;
+
+      if (!isEarlier(mHeap[child], entry))
+         break;
+
+      setEntry(index, mHeap[child]);
+      index = child;
+   }
+   setEntry(index, entry);
+}
+
+void SimEventQueue::removeAt(const U32 index)
+{
+   const U32 lastIndex = mHeap.size() - 1;
+   if (index != lastIndex)
+   {
+      // Move the last entry into the hole then restore the heap in whichever direction it needs.
+      setEntry(index, mHeap[lastIndex]);
+      mHeap.decrement();
+      if (index > 0 && isEarlier(mHeap[index], mHeap[(index - 1) / 2]))
+         siftUp(index);
+      else
+         siftDown(index);
+   }
+   else
+   {
+      mHeap.decrement();
+   }
+}
+
+//---------------------------------------------------------------------------
+
+#include "sim/simEventQueue_ScriptBinding.h"
@@ -0,0 +1,127 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+
+#ifndef _SIM_EVENT_QUEUE_H_
+#define _SIM_EVENT_QUEUE_H_
+
+#ifndef _SIM_EVENT_H_
+#include "sim/simEvent.h"
+#endif
+
+#ifndef _VECTOR_H_
+#include "collection/vector.h"
+#endif
+
+#ifndef _HASHTABLE_H
+#include "collection/hashTable.h"
+#endif
+
+#include <atomic>
+
+//---------------------------------------------------------------------------
+
+/// Pending events ordered by the time they are scheduled to occur.
+///
+/// Events are kept in a binary heap so posting and dispatching are O(log n)
+/// in the number of pending events.  Events scheduled for the same time are
+/// dispatched in the order they were inserted, which Con::threadSafeExecute()
+/// relies on to execute script code in the correct order.
+///
+/// Events are also indexed by their sequence count so they can be found and
+/// cancelled without walking the queue.  The queue owns the events it holds
+/// and does no locking of its own.
+///
+/// Other threads hand events over with post() which is lock free.  Posted
+/// events wait in an inbox until the owner moves them into the queue with
+/// insertPosted(), after which they are dispatched in the order they were
+/// posted relative to each other.
+class SimEventQueue
+{
+public:
+   SimEventQueue();
+   ~SimEventQueue();
+
+   /// Inserts an event.  Its time and unique sequence count must already be set.
+   void insert(SimEvent* event);
+
+   /// Adds an event to the inbox.  This is safe to call from any thread at any time.
+   void post(SimEvent* event);
+
+   /// Inserts every event in the inbox.  Events scheduled before the current time are moved up to it.
+   void insertPosted(const SimTime currentTime);
+
+   /// Finds the pending event with the specified sequence count or NULL if there isn't one.
+   SimEvent* find(U32 eventSequence);
+
+   /// Removes a pending event from the queue.  The caller then owns the event.
+   void remove(SimEvent* event);
+
+   /// Deletes every pending event destined for the specified object.
+   void deleteObjectEvents(SimObject* object);
+
+   /// Deletes every pending and posted event.
+   void deleteAll(void);
+
+   /// The earliest event or NULL if the queue is empty.
+   inline SimEvent* peek(void) const { return mHeap.size() ? mHeap[0].mEvent : NULL; }
+
+   /// Removes the earliest event.  The caller then owns the event.
+   SimEvent* pop(void);
+
+   inline U32 size(void) const { return mHeap.size(); }
+   inline bool isEmpty(void) const { return mHeap.size() == 0; }
+
+private:
+   /// The sort key is stored alongside the event so sifting doesn't touch the events themselves.
+   struct HeapEntry
+   {
+      SimTime     mTime;
+      U32         mOrder;
+      SimEvent*   mEvent;
+   };
+
+   inline static bool isEarlier(const HeapEntry& a, const HeapEntry& b)
+   {
+      // Insertion orders are compared with wrap-around so FIFO order survives the counter overflowing.
+      return a.mTime < b.mTime || (a.mTime == b.mTime && (S32)(a.mOrder - b.mOrder) < 0);
+   }
+
+   inline void setEntry(const U32 index, const HeapEntry& entry)
+   {
+      mHeap[index] = entry;
+      entry.mEvent->queueIndex = index;
+   }
+
+   void siftUp(U32 index);
+   void siftDown(U32 index);
+   void removeAt(const U32 index);
+
+   Vector<HeapEntry>          mHeap;
+   HashMap<U32, SimEvent*>    mEventMap;
+   U32                        mNextOrder;
+
+   /// Posted events, most recent first.
+   std::atomic<SimEvent*>     mPostedEvents;
+};
+
+#endif // _SIM_EVENT_QUEUE_H_
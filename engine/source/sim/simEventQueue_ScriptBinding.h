@@ -0,0 +1,153 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+
+#ifndef _MRANDOM_H_
+#include "math/mRandom.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+// Stands in for scheduled events when benchmarking the event queue.
+class BenchmarkSimEvent : public SimEvent
+{
+public:
+   BenchmarkSimEvent() : mNext(NULL) {}
+   virtual void process(SimObject *object) {}
+
+   BenchmarkSimEvent* mNext;
+};
+
+//-----------------------------------------------------------------------------
+
+ConsoleFunction( benchmarkEventQueue, const char*, 2, 3,   "(eventCount, [timeRange]) - Times the event queue against the sorted linked list it replaced.\n"
+                                                            "Both queues are given the same randomly timed events, a quarter of which are then cancelled by id, "
+                                                            "and then drained.  Their dispatch orders are checked to be identical.\n"
+                                                            "@param eventCount The number of events to post.\n"
+                                                            "@param timeRange The range of times the events are scheduled over.  Small ranges produce plenty of ties.  Defaults to 10000.\n"
+                                                            "@return (queueTime listTime) The time taken by each queue in milliseconds or an empty string on failure." )
+{
+   const S32 eventCount = dAtoi(argv[1]);
+   const S32 timeRange = argc >= 3 ? dAtoi(argv[2]) : 10000;
+
+   // Sanity!
+   if ( eventCount <= 0 || timeRange <= 0 )
+   {
+      Con::warnf( "benchmarkEventQueue() - Invalid event count or time range." );
+      return StringTable->EmptyString;
+   }
+
+   // Generate the event times up front so both queues see the same events.
+   RandomLCG random( 12345 );
+   Vector<SimTime> eventTimes;
+   eventTimes.setSize( eventCount );
+   for ( S32 index = 0; index < eventCount; ++index )
+      eventTimes[index] = (SimTime)random.randRangeI( 0, timeRange - 1 );
+
+   Vector<U32> queueOrder;
+   Vector<U32> listOrder;
+
+   // Time the event queue.
+   F64 startTime = Platform::getHighResolutionMilliseconds();
+   {
+      SimEventQueue eventQueue;
+      for ( S32 index = 0; index < eventCount; ++index )
+      {
+         BenchmarkSimEvent* pEvent = new BenchmarkSimEvent();
+         pEvent->time = eventTimes[index];
+         pEvent->sequenceCount = index + 1;
+         eventQueue.insert( pEvent );
+      }
+
+      for ( S32 index = 0; index < eventCount; index += 4 )
+      {
+         SimEvent* pEvent = eventQueue.find( index + 1 );
+         eventQueue.remove( pEvent );
+         delete pEvent;
+      }
+
+      while ( !eventQueue.isEmpty() )
+      {
+         SimEvent* pEvent = eventQueue.pop();
+         queueOrder.push_back( pEvent->sequenceCount );
+         delete pEvent;
+      }
+   }
+   const F32 queueTime = (F32)(Platform::getHighResolutionMilliseconds() - startTime);
+
+   // Time the sorted linked list.
+   startTime = Platform::getHighResolutionMilliseconds();
+   {
+      BenchmarkSimEvent* pHead = NULL;
+      for ( S32 index = 0; index < eventCount; ++index )
+      {
+         BenchmarkSimEvent* pEvent = new BenchmarkSimEvent();
+         pEvent->time = eventTimes[index];
+         pEvent->sequenceCount = index + 1;
+
+         BenchmarkSimEvent** walk = &pHead;
+         while ( *walk != NULL && (*walk)->time <= pEvent->time )
+            walk = &(*walk)->mNext;
+         pEvent->mNext = *walk;
+         *walk = pEvent;
+      }
+
+      for ( S32 index = 0; index < eventCount; index += 4 )
+      {
+         for ( BenchmarkSimEvent** walk = &pHead; *walk != NULL; walk = &(*walk)->mNext )
+         {
+            if ( (*walk)->sequenceCount == (U32)(index + 1) )
+            {
+               BenchmarkSimEvent* pEvent = *walk;
+               *walk = pEvent->mNext;
+               delete pEvent;
+               break;
+            }
+         }
+      }
+
+      while ( pHead != NULL )
+      {
+         BenchmarkSimEvent* pEvent = pHead;
+         pHead = pEvent->mNext;
+         listOrder.push_back( pEvent->sequenceCount );
+         delete pEvent;
+      }
+   }
+   const F32 listTime = (F32)(Platform::getHighResolutionMilliseconds() - startTime);
+
+   // Check the queues agree.
+   S32 mismatches = queueOrder.size() == listOrder.size() ? 0 : 1;
+   for ( S32 index = 0; index < queueOrder.size() && index < listOrder.size(); ++index )
+   {
+      if ( queueOrder[index] != listOrder[index] )
+         mismatches++;
+   }
+
+   Con::printf( "benchmarkEventQueue() - %d events over %d ticks: queue %.3fms, list %.3fms, %d mismatches.",
+      eventCount, timeRange, queueTime, listTime, mismatches );
+
+   // Format Buffer.
+   char* pBuffer = Con::getReturnBuffer(64);
+   dSprintf( pBuffer, 64, "%g %g", queueTime, listTime );
+   return pBuffer;
+}
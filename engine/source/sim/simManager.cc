@@ -23,6 +23,7 @@
 #include "platform/platform.h"
 #include "platform/threads/mutex.h"
 #include "sim/simBase.h"
+#include "sim/simEventQueue.h"
 #include "string/stringTable.h"
 #include "console/console.h"
 #include "io/fileStream.h"
@@ -31,6 +32,8 @@
 #include "console/consoleInternal.h"
 #include "memory/safeDelete.h"
 
+#include <atomic>
+
 //---------------------------------------------------------------------------
 
 // We comment out the implementation of the Con namespace when doxygenizing because
@@ -44,12 +47,12 @@ namespace Sim
 //---------------------------------------------------------------------------
 // event queue variables:
 
-SimTime gCurrentTime;
+std::atomic<SimTime> gCurrentTime;
 SimTime gTargetTime;
 
 void *gEventQueueMutex;
-SimEvent *gEventQueue;
-U32 gEventSequence;
+SimEventQueue *gEventQueue;
+std::atomic<U32> gEventSequence;
 
 //---------------------------------------------------------------------------
 // event queue init/shutdown
@@ -59,7 +62,7 @@ void initEventQueue()
    gCurrentTime = 0;
    gTargetTime = 0;
    gEventSequence = 1;
-   gEventQueue = NULL;
+   gEventQueue = new SimEventQueue();
    gEventQueueMutex = Mutex::createMutex();
 }
 
@@ -67,13 +70,7 @@ void shutdownEventQueue()
 {
    // Delete all pending events
    Mutex::lockMutex(gEventQueueMutex);
-   SimEvent *walk = gEventQueue;
-   while(walk)
-   {
-      SimEvent *temp = walk->nextEvent;
-      delete walk;
-      walk = temp;
-   }
+   SAFE_DELETE(gEventQueue);
    Mutex::unlockMutex(gEventQueueMutex);
    Mutex::destroyMutex(gEventQueueMutex);
 }
@@ -83,43 +80,43 @@ void shutdownEventQueue()
 
 U32 postEvent(SimObject *destObject, SimEvent* event,U32 time)
 {
-    AssertFatal(time == -1 || time >= getCurrentTime(),
+   // Other threads read the time without the lock and may be a tick behind.  Their events are clamped when they are inserted.
+   const bool mainThread = Con::isMainThread();
+   AssertFatal(!mainThread || time == -1 || time >= getCurrentTime(),
         "Sim::postEvent: Cannot go back in time. (flux capacitor unavailable -- BJG)");
    AssertFatal(destObject, "Destination object for event doesn't exist.");
 
-   Mutex::lockMutex(gEventQueueMutex);
+   if(!destObject)
+   {
+      delete event;
+      return InvalidEventId;
+   }
 
+   const SimTime currentTime = gCurrentTime;
    if( time == -1 )
-      time = gCurrentTime;
+      time = currentTime;
 
    event->time = time;
-   event->startTime = gCurrentTime;
+   event->startTime = currentTime;
    event->destObject = destObject;
+   event->sequenceCount = gEventSequence++;
 
-   if(!destObject)
+   const U32 seqCount = event->sequenceCount;
+
+   // Events from other threads go through the lock free inbox so they never wait on the dispatch loop.
+   // The inbox is emptied into the queue whenever the queue is locked.
+   if(!mainThread)
    {
-      delete event;
+      gEventQueue->post(event);
+      return seqCount;
+   }
 
-      Mutex::unlockMutex(gEventQueueMutex);
+   Mutex::lockMutex(gEventQueueMutex);
 
-      return InvalidEventId;
-   }
-   event->sequenceCount = gEventSequence++;
-   SimEvent **walk = &gEventQueue;
-   SimEvent *current;
-   
-   while((current = *walk) != NULL && (current->time < event->time))
-      walk = &(current->nextEvent);
-   
-   // [tom, 6/24/2005] This ensures that SimEvents are dispatched in the same order that they are posted.
+   // [tom, 6/24/2005] The queue dispatches events with the same time in the order that they are posted.
    // This is needed to ensure Con::threadSafeExecute() executes script code in the correct order.
-   while((current = *walk) != NULL && (current->time == event->time))
-      walk = &(current->nextEvent);
-   
-   event->nextEvent = current;
-   *walk = event;
-
-   U32 seqCount = event->sequenceCount;
+   gEventQueue->insertPosted(gCurrentTime);
+   gEventQueue->insert(event);
 
    Mutex::unlockMutex(gEventQueueMutex);
 
@@ -132,21 +129,13 @@ U32 postEvent(SimObject *destObject, SimEvent* event,U32 time)
 void cancelEvent(U32 eventSequence)
 {
    Mutex::lockMutex(gEventQueueMutex);
+   gEventQueue->insertPosted(gCurrentTime);
 
-   SimEvent **walk = &gEventQueue;
-   SimEvent *current;
-   
-   while((current = *walk) != NULL)
+   SimEvent *event = gEventQueue->find(eventSequence);
+   if(event)
    {
-      if(current->sequenceCount == eventSequence)
-      {
-         *walk = current->nextEvent;
-         delete current;
-         Mutex::unlockMutex(gEventQueueMutex);
-         return;
-      }
-      else
-         walk = &(current->nextEvent);
+      gEventQueue->remove(event);
+      delete event;
    }
 
    Mutex::unlockMutex(gEventQueueMutex);
@@ -155,20 +144,8 @@ void cancelEvent(U32 eventSequence)
 void cancelPendingEvents(SimObject *obj)
 {
    Mutex::lockMutex(gEventQueueMutex);
-
-   SimEvent **walk = &gEventQueue;
-   SimEvent *current;
-   
-   while((current = *walk) != NULL)
-   {
-      if(current->destObject == obj)
-      {
-         *walk = current->nextEvent;
-         delete current;
-      }
-      else
-         walk = &(current->nextEvent);
-   }
+   gEventQueue->insertPosted(gCurrentTime);
+   gEventQueue->deleteObjectEvents(obj);
    Mutex::unlockMutex(gEventQueueMutex);
 }
 
@@ -178,48 +155,49 @@ void cancelPendingEvents(SimObject *obj)
 bool isEventPending(U32 eventSequence)
 {
    Mutex::lockMutex(gEventQueueMutex);
-
-   for(SimEvent *walk = gEventQueue; walk; walk = walk->nextEvent)
-      if(walk->sequenceCount == eventSequence)
-      {
-         Mutex::unlockMutex(gEventQueueMutex);
-         return true;
-      }
+   gEventQueue->insertPosted(gCurrentTime);
+   const bool pending = gEventQueue->find(eventSequence) != NULL;
    Mutex::unlockMutex(gEventQueueMutex);
-   return false;
+   return pending;
 }
 
 U32 getEventTimeLeft(U32 eventSequence)
 {
    Mutex::lockMutex(gEventQueueMutex);
+   gEventQueue->insertPosted(gCurrentTime);
 
-   for(SimEvent *walk = gEventQueue; walk; walk = walk->nextEvent)
-      if(walk->sequenceCount == eventSequence)
-      {
-         SimTime t = walk->time - getCurrentTime();
-         Mutex::unlockMutex(gEventQueueMutex);
-         return t;
-      }
+   SimEvent *event = gEventQueue->find(eventSequence);
+   SimTime t = event ? event->time - getCurrentTime() : 0;
 
    Mutex::unlockMutex(gEventQueueMutex);
 
-   return 0;   
+   return t;
 }
 
 U32 getScheduleDuration(U32 eventSequence)
 {
-   for(SimEvent *walk = gEventQueue; walk; walk = walk->nextEvent)
-      if(walk->sequenceCount == eventSequence)
-         return (walk->time-walk->startTime);
-   return 0;
+   Mutex::lockMutex(gEventQueueMutex);
+   gEventQueue->insertPosted(gCurrentTime);
+
+   SimEvent *event = gEventQueue->find(eventSequence);
+   SimTime t = event ? event->time - event->startTime : 0;
+
+   Mutex::unlockMutex(gEventQueueMutex);
+
+   return t;
 }
 
 U32 getTimeSinceStart(U32 eventSequence)
 {
-   for(SimEvent *walk = gEventQueue; walk; walk = walk->nextEvent)
-      if(walk->sequenceCount == eventSequence)
-         return (getCurrentTime()-walk->startTime);
-   return 0;
+   Mutex::lockMutex(gEventQueueMutex);
+   gEventQueue->insertPosted(gCurrentTime);
+
+   SimEvent *event = gEventQueue->find(eventSequence);
+   SimTime t = event ? getCurrentTime() - event->startTime : 0;
+
+   Mutex::unlockMutex(gEventQueueMutex);
+
+   return t;
 }
 
 //---------------------------------------------------------------------------
@@ -231,10 +209,10 @@ void advanceToTime(SimTime targetTime)
 
    Mutex::lockMutex(gEventQueueMutex);
    gTargetTime = targetTime;
-   while(gEventQueue && gEventQueue->time <= targetTime)
+   gEventQueue->insertPosted(gCurrentTime);
+   while(!gEventQueue->isEmpty() && gEventQueue->peek()->time <= targetTime)
    {
-      SimEvent *event = gEventQueue;
-      gEventQueue = gEventQueue->nextEvent;
+      SimEvent *event = gEventQueue->pop();
       AssertFatal(event->time >= gCurrentTime,
             "SimEventQueue::pop: Cannot go back in time (flux capacitor not installed - BJG).");
       gCurrentTime = event->time;
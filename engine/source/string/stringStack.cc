@@ -32,7 +32,19 @@ void StringStack::getArgcArgv(StringTableEntry name, U32 *argc, const char ***in
    mArgV[0] = name;
    
    for(U32 i = 0; i < argCount; i++)
-      mArgV[i+1] = mBuffer + mStartOffsets[startStack + i];
+   {
+      const U32 slot = startStack + i;
+      char *arg = mBuffer + mStartOffsets[slot];
+
+      // Numbers are only formatted once someone asks for them as strings.
+      if(mSlotTypes[slot] == ConsoleValue::TypeInt)
+         dSprintf(arg, ConsoleValue::StringBufferSize, "%d", (S32)mSlotNumbers[slot]);
+      else if(mSlotTypes[slot] == ConsoleValue::TypeFloat)
+         dSprintf(arg, ConsoleValue::StringBufferSize, "%.9g", mSlotNumbers[slot]);
+      mSlotTypes[slot] = ConsoleValue::TypeString;
+
+      mArgV[i+1] = arg;
+   }
    argCount++;
    
    *argc = argCount;
@@ -40,3 +52,31 @@ void StringStack::getArgcArgv(StringTableEntry name, U32 *argc, const char ***in
    if(popStackFrame)
       popFrame();
 }
+
+void StringStack::getArgValues(StringTableEntry name, U32 *argc, ConsoleValue **in_argv)
+{
+   U32 startStack = mFrameOffsets[mNumFrames-1] + 1;
+   U32 argCount   = getMin(mStartStackSize - startStack, (U32)MaxArgs - 1);
+
+   *in_argv = mArgValues;
+   mArgValues[0].setStringValue(name);
+
+   for(U32 i = 0; i < argCount; i++)
+   {
+      const U32 slot = startStack + i;
+      ConsoleValue &value = mArgValues[i+1];
+      char *arg = mBuffer + mStartOffsets[slot];
+
+      if(mSlotTypes[slot] == ConsoleValue::TypeInt)
+         value.setIntValue((S32)mSlotNumbers[slot]);
+      else if(mSlotTypes[slot] == ConsoleValue::TypeFloat)
+         value.setFloatValue(mSlotNumbers[slot]);
+      else
+         value.setStringValue(arg);
+
+      value.setStringBuffer(arg);
+   }
+   argCount++;
+
+   *argc = argCount;
+}
@@ -26,6 +26,7 @@
 #include "platform/platform.h"
 #include "console/console.h"
 #include "console/compiler.h"
+#include "console/consoleValue.h"
 #include "string/stringTable.h"
 
 /// Core stack for interpreter operations.
@@ -42,9 +43,15 @@ struct StringStack
    char *mBuffer;
    U32   mBufferSize;
    const char *mArgV[MaxArgs];
+   ConsoleValue mArgValues[MaxArgs];
    U32 mFrameOffsets[MaxStackDepth];
    U32 mStartOffsets[MaxStackDepth];
 
+   /// Value type of each pushed entry.  Numeric entries keep their value in
+   /// mSlotNumbers and only reserve room for their string form in mBuffer.
+   U8  mSlotTypes[MaxStackDepth];
+   F64 mSlotNumbers[MaxStackDepth];
+
    U32 mNumFrames;
    U32 mArgc;
 
@@ -184,6 +191,7 @@ struct StringStack
    ///       properly push the stack.
    void advance()
    {
+      mSlotTypes[mStartStackSize] = ConsoleValue::TypeString;
       mStartOffsets[mStartStackSize++] = mStart;
       mStart += mLen;
       mLen = 0;
@@ -196,6 +204,7 @@ struct StringStack
    ///       properly push the stack.
    void advanceChar(char c)
    {
+      mSlotTypes[mStartStackSize] = ConsoleValue::TypeString;
       mStartOffsets[mStartStackSize++] = mStart;
       mStart += mLen;
       mBuffer[mStart] = c;
@@ -210,6 +219,32 @@ struct StringStack
       advanceChar(0);
    }
 
+   /// Push a number without formatting it, reserving room for its string
+   /// form in case the callee asks for one.
+   void pushNumber(ConsoleValue::Type type, F64 value)
+   {
+      validateBufferSize(mStart + ConsoleValue::StringBufferSize + 1);
+      mSlotTypes[mStartStackSize] = type;
+      mSlotNumbers[mStartStackSize] = value;
+      mStartOffsets[mStartStackSize++] = mStart;
+      mBuffer[mStart] = 0;
+      mStart += ConsoleValue::StringBufferSize;
+      mBuffer[mStart] = 0;
+      mLen = 0;
+   }
+
+   /// Push an integer without formatting it.
+   void pushInt(S32 value)
+   {
+      pushNumber(ConsoleValue::TypeInt, value);
+   }
+
+   /// Push a float without formatting it.
+   void pushFloat(F64 value)
+   {
+      pushNumber(ConsoleValue::TypeFloat, value);
+   }
+
    inline void setLen(U32 newlen)
    {
       mLen = newlen;
@@ -265,7 +300,15 @@ struct StringStack
    }
 
    /// Get the arguments for a function call from the stack.
+   ///
+   /// Numbers pushed with pushInt() or pushFloat() are formatted in place.
    void getArgcArgv(StringTableEntry name, U32 *argc, const char ***in_argv, bool popStackFrame = false);
+
+   /// Get the arguments for a function call from the stack as tagged values.
+   ///
+   /// Unlike getArgcArgv(), numbers are left unformatted.  The values stay
+   /// valid until the frame is popped.
+   void getArgValues(StringTableEntry name, U32 *argc, ConsoleValue **in_argv);
 };
 
 #endif
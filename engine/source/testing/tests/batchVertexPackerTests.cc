@@ -0,0 +1,123 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _BATCH_VERTEX_PACKER_H_
+#include "2d/core/BatchVertexPacker.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+// Adds a unit quad at the specified x position.
+static void addTestQuad( BatchVertexPacker& packer, const U32 textureBinding, const F32 x )
+{
+    packer.addQuad(
+        textureBinding,
+        Vector2( x, 0.0f ), Vector2( x + 1.0f, 0.0f ), Vector2( x + 1.0f, 1.0f ), Vector2( x, 1.0f ),
+        Vector2( 0.0f, 0.0f ), Vector2( 1.0f, 0.0f ), Vector2( 1.0f, 1.0f ), Vector2( 0.0f, 1.0f ),
+        ColorI( 255, 128, 64, 32 ) );
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( BatchVertexPackerTests, PackSingleBatch )
+{
+    BatchVertexPacker packer( 4 );
+    addTestQuad( packer, 7, 0.0f );
+    addTestQuad( packer, 7, 2.0f );
+
+    BatchVertex vertices[8];
+    ASSERT_EQ( 8u, packer.pack( vertices ) ) << "Vertex count is wrong.";
+    ASSERT_EQ( 1u, (U32)packer.getTextureBatches().size() ) << "Batch count is wrong.";
+
+    // Vertices are packed as corners 0, 1, 3, 2.
+    ASSERT_EQ( 0.0f, vertices[0].mPosition.x );
+    ASSERT_EQ( 1.0f, vertices[1].mPosition.x );
+    ASSERT_EQ( 0.0f, vertices[2].mPosition.x );
+    ASSERT_EQ( 1.0f, vertices[2].mPosition.y );
+    ASSERT_EQ( 1.0f, vertices[3].mTexturePosition.x );
+    ASSERT_EQ( 1.0f, vertices[3].mTexturePosition.y );
+    ASSERT_EQ( 2.0f, vertices[4].mPosition.x );
+    ASSERT_EQ( 128, vertices[5].mColor.green );
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( BatchVertexPackerTests, PackGroupsByTexture )
+{
+    BatchVertexPacker packer( 8 );
+    addTestQuad( packer, 3, 0.0f );
+    addTestQuad( packer, 5, 1.0f );
+    addTestQuad( packer, 3, 2.0f );
+    addTestQuad( packer, 9, 3.0f );
+    addTestQuad( packer, 5, 4.0f );
+
+    BatchVertex vertices[20];
+    ASSERT_EQ( 20u, packer.pack( vertices ) ) << "Vertex count is wrong.";
+
+    // Batches are in order of first use.
+    const BatchVertexPacker::typeTextureBatchVector& batches = packer.getTextureBatches();
+    ASSERT_EQ( 3u, (U32)batches.size() ) << "Batch count is wrong.";
+    ASSERT_EQ( 3u, batches[0].mTextureBinding );
+    ASSERT_EQ( 0u, batches[0].mFirstQuad );
+    ASSERT_EQ( 2u, batches[0].mQuadCount );
+    ASSERT_EQ( 5u, batches[1].mTextureBinding );
+    ASSERT_EQ( 2u, batches[1].mFirstQuad );
+    ASSERT_EQ( 2u, batches[1].mQuadCount );
+    ASSERT_EQ( 9u, batches[2].mTextureBinding );
+    ASSERT_EQ( 4u, batches[2].mFirstQuad );
+    ASSERT_EQ( 1u, batches[2].mQuadCount );
+
+    // Quads keep their submission order within a batch.
+    const F32 expectedX[] = { 0.0f, 2.0f, 1.0f, 4.0f, 3.0f };
+    for ( U32 quadIndex = 0; quadIndex < 5; ++quadIndex )
+    {
+        ASSERT_EQ( expectedX[quadIndex], vertices[quadIndex * 4].mPosition.x ) << "Quad " << quadIndex << " is out of order.";
+    }
+
+    // Clearing removes the quads and batches.
+    packer.clear();
+    ASSERT_EQ( 0u, packer.getQuadCount() );
+    ASSERT_EQ( 0u, (U32)packer.getTextureBatches().size() );
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( BatchVertexPackerTests, QuadIndices )
+{
+    U16 indices[BatchVertexPacker::QuadIndexCount * 2];
+    BatchVertexPacker::buildQuadIndices( indices, 2 );
+
+    const U16 expected[] = { 0, 1, 2, 3, 2, 1, 4, 5, 6, 7, 6, 5 };
+    for ( U32 index = 0; index < BatchVertexPacker::QuadIndexCount * 2; ++index )
+    {
+        ASSERT_EQ( expected[index], indices[index] ) << "Index " << index << " is wrong.";
+    }
+}
+
+#endif // TORQUE_SHIPPING
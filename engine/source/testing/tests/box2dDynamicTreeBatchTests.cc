@@ -0,0 +1,150 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _RANDOM_TEST_AABB_H_
+#include "testing/tests/randomTestAABB.h"
+#endif
+
+#include <algorithm>
+#include <vector>
+
+//-----------------------------------------------------------------------------
+
+// Collects proxies from both the single and batched tree queries.
+class TestTreeQueryCallback
+{
+public:
+   std::vector<int32> mSingleProxies;
+   std::vector< std::vector<int32> > mBatchProxies;
+   int32 mBatchBase;
+
+   bool QueryCallback( int32 proxyId )
+   {
+      mSingleProxies.push_back( proxyId );
+      return true;
+   }
+
+   float32 RayCastCallback( const b2RayCastInput& input, int32 proxyId )
+   {
+      mSingleProxies.push_back( proxyId );
+      return input.maxFraction;
+   }
+
+   bool QueryBatchCallback( int32 proxyId, uint32 queryMask )
+   {
+      for ( int32 n = 0; n < b2_maxBatchQueries; ++n )
+      {
+         if ( queryMask & (1u << n) )
+            mBatchProxies[mBatchBase + n].push_back( proxyId );
+      }
+
+      return true;
+   }
+
+   bool RayCastBatchCallback( int32 proxyId, uint32 queryMask )
+   {
+      return QueryBatchCallback( proxyId, queryMask );
+   }
+};
+
+//-----------------------------------------------------------------------------
+
+static void populateTestTree( b2DynamicTree& tree, RandomLCG& random )
+{
+   for ( int32 n = 0; n < 2000; ++n )
+      tree.CreateProxy( getRandomTestAABB( random, 500.0f, 5.0f ), NULL );
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( Box2DDynamicTreeBatchTests, QueryBatchMatchesQuery )
+{
+   RandomLCG random( 1 );
+   b2DynamicTree tree;
+   populateTestTree( tree, random );
+
+   // Use a count that leaves a partial final batch.
+   const int32 queryCount = 100;
+   std::vector<b2AABB> aabbs( queryCount );
+   for ( int32 n = 0; n < queryCount; ++n )
+   {
+      aabbs[n] = getRandomTestAABB( random, 500.0f, 40.0f );
+   }
+
+   TestTreeQueryCallback callback;
+   callback.mBatchProxies.resize( queryCount );
+   for ( callback.mBatchBase = 0; callback.mBatchBase < queryCount; callback.mBatchBase += b2_maxBatchQueries )
+      tree.QueryBatch( &callback, &aabbs[callback.mBatchBase], b2Min( (int32)b2_maxBatchQueries, queryCount - callback.mBatchBase ) );
+
+   for ( int32 n = 0; n < queryCount; ++n )
+   {
+      callback.mSingleProxies.clear();
+      tree.Query( &callback, aabbs[n] );
+
+      std::sort( callback.mSingleProxies.begin(), callback.mSingleProxies.end() );
+      std::sort( callback.mBatchProxies[n].begin(), callback.mBatchProxies[n].end() );
+      ASSERT_TRUE( callback.mSingleProxies == callback.mBatchProxies[n] );
+   }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( Box2DDynamicTreeBatchTests, RayCastBatchMatchesRayCast )
+{
+   RandomLCG random( 2 );
+   b2DynamicTree tree;
+   populateTestTree( tree, random );
+
+   const int32 rayCount = 100;
+   std::vector<b2RayCastInput> rays( rayCount );
+   for ( int32 n = 0; n < rayCount; ++n )
+   {
+      rays[n].p1.Set( random.randRangeF( 0.0f, 500.0f ), random.randRangeF( 0.0f, 500.0f ) );
+      rays[n].p2.Set( random.randRangeF( 0.0f, 500.0f ), random.randRangeF( 0.0f, 500.0f ) );
+      rays[n].maxFraction = 1.0f;
+   }
+
+   TestTreeQueryCallback callback;
+   callback.mBatchProxies.resize( rayCount );
+   for ( callback.mBatchBase = 0; callback.mBatchBase < rayCount; callback.mBatchBase += b2_maxBatchQueries )
+      tree.RayCastBatch( &callback, &rays[callback.mBatchBase], b2Min( (int32)b2_maxBatchQueries, rayCount - callback.mBatchBase ) );
+
+   for ( int32 n = 0; n < rayCount; ++n )
+   {
+      callback.mSingleProxies.clear();
+      tree.RayCast( &callback, rays[n] );
+
+      std::sort( callback.mSingleProxies.begin(), callback.mSingleProxies.end() );
+      std::sort( callback.mBatchProxies[n].begin(), callback.mBatchProxies[n].end() );
+      ASSERT_TRUE( callback.mSingleProxies == callback.mBatchProxies[n] );
+   }
+}
+
+#endif // TORQUE_SHIPPING
@@ -0,0 +1,199 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _PLATFORM_THREADS_THREADPOOL_H_
+#include "platform/threads/threadPool.h"
+#endif
+
+#include "box2d/Box2D.h"
+
+//-----------------------------------------------------------------------------
+
+// Runs Box2D tasks on a thread pool.
+class TestTaskExecutor : public b2TaskExecutor
+{
+   ThreadPool mThreadPool;
+   b2TaskFunction* mpTask;
+   void* mpContext;
+
+   static void runTask( void* context, U32 index )
+   {
+      TestTaskExecutor* pExecutor = static_cast<TestTaskExecutor*>( context );
+      pExecutor->mpTask( pExecutor->mpContext, (int32)index );
+   }
+
+public:
+   TestTaskExecutor( const U32 workerCount ) : mThreadPool( workerCount ), mpTask( NULL ), mpContext( NULL ) {}
+
+   virtual void ParallelFor( b2TaskFunction* task, void* context, int32 count )
+   {
+      mpTask = task;
+      mpContext = context;
+      mThreadPool.parallelFor( &runTask, this, (U32)count );
+   }
+
+   virtual int32 GetThreadCount( void ) const { return (int32)mThreadPool.getWorkerCount() + 1; }
+};
+
+//-----------------------------------------------------------------------------
+
+// Sums the impulses reported after solving, in the order they are reported.
+class TestContactListener : public b2ContactListener
+{
+public:
+   TestContactListener() : mImpulseSum( 0.0 ), mBeginCount( 0 ), mEndCount( 0 ) {}
+
+   virtual void BeginContact( b2Contact* pContact ) { ++mBeginCount; }
+   virtual void EndContact( b2Contact* pContact ) { ++mEndCount; }
+   virtual void PostSolve( b2Contact* pContact, const b2ContactImpulse* pImpulse )
+   {
+      for ( S32 index = 0; index < pImpulse->count; ++index )
+         mImpulseSum = mImpulseSum * 0.5 + pImpulse->normalImpulses[index];
+   }
+
+   F64 mImpulseSum;
+   U32 mBeginCount;
+   U32 mEndCount;
+};
+
+//-----------------------------------------------------------------------------
+
+// The state of a world after it has been stepped.
+struct TestWorldResult
+{
+   Vector<b2Vec2> mPositions;
+   Vector<F32> mAngles;
+   Vector<bool> mAwake;
+   F64 mImpulseSum;
+   U32 mBeginCount;
+   U32 mEndCount;
+};
+
+// Steps piles of boxes and circles on shared static ground, with sensors and joints
+// to the ground, so that many islands share the same static bodies.
+static void stepTestWorld( b2TaskExecutor* pExecutor, TestWorldResult& result )
+{
+   b2World world( b2Vec2( 0.0f, -10.0f ) );
+   TestContactListener listener;
+   world.SetContactListener( &listener );
+   world.SetTaskExecutor( pExecutor );
+
+   b2BodyDef groundDef;
+   b2Body* pGround = world.CreateBody( &groundDef );
+   b2EdgeShape groundEdge;
+   groundEdge.Set( b2Vec2( -200.0f, 0.0f ), b2Vec2( 200.0f, 0.0f ) );
+   pGround->CreateFixture( &groundEdge, 0.0f );
+
+   for ( S32 pile = 0; pile < 24; ++pile )
+   {
+      for ( S32 level = 0; level < 12; ++level )
+      {
+         b2BodyDef bodyDef;
+         bodyDef.type = b2_dynamicBody;
+         bodyDef.position.Set( -180.0f + pile * 15.0f + (level % 3) * 0.1f, 0.5f + level * 1.05f );
+         b2Body* pBody = world.CreateBody( &bodyDef );
+
+         if ( level % 3 == 0 )
+         {
+            b2CircleShape circle;
+            circle.m_radius = 0.5f;
+            pBody->CreateFixture( &circle, 1.0f );
+         }
+         else
+         {
+            b2PolygonShape box;
+            box.SetAsBox( 0.5f, 0.5f );
+            pBody->CreateFixture( &box, 1.0f );
+         }
+
+         if ( level == 4 )
+         {
+            b2CircleShape sensorCircle;
+            sensorCircle.m_radius = 0.8f;
+            b2FixtureDef sensorDef;
+            sensorDef.shape = &sensorCircle;
+            sensorDef.isSensor = true;
+            pBody->CreateFixture( &sensorDef );
+         }
+
+         if ( level == 11 )
+         {
+            b2RevoluteJointDef jointDef;
+            jointDef.Initialize( pGround, pBody, pBody->GetPosition() + b2Vec2( 0.0f, 2.0f ) );
+            world.CreateJoint( &jointDef );
+         }
+      }
+   }
+
+   for ( S32 step = 0; step < 240; ++step )
+      world.Step( 1.0f / 60.0f, 8, 3 );
+
+   for ( b2Body* pBody = world.GetBodyList(); pBody; pBody = pBody->GetNext() )
+   {
+      result.mPositions.push_back( pBody->GetPosition() );
+      result.mAngles.push_back( pBody->GetAngle() );
+      result.mAwake.push_back( pBody->IsAwake() );
+   }
+
+   result.mImpulseSum = listener.mImpulseSum;
+   result.mBeginCount = listener.mBeginCount;
+   result.mEndCount = listener.mEndCount;
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( Box2DParallelStepTests, MatchesSerialStepExactly )
+{
+   TestWorldResult serialResult;
+   stepTestWorld( NULL, serialResult );
+
+   const U32 workerCounts[] = { 1, 3 };
+   for ( U32 countIndex = 0; countIndex < 2; ++countIndex )
+   {
+      TestTaskExecutor executor( workerCounts[countIndex] );
+      TestWorldResult parallelResult;
+      stepTestWorld( &executor, parallelResult );
+
+      ASSERT_EQ( serialResult.mPositions.size(), parallelResult.mPositions.size() );
+      for ( S32 index = 0; index < serialResult.mPositions.size(); ++index )
+      {
+         // Bitwise equality is intended; the step must not depend on the thread count.
+         ASSERT_EQ( serialResult.mPositions[index].x, parallelResult.mPositions[index].x ) << "Body " << index << " moved differently.";
+         ASSERT_EQ( serialResult.mPositions[index].y, parallelResult.mPositions[index].y ) << "Body " << index << " moved differently.";
+         ASSERT_EQ( serialResult.mAngles[index], parallelResult.mAngles[index] ) << "Body " << index << " rotated differently.";
+         ASSERT_EQ( serialResult.mAwake[index], parallelResult.mAwake[index] ) << "Body " << index << " slept differently.";
+      }
+
+      ASSERT_EQ( serialResult.mImpulseSum, parallelResult.mImpulseSum ) << "Impulses were reported differently.";
+      ASSERT_EQ( serialResult.mBeginCount, parallelResult.mBeginCount );
+      ASSERT_EQ( serialResult.mEndCount, parallelResult.mEndCount );
+   }
+}
+
+#endif // TORQUE_SHIPPING
@@ -0,0 +1,155 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _PARTICLE_ASSET_FIELD_H_
+#include "2d/assets/ParticleAssetField.h"
+#endif
+
+#ifndef _TAML_CUSTOM_H_
+#include "persistence/taml/tamlCustom.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+// Configures a life field with a few keys that don't fall on lookup table intervals.
+static void initializeTestField( ParticleAssetField& field )
+{
+   field.initialize( 1.0f, 0.0f, 10.0f, 1.0f );
+   field.setSingleDataKey( 2.0f );
+   field.addDataKey( 0.3f, 9.0f );
+   field.addDataKey( 0.71f, 1.5f );
+   field.addDataKey( 1.0f, 4.0f );
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( ParticleAssetFieldTests, LookupTableMatchesDataKeys )
+{
+   ParticleAssetField field;
+   initializeTestField( field );
+
+   // The lookup table should follow the data keys to within 1% of the value range.
+   for ( U32 index = 0; index <= 1000; ++index )
+   {
+      const F32 time = index / 1000.0f;
+      ASSERT_NEAR( field.getFieldValue( time ), field.sampleLookupTable( time ), 0.1f ) << "Lookup table differs at time " << time << ".";
+   }
+
+   // Times outside the field are clamped.
+   ASSERT_NEAR( field.getFieldValue( 0.0f ), field.sampleLookupTable( -1.0f ), 0.0001f );
+   ASSERT_NEAR( field.getFieldValue( 1.0f ), field.sampleLookupTable( 2.0f ), 0.0001f );
+
+   // Editing the field rebakes the lookup table.
+   field.setDataKeyValue( 0, 6.0f );
+   ASSERT_NEAR( 6.0f, field.sampleLookupTable( 0.0f ), 0.0001f );
+   field.setValueScale( 0.5f );
+   ASSERT_NEAR( 3.0f, field.sampleLookupTable( 0.0f ), 0.0001f );
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( ParticleAssetFieldTests, BatchSamplingMatchesScalar )
+{
+   ParticleAssetField field;
+   initializeTestField( field );
+
+   // Use an odd count so both the batched and remaining samples are covered.
+   const U32 sampleCount = 37;
+   F32 times[sampleCount];
+   F32 scales[sampleCount];
+   F32 values[sampleCount];
+   for ( U32 index = 0; index < sampleCount; ++index )
+   {
+      times[index] = (index * 0.037f) - 0.1f;
+      scales[index] = 0.5f + index * 0.1f;
+   }
+
+   // Sample with per-value scales and clamping.
+   field.sampleLookupTable( times, scales, 2.0f, 1.0f, 8.0f, values, sampleCount );
+   for ( U32 index = 0; index < sampleCount; ++index )
+   {
+      const F32 expected = mClampF( field.sampleLookupTable( times[index] ) * scales[index] * 2.0f, 1.0f, 8.0f );
+      ASSERT_NEAR( expected, values[index], 0.0001f ) << "Batched sample " << index << " is wrong.";
+   }
+
+   // Sample without scales.
+   field.sampleLookupTable( times, NULL, 1.0f, -F32_MAX, F32_MAX, values, sampleCount );
+   for ( U32 index = 0; index < sampleCount; ++index )
+   {
+      ASSERT_NEAR( field.sampleLookupTable( times[index] ), values[index], 0.0001f ) << "Batched sample " << index << " is wrong.";
+   }
+}
+
+//-----------------------------------------------------------------------------
+
+// Checks that the lookup table of a loaded field follows its data keys.
+static void checkLoadedTestField( const ParticleAssetField& field )
+{
+   ASSERT_EQ( 4u, field.getDataKeyCount() );
+   ASSERT_NEAR( 9.0f, field.sampleLookupTable( 0.3f ), 0.1f );
+
+   for ( U32 index = 0; index <= 1000; ++index )
+   {
+      const F32 time = index / 1000.0f;
+      ASSERT_NEAR( field.getFieldValue( time ), field.sampleLookupTable( time ), 0.1f ) << "Loaded lookup table differs at time " << time << ".";
+   }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( ParticleAssetFieldTests, TamlReadBakesLookupTable )
+{
+   TamlCustomNodes customNodes;
+
+   // Keys as child nodes.
+   TamlCustomNode* pKeyNodesField = customNodes.addNode( "KeyNodesField" );
+   const F32 keys[] = { 0.0f, 2.0f, 0.3f, 9.0f, 0.71f, 1.5f, 1.0f, 4.0f };
+   for ( U32 index = 0; index < 8; index += 2 )
+   {
+      TamlCustomNode* pKeyNode = pKeyNodesField->addNode( "Key" );
+      pKeyNode->addField( "Time", keys[index] );
+      pKeyNode->addField( "Value", keys[index+1] );
+   }
+
+   ParticleAssetField keyNodesField;
+   keyNodesField.initialize( 1.0f, 0.0f, 10.0f, 1.0f );
+   keyNodesField.onTamlCustomRead( pKeyNodesField );
+   checkLoadedTestField( keyNodesField );
+
+   // Keys as a single field.
+   TamlCustomNode* pKeysField = customNodes.addNode( "KeysField" );
+   pKeysField->addField( "Keys", "0 2 0.3 9 0.71 1.5 1 4" );
+
+   ParticleAssetField keysField;
+   keysField.initialize( 1.0f, 0.0f, 10.0f, 1.0f );
+   keysField.onTamlCustomRead( pKeysField );
+   checkLoadedTestField( keysField );
+}
+
+#endif // TORQUE_SHIPPING
@@ -0,0 +1,43 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _RANDOM_TEST_AABB_H_
+#define _RANDOM_TEST_AABB_H_
+
+#ifndef _MRANDOM_H_
+#include "math/mRandom.h"
+#endif
+
+#include "box2d/Box2D.h"
+
+//-----------------------------------------------------------------------------
+
+// Random area within the extent that is up to the size across.
+inline b2AABB getRandomTestAABB( RandomLCG& random, const F32 extent, const F32 size )
+{
+   b2AABB aabb;
+   aabb.lowerBound.Set( random.randRangeF( 0.0f, extent ), random.randRangeF( 0.0f, extent ) );
+   aabb.upperBound = aabb.lowerBound + b2Vec2( random.randRangeF( 0.0f, size ), random.randRangeF( 0.0f, size ) );
+   return aabb;
+}
+
+#endif // _RANDOM_TEST_AABB_H_
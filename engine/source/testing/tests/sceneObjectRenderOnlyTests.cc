@@ -0,0 +1,137 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _SCENE_H_
+#include "2d/scene/Scene.h"
+#endif
+
+#ifndef _SCENE_OBJECT_H_
+#include "2d/sceneobject/SceneObject.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+// A registered scene and a render-only object placed in it.
+class RenderOnlyTestScene
+{
+public:
+   Scene* mpScene;
+   SceneObject* mpSceneObject;
+
+   RenderOnlyTestScene()
+   {
+      mpScene = new Scene();
+      mpScene->registerObject();
+
+      mpSceneObject = new SceneObject();
+      mpSceneObject->registerObject();
+      mpSceneObject->setRenderOnly( true );
+      mpSceneObject->setPosition( Vector2( 3.0f, 4.0f ) );
+      mpSceneObject->setAngle( 0.5f );
+      mpScene->addToScene( mpSceneObject );
+   }
+
+   ~RenderOnlyTestScene()
+   {
+      mpSceneObject->deleteObject();
+      mpScene->deleteObject();
+   }
+};
+
+//-----------------------------------------------------------------------------
+
+TEST( SceneObjectRenderOnlyTests, RenderOnlyHasNoBody )
+{
+   RenderOnlyTestScene testScene;
+   SceneObject* pSceneObject = testScene.mpSceneObject;
+
+   ASSERT_EQ( testScene.mpScene, pSceneObject->getScene() );
+   ASSERT_TRUE( pSceneObject->getRenderOnly() );
+   ASSERT_TRUE( pSceneObject->getBody() == NULL );
+
+   // The transform is kept without a body.
+   ASSERT_FLOAT_EQ( 3.0f, pSceneObject->getPosition().x );
+   ASSERT_FLOAT_EQ( 4.0f, pSceneObject->getPosition().y );
+   ASSERT_FLOAT_EQ( 0.5f, pSceneObject->getAngle() );
+
+   pSceneObject->setPosition( Vector2( -1.0f, 2.0f ) );
+   ASSERT_TRUE( pSceneObject->getBody() == NULL );
+   ASSERT_FLOAT_EQ( -1.0f, pSceneObject->getPosition().x );
+   ASSERT_FLOAT_EQ( 2.0f, pSceneObject->getPosition().y );
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( SceneObjectRenderOnlyTests, CollisionShapePromotesToBody )
+{
+   RenderOnlyTestScene testScene;
+   SceneObject* pSceneObject = testScene.mpSceneObject;
+
+   ASSERT_EQ( 0, pSceneObject->createPolygonBoxCollisionShape( 1.0f, 1.0f ) );
+
+   ASSERT_FALSE( pSceneObject->getRenderOnly() );
+   ASSERT_TRUE( pSceneObject->getBody() != NULL );
+   ASSERT_EQ( 1u, pSceneObject->getCollisionShapeCount() );
+
+   // The body starts where the render-only object was.
+   ASSERT_FLOAT_EQ( 3.0f, pSceneObject->getBody()->GetPosition().x );
+   ASSERT_FLOAT_EQ( 4.0f, pSceneObject->getBody()->GetPosition().y );
+   ASSERT_FLOAT_EQ( 0.5f, pSceneObject->getBody()->GetAngle() );
+
+   // Objects with collision shapes cannot become render-only again.
+   pSceneObject->setRenderOnly( true );
+   ASSERT_FALSE( pSceneObject->getRenderOnly() );
+   ASSERT_TRUE( pSceneObject->getBody() != NULL );
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( SceneObjectRenderOnlyTests, DynamicBodyTypePromotesToBody )
+{
+   RenderOnlyTestScene testScene;
+   SceneObject* pSceneObject = testScene.mpSceneObject;
+
+   pSceneObject->setBodyType( b2_dynamicBody );
+
+   ASSERT_FALSE( pSceneObject->getRenderOnly() );
+   ASSERT_TRUE( pSceneObject->getBody() != NULL );
+   ASSERT_EQ( b2_dynamicBody, pSceneObject->getBody()->GetType() );
+   ASSERT_FLOAT_EQ( 3.0f, pSceneObject->getBody()->GetPosition().x );
+   ASSERT_FLOAT_EQ( 4.0f, pSceneObject->getBody()->GetPosition().y );
+
+   // Without shapes or joints the body can be dropped again.
+   pSceneObject->setRenderOnly( true );
+   ASSERT_TRUE( pSceneObject->getRenderOnly() );
+   ASSERT_TRUE( pSceneObject->getBody() == NULL );
+   ASSERT_EQ( b2_staticBody, pSceneObject->getBodyType() );
+   ASSERT_FLOAT_EQ( 3.0f, pSceneObject->getPosition().x );
+   ASSERT_FLOAT_EQ( 4.0f, pSceneObject->getPosition().y );
+}
+
+#endif // TORQUE_SHIPPING
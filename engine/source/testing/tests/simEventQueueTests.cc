@@ -0,0 +1,196 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _SIM_EVENT_QUEUE_H_
+#include "sim/simEventQueue.h"
+#endif
+
+#include <thread>
+
+//-----------------------------------------------------------------------------
+
+// An event that does nothing when processed.
+class TestSimEvent : public SimEvent
+{
+public:
+   TestSimEvent( const SimTime eventTime, const U32 eventSequence, SimObject* pObject = NULL )
+   {
+      time = eventTime;
+      sequenceCount = eventSequence;
+      destObject = pObject;
+   }
+
+   virtual void process( SimObject* object ) {}
+};
+
+//-----------------------------------------------------------------------------
+
+TEST( SimEventQueueTests, DispatchInTimeOrder )
+{
+   SimEventQueue eventQueue;
+   const SimTime times[] = { 50, 10, 40, 20, 30, 0, 60 };
+   for ( U32 index = 0; index < 7; ++index )
+      eventQueue.insert( new TestSimEvent( times[index], index + 1 ) );
+
+   ASSERT_EQ( 7u, eventQueue.size() );
+
+   SimTime lastTime = 0;
+   while ( !eventQueue.isEmpty() )
+   {
+      SimEvent* pEvent = eventQueue.pop();
+      ASSERT_LE( lastTime, pEvent->time ) << "Events were dispatched out of time order.";
+      lastTime = pEvent->time;
+      delete pEvent;
+   }
+
+   ASSERT_EQ( 60u, lastTime );
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( SimEventQueueTests, SameTimeIsFirstInFirstOut )
+{
+   SimEventQueue eventQueue;
+   for ( U32 index = 0; index < 100; ++index )
+      eventQueue.insert( new TestSimEvent( index % 3, index + 1 ) );
+
+   // Events with the same time must come out in the order they were posted.
+   U32 lastSequence[3] = { 0, 0, 0 };
+   while ( !eventQueue.isEmpty() )
+   {
+      SimEvent* pEvent = eventQueue.pop();
+      ASSERT_LT( lastSequence[pEvent->time], pEvent->sequenceCount ) << "Events with the same time were reordered.";
+      lastSequence[pEvent->time] = pEvent->sequenceCount;
+      delete pEvent;
+   }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( SimEventQueueTests, FindAndRemove )
+{
+   SimEventQueue eventQueue;
+   for ( U32 index = 0; index < 20; ++index )
+      eventQueue.insert( new TestSimEvent( 20 - index, index + 1 ) );
+
+   SimEvent* pEvent = eventQueue.find( 5 );
+   ASSERT_TRUE( pEvent != NULL );
+   ASSERT_EQ( 16u, pEvent->time );
+
+   eventQueue.remove( pEvent );
+   delete pEvent;
+
+   ASSERT_TRUE( eventQueue.find( 5 ) == NULL ) << "Removed event is still pending.";
+   ASSERT_EQ( 19u, eventQueue.size() );
+
+   // The remaining events are still in order.
+   SimTime lastTime = 0;
+   while ( !eventQueue.isEmpty() )
+   {
+      pEvent = eventQueue.pop();
+      ASSERT_NE( 16u, pEvent->time );
+      ASSERT_LE( lastTime, pEvent->time );
+      lastTime = pEvent->time;
+      delete pEvent;
+   }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( SimEventQueueTests, DeleteObjectEvents )
+{
+   SimEventQueue eventQueue;
+   SimObject* pObjectA = (SimObject*)0x10;
+   SimObject* pObjectB = (SimObject*)0x20;
+   for ( U32 index = 0; index < 30; ++index )
+      eventQueue.insert( new TestSimEvent( (index * 7) % 11, index + 1, index % 2 ? pObjectA : pObjectB ) );
+
+   eventQueue.deleteObjectEvents( pObjectA );
+
+   ASSERT_EQ( 15u, eventQueue.size() );
+   ASSERT_TRUE( eventQueue.find( 2 ) == NULL ) << "Deleted event is still pending.";
+   ASSERT_TRUE( eventQueue.find( 1 ) != NULL );
+
+   SimTime lastTime = 0;
+   while ( !eventQueue.isEmpty() )
+   {
+      SimEvent* pEvent = eventQueue.pop();
+      ASSERT_EQ( pObjectB, pEvent->destObject );
+      ASSERT_LE( lastTime, pEvent->time );
+      lastTime = pEvent->time;
+      delete pEvent;
+   }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( SimEventQueueTests, PostedEventsKeepPostOrder )
+{
+   SimEventQueue eventQueue;
+   const U32 threadCount = 4;
+   const U32 eventsPerThread = 1000;
+
+   // Each thread posts its own range of sequence counts.
+   std::thread* threads[threadCount];
+   for ( U32 threadIndex = 0; threadIndex < threadCount; ++threadIndex )
+   {
+      threads[threadIndex] = new std::thread( [&eventQueue, threadIndex, eventsPerThread]()
+      {
+         for ( U32 index = 0; index < eventsPerThread; ++index )
+            eventQueue.post( new TestSimEvent( index % 2, threadIndex * eventsPerThread + index + 1 ) );
+      } );
+   }
+
+   for ( U32 threadIndex = 0; threadIndex < threadCount; ++threadIndex )
+   {
+      threads[threadIndex]->join();
+      delete threads[threadIndex];
+   }
+
+   // Posted events aren't in the queue until they are inserted.  Anything in the past is moved up to the current time.
+   ASSERT_TRUE( eventQueue.isEmpty() );
+   eventQueue.insertPosted( 1 );
+   ASSERT_EQ( threadCount * eventsPerThread, eventQueue.size() );
+
+   // Every thread's events come out in the order that thread posted them.
+   U32 lastSequence[threadCount] = { 0, 0, 0, 0 };
+   while ( !eventQueue.isEmpty() )
+   {
+      SimEvent* pEvent = eventQueue.pop();
+      ASSERT_EQ( 1u, pEvent->time ) << "Posted event was not moved up to the current time.";
+
+      const U32 threadIndex = (pEvent->sequenceCount - 1) / eventsPerThread;
+      ASSERT_LT( lastSequence[threadIndex], pEvent->sequenceCount ) << "Posted events were reordered.";
+      lastSequence[threadIndex] = pEvent->sequenceCount;
+      delete pEvent;
+   }
+}
+
+#endif // TORQUE_SHIPPING
@@ -0,0 +1,102 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _STRINGSTACK_H_
+#include "string/stringStack.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+static void pushTestArguments( StringStack& stack )
+{
+   stack.pushFrame();
+   stack.setStringValue( "abc" );
+   stack.push();
+   stack.pushInt( -5 );
+   stack.pushFloat( 0.25 );
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( StringStackTests, ArgValuesKeepNumbersUnformatted )
+{
+   StringStack* pStack = new StringStack();
+   pushTestArguments( *pStack );
+
+   U32 argc;
+   ConsoleValue* pArgv;
+   pStack->getArgValues( "test", &argc, &pArgv );
+
+   ASSERT_EQ( (U32)4, argc );
+   ASSERT_EQ( ConsoleValue::TypeString, pArgv[1].getType() );
+   ASSERT_EQ( ConsoleValue::TypeInt, pArgv[2].getType() );
+   ASSERT_EQ( ConsoleValue::TypeFloat, pArgv[3].getType() );
+   ASSERT_EQ( -5, pArgv[2].getIntValue() );
+   ASSERT_EQ( 0.25, pArgv[3].getFloatValue() );
+
+   ASSERT_STREQ( "abc", pArgv[1].getStringValue() );
+   ASSERT_STREQ( "-5", pArgv[2].getStringValue() );
+   ASSERT_STREQ( "0.25", pArgv[3].getStringValue() );
+
+   delete pStack;
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( StringStackTests, ArgvFormatsNumbers )
+{
+   StringStack* pStack = new StringStack();
+   pushTestArguments( *pStack );
+
+   U32 argc;
+   const char** pArgv;
+   pStack->getArgcArgv( "test", &argc, &pArgv, true );
+
+   ASSERT_EQ( (U32)4, argc );
+   ASSERT_STREQ( "test", pArgv[0] );
+   ASSERT_STREQ( "abc", pArgv[1] );
+   ASSERT_STREQ( "-5", pArgv[2] );
+   ASSERT_STREQ( "0.25", pArgv[3] );
+
+   delete pStack;
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( StringStackTests, ConsoleValueConversions )
+{
+   ASSERT_EQ( 1, ConsoleValue::fromFloat( 1.75 ).getIntValue() );
+   ASSERT_EQ( 3.0, ConsoleValue::fromInt( 3 ).getFloatValue() );
+   ASSERT_EQ( 2.5, ConsoleValue::fromString( "2.5" ).getFloatValue() );
+   ASSERT_TRUE( ConsoleValue::fromInt( 2 ).getBoolValue() );
+   ASSERT_FALSE( ConsoleValue::fromFloat( 0.0 ).getBoolValue() );
+   ASSERT_STREQ( "text", ConsoleValue::fromString( "text" ).getStringValue() );
+}
+
+#endif // TORQUE_SHIPPING
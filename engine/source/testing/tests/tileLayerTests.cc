@@ -0,0 +1,149 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _TILE_LAYER_H_
+#include "2d/sceneobject/TileLayer.h"
+#endif
+
+#ifndef _TMXMAP_SPRITE_H
+#include "2d/sceneobject/TmxMapSprite.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+// An isometric map whose tiles are not 2:1 along with a tile layer lined up with it as the map sprite does.
+class IsometricTestMap
+{
+public:
+   static const U32 Width = 6;
+   static const U32 Height = 5;
+
+   TmxMapSprite* mpMapSprite;
+   TileLayer* mpTileLayer;
+   Vector2 mTileSize;
+   Vector2 mOrigin;
+
+   IsometricTestMap() :
+      mTileSize( 64.0f, 48.0f ),
+      mOrigin( 0.0f, (Height * 48.0f) / 2 - 48.0f * 0.5f )
+   {
+      mpMapSprite = new TmxMapSprite();
+
+      mpTileLayer = new TileLayer();
+      mpTileLayer->setIsometric( true );
+      mpTileLayer->setCellSize( mTileSize );
+      mpTileLayer->setGridSize( Width, Height );
+
+      Vector2 firstTile( 0.0f, (F32)Height );
+      mpTileLayer->setGridOffset( getTileCoord( firstTile ) - mpTileLayer->getCellLocalPosition( 0, 0 ) );
+   }
+
+   ~IsometricTestMap()
+   {
+      delete mpTileLayer;
+      delete mpMapSprite;
+   }
+
+   Vector2 getTileCoord( Vector2& tile )
+   {
+      return mpMapSprite->TileToCoord( tile, mTileSize, mOrigin, true );
+   }
+};
+
+//-----------------------------------------------------------------------------
+
+TEST( TileLayerTests, IsometricCellsStepHalfATile )
+{
+   IsometricTestMap testMap;
+   TileLayer* pTileLayer = testMap.mpTileLayer;
+
+   const Vector2 origin = pTileLayer->getCellLocalPosition( 2, 2 );
+   const Vector2 stepX = pTileLayer->getCellLocalPosition( 3, 2 ) - origin;
+   const Vector2 stepY = pTileLayer->getCellLocalPosition( 2, 3 ) - origin;
+
+   ASSERT_FLOAT_EQ( 32.0f, stepX.x );
+   ASSERT_FLOAT_EQ( -24.0f, stepX.y );
+   ASSERT_FLOAT_EQ( 32.0f, stepY.x );
+   ASSERT_FLOAT_EQ( 24.0f, stepY.y );
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( TileLayerTests, IsometricCellsMatchMapTiles )
+{
+   IsometricTestMap testMap;
+   TileLayer* pTileLayer = testMap.mpTileLayer;
+
+   // Every cell sits where the map places the tile, so objects and collision line up with the tiles.
+   for ( U32 y = 0; y < IsometricTestMap::Height; ++y )
+   {
+      for ( U32 x = 0; x < IsometricTestMap::Width; ++x )
+      {
+         Vector2 tile( (F32)x, (F32)(IsometricTestMap::Height - y) );
+         const Vector2 coord = testMap.getTileCoord( tile );
+         const Vector2 cellPosition = pTileLayer->getCellLocalPosition( x, y );
+
+         ASSERT_NEAR( coord.x, cellPosition.x, 0.001f );
+         ASSERT_NEAR( coord.y, cellPosition.y, 0.001f );
+
+         // The chunk streaming inverts the placement.
+         const Vector2 inverse = testMap.mpMapSprite->CoordToTilePosition( coord, testMap.mTileSize, testMap.mOrigin, true );
+         ASSERT_NEAR( tile.x, inverse.x, 0.001f );
+         ASSERT_NEAR( tile.y, inverse.y, 0.001f );
+      }
+   }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( TileLayerTests, IsometricCellRangeFindsCell )
+{
+   IsometricTestMap testMap;
+   TileLayer* pTileLayer = testMap.mpTileLayer;
+
+   // A small area around a cell finds that cell in the visible range.
+   const Vector2 cellPosition = pTileLayer->getCellLocalPosition( 4, 1 );
+   b2AABB localAABB;
+   localAABB.lowerBound = cellPosition - Vector2( 1.0f, 1.0f );
+   localAABB.upperBound = cellPosition + Vector2( 1.0f, 1.0f );
+
+   S32 minX, minY, maxX, maxY;
+   ASSERT_TRUE( pTileLayer->getCellRange( localAABB, minX, minY, maxX, maxY ) );
+   ASSERT_LE( minX, 4 );
+   ASSERT_GE( maxX, 4 );
+   ASSERT_LE( minY, 1 );
+   ASSERT_GE( maxY, 1 );
+
+   // The range is only padded by a cell either side.
+   ASSERT_GE( minX, 2 );
+   ASSERT_LE( maxX, 6 );
+}
+
+#endif // TORQUE_SHIPPING
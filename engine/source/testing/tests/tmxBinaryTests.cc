@@ -0,0 +1,124 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _PLATFORM_H_
+#include "platform/platform.h"
+#endif
+
+#include <Tmx.h>
+
+//-----------------------------------------------------------------------------
+
+// Writes a binary map holding a single layer with the given size and tile count.
+static std::string writeTestBinaryMap( const S32 width, const S32 height, const S32 tileCount )
+{
+   Tmx::BinaryWriter writer;
+
+   // Map attributes.
+   writer.WriteDouble( 1.0 );
+   writer.WriteInt( Tmx::TMX_MO_ORTHOGONAL );
+   writer.WriteInt( width );
+   writer.WriteInt( height );
+   writer.WriteInt( 32 );
+   writer.WriteInt( 32 );
+   writer.WriteInt( 0 );
+
+   // No tilesets.
+   writer.WriteInt( 0 );
+
+   // The layer.
+   writer.WriteInt( 1 );
+   writer.WriteString( "layer" );
+   writer.WriteInt( width );
+   writer.WriteInt( height );
+   writer.WriteFloat( 1.0f );
+   writer.WriteBool( true );
+   writer.WriteInt( 0 );
+   writer.WriteInt( Tmx::TMX_ENCODING_CSV );
+   writer.WriteInt( Tmx::TMX_COMPRESSION_NONE );
+   writer.WriteInt( 0 );
+   for ( S32 index = 0; index < tileCount; ++index )
+   {
+      Tmx::MapTile tile;
+      writer.WriteBytes( &tile, sizeof(tile) );
+   }
+
+   // No image layers or object groups.
+   writer.WriteInt( 0 );
+   writer.WriteInt( 0 );
+
+   return writer.GetBuffer();
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( TmxBinaryTests, ReadsLayer )
+{
+   const std::string buffer = writeTestBinaryMap( 4, 3, 12 );
+
+   Tmx::Map map;
+   map.ParseBinary( "test.tmx", buffer.data(), buffer.size() );
+
+   ASSERT_FALSE( map.HasError() );
+   ASSERT_EQ( 1, map.GetNumLayers() );
+   ASSERT_EQ( 4, map.GetLayer(0)->GetWidth() );
+   ASSERT_EQ( 3, map.GetLayer(0)->GetHeight() );
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( TmxBinaryTests, RejectsTruncatedLayer )
+{
+   // The layer claims more tiles than the buffer holds.
+   const std::string buffer = writeTestBinaryMap( 4, 3, 6 );
+
+   Tmx::Map map;
+   map.ParseBinary( "test.tmx", buffer.data(), buffer.size() );
+
+   ASSERT_TRUE( map.HasError() );
+   ASSERT_EQ( 0, map.GetLayer(0)->GetWidth() );
+   ASSERT_EQ( 0, map.GetLayer(0)->GetHeight() );
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( TmxBinaryTests, RejectsOversizedLayer )
+{
+   // The tile count would overflow an int were it not checked before allocating.
+   const std::string buffer = writeTestBinaryMap( 0x10000, 0x10000, 0 );
+
+   Tmx::Map map;
+   map.ParseBinary( "test.tmx", buffer.data(), buffer.size() );
+
+   ASSERT_TRUE( map.HasError() );
+   ASSERT_EQ( 0, map.GetLayer(0)->GetWidth() );
+}
+
+#endif // TORQUE_SHIPPING
@@ -0,0 +1,158 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _SCENE_H_
+#include "2d/scene/Scene.h"
+#endif
+
+#ifndef _SCENE_OBJECT_H_
+#include "2d/sceneobject/SceneObject.h"
+#endif
+
+#ifndef _WORLD_QUERY_H_
+#include "2d/scene/WorldQuery.h"
+#endif
+
+#ifndef _RANDOM_TEST_AABB_H_
+#include "testing/tests/randomTestAABB.h"
+#endif
+
+#include <algorithm>
+#include <vector>
+
+//-----------------------------------------------------------------------------
+
+// Sorted scene objects of a set of query results.
+static std::vector<SceneObject*> getSortedObjects( const WorldQueryResult* pResults, const U32 count )
+{
+   std::vector<SceneObject*> objects;
+   for ( U32 index = 0; index < count; ++index )
+      objects.push_back( pResults[index].mpSceneObject );
+   std::sort( objects.begin(), objects.end() );
+   return objects;
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( WorldQueryBatchTests, OOBBBatchMatchesSingleQueries )
+{
+   Scene* pScene = new Scene();
+   pScene->registerObject();
+
+   // A grid of objects with every other one turned onto a diamond.
+   const U32 gridSize = 10;
+   std::vector<SceneObject*> gridObjects;
+   for ( U32 y = 0; y < gridSize; ++y )
+   {
+      for ( U32 x = 0; x < gridSize; ++x )
+      {
+         SceneObject* pSceneObject = new SceneObject();
+         pSceneObject->registerObject();
+         pSceneObject->setSize( Vector2( 1.0f, 1.0f ) );
+         pSceneObject->setPosition( Vector2( x * 1.5f, y * 1.5f ) );
+         pSceneObject->setAngle( ((x + y) & 1) ? b2_pi * 0.25f : 0.0f );
+         pScene->addToScene( pSceneObject );
+         gridObjects.push_back( pSceneObject );
+      }
+   }
+
+   // One always-in-scope object inside the grid and one far away from every query.
+   SceneObject* pFarObject = new SceneObject();
+   pFarObject->registerObject();
+   pFarObject->setSize( Vector2( 1.0f, 1.0f ) );
+   pFarObject->setPosition( Vector2( 500.0f, 500.0f ) );
+   pScene->addToScene( pFarObject );
+
+   WorldQuery* pWorldQuery = pScene->getWorldQuery( true );
+   pWorldQuery->addAlwaysInScope( gridObjects[0] );
+   pWorldQuery->addAlwaysInScope( pFarObject );
+
+   // More areas than a single tree walk handles.
+   const U32 areaCount = 75;
+   ASSERT_GT( areaCount, (U32)(2 * b2_maxBatchQueries) );
+   b2AABB areas[areaCount];
+   RandomLCG random( 1 );
+   for ( U32 index = 0; index < areaCount; ++index )
+   {
+      areas[index] = getRandomTestAABB( random, 15.0f, 4.0f );
+      areas[index].lowerBound -= b2Vec2( 1.0f, 1.0f );
+   }
+
+   // An area inside the bounding box of a diamond but outside the diamond itself.
+   const U32 cornerArea = 40;
+   SceneObject* pDiamond = gridObjects[1];
+   areas[cornerArea].lowerBound = pDiamond->getPosition() + b2Vec2( 0.45f, 0.45f );
+   areas[cornerArea].upperBound = pDiamond->getPosition() + b2Vec2( 0.65f, 0.65f );
+
+   // Batch the areas on a context of their own.
+   WorldQueryContext batchContext( pWorldQuery );
+   batchContext.setQueryFilter( WorldQueryFilter() );
+   batchContext.oobbQueryAABBs( areas, areaCount );
+   ASSERT_EQ( areaCount, batchContext.getBatchQueryCount() );
+
+   // Another batch on another context must not disturb the first.
+   WorldQueryContext otherContext( pWorldQuery );
+   otherContext.setQueryFilter( WorldQueryFilter() );
+   otherContext.oobbQueryAABBs( areas + 10, 5 );
+   ASSERT_EQ( 5u, otherContext.getBatchQueryCount() );
+
+   // Compare each area with a single query on the world query itself.
+   pWorldQuery->setQueryFilter( WorldQueryFilter() );
+   for ( U32 index = 0; index < areaCount; ++index )
+   {
+      pWorldQuery->clearQuery();
+      pWorldQuery->oobbQueryAABB( areas[index] );
+      const typeWorldQueryResultVector& singleResults = pWorldQuery->getQueryResults();
+
+      const std::vector<SceneObject*> expected = getSortedObjects( singleResults.address(), singleResults.size() );
+      const std::vector<SceneObject*> actual = getSortedObjects( batchContext.getBatchQueryResults( index ), batchContext.getBatchQueryResultsCount( index ) );
+      ASSERT_EQ( expected, actual ) << "Batched area " << index << " differs from the single query.";
+
+      // Always-in-scope objects are reported once, even when the area overlaps them.
+      ASSERT_EQ( 1, std::count( actual.begin(), actual.end(), gridObjects[0] ) ) << "Batched area " << index << ".";
+      ASSERT_EQ( 1, std::count( actual.begin(), actual.end(), pFarObject ) ) << "Batched area " << index << ".";
+      ASSERT_TRUE( std::adjacent_find( actual.begin(), actual.end() ) == actual.end() ) << "Batched area " << index << " has duplicates.";
+
+      if ( index >= 10 && index < 15 )
+      {
+         const std::vector<SceneObject*> other = getSortedObjects( otherContext.getBatchQueryResults( index - 10 ), otherContext.getBatchQueryResultsCount( index - 10 ) );
+         ASSERT_EQ( expected, other ) << "Other batched area " << index << " differs from the single query.";
+      }
+   }
+
+   // The corner area only overlaps the diamond's bounding box.
+   const std::vector<SceneObject*> cornerObjects = getSortedObjects( batchContext.getBatchQueryResults( cornerArea ), batchContext.getBatchQueryResultsCount( cornerArea ) );
+   ASSERT_EQ( 0, std::count( cornerObjects.begin(), cornerObjects.end(), pDiamond ) );
+
+   pWorldQuery->removeAlwaysInScope( gridObjects[0] );
+   pWorldQuery->removeAlwaysInScope( pFarObject );
+   pScene->deleteObject();
+}
+
+#endif // TORQUE_SHIPPING
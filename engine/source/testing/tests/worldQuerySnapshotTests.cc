@@ -0,0 +1,128 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _WORLD_QUERY_SNAPSHOT_H_
+#include "2d/scene/WorldQuerySnapshot.h"
+#endif
+
+#ifndef _RANDOM_TEST_AABB_H_
+#include "testing/tests/randomTestAABB.h"
+#endif
+
+#include <algorithm>
+#include <vector>
+
+//-----------------------------------------------------------------------------
+
+// Collects proxies from the tree.
+class TestSnapshotTreeCallback
+{
+public:
+   std::vector<S32> mProxies;
+
+   bool QueryCallback( S32 proxyId )
+   {
+      mProxies.push_back( proxyId );
+      return true;
+   }
+};
+
+//-----------------------------------------------------------------------------
+
+// Checks the snapshot finds exactly what the tree finds.
+static void checkSnapshotMatchesTree( const b2DynamicTree& tree, const WorldQuerySnapshot& snapshot, RandomLCG& random )
+{
+   for ( U32 n = 0; n < 50; ++n )
+   {
+      const b2AABB aabb = getRandomTestAABB( random, 500.0f, 60.0f );
+
+      TestSnapshotTreeCallback callback;
+      tree.Query( &callback, aabb );
+
+      Vector<S32> snapshotProxies;
+      snapshot.query( aabb, snapshotProxies );
+      std::vector<S32> proxies( snapshotProxies.begin(), snapshotProxies.end() );
+
+      std::sort( callback.mProxies.begin(), callback.mProxies.end() );
+      std::sort( proxies.begin(), proxies.end() );
+      ASSERT_TRUE( callback.mProxies == proxies );
+   }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( WorldQuerySnapshotTests, MatchesTreeQuery )
+{
+   RandomLCG random( 1 );
+   b2DynamicTree tree;
+   WorldQuerySnapshot snapshot( &tree );
+
+   // Populate.
+   std::vector<S32> proxies;
+   for ( U32 n = 0; n < 3000; ++n )
+   {
+      const S32 proxyId = tree.CreateProxy( getRandomTestAABB( random, 500.0f, 5.0f ), NULL );
+      snapshot.addProxy( proxyId );
+      proxies.push_back( proxyId );
+   }
+
+   // Everything starts in the overflow.
+   ASSERT_EQ( 3000u, snapshot.getOverflowCount() );
+   checkSnapshotMatchesTree( tree, snapshot, random );
+
+   // Build.
+   ASSERT_TRUE( snapshot.update() );
+   ASSERT_TRUE( snapshot.getActive() );
+   ASSERT_EQ( 3000u, snapshot.getLeafCount() );
+   ASSERT_EQ( 0u, snapshot.getOverflowCount() );
+   checkSnapshotMatchesTree( tree, snapshot, random );
+
+   // Move some proxies far enough to leave their fat AABBs and remove others.
+   for ( U32 n = 0; n < 400; ++n )
+   {
+      const S32 proxyId = proxies[n];
+      if ( tree.MoveProxy( proxyId, getRandomTestAABB( random, 500.0f, 5.0f ), b2Vec2( 1.0f, 0.0f ) ) )
+         snapshot.moveProxy( proxyId );
+   }
+   for ( U32 n = 400; n < 500; ++n )
+   {
+      snapshot.removeProxy( proxies[n] );
+      tree.DestroyProxy( proxies[n] );
+   }
+   checkSnapshotMatchesTree( tree, snapshot, random );
+
+   // Moving proxies stay in the overflow through a rebuild.
+   ASSERT_TRUE( snapshot.update() );
+   ASSERT_EQ( 2900u, snapshot.getLeafCount() + snapshot.getOverflowCount() );
+   ASSERT_TRUE( snapshot.getOverflowCount() > 0 );
+   checkSnapshotMatchesTree( tree, snapshot, random );
+}
+
+#endif // TORQUE_SHIPPING